@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/C_callback.hpp"
+#include "FastEngine/C_clock.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Benchmark of the CallbackHandler dispatch path.
+ *
+ * usage: example_callbackBenchmark_014 [callbackCount] [callCount]
+ *
+ * The thread-safe and the local handlers are compared with the previous implementation that locked a
+ * recursive mutex and erased the removed callbacks while iterating.
+ * Every global allocation is counted by replacing the global operator new.
+ */
+
+namespace
+{
+
+std::atomic<std::size_t> gAllocationCount{0};
+
+/**
+ * \brief The previous dispatch path of fge::CallbackHandler, kept as a reference
+ */
+template<class... Types>
+class LegacyCallbackHandler
+{
+public:
+    using CalleePtr = fge::CalleeUniquePtr<void, Types...>;
+
+    template<typename TLambda>
+    void addLambda(TLambda const& lambda)
+    {
+        std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
+        this->g_callees.push_back({CalleePtr{new fge::CallbackLambda<void, Types...>(lambda)}, false});
+    }
+
+    void call(Types... args)
+    {
+        std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
+
+        std::size_t eraseCount = 0;
+        for (std::size_t i = 0; i < this->g_callees.size(); ++i)
+        {
+            if (this->g_callees[i]._markedForDeletion)
+            {
+                ++eraseCount;
+                continue;
+            }
+
+            if (eraseCount > 0)
+            {
+                this->g_callees.erase(this->g_callees.begin() + i - eraseCount, this->g_callees.begin() + i);
+                i -= eraseCount;
+                eraseCount = 0;
+            }
+
+            this->g_callees[i]._f->call(std::forward<Types>(args)...);
+        }
+    }
+
+private:
+    struct CalleeData
+    {
+        CalleePtr _f;
+        bool _markedForDeletion;
+    };
+
+    std::vector<CalleeData> g_callees;
+    std::recursive_mutex g_mutex;
+};
+
+template<class THandler>
+void RunBench(std::string_view name, std::size_t callbackCount, std::size_t callCount)
+{
+    THandler handler;
+    uint64_t result = 0;
+
+    auto const allocationsBeforeAdd = gAllocationCount.load();
+    for (std::size_t i = 0; i < callbackCount; ++i)
+    {
+        handler.addLambda([&result, i](uint64_t value) { result += value ^ i; });
+    }
+    auto const addAllocations = gAllocationCount.load() - allocationsBeforeAdd;
+
+    auto const allocationsBeforeCall = gAllocationCount.load();
+    fge::Clock clock;
+
+    for (std::size_t i = 0; i < callCount; ++i)
+    {
+        handler.call(i);
+    }
+
+    auto const elapsedTime = clock.getElapsedTime<std::chrono::microseconds>();
+    auto const callAllocations = gAllocationCount.load() - allocationsBeforeCall;
+
+    std::cout << std::setw(16) << name << std::setw(12) << std::fixed << std::setprecision(2)
+              << static_cast<double>(elapsedTime) / 1000.0 << std::setw(16)
+              << static_cast<double>(elapsedTime) * 1000.0 / static_cast<double>(callCount) << std::setw(16)
+              << static_cast<double>(addAllocations) / static_cast<double>(callbackCount) << std::setw(16)
+              << callAllocations << std::setw(22) << result << std::endl;
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++gAllocationCount;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t callbackCount = 8;
+    std::size_t callCount = 2000000;
+
+    try
+    {
+        if (argc > 1)
+        {
+            callbackCount = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            callCount = std::stoul(argv[2]);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+
+    std::cout << "callback dispatch benchmark: " << callbackCount << " callbacks, " << callCount << " calls"
+              << std::endl
+              << std::endl;
+    std::cout << std::setw(16) << "handler" << std::setw(12) << "time ms" << std::setw(16) << "ns/call"
+              << std::setw(16) << "allocs/add" << std::setw(16) << "call allocs" << std::setw(22) << "checksum"
+              << std::endl;
+
+    RunBench<LegacyCallbackHandler<uint64_t>>("legacy", callbackCount, callCount);
+    RunBench<fge::CallbackHandler<uint64_t>>("thread-safe", callbackCount, callCount);
+    RunBench<fge::LocalCallbackHandler<uint64_t>>("local", callbackCount, callCount);
+    return 0;
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/C_clock.hpp"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/graphic/C_renderTexture.hpp"
+#include "FastEngine/manager/font_manager.hpp"
+#include "FastEngine/manager/shader_manager.hpp"
+#include "FastEngine/manager/texture_manager.hpp"
+#include "FastEngine/object/C_objText.hpp"
+#include "FastEngine/vulkan/vulkanGlobal.hpp"
+#include "SDL.h"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+/*
+ * Benchmark of the glyph rasterization time and texture memory, one bitmap page per character size
+ * versus one signed distance field page for every character size.
+ *
+ * usage: example_fontSdfBenchmark_018 [iterationCount]
+ *
+ * The Latin-1 charset is baked for every character size of the benchmark, the best time of every run
+ * is printed with the number of pages and their texture memory (the font keeps a CPU copy of the same size).
+ * Bitmap texts need another set of glyphs for their outline, distance field texts draw it in the shader.
+ * Both modes are then rendered with an outline (and a shadow for the SDF mode) in ./output.png.
+ */
+
+namespace
+{
+
+constexpr char const* gFontPath = "resources/fonts/SourceSansPro-Regular.ttf";
+constexpr std::array<fge::CharacterSize, 9> gCharacterSizes{12, 16, 20, 24, 32, 40, 48, 64, 96};
+constexpr float gOutlineThickness = 2.0f;
+
+struct Result
+{
+    double _time{0.0};
+    std::size_t _pageCount{0};
+    std::size_t _textureMemory{0};
+};
+
+Result RunBench(fge::FreeTypeFont::RenderModes mode, bool withOutline, std::size_t iterationCount)
+{
+    auto const charset = fge::MakeCodePointRange(0x20, 0x7E) + fge::MakeCodePointRange(0xA0, 0xFF);
+
+    Result result;
+    for (std::size_t i = 0; i < iterationCount; ++i)
+    {
+        fge::FreeTypeFont font;
+        if (!font.loadFromFile(gFontPath) || !font.setRenderMode(mode))
+        {
+            return result;
+        }
+
+        fge::Clock clock;
+        font.bakeGlyphs(charset, gCharacterSizes);
+        if (withOutline)
+        {
+            font.bakeGlyphs(charset, gCharacterSizes, false, gOutlineThickness);
+        }
+        auto const time = static_cast<double>(clock.getElapsedTime<std::chrono::microseconds>()) / 1000.0;
+        result._time = i == 0 ? time : std::min(result._time, time);
+
+        //Character sizes can share the same page
+        std::unordered_set<fge::vulkan::TextureImage const*> textures;
+        result._textureMemory = 0;
+        for (auto const characterSize: gCharacterSizes)
+        {
+            auto const& texture = font.getTexture(characterSize);
+            if (textures.insert(&texture).second)
+            {
+                auto const size = texture.getSize();
+                result._textureMemory += static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4;
+            }
+        }
+        result._pageCount = textures.size();
+    }
+    return result;
+}
+
+void PrintResult(std::string_view name, Result const& result)
+{
+    std::cout << std::setw(20) << name << std::setw(10) << result._pageCount << std::setw(16)
+              << result._textureMemory / 1024 << std::setw(14) << std::fixed << std::setprecision(3) << result._time
+              << std::endl;
+}
+
+} // namespace
+
+class MainScene : public fge::Scene
+{
+public:
+    void start(fge::RenderTexture& renderTexture)
+    {
+        fge::Event event;
+
+        this->setLinkedRenderTarget(&renderTexture);
+
+        fge::font::gManager.loadFromFile("bitmap", gFontPath);
+        fge::font::gManager.loadFromFile("sdf", gFontPath);
+        fge::font::gManager.getElement("sdf")->_ptr->setRenderMode(fge::FreeTypeFont::RenderModes::SDF);
+
+        //Every character size with the bitmap font first, then with the SDF font
+        fge::Vector2f position{10.0f, 10.0f};
+        for (std::string_view const font: {"bitmap", "sdf"})
+        {
+            for (auto const characterSize: gCharacterSizes)
+            {
+                auto const string = std::string{font} + " " + std::to_string(characterSize) + "px: Quartz vow";
+                auto* text = this->newObject<fge::ObjText>(string, std::string{font}, position, characterSize);
+                text->setFillColor(fge::Color::White);
+                text->setOutlineColor(fge::Color::Blue);
+                text->setOutlineThickness(gOutlineThickness);
+                text->setShadowColor(fge::Color{0, 0, 0, 160});
+                text->setShadowOffset({2.0f, 2.0f});
+
+                position.y += text->getLineSpacing();
+            }
+        }
+
+        fge::Clock tick;
+        this->update(renderTexture, event, std::chrono::duration_cast<std::chrono::milliseconds>(tick.restart()));
+
+        auto imageIndex = renderTexture.prepareNextFrame(nullptr, FGE_RENDER_TIMEOUT_BLOCKING);
+        if (imageIndex != FGE_RENDER_BAD_IMAGE_INDEX)
+        {
+            fge::vulkan::GetActiveContext()._garbageCollector.setCurrentFrame(renderTexture.getCurrentFrame());
+
+            renderTexture.beginRenderPass(imageIndex);
+
+            this->draw(renderTexture);
+
+            renderTexture.endRenderPass();
+
+            renderTexture.display(imageIndex);
+        }
+
+        fge::vulkan::GetActiveContext().waitIdle();
+
+        fge::vulkan::GetActiveContext()._garbageCollector.enable(false);
+
+        fge::Surface const surface{renderTexture.getTextureImage().copyToSurface()};
+        if (surface.saveToFile("output.png"))
+        {
+            std::cout << "rendered texts are saved to ./output.png" << std::endl;
+        }
+        else
+        {
+            std::cout << "error saving file" << std::endl;
+        }
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    using namespace fge::vulkan;
+
+    std::size_t iterationCount = 5;
+
+    try
+    {
+        if (argc > 1)
+        {
+            iterationCount = std::max<std::size_t>(std::stoul(argv[1]), 1);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+
+    auto instance = Context::init(SDL_INIT_VIDEO | SDL_INIT_EVENTS, "example 018: fontSdfBenchmark");
+    Context::enumerateExtensions();
+
+    Context vulkanContext;
+    vulkanContext.initVulkanSurfaceless(instance);
+    vulkanContext._garbageCollector.enable(true);
+
+    fge::shader::gManager.initialize();
+    fge::texture::gManager.initialize();
+    fge::font::gManager.initialize();
+
+    std::cout << "font page benchmark: Latin-1 charset, " << gCharacterSizes.size() << " character sizes, "
+              << iterationCount << " iterations" << std::endl
+              << std::endl;
+    std::cout << std::setw(20) << "mode" << std::setw(10) << "pages" << std::setw(16) << "texture KiB"
+              << std::setw(14) << "bake ms" << std::endl;
+
+    PrintResult("bitmap", RunBench(fge::FreeTypeFont::RenderModes::BITMAP, false, iterationCount));
+    PrintResult("bitmap + outline", RunBench(fge::FreeTypeFont::RenderModes::BITMAP, true, iterationCount));
+    PrintResult("sdf", RunBench(fge::FreeTypeFont::RenderModes::SDF, false, iterationCount));
+    std::cout << std::endl;
+
+    fge::RenderTexture renderTexture({1280, 960}, vulkanContext);
+    renderTexture.setClearColor(fge::Color{90, 90, 90});
+
+    std::unique_ptr<MainScene> scene = std::make_unique<MainScene>();
+    scene->start(renderTexture);
+    scene.reset();
+
+    fge::texture::gManager.uninitialize();
+    fge::font::gManager.uninitialize();
+    fge::shader::gManager.uninitialize();
+
+    renderTexture.destroy();
+
+    vulkanContext.destroy();
+
+    instance.destroy();
+    SDL_Quit();
+
+    return 0;
+}
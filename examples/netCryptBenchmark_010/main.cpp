@@ -0,0 +1,250 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/C_clock.hpp"
+#include "FastEngine/network/C_server.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Loopback benchmark of the server encrypted throughput.
+ *
+ * usage: example_netCryptBenchmark_010 [clientCount] [packetCountPerClient] [payloadSize] [cryptThreadCount...]
+ *
+ * For every crypt thread count, a server and some clients are started on the loopback interface,
+ * the server then send packets to every client as fast as possible. Compression is disabled in order
+ * to only measure the encryption cost.
+ */
+
+#define BENCH_SERVER_PORT 42049
+#define BENCH_PACKET_ID (FGE_NET_CUSTOM_ID_START + 1)
+#define BENCH_CONNECTION_TIMEOUT std::chrono::seconds(10)
+#define BENCH_RECEPTION_TIMEOUT std::chrono::seconds(2)
+
+namespace
+{
+
+struct BenchResult
+{
+    std::size_t _receivedPackets{0};
+    std::chrono::microseconds _elapsedTime{0};
+};
+
+bool RunBench(std::size_t cryptThreadCount,
+              std::size_t clientCount,
+              std::size_t packetCountPerClient,
+              std::size_t payloadSize,
+              BenchResult& result)
+{
+    fge::net::ServerSideNetUdp server(fge::net::IpAddress::Types::Ipv4);
+    server.setCryptThreadCount(cryptThreadCount);
+
+    auto const loopback = fge::net::IpAddress::Loopback(fge::net::IpAddress::Types::Ipv4);
+    if (!server.start(BENCH_SERVER_PORT, loopback))
+    {
+        std::cout << "can't start the server !" << std::endl;
+        return false;
+    }
+
+    auto* serverFlux = server.getDefaultFlux();
+    std::vector<fge::net::ClientSharedPtr> serverClients;
+    serverFlux->_onClientConnected.addLambda(
+            [&](fge::net::ClientSharedPtr const& client, [[maybe_unused]] fge::net::Identity const& id) {
+        //Send as fast as possible without compression
+        client->setSTOCLatency_ms(0);
+        fge::net::CompressionPolicyConfig config;
+        config._enabled = false;
+        client->_context._compressionPolicy.setConfig(config);
+        serverClients.push_back(client);
+    });
+
+    std::vector<std::unique_ptr<fge::net::ClientSideNetUdp>> clients;
+    std::vector<std::future<bool>> connectFutures;
+    for (std::size_t i = 0; i < clientCount; ++i)
+    {
+        auto& client = clients.emplace_back(std::make_unique<fge::net::ClientSideNetUdp>());
+        if (!client->start(FGE_ANYPORT, loopback, BENCH_SERVER_PORT, loopback))
+        {
+            std::cout << "can't start a client !" << std::endl;
+            return false;
+        }
+        connectFutures.push_back(client->connect());
+    }
+
+    auto processServer = [&]() {
+        fge::net::ClientSharedPtr client;
+        fge::net::ReceivedPacketPtr packet;
+        while (serverFlux->process(client, packet) != fge::net::FluxProcessResults::NONE_AVAILABLE)
+        {}
+    };
+
+    //Waiting for every client to be connected
+    fge::Clock connectionClock;
+    std::size_t connectedCount = 0;
+    while (connectedCount < clientCount)
+    {
+        processServer();
+
+        connectedCount = 0;
+        for (auto& future: connectFutures)
+        {
+            if (future.wait_for(std::chrono::milliseconds(1)) == std::future_status::ready)
+            {
+                ++connectedCount;
+            }
+        }
+
+        if (connectionClock.reached(BENCH_CONNECTION_TIMEOUT))
+        {
+            std::cout << "clients connection timeout !" << std::endl;
+            return false;
+        }
+    }
+    for (auto& future: connectFutures)
+    {
+        if (!future.get())
+        {
+            std::cout << "a client failed to connect !" << std::endl;
+            return false;
+        }
+    }
+    processServer();
+
+    //Sending packets
+    std::vector<uint8_t> const payload(payloadSize, 0xAB);
+    fge::Clock benchClock;
+    for (auto const& client: serverClients)
+    {
+        for (std::size_t i = 0; i < packetCountPerClient; ++i)
+        {
+            auto packet = fge::net::CreatePacket(BENCH_PACKET_ID);
+            packet->doNotReorder().doNotFragment().append(payload.data(), payload.size());
+            client->pushPacket(std::move(packet));
+        }
+    }
+
+    //Receiving packets
+    auto const expectedPackets = clientCount * packetCountPerClient;
+    fge::Clock lastReceptionClock;
+    auto lastReceptionTime = benchClock.getElapsedTime();
+    while (result._receivedPackets < expectedPackets && !lastReceptionClock.reached(BENCH_RECEPTION_TIMEOUT))
+    {
+        server.notifyTransmission();
+        processServer();
+
+        for (auto& client: clients)
+        {
+            fge::net::ReceivedPacketPtr packet;
+            fge::net::FluxProcessResults processResult;
+            do {
+                processResult = client->process(packet, fge::net::ClientSideNetUdp::OPTION_NO_TIMEOUT);
+                if (processResult == fge::net::FluxProcessResults::USER_RETRIEVABLE &&
+                    packet->retrieveHeaderId().value() == BENCH_PACKET_ID)
+                {
+                    ++result._receivedPackets;
+                    lastReceptionClock.restart();
+                    lastReceptionTime = benchClock.getElapsedTime();
+                }
+            } while (processResult != fge::net::FluxProcessResults::NONE_AVAILABLE);
+        }
+    }
+
+    result._elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(lastReceptionTime);
+
+    for (auto& client: clients)
+    {
+        client->stop();
+    }
+    server.stop();
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t clientCount = 4;
+    std::size_t packetCountPerClient = 5000;
+    std::size_t payloadSize = 1000;
+    std::vector<std::size_t> cryptThreadCounts;
+
+    try
+    {
+        if (argc > 1)
+        {
+            clientCount = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            packetCountPerClient = std::stoul(argv[2]);
+        }
+        if (argc > 3)
+        {
+            payloadSize = std::stoul(argv[3]);
+        }
+        for (int i = 4; i < argc; ++i)
+        {
+            cryptThreadCounts.push_back(std::stoul(argv[i]));
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+
+    if (cryptThreadCounts.empty())
+    {
+        cryptThreadCounts = {0, 1, 2, 4};
+    }
+
+    if (!fge::net::Socket::initSocket())
+    {
+        std::cout << "can't init socket system !" << std::endl;
+        return -1;
+    }
+
+    std::cout << "encrypted loopback benchmark: " << clientCount << " clients, " << packetCountPerClient
+              << " packets per client, payload of " << payloadSize << " bytes" << std::endl
+              << std::endl;
+
+    std::cout << std::setw(14) << "crypt threads" << std::setw(12) << "received" << std::setw(12) << "time ms"
+              << std::setw(14) << "packets/s" << std::setw(10) << "MB/s" << std::endl;
+
+    for (auto const cryptThreadCount: cryptThreadCounts)
+    {
+        BenchResult result;
+        if (!RunBench(cryptThreadCount, clientCount, packetCountPerClient, payloadSize, result))
+        {
+            return -1;
+        }
+
+        auto const seconds = static_cast<double>(result._elapsedTime.count()) / 1000000.0;
+        auto const packetsPerSecond = seconds > 0.0 ? static_cast<double>(result._receivedPackets) / seconds : 0.0;
+        auto const megaBytesPerSecond = packetsPerSecond * static_cast<double>(payloadSize) / (1024.0 * 1024.0);
+
+        std::cout << std::setw(14) << (cryptThreadCount == 0 ? std::string{"inline"} : std::to_string(cryptThreadCount))
+                  << std::setw(12) << result._receivedPackets << std::setw(12) << result._elapsedTime.count() / 1000
+                  << std::setw(14) << std::fixed << std::setprecision(0) << packetsPerSecond << std::setw(10)
+                  << std::setprecision(2) << megaBytesPerSecond << std::endl;
+    }
+
+    fge::net::Socket::uninitSocket();
+    return 0;
+}
@@ -0,0 +1,382 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/C_clock.hpp"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/extra/extra_function.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+#include "FastEngine/network/C_server.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Headless load test of a server Scene synchronised with snapshot deltas.
+ *
+ * usage: example_netLoadTest_013 [clientCount] [objectCount] [duration_s] [latency_ms] [jitter_ms] [loss_%]
+ *
+ * A server and some clients are started on the loopback interface, every tick the server move a part of its
+ * objects and send a snapshot delta to every client, the clients acknowledge the received snapshots.
+ * Once connected, the link conditioner of every side simulate the requested network conditions.
+ */
+
+#define LOADTEST_SERVER_PORT 42050
+#define LOADTEST_SNAPSHOT_ID (FGE_NET_CUSTOM_ID_START + 1)
+#define LOADTEST_ACK_ID (FGE_NET_CUSTOM_ID_START + 2)
+#define LOADTEST_TICK std::chrono::milliseconds(33)
+#define LOADTEST_MOVING_RATIO 4 ///< 1 object on LOADTEST_MOVING_RATIO is moving every tick
+#define LOADTEST_CONNECTION_TIMEOUT std::chrono::seconds(10)
+
+namespace
+{
+
+class Mover : public fge::Object
+{
+public:
+    Mover() { this->registerNetTypes(); }
+    Mover(Mover const& r) :
+            fge::Object(r),
+            _position(r._position),
+            _velocity(r._velocity),
+            _health(r._health)
+    {
+        this->registerNetTypes();
+    }
+    ~Mover() override = default;
+
+    FGE_OBJ_DEFAULT_COPYMETHOD(Mover)
+
+    char const* getClassName() const override { return "LOADTEST_MOVER"; }
+    char const* getReadableClassName() const override { return "mover"; }
+
+    fge::Vector2f _position{0.0f};
+    fge::Vector2f _velocity{0.0f};
+    uint32_t _health{100};
+
+private:
+    void registerNetTypes()
+    {
+        this->_netList.pushTrivial<fge::Vector2f>(&this->_position);
+        this->_netList.pushTrivial<uint32_t>(&this->_health);
+    }
+};
+
+struct SimulatedClient
+{
+    std::unique_ptr<fge::net::ClientSideNetUdp> _net{std::make_unique<fge::net::ClientSideNetUdp>()};
+    fge::Scene _scene;
+    std::chrono::microseconds _processTime{0};
+    std::size_t _appliedSnapshots{0};
+    std::size_t _ignoredSnapshots{0};
+};
+
+struct ServerClientStats
+{
+    std::size_t _resyncCount{0};
+    std::size_t _sentBytes{0};
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t clientCount = 16;
+    std::size_t objectCount = 500;
+    std::size_t duration_s = 10;
+    fge::net::LinkConditionerConfig linkConfig;
+    linkConfig._enabled = true;
+
+    try
+    {
+        if (argc > 1)
+        {
+            clientCount = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            objectCount = std::stoul(argv[2]);
+        }
+        if (argc > 3)
+        {
+            duration_s = std::stoul(argv[3]);
+        }
+        if (argc > 4)
+        {
+            linkConfig._latency = std::chrono::milliseconds{std::stoul(argv[4])};
+        }
+        if (argc > 5)
+        {
+            linkConfig._jitter = std::chrono::milliseconds{std::stoul(argv[5])};
+        }
+        if (argc > 6)
+        {
+            linkConfig._lossRate = std::stof(argv[6]) / 100.0f;
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+
+    if (!fge::net::Socket::initSocket())
+    {
+        std::cout << "can't init socket system !" << std::endl;
+        return -1;
+    }
+    fge::reg::RegisterNewClass<Mover>();
+
+    std::cout << "load test: " << clientCount << " clients, " << objectCount << " objects, " << duration_s
+              << " s, latency " << linkConfig._latency.count() << " ms, jitter " << linkConfig._jitter.count()
+              << " ms, loss " << linkConfig._lossRate * 100.0f << " %" << std::endl
+              << std::endl;
+
+    //Server
+    fge::net::ServerSideNetUdp server(fge::net::IpAddress::Types::Ipv4);
+    auto const loopback = fge::net::IpAddress::Loopback(fge::net::IpAddress::Types::Ipv4);
+    if (!server.start(LOADTEST_SERVER_PORT, loopback))
+    {
+        std::cout << "can't start the server !" << std::endl;
+        return -1;
+    }
+
+    auto* serverFlux = server.getDefaultFlux();
+    auto& serverClients = serverFlux->_clients;
+    serverClients.watchEvent(true);
+
+    std::unordered_map<fge::net::Identity, ServerClientStats, fge::net::IdentityHash> serverStats;
+    serverFlux->_onClientConnected.addLambda(
+            [&](fge::net::ClientSharedPtr const& client, fge::net::Identity const& id) {
+        client->setSTOCLatency_ms(0);
+        serverStats[id];
+    });
+
+    fge::Scene serverScene;
+    auto& random = fge::GetThreadRandom();
+    for (std::size_t i = 0; i < objectCount; ++i)
+    {
+        auto* mover = serverScene.newObject<Mover>();
+        mover->_position = random.rangeVec2(0.0f, 2000.0f, 0.0f, 2000.0f);
+        mover->_velocity = random.rangeVec2(-5.0f, 5.0f, -5.0f, 5.0f);
+    }
+
+    auto processServer = [&]() {
+        fge::net::ClientSharedPtr client;
+        fge::net::ReceivedPacketPtr packet;
+        fge::net::FluxProcessResults result;
+        while ((result = serverFlux->process(client, packet)) != fge::net::FluxProcessResults::NONE_AVAILABLE)
+        {
+            if (result == fge::net::FluxProcessResults::USER_RETRIEVABLE &&
+                packet->retrieveHeaderId().value() == LOADTEST_ACK_ID)
+            {
+                fge::Scene::NetSnapshotId snapshotId{0};
+                *packet >> snapshotId;
+                serverScene.acknowledgeNetSnapshot(packet->getIdentity(), snapshotId);
+            }
+        }
+    };
+
+    //Clients, connected one by one to not flood the connection handshakes
+    std::vector<std::unique_ptr<SimulatedClient>> clients;
+    for (std::size_t i = 0; i < clientCount; ++i)
+    {
+        auto& client = clients.emplace_back(std::make_unique<SimulatedClient>());
+        if (!client->_net->start(FGE_ANYPORT, loopback, LOADTEST_SERVER_PORT, loopback))
+        {
+            std::cout << "can't start a client !" << std::endl;
+            return -1;
+        }
+
+        auto future = client->_net->connect();
+        fge::Clock connectionClock;
+        while (future.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready)
+        {
+            processServer();
+
+            if (connectionClock.reached(LOADTEST_CONNECTION_TIMEOUT))
+            {
+                std::cout << "client connection timeout !" << std::endl;
+                return -1;
+            }
+        }
+        if (!future.get())
+        {
+            std::cout << "client " << i << " failed to connect !" << std::endl;
+            return -1;
+        }
+    }
+    processServer();
+
+    //The network conditions are only simulated after the connection
+    server.getLinkConditioner().setConfig(linkConfig);
+    for (auto& client: clients)
+    {
+        client->_net->getLinkConditioner().setConfig(linkConfig);
+    }
+
+    //Load test
+    std::chrono::microseconds totalTickTime{0};
+    std::chrono::microseconds maxTickTime{0};
+    std::size_t tickCount = 0;
+
+    fge::Clock testClock;
+    while (!testClock.reached(std::chrono::seconds(duration_s)))
+    {
+        fge::Clock tickClock;
+
+        //Server tick
+        processServer();
+
+        std::size_t moverIndex = 0;
+        for (auto const& data: serverScene)
+        {
+            if ((moverIndex++ + tickCount) % LOADTEST_MOVING_RATIO != 0)
+            {
+                continue;
+            }
+            auto* mover = static_cast<Mover*>(data->getObject());
+            mover->_position += mover->_velocity;
+            if (random.range(0, 100) == 0)
+            {
+                mover->_health = random.range<uint32_t>(0, 100);
+            }
+        }
+
+        serverScene.clientsCheckup(serverClients);
+        serverClients.clearClientEvent();
+        auto const snapshotId = serverScene.captureNetSnapshot();
+
+        {
+            auto clientsLock = serverClients.acquireLock();
+            for (auto it = serverClients.begin(clientsLock); it != serverClients.end(clientsLock); ++it)
+            {
+                auto& stats = serverStats[it->first];
+
+                //The acknowledged snapshot left the ring, the client receive a full state
+                auto const baseline = serverScene.getAcknowledgedNetSnapshot(it->first);
+                if (baseline != 0 && snapshotId - baseline >= FGE_SCENE_NET_SNAPSHOT_RING_SIZE)
+                {
+                    ++stats._resyncCount;
+                }
+
+                auto packet = fge::net::CreatePacket(LOADTEST_SNAPSHOT_ID);
+                packet->doNotReorder();
+                serverScene.packNetSnapshotDelta(packet->packet(), it->first);
+                stats._sentBytes += packet->packet().getDataSize();
+                it->second->pushPacket(std::move(packet));
+            }
+        }
+        server.notifyTransmission();
+
+        auto const tickTime = tickClock.getElapsedTime<std::chrono::microseconds>();
+        totalTickTime += std::chrono::microseconds{tickTime};
+        maxTickTime = std::max(maxTickTime, std::chrono::microseconds{tickTime});
+        ++tickCount;
+
+        //Clients
+        for (auto& client: clients)
+        {
+            fge::Clock processClock;
+
+            fge::net::ReceivedPacketPtr packet;
+            fge::net::FluxProcessResults result;
+            while ((result = client->_net->process(packet, fge::net::ClientSideNetUdp::OPTION_NO_TIMEOUT)) !=
+                   fge::net::FluxProcessResults::NONE_AVAILABLE)
+            {
+                if (result != fge::net::FluxProcessResults::USER_RETRIEVABLE ||
+                    packet->retrieveHeaderId().value() != LOADTEST_SNAPSHOT_ID)
+                {
+                    continue;
+                }
+
+                if (client->_scene.unpackNetSnapshotDelta(*packet))
+                {
+                    ++client->_ignoredSnapshots;
+                    continue;
+                }
+                ++client->_appliedSnapshots;
+
+                auto ack = fge::net::CreatePacket(LOADTEST_ACK_ID);
+                ack->doNotReorder() << client->_scene.getLastReceivedNetSnapshotId();
+                client->_net->_client.pushPacket(std::move(ack));
+                client->_net->notifyTransmission();
+            }
+
+            client->_processTime +=
+                    std::chrono::microseconds{processClock.getElapsedTime<std::chrono::microseconds>()};
+        }
+
+        auto const elapsed = tickClock.getElapsedTime<std::chrono::microseconds>();
+        if (std::chrono::microseconds{elapsed} < LOADTEST_TICK)
+        {
+            fge::Sleep(LOADTEST_TICK - std::chrono::microseconds{elapsed});
+        }
+    }
+    auto const testSeconds = static_cast<double>(testClock.getElapsedTime<std::chrono::microseconds>()) / 1000000.0;
+
+    //Report
+    std::size_t totalSentBytes = 0;
+    std::size_t totalResync = 0;
+    for (auto const& stats: serverStats)
+    {
+        totalSentBytes += stats.second._sentBytes;
+        totalResync += stats.second._resyncCount;
+    }
+    std::chrono::microseconds totalClientTime{0};
+    std::size_t totalApplied = 0;
+    std::size_t totalIgnored = 0;
+    for (auto const& client: clients)
+    {
+        totalClientTime += client->_processTime;
+        totalApplied += client->_appliedSnapshots;
+        totalIgnored += client->_ignoredSnapshots;
+    }
+    auto const serverLinkStats = server.getLinkConditioner().getStats();
+
+    auto const averageTick = tickCount > 0 ? static_cast<double>(totalTickTime.count()) / tickCount : 0.0;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "ticks:                   " << tickCount << std::endl;
+    std::cout << "server tick time:        " << averageTick / 1000.0 << " ms (max "
+              << static_cast<double>(maxTickTime.count()) / 1000.0 << " ms)" << std::endl;
+    std::cout << "server time per client:  " << averageTick / static_cast<double>(clientCount) << " us/tick"
+              << std::endl;
+    std::cout << "bytes per client:        "
+              << static_cast<double>(totalSentBytes) / static_cast<double>(clientCount) / testSeconds << " B/s"
+              << std::endl;
+    std::cout << "client CPU per client:   "
+              << static_cast<double>(totalClientTime.count()) / static_cast<double>(clientCount) / testSeconds
+              << " us/s" << std::endl;
+    std::cout << "applied snapshots:       " << totalApplied << " (" << totalIgnored << " old or invalid)"
+              << std::endl;
+    std::cout << "resyncs:                 " << totalResync << std::endl;
+    std::cout << "server link conditioner: " << serverLinkStats._lostCount << " lost, "
+              << serverLinkStats._reorderedCount << " reordered, " << serverLinkStats._duplicatedCount
+              << " duplicated" << std::endl;
+
+    for (auto& client: clients)
+    {
+        client->_net->stop();
+    }
+    server.stop();
+
+    fge::net::Socket::uninitSocket();
+    return 0;
+}
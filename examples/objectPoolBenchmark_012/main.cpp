@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/C_clock.hpp"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Benchmark of the spawn/despawn throughput of a Scene, with and without an object pool.
+ *
+ * usage: example_objectPoolBenchmark_012 [objectsPerFrame] [frameCount]
+ *
+ * Every frame, objectsPerFrame projectiles are spawned and the ones of the previous frame are despawned.
+ * Every global allocation is counted by replacing the global operator new.
+ */
+
+namespace
+{
+
+std::atomic<std::size_t> gAllocationCount{0};
+
+class Projectile : public fge::Object
+{
+public:
+    Projectile() = default;
+    ~Projectile() override = default;
+
+    FGE_OBJ_DEFAULT_COPYMETHOD(Projectile)
+
+    char const* getClassName() const override { return "PROJECTILE"; }
+    char const* getReadableClassName() const override { return "projectile"; }
+
+    fge::Vector2f _velocity{0.0f};
+    float _lifeTime{0.0f};
+};
+
+class PooledProjectile : public Projectile
+{
+public:
+    PooledProjectile() = default;
+    ~PooledProjectile() override = default;
+
+    FGE_OBJ_DEFAULT_COPYMETHOD(PooledProjectile)
+    FGE_OBJ_POOLED(PooledProjectile)
+
+    char const* getClassName() const override { return "POOLED_PROJECTILE"; }
+    char const* getReadableClassName() const override { return "pooled projectile"; }
+};
+
+template<class TObject>
+void RunBench(std::string_view name, std::size_t objectsPerFrame, std::size_t frameCount)
+{
+    fge::Scene scene;
+    std::vector<fge::ObjectSid> previousFrame;
+    std::vector<fge::ObjectSid> currentFrame;
+    previousFrame.reserve(objectsPerFrame);
+    currentFrame.reserve(objectsPerFrame);
+
+    auto const allocationsBefore = gAllocationCount.load();
+    fge::Clock clock;
+
+    for (std::size_t frame = 0; frame < frameCount; ++frame)
+    {
+        for (std::size_t i = 0; i < objectsPerFrame; ++i)
+        {
+            currentFrame.push_back(scene.newObject<TObject>()->_myObjectData.lock()->getSid());
+        }
+        for (auto const sid: previousFrame)
+        {
+            scene.delObject(sid);
+        }
+        previousFrame.swap(currentFrame);
+        currentFrame.clear();
+    }
+    scene.delAllObject(false);
+
+    auto const elapsedTime = clock.getElapsedTime<std::chrono::microseconds>();
+    auto const allocations = gAllocationCount.load() - allocationsBefore;
+    auto const spawnCount = objectsPerFrame * frameCount;
+
+    std::cout << std::setw(20) << name << std::setw(12) << std::fixed << std::setprecision(2)
+              << static_cast<double>(elapsedTime) / 1000.0 << std::setw(16) << std::setprecision(0)
+              << static_cast<double>(spawnCount) / (static_cast<double>(elapsedTime) / 1000000.0) << std::setw(16)
+              << std::setprecision(2) << static_cast<double>(allocations) / static_cast<double>(spawnCount)
+              << std::endl;
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++gAllocationCount;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t objectsPerFrame = 2000;
+    std::size_t frameCount = 500;
+
+    try
+    {
+        if (argc > 1)
+        {
+            objectsPerFrame = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            frameCount = std::stoul(argv[2]);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+
+    fge::reg::RegisterNewClass<Projectile>();
+    fge::reg::RegisterNewClass<PooledProjectile>();
+
+    std::cout << "spawn/despawn benchmark: " << objectsPerFrame << " objects per frame, " << frameCount << " frames"
+              << std::endl
+              << std::endl;
+    std::cout << std::setw(20) << "object" << std::setw(12) << "time ms" << std::setw(16) << "spawns/s"
+              << std::setw(16) << "allocs/spawn" << std::endl;
+
+    RunBench<Projectile>("regular", objectsPerFrame, frameCount);
+    RunBench<PooledProjectile>("pooled", objectsPerFrame, frameCount);
+
+    auto const& pool = fge::GetObjectPoolOf<PooledProjectile>();
+    std::cout << std::endl
+              << "pooled projectile pool: " << pool.getCapacity() << " blocks of " << pool.getBlockSize()
+              << " bytes in " << pool.getChunkCount() << " chunks" << std::endl;
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/C_clock.hpp"
+#include "FastEngine/C_propertyList.hpp"
+#include "FastEngine/C_vector.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Benchmark of the get/set throughput of a PropertyList.
+ *
+ * usage: example_propertyBenchmark_015 [propertyCount] [iterationCount]
+ *
+ * The flat open addressing PropertyList is compared with a std::unordered_map of properties, the previous
+ * storage of the PropertyList. Integer, vector and string values are written then read back.
+ * Every global allocation is counted by replacing the global operator new.
+ */
+
+namespace
+{
+
+std::atomic<std::size_t> gAllocationCount{0};
+
+class UnorderedMapList
+{
+public:
+    fge::Property& get(fge::StringId key) { return this->g_data[key]; }
+    fge::Property const* find(fge::StringId key) const
+    {
+        auto it = this->g_data.find(key);
+        return it != this->g_data.end() ? &it->second : nullptr;
+    }
+
+private:
+    std::unordered_map<fge::StringId, fge::Property> g_data;
+};
+
+class FlatList
+{
+public:
+    fge::Property& get(fge::StringId key) { return this->g_data[key]; }
+    fge::Property const* find(fge::StringId key) const { return this->g_data[key]; }
+
+private:
+    fge::PropertyList g_data;
+};
+
+struct Result
+{
+    double _setTime{0.0};
+    double _getTime{0.0};
+    std::size_t _allocations{0};
+};
+
+template<class TList, class TValue, class TRead>
+Result RunBench(std::vector<fge::StringId> const& keys, std::size_t iterationCount, TValue const& value, TRead read)
+{
+    TList list;
+    Result result;
+    double sink = 0.0;
+
+    //Creating the properties before measuring
+    for (auto const key: keys)
+    {
+        list.get(key) = value;
+    }
+
+    auto const allocationsBefore = gAllocationCount.load();
+    fge::Clock clock;
+
+    for (std::size_t i = 0; i < iterationCount; ++i)
+    {
+        for (auto const key: keys)
+        {
+            list.get(key) = value;
+        }
+    }
+    result._setTime = static_cast<double>(clock.restart<std::chrono::nanoseconds>());
+
+    auto const& constList = list;
+    for (std::size_t i = 0; i < iterationCount; ++i)
+    {
+        for (auto const key: keys)
+        {
+            sink += read(*constList.find(key));
+        }
+    }
+    result._getTime = static_cast<double>(clock.getElapsedTime<std::chrono::nanoseconds>());
+    result._allocations = gAllocationCount.load() - allocationsBefore;
+
+    if (sink == -1.0)
+    {
+        std::cout << sink << std::endl;
+    }
+    return result;
+}
+
+template<class TValue, class TRead>
+void RunBenches(std::string_view name,
+                std::vector<fge::StringId> const& keys,
+                std::size_t iterationCount,
+                TValue const& value,
+                TRead read)
+{
+    auto const operationCount = static_cast<double>(keys.size() * iterationCount);
+
+    auto const print = [&](std::string_view container, Result const& result) {
+        std::cout << std::setw(10) << name << std::setw(16) << container << std::setw(12) << std::fixed
+                  << std::setprecision(2) << result._setTime / operationCount << std::setw(12)
+                  << result._getTime / operationCount << std::setw(16)
+                  << static_cast<double>(result._allocations) / (operationCount * 2.0) << std::endl;
+    };
+
+    print("unordered_map", RunBench<UnorderedMapList>(keys, iterationCount, value, read));
+    print("PropertyList", RunBench<FlatList>(keys, iterationCount, value, read));
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++gAllocationCount;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t propertyCount = 32;
+    std::size_t iterationCount = 100000;
+
+    try
+    {
+        if (argc > 1)
+        {
+            propertyCount = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            iterationCount = std::stoul(argv[2]);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+
+    std::vector<fge::StringId> keys;
+    keys.reserve(propertyCount);
+    for (std::size_t i = 0; i < propertyCount; ++i)
+    {
+        keys.push_back(fge::InternString("property_" + std::to_string(i)));
+    }
+
+    std::cout << "property benchmark: " << propertyCount << " properties, " << iterationCount << " iterations"
+              << std::endl;
+    std::cout << "inline buffer: " << FGE_PROPERTY_INLINE_BUFFER_SIZE << " bytes, sizeof(Property): "
+              << sizeof(fge::Property) << " bytes" << std::endl
+              << std::endl;
+    std::cout << std::setw(10) << "value" << std::setw(16) << "container" << std::setw(12) << "set ns/op"
+              << std::setw(12) << "get ns/op" << std::setw(16) << "allocs/op" << std::endl;
+
+    RunBenches("integer", keys, iterationCount, fge::PintType{42}, [](fge::Property const& property) {
+        return static_cast<double>(*property.getPtr<fge::PintType>());
+    });
+    RunBenches("vector", keys, iterationCount, fge::Vector2f{1.0f, 2.0f}, [](fge::Property const& property) {
+        return static_cast<double>(property.getPtr<fge::Vector2f>()->x);
+    });
+    RunBenches("string", keys, iterationCount, std::string{"a property string value"},
+               [](fge::Property const& property) {
+        return static_cast<double>(property.getPtr<std::string>()->size());
+    });
+    return 0;
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/C_clock.hpp"
+#include "FastEngine/C_random.hpp"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif //_WIN32
+
+/*
+ * Benchmark of the Scene json save/load against the binary snapshot.
+ *
+ * usage: example_sceneSnapshotBenchmark_011 [objectCount] [all|json|binary|binary-lz4] [loadThreadCount]
+ *
+ * The peak memory is process-wide, to get the exact peak memory of a format, run the benchmark with only this format.
+ * The loadThreadCount is applied to the json load, see Scene::setLoadThreadCount.
+ */
+
+namespace
+{
+
+class BenchObject : public fge::Object
+{
+public:
+    BenchObject() = default;
+    ~BenchObject() override = default;
+
+    FGE_OBJ_DEFAULT_COPYMETHOD(BenchObject)
+
+    void save(nlohmann::json& jsonObject) override
+    {
+        fge::Object::save(jsonObject);
+        jsonObject["health"] = this->_health;
+        jsonObject["speed"] = this->_speed;
+        jsonObject["name"] = this->_name;
+    }
+    void load(nlohmann::json& jsonObject, std::filesystem::path const& filePath) override
+    {
+        fge::Object::load(jsonObject, filePath);
+        this->_health = jsonObject["health"].get<uint32_t>();
+        this->_speed = jsonObject["speed"].get<float>();
+        this->_name = jsonObject["name"].get<std::string>();
+    }
+    void pack(fge::net::Packet& pck) override
+    {
+        fge::Object::pack(pck);
+        pck << this->_health << this->_speed << this->_name;
+    }
+    void unpack(fge::net::Packet const& pck) override
+    {
+        fge::Object::unpack(pck);
+        pck >> this->_health >> this->_speed >> this->_name;
+    }
+
+    char const* getClassName() const override { return "BENCH_OBJECT"; }
+    char const* getReadableClassName() const override { return "bench object"; }
+
+    uint32_t _health{0};
+    float _speed{0.0f};
+    std::string _name;
+};
+
+std::size_t GetPeakMemory_kb()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+    {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    #ifdef __APPLE__
+    return static_cast<std::size_t>(usage.ru_maxrss) / 1024;
+    #else
+    return static_cast<std::size_t>(usage.ru_maxrss);
+    #endif
+#endif //_WIN32
+}
+
+template<class TFunc>
+void RunLoad(std::string_view formatName,
+             std::filesystem::path const& path,
+             std::size_t objectCount,
+             std::size_t loadThreadCount,
+             TFunc&& func)
+{
+    fge::Scene scene;
+    scene.setLoadThreadCount(loadThreadCount);
+    auto const memoryBefore_kb = GetPeakMemory_kb();
+
+    fge::Clock clock;
+    bool const result = func(scene, path);
+    auto const elapsedTime = clock.getElapsedTime<std::chrono::microseconds>();
+
+    auto const memoryAfter_kb = GetPeakMemory_kb();
+
+    std::cout << std::setw(12) << formatName << std::setw(12) << std::filesystem::file_size(path) / 1024
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << static_cast<double>(elapsedTime) / 1000.0 << std::setw(14) << memoryAfter_kb
+              << std::setw(14) << memoryAfter_kb - memoryBefore_kb;
+
+    if (!result || scene.getObjectSize() != objectCount)
+    {
+        std::cout << "  (load failed !)";
+    }
+    std::cout << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t objectCount = 50000;
+    std::string_view format = "all";
+    std::size_t loadThreadCount = 0;
+
+    try
+    {
+        if (argc > 1)
+        {
+            objectCount = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            format = argv[2];
+        }
+        if (argc > 3)
+        {
+            loadThreadCount = std::stoul(argv[3]);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+
+    fge::reg::RegisterNewClass(std::make_unique<fge::reg::Stamp<BenchObject>>());
+
+    std::filesystem::path const jsonPath = "sceneSnapshotBenchmark.json";
+    std::filesystem::path const binaryPath = "sceneSnapshotBenchmark.fges";
+    std::filesystem::path const binaryLZ4Path = "sceneSnapshotBenchmark_lz4.fges";
+
+    //Generating the scene
+    {
+        fge::Scene scene;
+        scene.setName("benchmark");
+        for (std::size_t i = 0; i < objectCount; ++i)
+        {
+            auto* object = scene.newObject<BenchObject>();
+            object->setPosition(fge::_random.rangeVec2(0.0f, 10000.0f, 0.0f, 10000.0f));
+            object->setRotation(fge::_random.range(0.0f, 360.0f));
+            object->_health = fge::_random.range<uint32_t>(0, 100);
+            object->_speed = fge::_random.range(0.0f, 10.0f);
+            object->_name = "object_" + std::to_string(i % 100);
+        }
+
+        if (!scene.saveInFile(jsonPath) || !scene.saveSnapshotInFile(binaryPath, false) ||
+            !scene.saveSnapshotInFile(binaryLZ4Path, true))
+        {
+            std::cout << "can't save the scene !" << std::endl;
+            return -1;
+        }
+    }
+
+    std::cout << "scene load benchmark with " << objectCount << " objects" << std::endl << std::endl;
+    std::cout << std::setw(12) << "format" << std::setw(12) << "size KB" << std::setw(12) << "load ms"
+              << std::setw(14) << "peak mem KB" << std::setw(14) << "peak grow KB" << std::endl;
+
+    //Binary formats first as they are expected to use less memory than json
+    if (format == "all" || format == "binary-lz4")
+    {
+        RunLoad("binary-lz4", binaryLZ4Path, objectCount, loadThreadCount,
+                [](fge::Scene& scene, std::filesystem::path const& path) {
+            return scene.loadSnapshotFromFile(path);
+        });
+    }
+    if (format == "all" || format == "binary")
+    {
+        RunLoad("binary", binaryPath, objectCount, loadThreadCount,
+                [](fge::Scene& scene, std::filesystem::path const& path) {
+            return scene.loadSnapshotFromFile(path);
+        });
+    }
+    if (format == "all" || format == "json")
+    {
+        RunLoad("json", jsonPath, objectCount, loadThreadCount,
+                [](fge::Scene& scene, std::filesystem::path const& path) {
+            return scene.loadFromFile(path);
+        });
+    }
+
+    std::filesystem::remove(jsonPath);
+    std::filesystem::remove(binaryPath);
+    std::filesystem::remove(binaryLZ4Path);
+    return 0;
+}
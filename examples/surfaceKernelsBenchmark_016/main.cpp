@@ -0,0 +1,326 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/C_clock.hpp"
+#include "FastEngine/graphic/C_surface.hpp"
+#include "FastEngine/graphic/pixelKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Micro-benchmark of the surface pixel kernels.
+ *
+ * usage: example_surfaceKernelsBenchmark_016 [size] [iterationCount]
+ *
+ * Every row kernel is compared with a scalar per pixel loop on a size*size RGBA32 buffer,
+ * then the Surface methods using them are compared with the previous getPixel/setPixel implementation.
+ * The best time of every run is printed.
+ */
+
+namespace
+{
+
+uint8_t* Bytes(uint32_t& pixel)
+{
+    return reinterpret_cast<uint8_t*>(&pixel);
+}
+
+//Scalar references
+
+void ReverseRowReference(uint32_t* row, std::size_t count)
+{
+    for (std::size_t i = 0; i < count / 2; ++i)
+    {
+        std::swap(row[i], row[count - i - 1]);
+    }
+}
+void ReplaceRowReference(uint32_t* row, std::size_t count, uint32_t key, uint32_t replacement)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        row[i] = row[i] == key ? replacement : row[i];
+    }
+}
+void PremultiplyRowReference(uint32_t* row, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto* pixel = Bytes(row[i]);
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            pixel[c] = static_cast<uint8_t>((pixel[c] * pixel[3] + 127) / 255);
+        }
+    }
+}
+void UnpremultiplyRowReference(uint32_t* row, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto* pixel = Bytes(row[i]);
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            pixel[c] = pixel[3] == 0 ? 0
+                                     : static_cast<uint8_t>(std::min(255, (pixel[c] * 255 + pixel[3] / 2) / pixel[3]));
+        }
+    }
+}
+
+template<class TFunc>
+double Measure(std::size_t iterationCount, TFunc&& func)
+{
+    double best = 0.0;
+    for (std::size_t i = 0; i < iterationCount; ++i)
+    {
+        fge::Clock clock;
+        func();
+        auto const time = static_cast<double>(clock.getElapsedTime<std::chrono::microseconds>()) / 1000.0;
+        best = i == 0 ? time : std::min(best, time);
+    }
+    return best;
+}
+
+void PrintResult(std::string_view name, double referenceTime, double time)
+{
+    std::cout << std::setw(24) << name << std::setw(14) << std::fixed << std::setprecision(3) << referenceTime
+              << std::setw(14) << time << std::setw(10) << std::setprecision(2) << referenceTime / std::max(time, 0.001)
+              << "x" << std::endl;
+}
+
+void FillNoise(std::vector<uint32_t>& buffer)
+{
+    uint32_t state = 0x2545F491;
+    for (auto& pixel: buffer)
+    {
+        state = state * 1664525u + 1013904223u;
+        //Few distinct colors so the color key is found often
+        pixel = state & 0xFF0F0F0F;
+    }
+}
+
+template<class TReference, class TKernel>
+void RunRowBench(std::string_view name,
+                 std::vector<uint32_t> const& source,
+                 std::size_t size,
+                 std::size_t iterationCount,
+                 TReference reference,
+                 TKernel kernel)
+{
+    auto buffer = source;
+    auto const referenceTime = Measure(iterationCount, [&]() {
+        for (std::size_t y = 0; y < size; ++y)
+        {
+            reference(buffer.data() + y * size, size);
+        }
+    });
+
+    buffer = source;
+    auto const time = Measure(iterationCount, [&]() {
+        for (std::size_t y = 0; y < size; ++y)
+        {
+            kernel(buffer.data() + y * size, size);
+        }
+    });
+
+    PrintResult(name, referenceTime, time);
+}
+
+void FlipHorizontallyReference(fge::Surface& surface)
+{
+    auto const size = surface.getSize();
+    for (int h = 0; h < size.y; ++h)
+    {
+        for (int w = 0; w < size.x / 2; ++w)
+        {
+            auto const left = surface.getPixel(w, h).value();
+            auto const right = surface.getPixel(size.x - w - 1, h).value();
+            surface.setPixel(w, h, right);
+            surface.setPixel(size.x - w - 1, h, left);
+        }
+    }
+}
+void FlipVerticallyReference(fge::Surface& surface)
+{
+    auto const size = surface.getSize();
+    for (int w = 0; w < size.x; ++w)
+    {
+        for (int h = 0; h < size.y / 2; ++h)
+        {
+            auto const top = surface.getPixel(w, h).value();
+            auto const bottom = surface.getPixel(w, size.y - h - 1).value();
+            surface.setPixel(w, h, bottom);
+            surface.setPixel(w, size.y - h - 1, top);
+        }
+    }
+}
+void CreateMaskFromColorReference(fge::Surface& surface, fge::Color const& color, uint8_t alpha)
+{
+    auto const size = surface.getSize();
+    for (int h = 0; h < size.y; ++h)
+    {
+        for (int w = 0; w < size.x; ++w)
+        {
+            auto pixel = surface.getPixel(w, h).value();
+            if (pixel == color)
+            {
+                pixel._a = alpha;
+                surface.setPixel(w, h, pixel);
+            }
+        }
+    }
+}
+void AddCircleReference(fge::Surface& surface, int x, int y, unsigned int radius, fge::Color const& color)
+{
+    auto const size = surface.getSize();
+    for (int h = 0; h < size.y; ++h)
+    {
+        for (int w = 0; w < size.x; ++w)
+        {
+            if (std::sqrt(static_cast<float>((w - x) * (w - x)) + static_cast<float>((h - y) * (h - y))) <=
+                static_cast<float>(radius))
+            {
+                surface.setPixel(w, h, color);
+            }
+        }
+    }
+}
+
+template<class TReference, class TMethod>
+void RunSurfaceBench(std::string_view name,
+                     int size,
+                     std::size_t iterationCount,
+                     TReference reference,
+                     TMethod method)
+{
+    fge::Surface surface(size, size, fge::Color::Red);
+    auto const referenceTime = Measure(iterationCount, [&]() { reference(surface); });
+    auto const time = Measure(iterationCount, [&]() { method(surface); });
+    PrintResult(name, referenceTime, time);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t size = 1024;
+    std::size_t iterationCount = 20;
+
+    try
+    {
+        if (argc > 1)
+        {
+            size = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            iterationCount = std::stoul(argv[2]);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+    if (size == 0 || iterationCount == 0)
+    {
+        std::cout << "bad arguments: size and iterationCount must be positive" << std::endl;
+        return -1;
+    }
+
+    std::cout << "pixel kernels benchmark: " << size << "x" << size << " pixels, best of " << iterationCount
+              << " runs, instruction set: " << fge::pixel::GetKernelsInstructionSet() << std::endl
+              << std::endl;
+
+    std::vector<uint32_t> source(size * size);
+    FillNoise(source);
+    uint32_t const key = source[0];
+    uint32_t const replacement = key & 0x00FFFFFF;
+
+    std::cout << std::setw(24) << "row kernel" << std::setw(14) << "scalar ms" << std::setw(14) << "kernel ms"
+              << std::setw(11) << "speedup" << std::endl;
+
+    RunRowBench("ReverseRow", source, size, iterationCount, ReverseRowReference, fge::pixel::ReverseRow);
+    RunRowBench(
+            "SwapRows", source, size, iterationCount,
+            [](uint32_t* row, std::size_t count) {
+                //The two halves of the row are swapped
+                for (std::size_t i = 0; i < count / 2; ++i)
+                {
+                    std::swap(row[i], row[count / 2 + i]);
+                }
+            },
+            [](uint32_t* row, std::size_t count) { fge::pixel::SwapRows(row, row + count / 2, count / 2); });
+    RunRowBench(
+            "FillRow", source, size, iterationCount,
+            [](uint32_t* row, std::size_t count) {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    row[i] = 0xFF00FF00;
+                }
+            },
+            [](uint32_t* row, std::size_t count) { fge::pixel::FillRow(row, count, 0xFF00FF00); });
+    RunRowBench(
+            "ReplaceRow", source, size, iterationCount,
+            [&](uint32_t* row, std::size_t count) { ReplaceRowReference(row, count, key, replacement); },
+            [&](uint32_t* row, std::size_t count) { fge::pixel::ReplaceRow(row, count, key, replacement); });
+    RunRowBench("PremultiplyRow", source, size, iterationCount, PremultiplyRowReference, fge::pixel::PremultiplyRow);
+    RunRowBench("UnpremultiplyRow", source, size, iterationCount, UnpremultiplyRowReference,
+                fge::pixel::UnpremultiplyRow);
+
+    auto const surfaceSize = static_cast<int>(size);
+    auto const radius = static_cast<unsigned int>(size / 3);
+
+    std::cout << std::endl
+              << std::setw(24) << "surface method" << std::setw(14) << "per pixel ms" << std::setw(14) << "kernel ms"
+              << std::setw(11) << "speedup" << std::endl;
+
+    RunSurfaceBench("flipHorizontally", surfaceSize, iterationCount, FlipHorizontallyReference,
+                    [](fge::Surface& surface) { surface.flipHorizontally(); });
+    RunSurfaceBench("flipVertically", surfaceSize, iterationCount, FlipVerticallyReference,
+                    [](fge::Surface& surface) { surface.flipVertically(); });
+    RunSurfaceBench(
+            "createMaskFromColor", surfaceSize, iterationCount,
+            [](fge::Surface& surface) { CreateMaskFromColorReference(surface, fge::Color::Red, 0); },
+            [](fge::Surface& surface) { surface.createMaskFromColor(fge::Color::Red, 0); });
+    RunSurfaceBench(
+            "addCircle", surfaceSize, iterationCount,
+            [&](fge::Surface& surface) {
+                AddCircleReference(surface, surfaceSize / 2, surfaceSize / 2, radius, fge::Color::Blue);
+            },
+            [&](fge::Surface& surface) {
+                surface.addCircle(surfaceSize / 2, surfaceSize / 2, radius, fge::Color::Blue);
+            });
+    RunSurfaceBench(
+            "premultiplyAlpha", surfaceSize, iterationCount,
+            [](fge::Surface& surface) {
+                auto* pixels = static_cast<uint8_t*>(surface.get()->pixels);
+                for (int h = 0; h < surface.get()->h; ++h)
+                {
+                    PremultiplyRowReference(reinterpret_cast<uint32_t*>(pixels + h * surface.get()->pitch),
+                                            surface.get()->w);
+                }
+            },
+            [](fge::Surface& surface) { surface.premultiplyAlpha(); });
+
+    return 0;
+}
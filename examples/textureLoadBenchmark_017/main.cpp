@@ -0,0 +1,344 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/C_clock.hpp"
+#include "FastEngine/graphic/C_surface.hpp"
+#include "FastEngine/vulkan/C_textureData.hpp"
+#include "SDL_image.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Benchmark of the texture load time, PNG decoding versus pre-compressed KTX2 files.
+ *
+ * usage: example_textureLoadBenchmark_017 [size] [iterationCount]
+ *
+ * A procedural size*size image is saved as a PNG, as an RGBA8 KTX2 and as a BC1 KTX2 (both with a full mip chain)
+ * in the temporary directory. Every file is then loaded into a CPU side texture ready to be uploaded,
+ * the best time of every run is printed with the file size and the size of the data to upload.
+ */
+
+namespace
+{
+
+template<class TFunc>
+double Measure(std::size_t iterationCount, TFunc&& func)
+{
+    double best = 0.0;
+    for (std::size_t i = 0; i < iterationCount; ++i)
+    {
+        fge::Clock clock;
+        func();
+        auto const time = static_cast<double>(clock.getElapsedTime<std::chrono::microseconds>()) / 1000.0;
+        best = i == 0 ? time : std::min(best, time);
+    }
+    return best;
+}
+
+void PrintResult(std::string_view name, std::filesystem::path const& path, double time, std::size_t uploadSize)
+{
+    std::cout << std::setw(20) << name << std::setw(14) << std::filesystem::file_size(path) / 1024 << std::setw(14)
+              << std::fixed << std::setprecision(3) << time << std::setw(14) << uploadSize / 1024 << std::endl;
+}
+
+void FillImage(fge::Surface& surface)
+{
+    auto* sdlSurface = surface.get();
+    auto const size = surface.getSize();
+    uint32_t state = 0x2545F491;
+    for (int y = 0; y < size.y; ++y)
+    {
+        auto* row = static_cast<uint8_t*>(sdlSurface->pixels) + static_cast<std::size_t>(y) * sdlSurface->pitch;
+        for (int x = 0; x < size.x; ++x)
+        {
+            //Gradients with some noise, so the PNG compression is not trivial
+            state = state * 1664525u + 1013904223u;
+            auto const noise = static_cast<int>(state >> 28);
+            row[x * 4 + 0] = static_cast<uint8_t>((x * 255 / size.x + noise) & 0xFF);
+            row[x * 4 + 1] = static_cast<uint8_t>((y * 255 / size.y + noise) & 0xFF);
+            row[x * 4 + 2] = static_cast<uint8_t>(((x ^ y) & 0xFF) / 2 + noise);
+            row[x * 4 + 3] = 255;
+        }
+    }
+}
+
+//Minimal BC1 encoder, the block colors are the bounds of the block colors
+
+uint16_t ToRGB565(uint8_t const* color)
+{
+    return static_cast<uint16_t>(((color[0] >> 3) << 11) | ((color[1] >> 2) << 5) | (color[2] >> 3));
+}
+void FromRGB565(uint16_t color, int* result)
+{
+    result[0] = ((color >> 11) & 0x1F) * 255 / 31;
+    result[1] = ((color >> 5) & 0x3F) * 255 / 63;
+    result[2] = (color & 0x1F) * 255 / 31;
+}
+
+void EncodeBC1Block(uint8_t const* pixels, uint8_t* block)
+{
+    uint8_t minColor[3] = {255, 255, 255};
+    uint8_t maxColor[3] = {0, 0, 0};
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            minColor[c] = std::min(minColor[c], pixels[i * 4 + c]);
+            maxColor[c] = std::max(maxColor[c], pixels[i * 4 + c]);
+        }
+    }
+
+    auto color0 = ToRGB565(maxColor);
+    auto color1 = ToRGB565(minColor);
+    if (color0 < color1)
+    {
+        std::swap(color0, color1);
+    }
+
+    int palette[4][3];
+    FromRGB565(color0, palette[0]);
+    FromRGB565(color1, palette[1]);
+    for (std::size_t c = 0; c < 3; ++c)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    uint32_t indices = 0;
+    if (color0 != color1)
+    {
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            int bestDistance = 0;
+            uint32_t bestIndex = 0;
+            for (uint32_t p = 0; p < 4; ++p)
+            {
+                int distance = 0;
+                for (std::size_t c = 0; c < 3; ++c)
+                {
+                    auto const delta = palette[p][c] - pixels[i * 4 + c];
+                    distance += delta * delta;
+                }
+                if (p == 0 || distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    bestIndex = p;
+                }
+            }
+            indices |= bestIndex << (i * 2);
+        }
+    }
+
+    block[0] = static_cast<uint8_t>(color0);
+    block[1] = static_cast<uint8_t>(color0 >> 8);
+    block[2] = static_cast<uint8_t>(color1);
+    block[3] = static_cast<uint8_t>(color1 >> 8);
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        block[4 + i] = static_cast<uint8_t>(indices >> (i * 8));
+    }
+}
+
+std::vector<uint8_t> EncodeBC1Level(uint8_t const* pixels, fge::Vector2i const& size)
+{
+    auto const blockCountX = (size.x + 3) / 4;
+    auto const blockCountY = (size.y + 3) / 4;
+    std::vector<uint8_t> result(static_cast<std::size_t>(blockCountX) * blockCountY * 8);
+
+    uint8_t blockPixels[16 * 4];
+    for (int by = 0; by < blockCountY; ++by)
+    {
+        for (int bx = 0; bx < blockCountX; ++bx)
+        {
+            //Pixels outside of the level are clamped to the border
+            for (int y = 0; y < 4; ++y)
+            {
+                for (int x = 0; x < 4; ++x)
+                {
+                    auto const px = std::min(bx * 4 + x, size.x - 1);
+                    auto const py = std::min(by * 4 + y, size.y - 1);
+                    std::copy_n(pixels + (static_cast<std::size_t>(py) * size.x + px) * 4, 4,
+                                blockPixels + (y * 4 + x) * 4);
+                }
+            }
+            EncodeBC1Block(blockPixels, result.data() + (static_cast<std::size_t>(by) * blockCountX + bx) * 8);
+        }
+    }
+    return result;
+}
+
+void WriteLE(std::vector<uint8_t>& buffer, std::size_t offset, uint64_t value, std::size_t size)
+{
+    if (buffer.size() < offset + size)
+    {
+        buffer.resize(offset + size, 0);
+    }
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        buffer[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+//Write a minimal KTX2 file (no data format descriptor) with the levels stored from the smallest to the largest
+bool SaveKTX2(std::filesystem::path const& path,
+              VkFormat format,
+              fge::Vector2i const& size,
+              std::vector<std::vector<uint8_t>> const& levels)
+{
+    uint8_t const identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+    std::vector<uint8_t> file(identifier, identifier + 12);
+    WriteLE(file, 12, static_cast<uint32_t>(format), 4);
+    WriteLE(file, 16, 1, 4);
+    WriteLE(file, 20, static_cast<uint32_t>(size.x), 4);
+    WriteLE(file, 24, static_cast<uint32_t>(size.y), 4);
+    WriteLE(file, 36, 1, 4);
+    WriteLE(file, 40, levels.size(), 4);
+    WriteLE(file, 80 + levels.size() * 24, 0, 0);
+
+    for (std::size_t i = levels.size(); i-- > 0;)
+    {
+        auto const offset = file.size();
+        WriteLE(file, 80 + i * 24, offset, 8);
+        WriteLE(file, 80 + i * 24 + 8, levels[i].size(), 8);
+        WriteLE(file, 80 + i * 24 + 16, levels[i].size(), 8);
+        file.insert(file.end(), levels[i].begin(), levels[i].end());
+    }
+
+    std::ofstream stream(path, std::ios::binary);
+    stream.write(reinterpret_cast<char const*>(file.data()), static_cast<std::streamsize>(file.size()));
+    return stream.good();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    int size = 1024;
+    std::size_t iterationCount = 10;
+
+    try
+    {
+        if (argc > 1)
+        {
+            size = std::stoi(argv[1]);
+        }
+        if (argc > 2)
+        {
+            iterationCount = std::stoul(argv[2]);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cout << "bad arguments: " << e.what() << std::endl;
+        return -1;
+    }
+    if (size <= 0 || iterationCount == 0)
+    {
+        std::cout << "bad arguments: size and iterationCount must be positive" << std::endl;
+        return -1;
+    }
+
+    IMG_Init(IMG_INIT_PNG);
+
+    auto const directory = std::filesystem::temp_directory_path();
+    auto const pngPath = directory / "fge_textureLoadBenchmark.png";
+    auto const rgbaPath = directory / "fge_textureLoadBenchmark_rgba8.ktx2";
+    auto const bc1Path = directory / "fge_textureLoadBenchmark_bc1.ktx2";
+
+    //Preparing the files
+    fge::Surface image(size, size);
+    FillImage(image);
+
+    fge::vulkan::TextureData mipmaps;
+    if (!image.saveToFile(pngPath) || !mipmaps.create(image.get()))
+    {
+        std::cout << "unable to create the png file" << std::endl;
+        IMG_Quit();
+        return -1;
+    }
+
+    std::vector<std::vector<uint8_t>> rgbaLevels;
+    std::vector<std::vector<uint8_t>> bc1Levels;
+    for (uint32_t i = 0; i < mipmaps.getLevelCount(); ++i)
+    {
+        auto const& level = mipmaps.getLevel(i);
+        auto const* levelData = mipmaps.getLevelData(i);
+        rgbaLevels.emplace_back(levelData, levelData + level._byteSize);
+        bc1Levels.push_back(EncodeBC1Level(levelData, level._size));
+    }
+    if (!SaveKTX2(rgbaPath, VK_FORMAT_R8G8B8A8_UNORM, mipmaps.getSize(), rgbaLevels) ||
+        !SaveKTX2(bc1Path, VK_FORMAT_BC1_RGB_UNORM_BLOCK, mipmaps.getSize(), bc1Levels))
+    {
+        std::cout << "unable to create the ktx2 files" << std::endl;
+        IMG_Quit();
+        return -1;
+    }
+
+    std::cout << "texture load benchmark: " << size << "x" << size << " pixels, " << mipmaps.getLevelCount()
+              << " mip levels, best of " << iterationCount << " runs" << std::endl
+              << std::endl;
+    std::cout << std::setw(20) << "file" << std::setw(14) << "file KiB" << std::setw(14) << "load ms" << std::setw(14)
+              << "upload KiB" << std::endl;
+
+    //PNG, decoded without mipmaps
+    std::size_t uploadSize = 0;
+    auto time = Measure(iterationCount, [&]() {
+        fge::Surface surface;
+        surface.loadFromFile(pngPath);
+        uploadSize = static_cast<std::size_t>(surface.getSize().x) * surface.getSize().y * 4;
+    });
+    PrintResult("png", pngPath, time, uploadSize);
+
+    //PNG, decoded with the CPU mip chain
+    time = Measure(iterationCount, [&]() {
+        fge::Surface surface;
+        surface.loadFromFile(pngPath);
+        fge::vulkan::TextureData data;
+        data.create(surface.get());
+        uploadSize = data.getData().size();
+    });
+    PrintResult("png + cpu mipmaps", pngPath, time, uploadSize);
+
+    //KTX2, every level is already in the file
+    time = Measure(iterationCount, [&]() {
+        fge::vulkan::TextureData data;
+        data.loadFromFile(rgbaPath);
+        uploadSize = data.getData().size();
+    });
+    PrintResult("ktx2 rgba8", rgbaPath, time, uploadSize);
+
+    time = Measure(iterationCount, [&]() {
+        fge::vulkan::TextureData data;
+        data.loadFromFile(bc1Path);
+        uploadSize = data.getData().size();
+    });
+    PrintResult("ktx2 bc1", bc1Path, time, uploadSize);
+
+    std::filesystem::remove(pngPath);
+    std::filesystem::remove(rgbaPath);
+    std::filesystem::remove(bc1Path);
+
+    IMG_Quit();
+    return 0;
+}
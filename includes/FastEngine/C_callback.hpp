@@ -17,11 +17,20 @@
 #ifndef _FGE_C_CALLBACKHANDLER_HPP_INCLUDED
 #define _FGE_C_CALLBACKHANDLER_HPP_INCLUDED
 
+#include "FastEngine/C_nullMutex.hpp"
 #include "FastEngine/C_subscription.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <type_traits>
 #include <vector>
 
+#define FGE_CALLBACK_LAMBDA_BUFFER_SIZE (sizeof(void*) * 4)
+
 namespace fge
 {
 
@@ -86,6 +95,9 @@ protected:
  * \ingroup callback
  * \brief Callback lambda (with/without capture)
  *
+ * A lambda that fit in FGE_CALLBACK_LAMBDA_BUFFER_SIZE bytes is stored inside the callback without any
+ * extra allocation.
+ *
  * \tparam Types The list of arguments types passed to the lambda
  */
 template<class TReturn, class... Types>
@@ -117,6 +129,7 @@ public:
     inline bool check(void* ptr) override;
 
 protected:
+    alignas(std::max_align_t) std::byte g_buffer[FGE_CALLBACK_LAMBDA_BUFFER_SIZE];
     void* g_lambda;
     TReturn (*g_executeLambda)(void*, Types...);
     void (*g_deleteLambda)(void*);
@@ -225,51 +238,55 @@ struct CallbackStaticHelpers
 };
 
 /**
- * \class CallbackHandler
+ * \class BasicCallbackHandler
  * \ingroup callback
  * \brief This class is used to handle callbacks in a safe way
  *
  * Every callback muse use the same template parameters Types than a handler.
- * This class is thread-safe.
+ * With std::recursive_mutex, this class is thread-safe (see CallbackHandler).
+ * With NullMutex, the handler must be owned by a single thread (see LocalCallbackHandler).
+ *
+ * The list of callbacks is copied on write, call() never lock nor allocate and can be done
+ * while another thread modify the list. A list replaced during a call is kept alive until no call is running,
+ * it is destroyed by the last call to leave or by the next modification.
+ * A callback added during a call is also called by this call.
  *
  * This class inherits from Subscription to be able to subscribe to it. When a subscriber is
  * added to a handler and is destroyed, all the callbacks related to this subscriber are automatically removed.
  *
  * \see Subscription
  *
+ * \tparam TMutex The mutex type used to modify the list of callbacks
  * \tparam Types The list of arguments types passed to the callbacks
  */
-template<class... Types>
-class CallbackHandler : public fge::Subscription
+template<class TMutex, class... Types>
+class BasicCallbackHandler : public fge::Subscription
 {
 public:
     using CalleePtr = CalleeUniquePtr<void, Types...>;
     using StaticHelpers = CallbackStaticHelpers<void, CalleePtr, Types...>;
 
-    CallbackHandler() = default;
-    ~CallbackHandler() override = default;
+    BasicCallbackHandler() = default;
+    ~BasicCallbackHandler() override;
 
     /**
      * \brief Copy constructor that does nothing
      */
-    CallbackHandler([[maybe_unused]] fge::CallbackHandler<Types...> const& n) :
+    BasicCallbackHandler([[maybe_unused]] BasicCallbackHandler const& n) :
             fge::Subscription() {};
     /**
      * \brief Move constructor prohibited
      */
-    CallbackHandler(fge::CallbackHandler<Types...>&& n) = delete;
+    BasicCallbackHandler(BasicCallbackHandler&& n) = delete;
 
     /**
      * \brief Copy operator that does nothing
      */
-    fge::CallbackHandler<Types...>& operator=([[maybe_unused]] fge::CallbackHandler<Types...> const& n)
-    {
-        return *this;
-    };
+    BasicCallbackHandler& operator=([[maybe_unused]] BasicCallbackHandler const& n) { return *this; };
     /**
      * \brief Move operator prohibited
      */
-    fge::CallbackHandler<Types...>& operator=(fge::CallbackHandler<Types...>&& n) = delete;
+    BasicCallbackHandler& operator=(BasicCallbackHandler&& n) = delete;
 
     /**
      * \brief Clear the list of callbacks
@@ -362,6 +379,8 @@ public:
     /**
      * \brief Call all the callbacks with the given arguments
      *
+     * This method is wait-free, it never lock the handler.
+     *
      * \param args The list of arguments
      */
     void call(Types... args);
@@ -377,7 +396,7 @@ public:
      * \param handler Another handler of the same type
      * \param subscriber The subscriber associated with this handler
      */
-    void hook(fge::CallbackHandler<Types...>& handler, fge::Subscriber* subscriber = nullptr);
+    void hook(BasicCallbackHandler& handler, fge::Subscriber* subscriber = nullptr);
 
 protected:
     /**
@@ -392,22 +411,103 @@ protected:
 private:
     struct CalleeData
     {
-        inline CalleeData(CalleePtr&& f, fge::Subscriber* subscriber) :
-                _f(std::move(f)),
-                _subscriber(subscriber)
+        inline CalleeData(fge::CallbackBase<void, Types...>* f, fge::Subscriber* subscriber, uint64_t id) :
+                _f(f),
+                _subscriber(subscriber),
+                _id(id)
         {}
 
-        CalleePtr _f;
+        fge::CallbackBase<void, Types...>* _f; ///< Owned by the handler, shared between the lists
         fge::Subscriber* _subscriber = nullptr;
-        bool _markedForDeletion = false;
+        uint64_t _id; ///< Increasing with the insertion order
     };
     using CalleeList = std::vector<CalleeData>;
 
-    CalleeList g_callees;
+    ///A value shared between the calls and the modifications, atomic only when the handler is thread-safe
+    template<class T>
+    using SharedValue = std::conditional_t<std::is_same_v<TMutex, fge::NullMutex>, T, std::atomic<T>>;
 
-    mutable std::recursive_mutex g_mutex;
+    struct CallGuard
+    {
+        inline explicit CallGuard(BasicCallbackHandler& handler) :
+                _handler(handler)
+        {
+            ++this->_handler.g_activeCalls;
+        }
+        inline ~CallGuard()
+        {
+            if (--this->_handler.g_activeCalls == 0 && this->_handler.g_hasRetired)
+            {
+                this->_handler.tryReclaimRetired();
+            }
+        }
+
+        BasicCallbackHandler& _handler;
+    };
+
+    /**
+     * \brief Copy the current list of callbacks
+     *
+     * \param extraCapacity The number of callbacks that will be added to the copy
+     * \return The copied list
+     */
+    [[nodiscard]] CalleeList copyCallees(std::size_t extraCapacity = 0) const;
+    /**
+     * \brief Replace the list of callbacks seen by call()
+     *
+     * The mutex must be locked.
+     *
+     * \param callees The new list
+     */
+    void publish(CalleeList&& callees);
+    /**
+     * \brief Retire a callback removed from the list, it is destroyed with the retired lists
+     *
+     * The mutex must be locked.
+     *
+     * \param callee The removed callee
+     */
+    void retire(CalleeData const& callee);
+    /**
+     * \brief Destroy the retired lists and callbacks if no call is running
+     *
+     * The mutex must be locked.
+     */
+    void reclaimRetired();
+    /**
+     * \brief Called by the last call to leave, reclaim the retired lists without waiting for the mutex
+     */
+    void tryReclaimRetired();
+
+    SharedValue<CalleeList const*> g_callees{nullptr};
+    std::unique_ptr<CalleeList const> g_calleesOwner; ///< The current list, only accessed with the mutex locked
+    std::vector<std::unique_ptr<CalleeList const>> g_retiredCallees;
+    std::vector<CalleePtr> g_retiredCallbacks;
+    SharedValue<bool> g_hasRetired{false};
+    SharedValue<uint32_t> g_activeCalls{0};
+    uint64_t g_nextCalleeId{0};
+
+    mutable TMutex g_mutex;
 };
 
+/**
+ * \ingroup callback
+ * \brief A thread-safe callback handler
+ *
+ * \see BasicCallbackHandler
+ */
+template<class... Types>
+using CallbackHandler = fge::BasicCallbackHandler<std::recursive_mutex, Types...>;
+
+/**
+ * \ingroup callback
+ * \brief A callback handler without lock, must be owned by a single thread
+ *
+ * \see BasicCallbackHandler
+ */
+template<class... Types>
+using LocalCallbackHandler = fge::BasicCallbackHandler<fge::NullMutex, Types...>;
+
 /**
  * \class UniqueCallbackHandler
  * \ingroup callback
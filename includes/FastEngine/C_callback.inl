@@ -59,9 +59,20 @@ bool CallbackObjectFunctor<TReturn, TObject, Types...>::check(void* ptr)
 
 template<class TReturn, class... Types>
 template<typename TLambda>
-CallbackLambda<TReturn, Types...>::CallbackLambda(TLambda const& lambda) :
-        g_lambda(new TLambda(lambda))
+CallbackLambda<TReturn, Types...>::CallbackLambda(TLambda const& lambda)
 {
+    if constexpr (sizeof(TLambda) <= FGE_CALLBACK_LAMBDA_BUFFER_SIZE &&
+                  alignof(TLambda) <= alignof(std::max_align_t))
+    {
+        this->g_lambda = new (this->g_buffer) TLambda(lambda);
+        this->g_deleteLambda = [](void* lambdaPtr) { std::destroy_at(reinterpret_cast<TLambda*>(lambdaPtr)); };
+    }
+    else
+    {
+        this->g_lambda = new TLambda(lambda);
+        this->g_deleteLambda = [](void* lambdaPtr) { delete reinterpret_cast<TLambda*>(lambdaPtr); };
+    }
+
     this->g_executeLambda = [](void* lambdaPtr, [[maybe_unused]] Types... arguments) {
         if constexpr (std::is_invocable_v<TLambda, Types...>)
         {
@@ -72,7 +83,6 @@ CallbackLambda<TReturn, Types...>::CallbackLambda(TLambda const& lambda) :
             return (*reinterpret_cast<TLambda*>(lambdaPtr))();
         }
     };
-    this->g_deleteLambda = [](void* lambdaPtr) { delete reinterpret_cast<TLambda*>(lambdaPtr); };
 }
 template<class TReturn, class... Types>
 CallbackLambda<TReturn, Types...>::~CallbackLambda()
@@ -93,62 +103,67 @@ bool CallbackLambda<TReturn, Types...>::check([[maybe_unused]] void* ptr)
 
 //CallbackHandler
 
-template<class... Types>
-void CallbackHandler<Types...>::clear()
+template<class TMutex, class... Types>
+BasicCallbackHandler<TMutex, Types...>::~BasicCallbackHandler()
 {
-    std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
-    this->detachAll();
-    for (auto& callee: this->g_callees)
+    //No call can be running anymore, the callbacks of the current list are owned by the handler
+    if (this->g_calleesOwner)
     {
-        callee._markedForDeletion = true;
+        for (auto const& callee: *this->g_calleesOwner)
+        {
+            delete callee._f;
+        }
     }
 }
 
-template<class... Types>
-fge::CallbackBase<void, Types...>* CallbackHandler<Types...>::add(CalleePtr&& callback, fge::Subscriber* subscriber)
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::clear()
 {
-    std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
-
-    this->attach(subscriber);
-
-    //Search for a "mark for deletion" callee and replace it with the new one
-    for (auto& callee: this->g_callees)
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
+    this->detachAll();
+    if (this->g_calleesOwner)
     {
-        if (callee._markedForDeletion)
+        for (auto const& callee: *this->g_calleesOwner)
         {
-            //TODO: _markedForDeletion has been added in order to avoid undefined behavior when a callback remove itself
-            // while being called. But here we do the same mistake, we replace a callee that could be called at the same time.
-            // We need a better solution.
-            callee._f = std::move(callback);
-            callee._subscriber = subscriber;
-            callee._markedForDeletion = false;
-            return callee._f.get();
+            this->retire(callee);
         }
     }
+    this->publish({});
+}
+
+template<class TMutex, class... Types>
+fge::CallbackBase<void, Types...>* BasicCallbackHandler<TMutex, Types...>::add(CalleePtr&& callback,
+                                                                               fge::Subscriber* subscriber)
+{
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
+
+    this->attach(subscriber);
 
-    //Emplace back the new callee if there is no "mark for deletion"
-    this->g_callees.emplace_back(std::move(callback), subscriber);
-    return this->g_callees.back()._f.get();
+    auto callees = this->copyCallees(1);
+    callees.emplace_back(callback.get(), subscriber, this->g_nextCalleeId++);
+    this->publish(std::move(callees));
+    //Once published, the callback is owned by the handler
+    return callback.release();
 }
-template<class... Types>
+template<class TMutex, class... Types>
 inline fge::CallbackFunctor<void, Types...>*
-CallbackHandler<Types...>::addFunctor(typename fge::CallbackFunctor<void, Types...>::CallbackFunction func,
-                                      fge::Subscriber* subscriber)
+BasicCallbackHandler<TMutex, Types...>::addFunctor(typename fge::CallbackFunctor<void, Types...>::CallbackFunction func,
+                                                   fge::Subscriber* subscriber)
 {
     return reinterpret_cast<fge::CallbackFunctor<void, Types...>*>(
             this->add(StaticHelpers::newFunctor(func), subscriber));
 }
-template<class... Types>
+template<class TMutex, class... Types>
 template<typename TLambda>
-inline fge::CallbackLambda<void, Types...>* CallbackHandler<Types...>::addLambda(TLambda const& lambda,
-                                                                                 fge::Subscriber* subscriber)
+inline fge::CallbackLambda<void, Types...>*
+BasicCallbackHandler<TMutex, Types...>::addLambda(TLambda const& lambda, fge::Subscriber* subscriber)
 {
     return reinterpret_cast<fge::CallbackLambda<void, Types...>*>(
             this->add(StaticHelpers::newLambda(lambda), subscriber));
 }
-template<class... Types>
+template<class TMutex, class... Types>
 template<class TObject>
-inline fge::CallbackObjectFunctor<void, TObject, Types...>* CallbackHandler<Types...>::addObjectFunctor(
+inline fge::CallbackObjectFunctor<void, TObject, Types...>* BasicCallbackHandler<TMutex, Types...>::addObjectFunctor(
         typename fge::CallbackObjectFunctor<void, TObject, Types...>::CallbackFunctionObject func,
         TObject* object,
         Subscriber* subscriber)
@@ -157,123 +172,182 @@ inline fge::CallbackObjectFunctor<void, TObject, Types...>* CallbackHandler<Type
             this->add(StaticHelpers::newObjectFunctor(func, object), subscriber));
 }
 
-template<class... Types>
-void CallbackHandler<Types...>::delPtr(void* ptr)
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::delPtr(void* ptr)
 {
-    std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
-    for (auto& callee: this->g_callees)
-    {
-        if (callee._markedForDeletion)
-        {
-            continue;
-        }
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
 
+    auto callees = this->copyCallees();
+    std::erase_if(callees, [&](CalleeData const& callee) {
         if (callee._f->check(ptr))
         {
             this->detachOnce(callee._subscriber);
-            callee._markedForDeletion = true;
+            this->retire(callee);
+            return true;
         }
-    }
+        return false;
+    });
+    this->publish(std::move(callees));
 }
-template<class... Types>
-void CallbackHandler<Types...>::delSub(fge::Subscriber* subscriber)
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::delSub(fge::Subscriber* subscriber)
 {
-    std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
-    for (auto& callee: this->g_callees)
-    {
-        if (callee._markedForDeletion)
-        {
-            continue;
-        }
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
 
-        if (callee._subscriber == subscriber)
+    auto callees = this->copyCallees();
+    bool allDetached = false;
+    std::erase_if(callees, [&](CalleeData const& callee) {
+        if (allDetached || callee._subscriber != subscriber)
         {
-            if (this->detachOnce(callee._subscriber) == 0)
-            { //At this point, all subscribers are detached so we can end the loop
-                callee._markedForDeletion = true;
-                break;
-            }
-            callee._markedForDeletion = true;
+            return false;
         }
-    }
+        //When all subscribers are detached, the remaining callees are kept
+        allDetached = this->detachOnce(callee._subscriber) == 0;
+        this->retire(callee);
+        return true;
+    });
+    this->publish(std::move(callees));
 }
-template<class... Types>
-void CallbackHandler<Types...>::del(fge::CallbackBase<void, Types...>* callback)
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::del(fge::CallbackBase<void, Types...>* callback)
 {
-    std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
-    for (auto& callee: this->g_callees)
-    {
-        if (callee._markedForDeletion)
-        {
-            continue;
-        }
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
 
-        if (callee._f.get() == callback)
+    auto callees = this->copyCallees();
+    std::erase_if(callees, [&](CalleeData const& callee) {
+        if (callee._f == callback)
         {
             this->detachOnce(callee._subscriber);
-            this->g_callees._markedForDeletion = true;
+            this->retire(callee);
+            return true;
         }
-    }
+        return false;
+    });
+    this->publish(std::move(callees));
 }
 
-template<class... Types>
-void CallbackHandler<Types...>::call(Types... args)
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::call(Types... args)
 {
-    std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
+    //The lists seen here can't be destroyed before the guard is released
+    CallGuard const guard(*this);
 
-    std::size_t eraseCount = 0;
-    for (std::size_t i = 0; i < this->g_callees.size(); ++i)
+    CalleeList const* callees = this->g_callees;
+    std::size_t i = 0;
+    while (callees != nullptr && i < callees->size())
     {
-        if (this->g_callees[i]._markedForDeletion)
+        auto const& callee = (*callees)[i];
+        callee._f->call(std::forward<Types>(args)...);
+
+        //While calling, the callee can add or remove itself or others,
+        //in that case the call continue with the callees that follow it in the new list
+        CalleeList const* newCallees = this->g_callees;
+        if (newCallees == callees)
         {
-            ++eraseCount;
+            ++i;
             continue;
         }
 
-        if (eraseCount > 0)
-        { //We found a valid callee, we can erase the previous ones
-            this->g_callees.erase(this->g_callees.begin() + i - eraseCount, this->g_callees.begin() + i);
-            i -= eraseCount;
-            eraseCount = 0;
+        auto const calleeId = callee._id;
+        callees = newCallees;
+        if (callees != nullptr)
+        {
+            i = std::upper_bound(callees->begin(), callees->end(), calleeId,
+                                 [](uint64_t id, CalleeData const& data) { return id < data._id; }) -
+                callees->begin();
         }
-
-        this->g_callees[i]._f->call(std::forward<Types>(args)...);
-
-        //While calling, the callee can remove itself or others
-        //Every erased callee is flagged (mark for deletion)
-        //In order to avoid calling something that is not valid anymore
     }
 }
 
-template<class... Types>
-void CallbackHandler<Types...>::hook(fge::CallbackHandler<Types...>& handler, fge::Subscriber* subscriber)
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::hook(BasicCallbackHandler& handler, fge::Subscriber* subscriber)
 {
     if (this == &handler)
     { //Can't hook itself
         return;
     }
 
-    std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
-    this->add(new fge::CallbackLambda<Types...>(
-                      [&handler](Types... args) { handler.call(std::forward<Types>(args)...); }),
+    this->add(StaticHelpers::newLambda([&handler](Types... args) { handler.call(std::forward<Types>(args)...); }),
               subscriber);
 }
 
-template<class... Types>
-void CallbackHandler<Types...>::onDetach(fge::Subscriber* subscriber)
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::onDetach(fge::Subscriber* subscriber)
 {
-    std::scoped_lock<std::recursive_mutex> const lck(this->g_mutex);
-    for (auto& callee: this->g_callees)
-    {
-        if (callee._markedForDeletion)
-        {
-            continue;
-        }
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
 
+    auto callees = this->copyCallees();
+    std::erase_if(callees, [&](CalleeData const& callee) {
         if (callee._subscriber == subscriber)
         {
-            callee._markedForDeletion = true;
+            this->retire(callee);
+            return true;
         }
+        return false;
+    });
+    this->publish(std::move(callees));
+}
+
+template<class TMutex, class... Types>
+typename BasicCallbackHandler<TMutex, Types...>::CalleeList
+BasicCallbackHandler<TMutex, Types...>::copyCallees(std::size_t extraCapacity) const
+{
+    CalleeList copy;
+    if (this->g_calleesOwner)
+    {
+        copy.reserve(this->g_calleesOwner->size() + extraCapacity);
+        copy.assign(this->g_calleesOwner->begin(), this->g_calleesOwner->end());
+    }
+    return copy;
+}
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::publish(CalleeList&& callees)
+{
+    auto newCallees = callees.empty() ? nullptr : std::make_unique<CalleeList const>(std::move(callees));
+    this->g_callees = newCallees.get();
+
+    if (this->g_calleesOwner)
+    {
+        this->g_retiredCallees.push_back(std::move(this->g_calleesOwner));
+    }
+    this->g_calleesOwner = std::move(newCallees);
+
+    if (!this->g_retiredCallees.empty() || !this->g_retiredCallbacks.empty())
+    {
+        this->g_hasRetired = true;
+        this->reclaimRetired();
+    }
+}
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::retire(CalleeData const& callee)
+{
+    this->g_retiredCallbacks.emplace_back(callee._f);
+}
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::reclaimRetired()
+{
+    //A call starting after the new list is set can't see the retired lists,
+    //so without running call they can be destroyed
+    if (this->g_activeCalls != 0)
+    {
+        return;
+    }
+
+    //Moved out first, as destroying a callback can modify this handler
+    auto const retiredCallees = std::move(this->g_retiredCallees);
+    auto const retiredCallbacks = std::move(this->g_retiredCallbacks);
+    this->g_retiredCallees.clear();
+    this->g_retiredCallbacks.clear();
+    this->g_hasRetired = false;
+}
+template<class TMutex, class... Types>
+void BasicCallbackHandler<TMutex, Types...>::tryReclaimRetired()
+{
+    //call() never wait, when the mutex is taken the lists are reclaimed by the next call or modification
+    std::unique_lock<TMutex> const lck(this->g_mutex, std::try_to_lock);
+    if (lck.owns_lock())
+    {
+        this->reclaimRetired();
     }
 }
 
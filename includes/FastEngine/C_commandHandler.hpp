@@ -20,6 +20,7 @@
 #include "FastEngine/fge_extern.hpp"
 #include "FastEngine/C_callback.hpp"
 #include "FastEngine/C_property.hpp"
+#include "FastEngine/C_stringId.hpp"
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -46,6 +47,7 @@ using CommandStaticHelpers =
  * be called by another object with ease.
  *
  * A command is also indexed to avoid sending the command name on a network communication.
+ * Commands are looked up by their StringId, the StringId overloads avoid hashing the name on every call.
  */
 class FGE_API CommandHandler
 {
@@ -58,11 +60,13 @@ public:
     {
         inline CommandData(fge::CommandFunction cmdfunc, std::string_view name) :
                 _func(std::move(cmdfunc)),
-                _name(name)
+                _name(name),
+                _id(fge::InternString(name))
         {}
 
         fge::CommandFunction _func;
         std::string _name;
+        fge::StringId _id;
     };
 
     using CommandDataType = std::vector<CommandData>;
@@ -115,6 +119,16 @@ public:
      */
     fge::Property
     callCmd(std::string_view name, fge::Object* caller, fge::Property const& arg, fge::Scene* callerScene);
+    /**
+     * \brief Call a command by its StringId
+     *
+     * \param id The StringId of the command name
+     * \param caller The object that call the command
+     * \param arg The arguments of the command
+     * \param callerScene The scene that contains the caller
+     * \return A Property containing the result of the command
+     */
+    fge::Property callCmd(fge::StringId id, fge::Object* caller, fge::Property const& arg, fge::Scene* callerScene);
     /**
      * \brief Call a command by its index
      *
@@ -133,6 +147,7 @@ public:
      * \return The index of the command or std::numeric_limits<std::size_t>::max() if the command doesn't exist
      */
     [[nodiscard]] std::size_t getCmdIndex(std::string_view name) const;
+    [[nodiscard]] std::size_t getCmdIndex(fge::StringId id) const;
     /**
      * \brief Get the name of a command by its index
      *
@@ -148,6 +163,7 @@ public:
      * \return The command or nullptr if the command doesn't exist
      */
     [[nodiscard]] CommandData const* getCmd(std::string_view name) const;
+    [[nodiscard]] CommandData const* getCmd(fge::StringId id) const;
 
     /**
      * \brief Get the number of commands
@@ -165,7 +181,7 @@ public:
 
 private:
     CommandDataType g_cmdData;
-    std::unordered_map<std::string_view, std::size_t> g_cmdDataMap;
+    std::unordered_map<fge::StringId, std::size_t> g_cmdDataMap;
 };
 
 } // namespace fge
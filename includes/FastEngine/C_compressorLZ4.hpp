@@ -19,7 +19,9 @@
 
 #include "fge_extern.hpp"
 #include "FastEngine/C_compressor.hpp"
+#include <filesystem>
 #include <limits>
+#include <memory>
 
 /*
  * This file is using the library :
@@ -33,14 +35,68 @@
 #define FGE_COMPRESSOR_LZ4HC_DEFAULT_MAX_SIZE std::numeric_limits<uint16_t>::max()
 #define FGE_COMPRESSOR_LZ4HC_DEFAULT_COMPRESSION_LEVEL 9
 #define FGE_COMPRESSOR_LZ4_VERSION "1.10.0"
+#define FGE_COMPRESSOR_LZ4_DICTIONARY_MAX_SIZE (64 * 1024)
+#define FGE_COMPRESSOR_LZ4_DICTIONARY_NONE 0
 
 namespace fge
 {
 
+/**
+ * \class CompressorLZ4Dictionary
+ * \brief A raw LZ4 dictionary that can be shared between compressors
+ *
+ * LZ4 only uses the last 64KB of a dictionary, so bigger data are truncated from the front.
+ * The dictionary content can be trained (e.g. with "zstd --train") or simply be a concatenation
+ * of typical packets payloads. Both sides of a connection must use the exact same dictionary,
+ * this is verified with the dictionary id that is a hash of its content.
+ */
+class FGE_API CompressorLZ4Dictionary
+{
+public:
+    using Id = uint32_t;
+
+    CompressorLZ4Dictionary() = default;
+    explicit CompressorLZ4Dictionary(std::span<uint8_t const> const& data);
+
+    void loadFromMemory(std::span<uint8_t const> const& data);
+    bool loadFromFile(std::filesystem::path const& path);
+    void clear();
+
+    /**
+     * \brief Get the dictionary id
+     *
+     * \return A non-zero hash of the dictionary content or FGE_COMPRESSOR_LZ4_DICTIONARY_NONE if empty
+     */
+    [[nodiscard]] Id getId() const;
+    [[nodiscard]] std::vector<uint8_t> const& getData() const;
+    [[nodiscard]] bool isEmpty() const;
+
+private:
+    std::vector<uint8_t> g_data;
+    Id g_id{FGE_COMPRESSOR_LZ4_DICTIONARY_NONE};
+};
+
+using CompressorLZ4DictionaryPtr = std::shared_ptr<CompressorLZ4Dictionary const>;
+
+/**
+ * \class CompressorLZ4
+ * \brief LZ4 compressor with an optional dictionary
+ *
+ * The compressor keep an internal LZ4 stream context that is reset (and re-attached to the dictionary)
+ * for every compressed block, this avoid the full state initialisation cost of a fresh compression.
+ *
+ * Every block stay independently decodable, this is required as packets can be lost or reordered.
+ */
 class FGE_API CompressorLZ4 : public Compressor
 {
 public:
-    using Compressor::Compressor;
+    CompressorLZ4();
+    CompressorLZ4(CompressorLZ4 const& r);
+    CompressorLZ4(CompressorLZ4&& r) noexcept;
+    ~CompressorLZ4() override;
+
+    CompressorLZ4& operator=(CompressorLZ4 const& r) = delete;
+    CompressorLZ4& operator=(CompressorLZ4&& r) noexcept = delete;
 
     [[nodiscard]] std::optional<ErrorString> compress(std::span<uint8_t const> const& rawData) override;
     [[nodiscard]] std::optional<ErrorString> uncompress(std::span<uint8_t const> const& data) override;
@@ -48,14 +104,43 @@ public:
     void setMaxUncompressedSize(uint32_t value);
     [[nodiscard]] uint32_t getMaxUncompressedSize() const;
 
+    /**
+     * \brief Set the dictionary used for compression and decompression
+     *
+     * \param dictionary The shared dictionary or \b nullptr to disable it
+     */
+    void setDictionary(CompressorLZ4DictionaryPtr dictionary);
+    [[nodiscard]] CompressorLZ4DictionaryPtr const& getDictionary() const;
+    [[nodiscard]] CompressorLZ4Dictionary::Id getDictionaryId() const;
+
 private:
+    struct StreamContext;
+
     uint32_t g_maxUncompressedSize{FGE_COMPRESSOR_LZ4_DEFAULT_MAX_SIZE};
+    CompressorLZ4DictionaryPtr g_dictionary;
+    std::unique_ptr<StreamContext> g_streamContext;
 };
 
+/**
+ * \class CompressorLZ4HC
+ * \brief LZ4 high compression compressor with an optional dictionary
+ *
+ * The produced blocks use the same format as CompressorLZ4, so they can be decompressed by
+ * both compressors as long as the same dictionary is used.
+ *
+ * \warning The LZ4HC stream context is quite big (~512KB), it is shared by all the compressors of a thread
+ * and only allocated on the first compression made by this thread.
+ */
 class FGE_API CompressorLZ4HC : public Compressor
 {
 public:
-    using Compressor::Compressor;
+    CompressorLZ4HC();
+    CompressorLZ4HC(CompressorLZ4HC const& r);
+    CompressorLZ4HC(CompressorLZ4HC&& r) noexcept;
+    ~CompressorLZ4HC() override;
+
+    CompressorLZ4HC& operator=(CompressorLZ4HC const& r) = delete;
+    CompressorLZ4HC& operator=(CompressorLZ4HC&& r) noexcept = delete;
 
     [[nodiscard]] std::optional<ErrorString> compress(std::span<uint8_t const> const& rawData) override;
     [[nodiscard]] std::optional<ErrorString> uncompress(std::span<uint8_t const> const& data) override;
@@ -66,9 +151,19 @@ public:
     void setCompressionLevel(int value);
     [[nodiscard]] int getCompressionLevel() const;
 
+    /**
+     * \brief Set the dictionary used for compression and decompression
+     *
+     * \param dictionary The shared dictionary or \b nullptr to disable it
+     */
+    void setDictionary(CompressorLZ4DictionaryPtr dictionary);
+    [[nodiscard]] CompressorLZ4DictionaryPtr const& getDictionary() const;
+    [[nodiscard]] CompressorLZ4Dictionary::Id getDictionaryId() const;
+
 private:
     uint32_t g_maxUncompressedSize{FGE_COMPRESSOR_LZ4HC_DEFAULT_MAX_SIZE};
     int g_compressionLevel{FGE_COMPRESSOR_LZ4HC_DEFAULT_COMPRESSION_LEVEL};
+    CompressorLZ4DictionaryPtr g_dictionary;
 };
 
 } // namespace fge
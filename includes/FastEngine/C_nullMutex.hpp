@@ -0,0 +1,38 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _FGE_C_NULLMUTEX_HPP_INCLUDED
+#define _FGE_C_NULLMUTEX_HPP_INCLUDED
+
+namespace fge
+{
+
+/**
+ * \struct NullMutex
+ * \ingroup utility
+ * \brief A mutex that does nothing, for instances that are never shared between threads
+ */
+struct NullMutex
+{
+    constexpr void lock() {}
+    constexpr void unlock() {}
+    [[nodiscard]] constexpr bool try_lock() { return true; }
+};
+
+} // namespace fge
+
+#endif // _FGE_C_NULLMUTEX_HPP_INCLUDED
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _FGE_C_OBJECTPOOL_HPP_INCLUDED
+#define _FGE_C_OBJECTPOOL_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <typeindex>
+#include <vector>
+
+#define FGE_OBJECTPOOL_DEFAULT_BLOCKS_PER_CHUNK 256
+
+/**
+ * \brief Allocate every instance of an Object class from a FixedSizePool
+ * \ingroup objectControl
+ *
+ * This macro must be placed in the public part of the class, it declares the class operator new/delete.
+ * Every allocation with the exact size of the class (new objClass, std::make_unique, reg::Stamp::createNew,
+ * Object::copy ...) is then served by the pool of the class. A derived class with a different size
+ * fallback to the global operator new/delete.
+ */
+#define FGE_OBJ_POOLED(objClass)                                                                                       \
+    static void* operator new(std::size_t size)                                                                        \
+    {                                                                                                                  \
+        return size == sizeof(objClass) ? fge::GetObjectPoolOf<objClass>().allocate() : ::operator new(size);         \
+    }                                                                                                                  \
+    static void operator delete(void* ptr, std::size_t size)                                                           \
+    {                                                                                                                  \
+        if (size == sizeof(objClass))                                                                                  \
+        {                                                                                                              \
+            fge::GetObjectPoolOf<objClass>().deallocate(ptr);                                                          \
+        }                                                                                                              \
+        else                                                                                                           \
+        {                                                                                                              \
+            ::operator delete(ptr);                                                                                    \
+        }                                                                                                              \
+    }
+
+namespace fge
+{
+
+/**
+ * \class FixedSizePool
+ * \ingroup objectControl
+ * \brief A thread-safe pool of fixed size memory blocks
+ *
+ * Blocks are allocated by chunks and recycled with a free list, the memory is only given back to the system
+ * when the pool is destroyed.
+ */
+class FGE_API FixedSizePool
+{
+public:
+    FixedSizePool(std::size_t blockSize,
+                  std::size_t blockAlignment,
+                  std::size_t blocksPerChunk = FGE_OBJECTPOOL_DEFAULT_BLOCKS_PER_CHUNK);
+    FixedSizePool(FixedSizePool const& r) = delete;
+    FixedSizePool(FixedSizePool&& r) noexcept = delete;
+    ~FixedSizePool();
+
+    FixedSizePool& operator=(FixedSizePool const& r) = delete;
+    FixedSizePool& operator=(FixedSizePool&& r) noexcept = delete;
+
+    [[nodiscard]] void* allocate();
+    void deallocate(void* ptr);
+
+    [[nodiscard]] std::size_t getBlockSize() const;
+    [[nodiscard]] std::size_t getUsedBlockCount() const;
+    [[nodiscard]] std::size_t getCapacity() const;
+    /**
+     * \brief Get the number of chunks allocated from the system
+     *
+     * \return The chunk count
+     */
+    [[nodiscard]] std::size_t getChunkCount() const;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* _next;
+    };
+
+    void allocateChunk();
+
+    std::size_t g_blockSize;
+    std::size_t g_blockAlignment;
+    std::size_t g_blocksPerChunk;
+
+    mutable std::mutex g_mutex;
+    FreeBlock* g_freeList{nullptr};
+    std::vector<void*> g_chunks;
+    std::size_t g_usedBlockCount{0};
+};
+
+/**
+ * \ingroup objectControl
+ * \brief Get the pool of a type
+ *
+ * Pools are owned by the library and never destroyed, so pooled objects can safely be
+ * deleted during the static destruction.
+ *
+ * \param type The type of the pooled objects
+ * \param blockSize The size of the type
+ * \param blockAlignment The alignment of the type
+ * \return The pool of the type
+ */
+FGE_API fge::FixedSizePool& GetObjectPool(std::type_index type, std::size_t blockSize, std::size_t blockAlignment);
+
+template<class T>
+inline fge::FixedSizePool& GetObjectPoolOf()
+{
+    static fge::FixedSizePool& pool = fge::GetObjectPool(typeid(T), sizeof(T), alignof(T));
+    return pool;
+}
+
+/**
+ * \ingroup objectControl
+ * \brief Get the thread-safe memory resource used to allocate the ObjectData
+ *
+ * The resource is never destroyed, as an ObjectData can outlive its Scene.
+ *
+ * \return The memory resource
+ */
+FGE_API std::pmr::memory_resource* GetObjectDataMemoryResource();
+
+} // namespace fge
+
+#endif // _FGE_C_OBJECTPOOL_HPP_INCLUDED
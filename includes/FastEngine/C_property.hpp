@@ -19,11 +19,15 @@
 
 #include "FastEngine/fge_extern.hpp"
 #include "FastEngine/extra/extra_string.hpp"
+#include <cstddef>
+#include <new>
 #include <optional>
 #include <string>
 #include <typeinfo>
 #include <vector>
 
+#define FGE_PROPERTY_INLINE_BUFFER_SIZE (sizeof(void*) * 4)
+
 namespace fge
 {
 
@@ -46,7 +50,11 @@ class PropertyClassWrapperType;
  *
  * This class can store any type of data.
  * Integer is converted to PintType or PuintType so in order to get the value you need to use the defined types.
- * class oder than the basic type are stored as a pointer to a PropertyClassWrapper.
+ * class oder than the basic type are stored in a PropertyClassWrapper.
+ *
+ * Strings and small classes (like a Vector2f or a ParrayType) are stored inside the Property itself,
+ * only a class that do not fit in FGE_PROPERTY_INLINE_BUFFER_SIZE bytes (with its wrapper) or that
+ * is not nothrow move constructible is allocated on the heap.
  *
  * This class also easly enable to store an array of Property.
  */
@@ -84,23 +92,21 @@ public:
 
         void* _ptr;
 
-        constexpr void setClassWrapper(fge::PropertyClassWrapper* val) { this->_ptr = val; }
-        [[nodiscard]] constexpr fge::PropertyClassWrapper* getClassWrapper() const
-        {
-            return static_cast<fge::PropertyClassWrapper*>(this->_ptr);
-        }
-        template<class T>
-        [[nodiscard]] constexpr fge::PropertyClassWrapperType<T>* getClassWrapper() const
-        {
-            return static_cast<fge::PropertyClassWrapperType<T>*>(this->_ptr);
-        }
-        [[nodiscard]] constexpr fge::PropertyClassWrapperType<fge::ParrayType>* getArray() const
-        {
-            return static_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->_ptr);
-        }
-        [[nodiscard]] constexpr std::string* getString() const { return static_cast<std::string*>(this->_ptr); }
+        alignas(void*) std::byte _buffer[FGE_PROPERTY_INLINE_BUFFER_SIZE];
     };
 
+    /**
+     * \brief Check if a class type is stored inside the Property buffer
+     *
+     * \tparam T The class type
+     */
+    template<class T>
+    static constexpr bool IsClassStoredInline =
+            sizeof(fge::PropertyClassWrapperType<T>) <= FGE_PROPERTY_INLINE_BUFFER_SIZE &&
+            alignof(fge::PropertyClassWrapperType<T>) <= alignof(void*) && std::is_nothrow_move_constructible_v<T>;
+    static constexpr bool IsStringStoredInline =
+            sizeof(std::string) <= FGE_PROPERTY_INLINE_BUFFER_SIZE && alignof(std::string) <= alignof(void*);
+
     Property() = default;
 
     //Copy/Move constructor
@@ -196,10 +202,25 @@ public:
     void setModifiedFlag(bool flag);
 
 private:
-    Types g_type{Types::PTYPE_NULL};
+    [[nodiscard]] std::string* getString() const;
+    template<class... TArgs>
+    std::string& emplaceString(TArgs&&... args);
+
+    [[nodiscard]] fge::PropertyClassWrapper* getClassWrapper() const;
+    template<class T>
+    [[nodiscard]] fge::PropertyClassWrapperType<T>* getClassWrapper() const;
+    [[nodiscard]] fge::PropertyClassWrapperType<fge::ParrayType>* getArray() const;
+    template<class T, class... TArgs>
+    T& emplaceClass(TArgs&&... args);
+    void copyClassFrom(fge::PropertyClassWrapper const* wrapper);
+    void moveFrom(fge::Property& val);
+
     Data g_data{};
+    std::type_info const* g_classType{nullptr}; ///< Avoid a virtual call when checking the type of a class
+    Types g_type{Types::PTYPE_NULL};
     bool g_isSigned{};
     bool g_isModified{false};
+    bool g_isInline{false}; ///< The class wrapper is stored in the buffer
 };
 
 class PropertyClassWrapper
@@ -213,6 +234,20 @@ public:
     [[nodiscard]] virtual std::string toString() const = 0;
 
     [[nodiscard]] virtual fge::PropertyClassWrapper* copy() const = 0;
+    /**
+     * \brief Copy the wrapper inside a Property buffer if the type is small enough, on the heap otherwise
+     *
+     * \param buffer A buffer of FGE_PROPERTY_INLINE_BUFFER_SIZE bytes
+     * \return The new wrapper, equal to buffer if it was constructed inside
+     */
+    [[nodiscard]] virtual fge::PropertyClassWrapper* copy(void* buffer) const = 0;
+    /**
+     * \brief Move an inline wrapper into another Property buffer
+     *
+     * \param buffer A buffer of FGE_PROPERTY_INLINE_BUFFER_SIZE bytes
+     * \return The new wrapper
+     */
+    virtual fge::PropertyClassWrapper* move(void* buffer) noexcept = 0;
 
     virtual bool tryToCopy(fge::PropertyClassWrapper const* val) = 0;
 
@@ -260,6 +295,8 @@ public:
     [[nodiscard]] std::string toString() const override;
 
     [[nodiscard]] fge::PropertyClassWrapper* copy() const override;
+    [[nodiscard]] fge::PropertyClassWrapper* copy(void* buffer) const override;
+    fge::PropertyClassWrapper* move(void* buffer) noexcept override;
 
     bool tryToCopy(fge::PropertyClassWrapper const* val) override;
 
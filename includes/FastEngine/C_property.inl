@@ -53,8 +53,7 @@ Property::Property(T&& val) :
     }
     else if constexpr (std::is_same_v<TT, std::string>)
     {
-        this->g_type = Types::PTYPE_STRING;
-        this->g_data._ptr = new std::string(std::forward<T>(val));
+        this->emplaceString(std::forward<T>(val));
     }
     else if constexpr (std::is_pointer_v<TT>)
     {
@@ -63,8 +62,7 @@ Property::Property(T&& val) :
     }
     else
     {
-        this->g_type = Types::PTYPE_CLASS;
-        this->g_data.setClassWrapper(new fge::PropertyClassWrapperType<TT>(std::forward<T>(val)));
+        this->emplaceClass<TT>(std::forward<T>(val));
     }
 }
 
@@ -125,11 +123,10 @@ T& Property::setType()
         if (this->g_type != Types::PTYPE_STRING)
         {
             this->clear();
-            this->g_type = Types::PTYPE_STRING;
-            this->g_data._ptr = new std::string();
+            return this->emplaceString();
         }
 
-        return *this->g_data.getString();
+        return *this->getString();
     }
     else if constexpr (std::is_pointer_v<T>)
     {
@@ -148,20 +145,16 @@ T& Property::setType()
         if (this->g_type != Types::PTYPE_CLASS)
         {
             this->clear();
-            this->g_type = Types::PTYPE_CLASS;
-            this->g_data.setClassWrapper(new fge::PropertyClassWrapperType<TT>());
-            return this->g_data.getClassWrapper<TT>()->_data;
+            return this->emplaceClass<TT>();
         }
 
-        if (this->g_data.getClassWrapper()->getType() == typeid(T))
+        if (*this->g_classType == typeid(T))
         {
-            return this->g_data.getClassWrapper<TT>()->_data;
+            return this->getClassWrapper<TT>()->_data;
         }
 
         this->clear();
-        this->g_type = Types::PTYPE_CLASS;
-        this->g_data.setClassWrapper(new fge::PropertyClassWrapperType<TT>());
-        return this->g_data.getClassWrapper<TT>()->_data;
+        return this->emplaceClass<TT>();
     }
 }
 
@@ -195,7 +188,7 @@ bool Property::isType() const
     {
         if (this->g_type == Types::PTYPE_CLASS)
         {
-            return this->g_data.getClassWrapper()->getType() == typeid(T);
+            return *this->g_classType == typeid(T);
         }
         return false;
     }
@@ -276,14 +269,13 @@ bool Property::set(T&& val)
         {
             if (this->g_type == Types::PTYPE_NULL)
             {
-                this->g_type = Types::PTYPE_STRING;
-                this->g_data._ptr = new std::string(std::forward<T>(val));
+                this->emplaceString(std::forward<T>(val));
                 return true;
             }
             return false;
         }
 
-        *this->g_data.getString() = std::forward<T>(val);
+        *this->getString() = std::forward<T>(val);
         return true;
     }
     else if constexpr (std::is_pointer_v<TT>)
@@ -309,16 +301,15 @@ bool Property::set(T&& val)
         {
             if (this->g_type == Types::PTYPE_NULL)
             {
-                this->g_type = Types::PTYPE_CLASS;
-                this->g_data.setClassWrapper(new fge::PropertyClassWrapperType<TT>(std::forward<T>(val)));
+                this->emplaceClass<TT>(std::forward<T>(val));
                 return true;
             }
             return false;
         }
 
-        if (this->g_data.getClassWrapper()->getType() == typeid(TT))
+        if (*this->g_classType == typeid(TT))
         {
-            this->g_data.getClassWrapper<TT>()->_data = std::forward<T>(val);
+            this->getClassWrapper<TT>()->_data = std::forward<T>(val);
             return true;
         }
         return false;
@@ -416,7 +407,7 @@ bool Property::get(T& val) const
             return false;
         }
 
-        val = *this->g_data.getString();
+        val = *this->getString();
         return true;
     }
     else if constexpr (std::is_same_v<T, char const*>)
@@ -426,7 +417,7 @@ bool Property::get(T& val) const
             return false;
         }
 
-        val = this->g_data.getString()->data();
+        val = this->getString()->data();
         return true;
     }
     else if constexpr (std::is_pointer_v<T>)
@@ -443,10 +434,10 @@ bool Property::get(T& val) const
     {
         if (this->g_type == Types::PTYPE_CLASS)
         {
-            if (this->g_data.getClassWrapper()->getType() == typeid(T))
+            if (*this->g_classType == typeid(T))
             {
                 using TT = remove_cvref_t<T>;
-                val = this->g_data.getClassWrapper<TT>()->_data;
+                val = this->getClassWrapper<TT>()->_data;
                 return true;
             }
         }
@@ -533,7 +524,7 @@ std::optional<T> Property::get() const
             return std::nullopt;
         }
 
-        return *this->g_data.getString();
+        return *this->getString();
     }
     else if constexpr (std::is_same_v<T, char const*>)
     {
@@ -542,7 +533,7 @@ std::optional<T> Property::get() const
             return std::nullopt;
         }
 
-        return this->g_data.getString()->data();
+        return this->getString()->data();
     }
     else if constexpr (std::is_pointer_v<T>)
     {
@@ -557,10 +548,10 @@ std::optional<T> Property::get() const
     {
         if (this->g_type == Types::PTYPE_CLASS)
         {
-            if (this->g_data.getClassWrapper()->getType() == typeid(T))
+            if (*this->g_classType == typeid(T))
             {
                 using TT = remove_cvref_t<T>;
-                return this->g_data.getClassWrapper<TT>()->_data;
+                return this->getClassWrapper<TT>()->_data;
             }
         }
 
@@ -620,7 +611,7 @@ T* Property::getPtr()
             return nullptr;
         }
 
-        return this->g_data.getString();
+        return this->getString();
     }
     else if constexpr (std::is_pointer_v<T>)
     {
@@ -635,10 +626,10 @@ T* Property::getPtr()
     {
         if (this->g_type == Types::PTYPE_CLASS)
         {
-            if (this->g_data.getClassWrapper()->getType() == typeid(T))
+            if (*this->g_classType == typeid(T))
             {
                 using TT = remove_cvref_t<T>;
-                return &this->g_data.getClassWrapper<TT>()->_data;
+                return &this->getClassWrapper<TT>()->_data;
             }
         }
 
@@ -662,11 +653,11 @@ T const* Property::getPtr() const
 
         if constexpr (std::is_signed_v<T>)
         {
-            return static_cast<T*>(&this->g_data._i);
+            return static_cast<T const*>(&this->g_data._i);
         }
         else
         {
-            return static_cast<T*>(&this->g_data._u);
+            return static_cast<T const*>(&this->g_data._u);
         }
     }
     else if constexpr (std::is_floating_point_v<T>)
@@ -697,7 +688,7 @@ T const* Property::getPtr() const
             return nullptr;
         }
 
-        return this->g_data.getString();
+        return this->getString();
     }
     else if constexpr (std::is_pointer_v<T>)
     {
@@ -712,10 +703,10 @@ T const* Property::getPtr() const
     {
         if (this->g_type == Types::PTYPE_CLASS)
         {
-            if (this->g_data.getClassWrapper()->getType() == typeid(T))
+            if (*this->g_classType == typeid(T))
             {
                 using TT = remove_cvref_t<T>;
-                return &this->g_data.getClassWrapper<TT>()->_data;
+                return &this->getClassWrapper<TT>()->_data;
             }
         }
 
@@ -728,9 +719,9 @@ bool Property::pushType()
 {
     if (this->g_type == Types::PTYPE_CLASS)
     {
-        if (this->g_data.getClassWrapper()->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            this->g_data.getArray()->_data.emplace_back().setType<T>();
+            this->getArray()->_data.emplace_back().setType<T>();
             return true;
         }
     }
@@ -742,11 +733,11 @@ bool Property::getData(std::size_t index, T& val) const
 {
     if (this->g_type == Types::PTYPE_CLASS)
     {
-        if (this->g_data.getClassWrapper()->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            if (this->g_data.getArray()->_data.size() > index)
+            if (this->getArray()->_data.size() > index)
             {
-                return this->g_data.getArray()->_data[index].get<T>(val);
+                return this->getArray()->_data[index].get<T>(val);
             }
         }
     }
@@ -757,11 +748,11 @@ T* Property::getDataPtr(std::size_t index)
 {
     if (this->g_type == Types::PTYPE_CLASS)
     {
-        if (this->g_data.getClassWrapper()->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            if (this->g_data.getArray()->_data.size() > index)
+            if (this->getArray()->_data.size() > index)
             {
-                return this->g_data.getArray()->_data[index].getPtr<T>();
+                return this->getArray()->_data[index].getPtr<T>();
             }
         }
     }
@@ -772,17 +763,66 @@ T const* Property::getDataPtr(std::size_t index) const
 {
     if (this->g_type == Types::PTYPE_CLASS)
     {
-        if (this->g_data.getClassWrapper()->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            if (this->g_data.getArray()->_data.size() > index)
+            if (this->getArray()->_data.size() > index)
             {
-                return this->g_data.getArray()->_data[index].getPtr<T>();
+                return this->getArray()->_data[index].getPtr<T>();
             }
         }
     }
     return nullptr;
 }
 
+template<class... TArgs>
+std::string& Property::emplaceString(TArgs&&... args)
+{
+    this->g_type = Types::PTYPE_STRING;
+    if constexpr (IsStringStoredInline)
+    {
+        return *new (this->g_data._buffer) std::string(std::forward<TArgs>(args)...);
+    }
+    else
+    {
+        auto* str = new std::string(std::forward<TArgs>(args)...);
+        this->g_data._ptr = str;
+        return *str;
+    }
+}
+
+template<class T>
+fge::PropertyClassWrapperType<T>* Property::getClassWrapper() const
+{
+    //The storage of a class is known at compile-time, no need to check g_isInline
+    if constexpr (IsClassStoredInline<T>)
+    {
+        return std::launder(
+                reinterpret_cast<fge::PropertyClassWrapperType<T>*>(const_cast<std::byte*>(this->g_data._buffer)));
+    }
+    else
+    {
+        return static_cast<fge::PropertyClassWrapperType<T>*>(this->g_data._ptr);
+    }
+}
+template<class T, class... TArgs>
+T& Property::emplaceClass(TArgs&&... args)
+{
+    this->g_type = Types::PTYPE_CLASS;
+    this->g_classType = &typeid(T);
+    if constexpr (IsClassStoredInline<T>)
+    {
+        this->g_isInline = true;
+        return (new (this->g_data._buffer) fge::PropertyClassWrapperType<T>(std::forward<TArgs>(args)...))->_data;
+    }
+    else
+    {
+        this->g_isInline = false;
+        auto* wrapper = new fge::PropertyClassWrapperType<T>(std::forward<TArgs>(args)...);
+        this->g_data._ptr = wrapper;
+        return wrapper->_data;
+    }
+}
+
 //PropertyClassWrapperType
 
 template<class T>
@@ -793,7 +833,7 @@ PropertyClassWrapperType<T>::PropertyClassWrapperType(T const& val) :
 template<class T>
 template<typename>
 PropertyClassWrapperType<T>::PropertyClassWrapperType(T&& val) noexcept :
-        _data(val)
+        _data(std::move(val))
 {}
 
 template<class T>
@@ -820,6 +860,30 @@ fge::PropertyClassWrapper* PropertyClassWrapperType<T>::copy() const
 {
     return static_cast<fge::PropertyClassWrapper*>(new fge::PropertyClassWrapperType<T>(this->_data));
 }
+template<class T>
+fge::PropertyClassWrapper* PropertyClassWrapperType<T>::copy(void* buffer) const
+{
+    if constexpr (fge::Property::IsClassStoredInline<T>)
+    {
+        return new (buffer) fge::PropertyClassWrapperType<T>(this->_data);
+    }
+    else
+    {
+        return this->copy();
+    }
+}
+template<class T>
+fge::PropertyClassWrapper* PropertyClassWrapperType<T>::move(void* buffer) noexcept
+{
+    if constexpr (fge::Property::IsClassStoredInline<T>)
+    {
+        return new (buffer) fge::PropertyClassWrapperType<T>(std::move(this->_data));
+    }
+    else
+    { //A heap wrapper is moved by moving its pointer
+        return nullptr;
+    }
+}
 
 template<class T>
 bool PropertyClassWrapperType<T>::tryToCopy(fge::PropertyClassWrapper const* val)
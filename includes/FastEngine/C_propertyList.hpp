@@ -18,8 +18,16 @@
 #define _FGE_C_PROPERTYLIST_HPP_INCLUDED
 
 #include "FastEngine/C_property.hpp"
-#include <string>
-#include <unordered_map>
+#include "FastEngine/C_stringId.hpp"
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#define FGE_PROPERTYLIST_MIN_SLOT_COUNT 8
 
 namespace fge
 {
@@ -29,56 +37,137 @@ namespace fge
  * \ingroup utility
  * \brief A class that map a string to a Property
  *
+ * Keys are stored as StringId, every method have an overload taking a StringId in order to avoid
+ * hashing the key on hot paths. Inserting a new property by string intern its key.
+ *
+ * The lookup is done with a flat open addressing table (linear probing) of keys and entry indices, so a lookup
+ * is a few integer comparisons in a contiguous array. The entries themselves are stored in a deque and recycled
+ * when removed, a reference to a Property stays valid until the property is removed.
+ *
  * \see Property
  */
 class PropertyList
 {
 public:
-    using DataType = std::unordered_map<std::string, fge::Property>;
+    using EntryType = std::pair<fge::StringId const, fge::Property>;
+    using DataType = std::deque<EntryType>;
+
+    /**
+     * \class BasicIterator
+     * \brief A forward iterator over the properties, removed entries are skipped
+     */
+    template<class TEntry, class TDataIterator>
+    class BasicIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = EntryType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = TEntry*;
+        using reference = TEntry&;
+
+        BasicIterator() = default;
+        inline BasicIterator(TDataIterator it, TDataIterator end);
+
+        [[nodiscard]] inline reference operator*() const;
+        [[nodiscard]] inline pointer operator->() const;
+
+        inline BasicIterator& operator++();
+        inline BasicIterator operator++(int);
+
+        [[nodiscard]] inline bool operator==(BasicIterator const& r) const;
+
+    private:
+        inline void skipFreeEntries();
+
+        TDataIterator g_it;
+        TDataIterator g_end;
+    };
+
+    using iterator = BasicIterator<EntryType, DataType::iterator>;
+    using const_iterator = BasicIterator<EntryType const, DataType::const_iterator>;
 
     inline PropertyList() = default;
     inline PropertyList(PropertyList const& r) = default;
     inline PropertyList(PropertyList&& r) noexcept = default;
     inline ~PropertyList() = default;
 
-    inline PropertyList& operator=(PropertyList const& r) = default;
+    inline PropertyList& operator=(PropertyList const& r);
     inline PropertyList& operator=(PropertyList&& r) noexcept = default;
 
     inline void delAllProperties();
-    inline void delProperty(std::string const& key);
+    inline void delProperty(std::string_view key);
+    inline void delProperty(fge::StringId key);
 
     template<class T>
-    [[nodiscard]] inline bool findProperty(std::string const& key) const;
-    [[nodiscard]] inline bool findProperty(std::string const& key) const;
+    [[nodiscard]] inline bool findProperty(std::string_view key) const;
+    template<class T>
+    [[nodiscard]] inline bool findProperty(fge::StringId key) const;
+    [[nodiscard]] inline bool findProperty(std::string_view key) const;
+    [[nodiscard]] inline bool findProperty(fge::StringId key) const;
 
     template<class T>
-    inline void setProperty(std::string const& key, T&& value);
+    inline void setProperty(std::string_view key, T&& value);
+    template<class T>
+    inline void setProperty(fge::StringId key, T&& value);
 
     template<class T>
-    [[nodiscard]] inline T* getProperty(std::string const& key);
+    [[nodiscard]] inline T* getProperty(std::string_view key);
+    template<class T>
+    [[nodiscard]] inline T* getProperty(fge::StringId key);
+    template<class T>
+    [[nodiscard]] inline T const* getProperty(std::string_view key) const;
     template<class T>
-    [[nodiscard]] inline T const* getProperty(std::string const& key) const;
+    [[nodiscard]] inline T const* getProperty(fge::StringId key) const;
     template<class T, class TDefault>
-    [[nodiscard]] inline T& getProperty(std::string const& key, TDefault&& defaultValue);
+    [[nodiscard]] inline T& getProperty(std::string_view key, TDefault&& defaultValue);
+    template<class T, class TDefault>
+    [[nodiscard]] inline T& getProperty(fge::StringId key, TDefault&& defaultValue);
 
-    [[nodiscard]] inline fge::Property& getProperty(std::string const& key);
-    [[nodiscard]] inline fge::Property const* getProperty(std::string const& key) const;
+    [[nodiscard]] inline fge::Property& getProperty(std::string_view key);
+    [[nodiscard]] inline fge::Property& getProperty(fge::StringId key);
+    [[nodiscard]] inline fge::Property const* getProperty(std::string_view key) const;
+    [[nodiscard]] inline fge::Property const* getProperty(fge::StringId key) const;
 
-    [[nodiscard]] inline fge::Property& operator[](std::string const& key);
-    [[nodiscard]] inline fge::Property const* operator[](std::string const& key) const;
+    [[nodiscard]] inline fge::Property& operator[](std::string_view key);
+    [[nodiscard]] inline fge::Property& operator[](fge::StringId key);
+    [[nodiscard]] inline fge::Property const* operator[](std::string_view key) const;
+    [[nodiscard]] inline fge::Property const* operator[](fge::StringId key) const;
 
     [[nodiscard]] inline std::size_t count() const;
 
-    [[nodiscard]] inline DataType::iterator begin();
-    [[nodiscard]] inline DataType::iterator end();
-    [[nodiscard]] inline DataType::const_iterator begin() const;
-    [[nodiscard]] inline DataType::const_iterator end() const;
+    [[nodiscard]] inline iterator begin();
+    [[nodiscard]] inline iterator end();
+    [[nodiscard]] inline const_iterator begin() const;
+    [[nodiscard]] inline const_iterator end() const;
 
     inline void clearAllModificationFlags();
     [[nodiscard]] inline std::size_t countAllModificationFlags() const;
 
 private:
+    static constexpr uint32_t EmptySlot = UINT32_MAX;
+
+    struct Slot
+    {
+        fge::StringId::Value _key{0};
+        uint32_t _index{EmptySlot};
+    };
+
+    [[nodiscard]] static inline std::size_t GetIdealSlot(fge::StringId::Value key, std::size_t mask);
+
+    [[nodiscard]] inline fge::Property* find(fge::StringId key);
+    [[nodiscard]] inline fge::Property const* find(fge::StringId key) const;
+    [[nodiscard]] inline std::size_t findSlot(fge::StringId key) const;
+    [[nodiscard]] inline fge::Property& insert(fge::StringId key);
+    [[nodiscard]] inline fge::Property& getOrInsert(std::string_view key);
+    [[nodiscard]] inline fge::Property& getOrInsert(fge::StringId key);
+    inline void erase(fge::StringId key);
+    inline void rehash(std::size_t slotCount);
+
     DataType g_data;
+    std::vector<Slot> g_slots;
+    std::vector<uint32_t> g_freeEntries;
+    std::size_t g_count{0};
 };
 
 } // namespace fge
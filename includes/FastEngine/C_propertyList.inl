@@ -17,55 +17,153 @@
 namespace fge
 {
 
+//BasicIterator
+
+template<class TEntry, class TDataIterator>
+PropertyList::BasicIterator<TEntry, TDataIterator>::BasicIterator(TDataIterator it, TDataIterator end) :
+        g_it(it),
+        g_end(end)
+{
+    this->skipFreeEntries();
+}
+
+template<class TEntry, class TDataIterator>
+typename PropertyList::BasicIterator<TEntry, TDataIterator>::reference
+PropertyList::BasicIterator<TEntry, TDataIterator>::operator*() const
+{
+    return *this->g_it;
+}
+template<class TEntry, class TDataIterator>
+typename PropertyList::BasicIterator<TEntry, TDataIterator>::pointer
+PropertyList::BasicIterator<TEntry, TDataIterator>::operator->() const
+{
+    return &(*this->g_it);
+}
+
+template<class TEntry, class TDataIterator>
+PropertyList::BasicIterator<TEntry, TDataIterator>& PropertyList::BasicIterator<TEntry, TDataIterator>::operator++()
+{
+    ++this->g_it;
+    this->skipFreeEntries();
+    return *this;
+}
+template<class TEntry, class TDataIterator>
+PropertyList::BasicIterator<TEntry, TDataIterator> PropertyList::BasicIterator<TEntry, TDataIterator>::operator++(int)
+{
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+template<class TEntry, class TDataIterator>
+bool PropertyList::BasicIterator<TEntry, TDataIterator>::operator==(BasicIterator const& r) const
+{
+    return this->g_it == r.g_it;
+}
+
+template<class TEntry, class TDataIterator>
+void PropertyList::BasicIterator<TEntry, TDataIterator>::skipFreeEntries()
+{
+    while (this->g_it != this->g_end && !this->g_it->first.isValid())
+    {
+        ++this->g_it;
+    }
+}
+
+//PropertyList
+
+PropertyList& PropertyList::operator=(PropertyList const& r)
+{
+    if (this != &r)
+    {
+        //Entries have a const key and can't be assigned, so the list is rebuilt
+        *this = PropertyList{r};
+    }
+    return *this;
+}
+
 void PropertyList::delAllProperties()
 {
     this->g_data.clear();
+    this->g_slots.clear();
+    this->g_freeEntries.clear();
+    this->g_count = 0;
+}
+void PropertyList::delProperty(std::string_view key)
+{
+    this->erase(fge::StringId{key});
 }
-void PropertyList::delProperty(std::string const& key)
+void PropertyList::delProperty(fge::StringId key)
 {
-    this->g_data.erase(key);
+    this->erase(key);
 }
 
 template<class T>
-bool PropertyList::findProperty(std::string const& key) const
+bool PropertyList::findProperty(std::string_view key) const
 {
-    auto it = this->g_data.find(key);
-    if (it != this->g_data.cend())
-    {
-        return it->second.isType<T>();
-    }
-    return false;
+    return this->findProperty<T>(fge::StringId{key});
 }
-bool PropertyList::findProperty(std::string const& key) const
+template<class T>
+bool PropertyList::findProperty(fge::StringId key) const
 {
-    return this->g_data.find(key) != this->g_data.cend();
+    auto const* property = this->find(key);
+    return property != nullptr && property->isType<T>();
+}
+bool PropertyList::findProperty(std::string_view key) const
+{
+    return this->findProperty(fge::StringId{key});
+}
+bool PropertyList::findProperty(fge::StringId key) const
+{
+    return this->find(key) != nullptr;
 }
 
 template<class T>
-void PropertyList::setProperty(std::string const& key, T&& value)
+void PropertyList::setProperty(std::string_view key, T&& value)
 {
-    this->g_data[key] = std::forward<T>(value);
+    this->getOrInsert(key) = std::forward<T>(value);
+}
+template<class T>
+void PropertyList::setProperty(fge::StringId key, T&& value)
+{
+    this->getOrInsert(key) = std::forward<T>(value);
 }
 
 template<class T>
-T* PropertyList::getProperty(std::string const& key)
+T* PropertyList::getProperty(std::string_view key)
+{
+    return this->getOrInsert(key).getPtr<T>();
+}
+template<class T>
+T* PropertyList::getProperty(fge::StringId key)
+{
+    return this->getOrInsert(key).getPtr<T>();
+}
+template<class T>
+T const* PropertyList::getProperty(std::string_view key) const
 {
-    return this->g_data[key].getPtr<T>();
+    return this->getProperty<T>(fge::StringId{key});
 }
 template<class T>
-T const* PropertyList::getProperty(std::string const& key) const
+T const* PropertyList::getProperty(fge::StringId key) const
+{
+    auto const* property = this->find(key);
+    return property != nullptr ? property->getPtr<T>() : nullptr;
+}
+template<class T, class TDefault>
+T& PropertyList::getProperty(std::string_view key, TDefault&& defaultValue)
 {
-    auto it = this->g_data.find(key);
-    if (it != this->g_data.cend())
+    auto& data = this->getOrInsert(key);
+    if (!data.isType<T>())
     {
-        return it->second.getPtr<T>();
+        return data.setType<T>() = std::forward<TDefault>(defaultValue);
     }
-    return nullptr;
+    return data.get<T>();
 }
 template<class T, class TDefault>
-T& PropertyList::getProperty(std::string const& key, TDefault&& defaultValue)
+T& PropertyList::getProperty(fge::StringId key, TDefault&& defaultValue)
 {
-    auto& data = this->g_data[key];
+    auto& data = this->getOrInsert(key);
     if (!data.isType<T>())
     {
         return data.setType<T>() = std::forward<TDefault>(defaultValue);
@@ -73,59 +171,65 @@ T& PropertyList::getProperty(std::string const& key, TDefault&& defaultValue)
     return data.get<T>();
 }
 
-fge::Property& PropertyList::getProperty(std::string const& key)
+fge::Property& PropertyList::getProperty(std::string_view key)
 {
-    return this->g_data[key];
+    return this->getOrInsert(key);
 }
-fge::Property const* PropertyList::getProperty(std::string const& key) const
+fge::Property& PropertyList::getProperty(fge::StringId key)
 {
-    auto it = this->g_data.find(key);
-    if (it != this->g_data.cend())
-    {
-        return &it->second;
-    }
-    return nullptr;
+    return this->getOrInsert(key);
+}
+fge::Property const* PropertyList::getProperty(std::string_view key) const
+{
+    return this->find(fge::StringId{key});
+}
+fge::Property const* PropertyList::getProperty(fge::StringId key) const
+{
+    return this->find(key);
 }
 
-fge::Property& PropertyList::operator[](std::string const& key)
+fge::Property& PropertyList::operator[](std::string_view key)
 {
-    return this->g_data[key];
+    return this->getOrInsert(key);
 }
-fge::Property const* PropertyList::operator[](std::string const& key) const
+fge::Property& PropertyList::operator[](fge::StringId key)
 {
-    auto it = this->g_data.find(key);
-    if (it != this->g_data.cend())
-    {
-        return &it->second;
-    }
-    return nullptr;
+    return this->getOrInsert(key);
+}
+fge::Property const* PropertyList::operator[](std::string_view key) const
+{
+    return this->find(fge::StringId{key});
+}
+fge::Property const* PropertyList::operator[](fge::StringId key) const
+{
+    return this->find(key);
 }
 
 std::size_t PropertyList::count() const
 {
-    return this->g_data.size();
+    return this->g_count;
 }
 
-fge::PropertyList::DataType::iterator PropertyList::begin()
+fge::PropertyList::iterator PropertyList::begin()
 {
-    return this->g_data.begin();
+    return {this->g_data.begin(), this->g_data.end()};
 }
-fge::PropertyList::DataType::iterator PropertyList::end()
+fge::PropertyList::iterator PropertyList::end()
 {
-    return this->g_data.end();
+    return {this->g_data.end(), this->g_data.end()};
 }
-fge::PropertyList::DataType::const_iterator PropertyList::begin() const
+fge::PropertyList::const_iterator PropertyList::begin() const
 {
-    return this->g_data.begin();
+    return {this->g_data.cbegin(), this->g_data.cend()};
 }
-fge::PropertyList::DataType::const_iterator PropertyList::end() const
+fge::PropertyList::const_iterator PropertyList::end() const
 {
-    return this->g_data.end();
+    return {this->g_data.cend(), this->g_data.cend()};
 }
 
 void PropertyList::clearAllModificationFlags()
 {
-    for (auto& data: this->g_data)
+    for (auto& data: *this)
     {
         data.second.setModifiedFlag(false);
     }
@@ -134,7 +238,7 @@ std::size_t PropertyList::countAllModificationFlags() const
 {
     std::size_t counter{0};
 
-    for (auto const& data: this->g_data)
+    for (auto const& data: *this)
     {
         if (data.second.isModified())
         {
@@ -145,4 +249,153 @@ std::size_t PropertyList::countAllModificationFlags() const
     return counter;
 }
 
+std::size_t PropertyList::GetIdealSlot(fge::StringId::Value key, std::size_t mask)
+{
+    //Folding the high bits of the hash as only the low bits are used
+    return static_cast<std::size_t>(key ^ (key >> 32)) & mask;
+}
+
+fge::Property* PropertyList::find(fge::StringId key)
+{
+    auto const slot = this->findSlot(key);
+    return slot != this->g_slots.size() ? &this->g_data[this->g_slots[slot]._index].second : nullptr;
+}
+fge::Property const* PropertyList::find(fge::StringId key) const
+{
+    auto const slot = this->findSlot(key);
+    return slot != this->g_slots.size() ? &this->g_data[this->g_slots[slot]._index].second : nullptr;
+}
+std::size_t PropertyList::findSlot(fge::StringId key) const
+{
+    if (this->g_slots.empty())
+    {
+        return this->g_slots.size();
+    }
+
+    auto const mask = this->g_slots.size() - 1;
+    auto const value = key.getValue();
+    //The table is never full, so there is always an empty slot that end the probing
+    for (auto slot = GetIdealSlot(value, mask);; slot = (slot + 1) & mask)
+    {
+        auto const& current = this->g_slots[slot];
+        if (current._index == EmptySlot)
+        {
+            return this->g_slots.size();
+        }
+        if (current._key == value)
+        {
+            return slot;
+        }
+    }
+}
+fge::Property& PropertyList::insert(fge::StringId key)
+{
+    //Keeping the load factor under 3/4
+    if ((this->g_count + 1) * 4 > this->g_slots.size() * 3)
+    {
+        this->rehash(this->g_slots.empty() ? FGE_PROPERTYLIST_MIN_SLOT_COUNT : this->g_slots.size() * 2);
+    }
+
+    uint32_t index;
+    if (this->g_freeEntries.empty())
+    {
+        index = static_cast<uint32_t>(this->g_data.size());
+        this->g_data.emplace_back(key, fge::Property{});
+    }
+    else
+    {
+        index = this->g_freeEntries.back();
+        this->g_freeEntries.pop_back();
+        auto* entry = &this->g_data[index];
+        std::destroy_at(entry);
+        std::construct_at(entry, key, fge::Property{});
+    }
+
+    auto const mask = this->g_slots.size() - 1;
+    auto slot = GetIdealSlot(key.getValue(), mask);
+    while (this->g_slots[slot]._index != EmptySlot)
+    {
+        slot = (slot + 1) & mask;
+    }
+    this->g_slots[slot] = {key.getValue(), index};
+
+    ++this->g_count;
+    return this->g_data[index].second;
+}
+fge::Property& PropertyList::getOrInsert(std::string_view key)
+{
+    if (auto* property = this->find(fge::StringId{key}))
+    {
+        return *property;
+    }
+    //Only interning the key when a new property is created
+    return this->insert(fge::InternString(key));
+}
+fge::Property& PropertyList::getOrInsert(fge::StringId key)
+{
+    if (auto* property = this->find(key))
+    {
+        return *property;
+    }
+    return this->insert(key);
+}
+void PropertyList::erase(fge::StringId key)
+{
+    auto hole = this->findSlot(key);
+    if (hole == this->g_slots.size())
+    {
+        return;
+    }
+
+    //Releasing the entry, a free entry have an invalid key
+    auto const index = this->g_slots[hole]._index;
+    if (index + 1 == this->g_data.size())
+    {
+        this->g_data.pop_back();
+    }
+    else
+    {
+        auto* entry = &this->g_data[index];
+        std::destroy_at(entry);
+        std::construct_at(entry, fge::StringId{}, fge::Property{});
+        this->g_freeEntries.push_back(index);
+    }
+    --this->g_count;
+
+    //Backward shift deletion, the following slots of the probe sequence are moved in order to fill the hole
+    auto const mask = this->g_slots.size() - 1;
+    for (auto slot = (hole + 1) & mask; this->g_slots[slot]._index != EmptySlot; slot = (slot + 1) & mask)
+    {
+        auto const idealSlot = GetIdealSlot(this->g_slots[slot]._key, mask);
+        if (((slot - idealSlot) & mask) >= ((slot - hole) & mask))
+        {
+            this->g_slots[hole] = this->g_slots[slot];
+            hole = slot;
+        }
+    }
+    this->g_slots[hole] = {};
+}
+void PropertyList::rehash(std::size_t slotCount)
+{
+    std::vector<Slot> slots(slotCount);
+    auto const mask = slotCount - 1;
+
+    for (auto const& oldSlot: this->g_slots)
+    {
+        if (oldSlot._index == EmptySlot)
+        {
+            continue;
+        }
+
+        auto slot = GetIdealSlot(oldSlot._key, mask);
+        while (slots[slot]._index != EmptySlot)
+        {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = oldSlot;
+    }
+
+    this->g_slots = std::move(slots);
+}
+
 } // namespace fge
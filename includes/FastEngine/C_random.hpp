@@ -18,27 +18,95 @@
 #define _FGE_C_RANDOM_HPP_INCLUDED
 
 #include "FastEngine/fge_extern.hpp"
+#include "FastEngine/C_nullMutex.hpp"
 #include "FastEngine/C_vector.hpp"
 #include "FastEngine/graphic/C_color.hpp"
 
+#include <array>
+#include <bit>
 #include <chrono>
 #include <limits>
 #include <mutex>
 #include <random>
+#include <span>
 #include <string>
 
+#define FGE_RANDOM_BULK_LANES 4
+#define FGE_RANDOM_BULK_MIN_SIZE (FGE_RANDOM_BULK_LANES * 8)
+
 namespace fge
 {
 
+/**
+ * \class Xoshiro256ss
+ * \ingroup utility
+ * \brief The xoshiro256** random engine
+ *
+ * A small and fast 64-bit engine with a period of 2^256 - 1, it satisfies the UniformRandomBitGenerator
+ * requirements and can be used with the standard distributions.
+ *
+ * The engine can also generate values in bulk: FGE_RANDOM_BULK_LANES independent streams, separated
+ * from the main stream with jump(), are advanced together in a loop that the compiler can vectorize.
+ * The bulk streams are created on the first bulk generation and are reset by seed().
+ */
+class FGE_API Xoshiro256ss
+{
+public:
+    using result_type = uint64_t;
+
+    Xoshiro256ss();
+    /**
+     * \brief Initialize the engine
+     *
+     * \param seed a 64-bit seed, expanded to the 256-bit state with splitmix64
+     */
+    explicit Xoshiro256ss(uint64_t seed);
+
+    void seed(uint64_t seed);
+
+    [[nodiscard]] static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    [[nodiscard]] static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    inline result_type operator()();
+    void discard(unsigned long long count);
+
+    /**
+     * \brief Advance the main stream by 2^128 values
+     *
+     * This can be used to create up to 2^128 non-overlapping streams from a single seed.
+     */
+    void jump();
+
+    /**
+     * \brief Generate a lot of values at once
+     *
+     * Small spans are generated from the main stream, bigger ones from the bulk streams.
+     *
+     * \param values The span that receive the values
+     */
+    void generate(std::span<result_type> values);
+
+    [[nodiscard]] bool operator==(Xoshiro256ss const& r) const;
+
+private:
+    void initBulk();
+
+    std::array<uint64_t, 4> g_state{};
+    //Bulk streams state, structure of array in order to be vectorized
+    std::array<std::array<uint64_t, FGE_RANDOM_BULK_LANES>, 4> g_bulkState{};
+    bool g_bulkReady{false};
+};
+
 /**
  * \class Random
  * \ingroup utility
  * \brief A class to generate random numbers
  *
  * This class is a wrapper for the C++ random number generator.
- * It is thread-safe and can be used in a multi-threaded environment.
+ * With the default mutex, it is thread-safe and can be used in a multi-threaded environment.
+ * With NullMutex, the instance must be owned by a single thread (see LocalRandom).
  */
-template<typename TEngine>
+template<typename TEngine, typename TMutex = std::mutex>
 class Random
 {
 public:
@@ -68,6 +136,20 @@ public:
     template<typename T>
     T range(T min, T max);
 
+    /**
+     * \brief Fill a span with random numbers within a range
+     *
+     * The lock is only taken once. With the Xoshiro256ss engine and a floating point type,
+     * the values are generated in bulk and converted in a vectorizable pass.
+     *
+     * \tparam T Type of the random numbers
+     * \param values The span to fill
+     * \param min Minimum value of the range
+     * \param max Maximum value of the range (included for integers)
+     */
+    template<typename T>
+    void fill(std::span<T> values, T min, T max);
+
     /**
      * \brief Get the random engine
      *
@@ -188,9 +270,15 @@ public:
 
 private:
     TEngine g_engine;
-    std::mutex g_mutex;
+    TMutex g_mutex;
 };
 
+/**
+ * \ingroup utility
+ * \brief A fast random number generator without lock, must be owned by a single thread
+ */
+using LocalRandom = fge::Random<fge::Xoshiro256ss, fge::NullMutex>;
+
 /**
  * \ingroup utility
  * \brief Default random number generator instance
@@ -200,6 +288,27 @@ private:
  */
 FGE_API extern fge::Random<std::mt19937_64> _random;
 
+/**
+ * \ingroup utility
+ * \brief Get the random number generator of the calling thread
+ *
+ * Every thread get its own independently seeded LocalRandom, avoiding the lock of fge::_random.
+ * The seed of a stream is derived from the thread seed (see SetThreadRandomSeed) and the order of creation
+ * of the stream.
+ *
+ * \return The random number generator of the calling thread
+ */
+FGE_API fge::LocalRandom& GetThreadRandom();
+/**
+ * \ingroup utility
+ * \brief Set the seed used to derive the thread random streams
+ *
+ * Only streams created after this call are affected, this should be called before starting the threads.
+ *
+ * \param seed a 64-bit seed
+ */
+FGE_API void SetThreadRandomSeed(uint64_t seed);
+
 } // namespace fge
 
 #include <FastEngine/C_random.inl>
@@ -17,39 +17,59 @@
 namespace fge
 {
 
-template<typename TEngine>
-Random<TEngine>::Random() :
+//Xoshiro256ss
+
+Xoshiro256ss::result_type Xoshiro256ss::operator()()
+{
+    auto const result = std::rotl(this->g_state[1] * 5, 7) * 9;
+    auto const t = this->g_state[1] << 17;
+
+    this->g_state[2] ^= this->g_state[0];
+    this->g_state[3] ^= this->g_state[1];
+    this->g_state[1] ^= this->g_state[2];
+    this->g_state[0] ^= this->g_state[3];
+
+    this->g_state[2] ^= t;
+    this->g_state[3] = std::rotl(this->g_state[3], 45);
+
+    return result;
+}
+
+//Random
+
+template<typename TEngine, typename TMutex>
+Random<TEngine, TMutex>::Random() :
         g_engine(std::chrono::system_clock::now().time_since_epoch().count())
 {}
-template<typename TEngine>
-Random<TEngine>::Random(uint64_t seed) :
+template<typename TEngine, typename TMutex>
+Random<TEngine, TMutex>::Random(uint64_t seed) :
         g_engine(seed)
 {}
 
-template<typename TEngine>
-void Random<TEngine>::setSeed(uint64_t seed)
+template<typename TEngine, typename TMutex>
+void Random<TEngine, TMutex>::setSeed(uint64_t seed)
 {
-    std::scoped_lock<std::mutex> const lck(this->g_mutex);
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
     this->g_engine.seed(seed);
 }
 
-template<typename TEngine>
-TEngine const& Random<TEngine>::getEngine() const
+template<typename TEngine, typename TMutex>
+TEngine const& Random<TEngine, TMutex>::getEngine() const
 {
     return this->g_engine;
 }
-template<typename TEngine>
-TEngine& Random<TEngine>::getEngine()
+template<typename TEngine, typename TMutex>
+TEngine& Random<TEngine, TMutex>::getEngine()
 {
     return this->g_engine;
 }
 
-template<typename TEngine>
+template<typename TEngine, typename TMutex>
 template<typename T>
-T Random<TEngine>::range(T min, T max)
+T Random<TEngine, TMutex>::range(T min, T max)
 {
     static_assert(std::is_arithmetic<T>::value, "T must be arithmetic !");
-    std::scoped_lock<std::mutex> const lck(this->g_mutex);
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
 
     if constexpr (std::is_floating_point<T>::value)
     {
@@ -63,12 +83,56 @@ T Random<TEngine>::range(T min, T max)
     }
 }
 
-template<typename TEngine>
+template<typename TEngine, typename TMutex>
+template<typename T>
+void Random<TEngine, TMutex>::fill(std::span<T> values, T min, T max)
+{
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic !");
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
+
+    if constexpr (std::is_same_v<TEngine, fge::Xoshiro256ss> && std::is_floating_point<T>::value)
+    {
+        //The mantissa bits of a T are taken from the top of every raw value
+        constexpr int mantissaBits = std::numeric_limits<T>::digits;
+        constexpr T scale = T{1} / static_cast<T>(uint64_t{1} << mantissaBits);
+        T const range = max - min;
+
+        constexpr std::size_t chunkSize = 256;
+        std::array<uint64_t, chunkSize> raw;
+        for (std::size_t offset = 0; offset < values.size(); offset += chunkSize)
+        {
+            auto const count = std::min(chunkSize, values.size() - offset);
+            this->g_engine.generate({raw.data(), count});
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                values[offset + i] = min + range * (static_cast<T>(raw[i] >> (64 - mantissaBits)) * scale);
+            }
+        }
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        std::uniform_real_distribution<T> uniform_dist(min, max);
+        for (auto& value: values)
+        {
+            value = uniform_dist(this->g_engine);
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<T> uniform_dist(min, max);
+        for (auto& value: values)
+        {
+            value = uniform_dist(this->g_engine);
+        }
+    }
+}
+
+template<typename TEngine, typename TMutex>
 template<typename T>
-T Random<TEngine>::rand()
+T Random<TEngine, TMutex>::rand()
 {
     static_assert(std::is_arithmetic<T>::value, "T must be arithmetic !");
-    std::scoped_lock<std::mutex> const lck(this->g_mutex);
+    std::scoped_lock<TMutex> const lck(this->g_mutex);
 
     if constexpr (std::is_floating_point<T>::value)
     {
@@ -82,27 +146,27 @@ T Random<TEngine>::rand()
     }
 }
 
-template<typename TEngine>
+template<typename TEngine, typename TMutex>
 template<typename T>
-fge::Vector2<T> Random<TEngine>::rangeVec2(T min_x, T max_x, T min_y, T max_y)
+fge::Vector2<T> Random<TEngine, TMutex>::rangeVec2(T min_x, T max_x, T min_y, T max_y)
 {
     return fge::Vector2<T>(this->range<T>(min_x, max_x), this->range<T>(min_y, max_y));
 }
 
-template<typename TEngine>
+template<typename TEngine, typename TMutex>
 template<typename T>
-fge::Vector3<T> Random<TEngine>::rangeVec3(T min_x, T max_x, T min_y, T max_y, T min_z, T max_z)
+fge::Vector3<T> Random<TEngine, TMutex>::rangeVec3(T min_x, T max_x, T min_y, T max_y, T min_z, T max_z)
 {
     return fge::Vector3<T>(this->range<T>(min_x, max_x), this->range<T>(min_y, max_y), this->range<T>(min_z, max_z));
 }
 
-template<typename TEngine>
-fge::Color Random<TEngine>::rangeColor(uint32_t min, uint32_t max)
+template<typename TEngine, typename TMutex>
+fge::Color Random<TEngine, TMutex>::rangeColor(uint32_t min, uint32_t max)
 {
     return fge::Color(this->range<uint32_t>(min, max));
 }
-template<typename TEngine>
-fge::Color Random<TEngine>::rangeColor(uint8_t min_r,
+template<typename TEngine, typename TMutex>
+fge::Color Random<TEngine, TMutex>::rangeColor(uint8_t min_r,
                                        uint8_t max_r,
                                        uint8_t min_g,
                                        uint8_t max_g,
@@ -115,28 +179,28 @@ fge::Color Random<TEngine>::rangeColor(uint8_t min_r,
                       this->range<uint8_t>(min_b, max_b), this->range<uint8_t>(min_a, max_a));
 }
 
-template<typename TEngine>
+template<typename TEngine, typename TMutex>
 template<typename T>
-fge::Vector2<T> Random<TEngine>::randVec2()
+fge::Vector2<T> Random<TEngine, TMutex>::randVec2()
 {
     return fge::Vector2<T>(this->rand<T>(), this->rand<T>());
 }
 
-template<typename TEngine>
+template<typename TEngine, typename TMutex>
 template<typename T>
-fge::Vector3<T> Random<TEngine>::randVec3()
+fge::Vector3<T> Random<TEngine, TMutex>::randVec3()
 {
     return fge::Vector3<T>(this->rand<T>(), this->rand<T>(), this->rand<T>());
 }
 
-template<typename TEngine>
-fge::Color Random<TEngine>::randColor()
+template<typename TEngine, typename TMutex>
+fge::Color Random<TEngine, TMutex>::randColor()
 {
     return fge::Color(this->rand<uint32_t>());
 }
 
-template<typename TEngine>
-std::string Random<TEngine>::randStr(std::size_t length, std::string const& bucket)
+template<typename TEngine, typename TMutex>
+std::string Random<TEngine, TMutex>::randStr(std::size_t length, std::string const& bucket)
 {
     if ((length == 0) || bucket.empty())
     {
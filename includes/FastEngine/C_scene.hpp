@@ -21,11 +21,16 @@
 
 #include "FastEngine/C_callback.hpp"
 #include "FastEngine/C_commandHandler.hpp"
+#include "FastEngine/C_objectPool.hpp"
 #include "FastEngine/C_propertyList.hpp"
+#include "FastEngine/C_random.hpp"
 #include "FastEngine/graphic/C_renderTarget.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
 #include "FastEngine/network/C_identity.hpp"
 #include "FastEngine/object/C_object.hpp"
+#include <list>
 #include <memory>
+#include <memory_resource>
 #include <queue>
 #include <string>
 #include <unordered_map>
@@ -48,6 +53,10 @@
 
 #define FGE_SCENE_LIMIT_NAMESIZE 200
 
+#define FGE_SCENE_PARALLEL_LOAD_MIN_OBJECTS 64
+
+#define FGE_SCENE_NET_SNAPSHOT_RING_SIZE 32
+
 #define FGE_NEWOBJECT(objectType_, ...)                                                                                \
     fge::ObjectPtr                                                                                                     \
     {                                                                                                                  \
@@ -110,6 +119,24 @@ struct SceneNetEvent
     int8_t _signal{0};
 };
 
+/**
+ * \struct SceneInterestConfig
+ * \ingroup network
+ * \brief Parameters of the Scene interest management
+ *
+ * An Object become relevant for a client when its distance to the client viewpoint is lower or equal
+ * to _enterDistance and stay relevant until this distance is greater than _leaveDistance.
+ *
+ * \see Scene::enableInterestManagement
+ */
+struct SceneInterestConfig
+{
+    float _cellSize{512.0f};       ///< The size of a cell of the spatial index
+    float _enterDistance{1024.0f}; ///< The distance where an Object become relevant
+    float _leaveDistance{1280.0f}; ///< The distance where an Object stop being relevant, must be >= _enterDistance
+    std::size_t _byteBudget{0};    ///< The maximum Object data size of a packModification call, 0 for unlimited
+};
+
 /**
  * \enum ObjectTypes
  * \ingroup objectControl
@@ -178,7 +205,8 @@ public:
             g_type(fge::ObjectTypes::INVALID),
 
             g_planDepth(FGE_SCENE_BAD_PLANDEPTH),
-            g_requireForceClientsCheckup(true)
+            g_requireForceClientsCheckup(true),
+            g_indexed(false)
     {}
     inline ObjectData(fge::Scene* boundScene,
                       fge::ObjectPtr&& newObj,
@@ -191,9 +219,11 @@ public:
             g_sid(newSid),
             g_plan(newPlan),
             g_type(newType),
+            g_classNameId(this->g_object ? fge::StringId{this->g_object->getClassName()} : fge::StringId{}),
 
             g_planDepth(FGE_SCENE_BAD_PLANDEPTH),
-            g_requireForceClientsCheckup(true)
+            g_requireForceClientsCheckup(true),
+            g_indexed(false)
     {}
 
     /**
@@ -323,6 +353,19 @@ public:
     {
         return this->g_object->getClassName() == className;
     }
+    /**
+     * \brief Check if the Object is a specific class.
+     *
+     * @param className The StringId of the class name
+     * @return True if the Object is the specified class, False otherwise
+     */
+    [[nodiscard]] inline bool isClass(fge::StringId className) const { return this->g_classNameId == className; }
+    /**
+     * \brief Get the StringId of the Object class name, computed when the ObjectData is created.
+     *
+     * \return The class name StringId
+     */
+    [[nodiscard]] inline fge::StringId getClassNameId() const { return this->g_classNameId; }
 
     [[nodiscard]] inline fge::EnumFlags<ObjectContextFlags>& getContextFlags() const { return this->g_contextFlags; }
 
@@ -372,6 +415,7 @@ private:
     fge::ObjectSid g_sid;
     fge::ObjectPlan g_plan;
     fge::ObjectTypes g_type;
+    fge::StringId g_classNameId;
 
     //Dynamic data (not saved, local only)
     mutable fge::ObjectPlanDepth g_planDepth;
@@ -379,6 +423,7 @@ private:
     mutable fge::EnumFlags<ObjectContextFlags> g_contextFlags; //TODO: make it uneditable ?
 
     bool g_requireForceClientsCheckup;
+    bool g_indexed; //The object is referenced by the class and tag indices of its Scene
 
     friend class fge::Scene;
     friend class fge::ChildObjectsAccessor;
@@ -386,8 +431,27 @@ private:
 
 using ObjectDataWeak = std::weak_ptr<fge::ObjectData>;
 using ObjectDataShared = std::shared_ptr<fge::ObjectData>;
-using ObjectContainer = std::list<fge::ObjectDataShared>;
+using ObjectContainer = std::pmr::list<fge::ObjectDataShared>;
+
+/**
+ * \brief Create a shared ObjectData
+ * \ingroup objectControl
+ *
+ * This is the same as std::make_shared but the ObjectData and its control block are allocated
+ * from a pool (see GetObjectDataMemoryResource).
+ *
+ * \param args The arguments of the ObjectData constructor
+ * \return The shared ObjectData
+ */
+template<class... TArgs>
+inline fge::ObjectDataShared MakeObjectData(TArgs&&... args)
+{
+    return std::allocate_shared<fge::ObjectData>(
+            std::pmr::polymorphic_allocator<fge::ObjectData>{fge::GetObjectDataMemoryResource()},
+            std::forward<TArgs>(args)...);
+}
 using ObjectPlanDataMap = std::map<fge::ObjectPlan, fge::ObjectContainer::iterator>;
+using ObjectIndexMap = std::unordered_map<fge::StringId, std::vector<fge::ObjectDataShared>>;
 
 /**
  * \class ObjectContainerHashMap
@@ -397,9 +461,15 @@ using ObjectPlanDataMap = std::map<fge::ObjectPlan, fge::ObjectContainer::iterat
 class FGE_API ObjectContainerHashMap
 {
 public:
-    using Map = std::unordered_map<ObjectSid, ObjectContainer::iterator>;
+    using Map = std::pmr::unordered_map<ObjectSid, ObjectContainer::iterator>;
 
     ObjectContainerHashMap() = default;
+    /**
+     * \brief Create an empty hash map that allocate its nodes from a memory resource
+     *
+     * \param resource The memory resource, must outlive the hash map
+     */
+    explicit ObjectContainerHashMap(std::pmr::memory_resource* resource);
     explicit ObjectContainerHashMap(ObjectContainer& objects);
     ObjectContainerHashMap(ObjectContainerHashMap const& r) = delete;
     ObjectContainerHashMap(ObjectContainerHashMap&& r) noexcept = default;
@@ -466,6 +536,7 @@ class FGE_API Scene : public fge::CommandHandler, public fge::OwnView
 public:
     using NetworkEventQueue = std::queue<fge::SceneNetEvent>;
     using UpdateCount = uint16_t;
+    using NetSnapshotId = uint32_t; ///< 0 is reserved for "no snapshot"
     struct UpdateCountRange
     {
         UpdateCount _last;
@@ -949,6 +1020,9 @@ public:
     /**
      * \brief Get all Object with the same class name.
      *
+     * The Scene maintain an index of its Objects by class name, so this function only visit the
+     * matching Objects. They are returned in their insertion order.
+     *
      * \see Object::getClassName
      *
      * \warning This function do not clear data in the ObjectContainer.
@@ -958,9 +1032,23 @@ public:
      * \return The number of Objects added in the container
      */
     std::size_t getAllObj_ByClass(std::string_view class_name, fge::ObjectContainer& buff) const;
+    /**
+     * \brief Get all Object with the same class name StringId.
+     *
+     * Same as getAllObj_ByClass but compare integers instead of strings.
+     *
+     * \param class_name The StringId of the wanted class name
+     * \param buff An ObjectContainer that will receive results
+     * \return The number of Objects added in the container
+     */
+    std::size_t getAllObj_ByClass(fge::StringId class_name, fge::ObjectContainer& buff) const;
+    std::size_t getAllObj_ByClass(fge::reg::ClassId class_id, fge::ObjectContainer& buff) const;
     /**
      * \brief Get all Object that contain the provided tag.
      *
+     * The Scene maintain an index of its Objects by tag, updated when a tag is added or removed
+     * from an Object inside the Scene. Objects are returned in the order they received the tag.
+     *
      * \see TagList
      *
      * \warning This function do not clear data in the ObjectContainer.
@@ -970,6 +1058,7 @@ public:
      * \return The number of Objects added in the container
      */
     std::size_t getAllObj_ByTag(std::string_view tag_name, fge::ObjectContainer& buff) const;
+    std::size_t getAllObj_ByTag(fge::StringId tag_name, fge::ObjectContainer& buff) const;
 
     /**
      * \brief Get the first Object with a position.
@@ -1043,6 +1132,8 @@ public:
 #endif //FGE_DEF_SERVER
 
     fge::ObjectDataShared getFirstObj_ByClass(std::string_view class_name) const;
+    fge::ObjectDataShared getFirstObj_ByClass(fge::StringId class_name) const;
+    fge::ObjectDataShared getFirstObj_ByClass(fge::reg::ClassId class_id) const;
     /**
      * \brief Get the first Object that match a provided tag.
      *
@@ -1052,6 +1143,7 @@ public:
      * \return The first Object that match the argument
      */
     fge::ObjectDataShared getFirstObj_ByTag(std::string_view tag_name) const;
+    fge::ObjectDataShared getFirstObj_ByTag(fge::StringId tag_name) const;
 
     // Static id
     /**
@@ -1074,7 +1166,7 @@ public:
      * \brief Generate an SID based on the provided wanted SID.
      *
      * By default, if the wanted SID is FGE_SCENE_BAD_SID, this function
-     * try to generate one with random value using fge::_random.
+     * try to generate one with random value using the Scene random stream (see getRandom).
      * The last 2bits in the SID is also here to separate from each of ObjectType.
      *
      * If the wanted SID is already taken, this will cause a random SID generation.
@@ -1085,6 +1177,25 @@ public:
      */
     virtual fge::ObjectSid generateSid(fge::ObjectSid wanted_sid, fge::ObjectTypes type) const;
 
+    /**
+     * \brief Seed the random stream of this Scene.
+     *
+     * Every Scene own a random stream, seeded from the thread random stream by default (see fge::GetThreadRandom).
+     * Seeding it allows a deterministic and replayable behaviour like the generated SID.
+     * A copied Scene is seeded again so that it does not generate the same SID sequence as its source.
+     *
+     * \param seed a 64-bit seed
+     */
+    void setRandomSeed(uint64_t seed);
+    /**
+     * \brief Get the random stream of this Scene.
+     *
+     * The stream is not thread-safe, it must be used from the thread that own the Scene.
+     *
+     * \return The random stream
+     */
+    [[nodiscard]] fge::LocalRandom& getRandom() const;
+
     // Network
     /**
      * \brief Signal an Object over the network.
@@ -1277,6 +1388,140 @@ public:
      */
     std::optional<fge::net::Error> unpackWatchedEvent(fge::net::Packet const& pck);
 
+    // Interest management
+    /**
+     * \brief Enable the interest management of the network synchronisation.
+     *
+     * Every client with a viewpoint (see setClientViewpoint) only receive the synchronised Object
+     * (FULL_SYNC or DELTA_SYNC) that are relevant for it, GUI Object are never synchronised to these clients:
+     * - pack and packModification ignore non-relevant Object,
+     * - updateInterest push an OBJECT_CREATED/OBJECT_DELETED event when an Object enter/leave the relevant set,
+     * - broadcasted SceneNetEvent about non-relevant Object are not pushed for the client,
+     * - packModification send the modified Object by priority (closest and most stale first) until the
+     * byte budget is reached, the remaining modifications are kept for the next call.
+     *
+     * Clients without a viewpoint are synchronised as usual.
+     *
+     * \param config The interest management parameters
+     */
+    void enableInterestManagement(fge::SceneInterestConfig const& config);
+    /**
+     * \brief Disable the interest management.
+     *
+     * Clients with a viewpoint should be fully re-synchronised with pack after this call.
+     */
+    void disableInterestManagement();
+    [[nodiscard]] bool isInterestManagementEnabled() const;
+    [[nodiscard]] fge::SceneInterestConfig const& getInterestConfig() const;
+
+    /**
+     * \brief Set the viewpoint of a client.
+     *
+     * When a client receive its first viewpoint, the client is assumed to know every synchronised Object,
+     * the non-relevant ones will be deleted by the next updateInterest.
+     *
+     * \param id The client net::Identity
+     * \param viewpoint The position of the client in the Scene
+     * \return \b true if the client is known by the Scene, \b false otherwise
+     */
+    bool setClientViewpoint(fge::net::Identity const& id, fge::Vector2f const& viewpoint);
+    /**
+     * \brief Remove the viewpoint of a client, the client will be synchronised as usual.
+     *
+     * \param id The client net::Identity
+     */
+    void clearClientViewpoint(fge::net::Identity const& id);
+    [[nodiscard]] std::optional<fge::Vector2f> getClientViewpoint(fge::net::Identity const& id) const;
+    /**
+     * \brief Check if an Object is relevant for a client.
+     *
+     * A client without a viewpoint, or a Scene without interest management, consider every Object as relevant.
+     *
+     * \param sid The Object SID
+     * \param id The client net::Identity
+     * \return \b true if the Object is relevant
+     */
+    [[nodiscard]] bool isRelevantFor(fge::ObjectSid sid, fge::net::Identity const& id) const;
+
+    /**
+     * \brief Compute the relevant Object of every client with a viewpoint.
+     *
+     * A spatial grid of the synchronised Object is built and every viewpoint query it. The
+     * relevance changes are pushed as SceneNetEvent for the client.
+     *
+     * This is automatically called at the end of clientsCheckup when the interest management is enabled.
+     */
+    void updateInterest();
+
+    // Network snapshot
+    /**
+     * \brief Capture a snapshot of the synchronised data.
+     *
+     * Every network type of the Scene and of the synchronised Object (FULL_SYNC or DELTA_SYNC) is serialized
+     * and compared to the previous snapshot in order to know in which snapshot each value last changed.
+     * A value that is not modified since the previous snapshot (see NetworkTypeBase::getModificationRevision)
+     * is not serialized again, its previous data is reused.
+     * The last FGE_SCENE_NET_SNAPSHOT_RING_SIZE snapshots are kept as possible baselines for packNetSnapshotDelta.
+     *
+     * This should be called by a server once per tick, before packing the snapshot deltas.
+     *
+     * \return The id of the new snapshot
+     */
+    NetSnapshotId captureNetSnapshot();
+    [[nodiscard]] NetSnapshotId getLastNetSnapshotId() const;
+    /**
+     * \brief Acknowledge a snapshot received by a client.
+     *
+     * The acknowledged snapshot become the baseline of the next packNetSnapshotDelta for this client.
+     * An older or not yet captured snapshot is ignored.
+     *
+     * \param id The client net::Identity
+     * \param snapshotId The last snapshot id received by the client, see getLastReceivedNetSnapshotId
+     * \return \b true if the baseline of the client has been updated
+     */
+    bool acknowledgeNetSnapshot(fge::net::Identity const& id, NetSnapshotId snapshotId);
+    [[nodiscard]] NetSnapshotId getAcknowledgedNetSnapshot(fge::net::Identity const& id) const;
+    /**
+     * \brief Pack the last snapshot as a delta against the last acknowledged snapshot of a client.
+     *
+     * Only the values that changed since the baseline are packed. Contrary to packModification, a lost
+     * Packet does not require any resync: the next delta contain the lost values as long as the client
+     * has not acknowledged a newer snapshot. When the client has no baseline or when its baseline is
+     * no longer in the ring, every value is packed.
+     *
+     * Object creations and deletions are still synchronised with SceneNetEvent and NetworkTypeEvents are
+     * not part of a snapshot as they do not hold any state.
+     * When the interest management is enabled, only the relevant Object are packed.
+     *
+     * If no snapshot have been captured yet, a new one is captured.
+     *
+     * \see captureNetSnapshot acknowledgeNetSnapshot unpackNetSnapshotDelta
+     *
+     * \param pck The network packet
+     * \param id The client net::Identity
+     */
+    void packNetSnapshotDelta(fge::net::Packet& pck, fge::net::Identity const& id);
+    /**
+     * \brief Unpack a snapshot delta from a server.
+     *
+     * A snapshot older than the last received one is ignored with a ERR_SCENE_OLD_PACKET error.
+     * The client should acknowledge getLastReceivedNetSnapshotId to the server.
+     *
+     * \see packNetSnapshotDelta
+     *
+     * \param pck The network packet
+     */
+    std::optional<fge::net::Error> unpackNetSnapshotDelta(fge::net::Packet const& pck);
+    [[nodiscard]] NetSnapshotId getLastReceivedNetSnapshotId() const;
+    /**
+     * \brief Get the server time of the last received snapshot.
+     *
+     * This is the time that should be used to push the received values in a net::InterpolationBuffer.
+     *
+     * \return The capture time of the snapshot in ms (see net::Client::getFullTimestamp_ms), 0 if none
+     */
+    [[nodiscard]] uint64_t getLastReceivedNetSnapshotTimestamp() const;
+
     // Operator
     inline fge::ObjectDataShared operator[](fge::ObjectSid sid) const { return this->getObject(sid); }
 
@@ -1338,6 +1583,51 @@ public:
      */
     fge::CallbackContext getCallbackContext() const;
 
+    /**
+     * \brief Set the number of threads used to deserialize Object during a load.
+     *
+     * When set to more than 1, load() and unpack() work in two phases: every Object is first created and
+     * inserted serially in plan order, then the Object::load / Object::unpack calls are dispatched across
+     * the threads. The Scene is only touched by the calling thread, but every Object deserialization must be
+     * independent and thread-safe (no shared state other than the managers).
+     *
+     * A Scene with less than FGE_SCENE_PARALLEL_LOAD_MIN_OBJECTS objects to load is always loaded serially.
+     * The calling thread takes part in the work, the other threads are created on the first parallel load
+     * and kept alive until the count is changed or the Scene is destroyed.
+     *
+     * unpack() can only deserialize in parallel if the sender packed the Object data sizes,
+     * see setPackObjectSizes.
+     *
+     * \param count The number of threads, 0 or 1 to disable the parallel loading (default)
+     */
+    void setLoadThreadCount(std::size_t count);
+    /**
+     * \brief Get the number of threads used to deserialize Object during a load.
+     *
+     * \see setLoadThreadCount
+     *
+     * \return The number of threads
+     */
+    [[nodiscard]] std::size_t getLoadThreadCount() const;
+    /**
+     * \brief Prefix every Object data with its size during a pack().
+     *
+     * The sizes allow a receiving Scene with more than 1 load thread to unpack the Object in parallel,
+     * at the cost of 4 more bytes per Object. The choice is written in the packet so a receiving Scene
+     * can always unpack it.
+     *
+     * \param enable \b true to pack the sizes, \b false to not pack them (default)
+     */
+    void setPackObjectSizes(bool enable);
+    /**
+     * \brief Check if every Object data is prefixed with its size during a pack().
+     *
+     * \see setPackObjectSizes
+     *
+     * \return \b true if the sizes are packed
+     */
+    [[nodiscard]] bool isPackingObjectSizes() const;
+
     // Save/Load in file
     /**
      * \brief Save some user defined custom data.
@@ -1361,6 +1651,28 @@ public:
      * \param jsonObject The json object
      */
     virtual void loadCustomData([[maybe_unused]] nlohmann::json& jsonObject) {}
+    /**
+     * \brief Pack some user defined custom data.
+     *
+     * This function doesn't do anything by default but can be overridden to save some
+     * data during a saveSnapshotInFile call.
+     *
+     * \see saveSnapshotInFile
+     *
+     * \param pck The packet that will be stored in the snapshot
+     */
+    virtual void packCustomData([[maybe_unused]] fge::net::Packet& pck) {}
+    /**
+     * \brief Unpack some user defined custom data.
+     *
+     * This function doesn't do anything by default but can be overridden to load some
+     * data during a loadSnapshotFromFile call.
+     *
+     * \see loadSnapshotFromFile
+     *
+     * \param pck The packet stored in the snapshot
+     */
+    virtual void unpackCustomData([[maybe_unused]] fge::net::Packet const& pck) {}
 
     /**
      * \brief Save all the Scene data in a json object.
@@ -1404,6 +1716,29 @@ public:
      * \return \b true if successful, \b false otherwise
      */
     bool loadFromFile(std::filesystem::path const& path, bool ignoreSid = false);
+    /**
+     * \brief Save all the Scene with its Object in a binary snapshot file.
+     *
+     * Objects are saved with Object::pack, this is a lot faster to load than a json file
+     * but only the packed data is kept.
+     *
+     * \see SaveSceneSnapshot
+     *
+     * \param path The path of the file
+     * \param compress If \b true, every section of the snapshot is compressed with LZ4
+     * \return \b true if successful, \b false otherwise
+     */
+    bool saveSnapshotInFile(std::filesystem::path const& path, bool compress = false);
+    /**
+     * \brief Load all the Scene data from a binary snapshot file.
+     *
+     * \see LoadSceneSnapshot
+     *
+     * \param path The path of the file
+     * \param ignoreSid If \b true, the SID in the file is ignored and new one is generated for every Object
+     * \return \b true if successful, \b false otherwise
+     */
+    bool loadSnapshotFromFile(std::filesystem::path const& path, bool ignoreSid = false);
 
     // Iterator
     inline fge::ObjectContainer::const_iterator begin() const { return this->g_objects.begin(); }
@@ -1478,14 +1813,69 @@ private:
                 _lastUpdateCount(updateCount)
         {}
 
+        struct Interest
+        {
+            uint32_t _lastPackCount{0}; ///< The _packCount of the last packModification that sent the Object
+            float _distance{0.0f};
+            NetSnapshotId _enterSnapshot{0}; ///< The last snapshot id when the Object became relevant
+        };
+
         UpdateCount _lastUpdateCount;
         NetworkEventQueue _networkEvents;
+
+        std::optional<fge::Vector2f> _viewpoint;
+        std::unordered_map<fge::ObjectSid, Interest> _relevantObjects;
+        uint32_t _packCount{0}; ///< The number of packModification done for this client
+
+        NetSnapshotId _acknowledgedSnapshot{0};
     };
     using PerClientSyncMap = std::unordered_map<fge::net::Identity, PerClientSync, fge::net::IdentityHash>;
 
+    [[nodiscard]] bool isInterestSubject(fge::ObjectData const& data) const;
+    [[nodiscard]] bool isInterestManaged(PerClientSync const& clientSync) const;
+
+    struct NetSnapshot
+    {
+        struct Field
+        {
+            std::size_t _offset;
+            std::size_t _size;
+            NetSnapshotId _lastChange; ///< The id of the snapshot where the value last changed
+            uint32_t _revision;        ///< The modification revision of the network type when captured
+            bool _unmodified;          ///< \b true if the network type check() was \b false when captured
+        };
+        struct ObjectEntry
+        {
+            fge::ObjectSid _sid;
+            fge::reg::ClassId _class;
+            fge::ObjectPlan _plan;
+            fge::ObjectTypes _type;
+            std::size_t _firstField;
+            std::size_t _fieldCount;
+        };
+
+        NetSnapshotId _id{0};
+        uint64_t _timestamp{0}; ///< The capture time in ms, see net::Client::getFullTimestamp_ms
+        fge::net::Packet _data;
+        std::vector<Field> _fields; ///< The Scene fields followed by the Object fields
+        std::size_t _sceneFieldCount{0};
+        std::vector<ObjectEntry> _objects;
+        std::unordered_map<fge::ObjectSid, std::size_t> _objectIndices;
+    };
+
+    [[nodiscard]] NetSnapshot const* getNetSnapshot(NetSnapshotId snapshotId) const;
+
+    struct LoadWorkerPool;
+    [[nodiscard]] LoadWorkerPool& getLoadWorkerPool();
+    std::optional<fge::net::Error> unpackModificationBody(fge::net::Packet const& pck);
+
     void hash_updatePlanDataMap(fge::ObjectPlan plan, fge::ObjectContainer::iterator whoIterator, bool isLeaving);
     fge::ObjectContainer::iterator hash_getInsertionIteratorFromPlanDataMap(fge::ObjectPlan plan);
 
+    void index_addObject(fge::ObjectDataShared const& data);
+    void index_delObject(fge::ObjectDataShared const& data);
+    void index_updateTag(fge::ObjectDataShared const& data, fge::StringId tag, bool added);
+
     std::string g_name;
 
     NetworkEventQueue g_sceneNetworkEvents;
@@ -1499,11 +1889,27 @@ private:
     bool g_deleteMe;                                        //Delete an object while updating flag
     fge::ObjectContainer::iterator g_updatedObjectIterator; //The iterator of the updated object
 
+    //Arena of the container nodes, only used by this Scene so no synchronisation is needed
+    std::pmr::unsynchronized_pool_resource g_objectResource;
     fge::ObjectContainer g_objects;
     fge::ObjectContainerHashMap g_objectsHashMap;
     fge::ObjectPlanDataMap g_planDataMap;
+    fge::ObjectIndexMap g_classIndex;
+    fge::ObjectIndexMap g_tagIndex;
 
     fge::CallbackContext g_callbackContext;
+    std::size_t g_loadThreadCount;
+    std::unique_ptr<LoadWorkerPool> g_loadWorkerPool;
+    bool g_packObjectSizes;
+    fge::SceneInterestConfig g_interestConfig;
+    bool g_interestEnabled;
+    std::vector<NetSnapshot> g_netSnapshots; ///< Ring of the last captured snapshots
+    NetSnapshotId g_lastNetSnapshotId;
+    NetSnapshotId g_lastReceivedNetSnapshotId;
+    uint64_t g_lastReceivedNetSnapshotTimestamp;
+    mutable fge::LocalRandom g_random;
+
+    friend class fge::TagList;
 };
 
 } // namespace fge
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _FGE_C_SCENESNAPSHOT_HPP_INCLUDED
+#define _FGE_C_SCENESNAPSHOT_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "FastEngine/C_scene.hpp"
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#define FGE_SCENE_SNAPSHOT_MAGIC {'F', 'G', 'E', 'S'}
+#define FGE_SCENE_SNAPSHOT_VERSION 1
+#define FGE_SCENE_SNAPSHOT_ENDIAN_CHECK 0x01020304
+#define FGE_SCENE_SNAPSHOT_SECTION_ALIGNMENT 8
+
+namespace fge
+{
+
+/**
+ * \enum SceneSnapshotSections
+ * \ingroup objectControl
+ * \brief The sections of a binary Scene snapshot, in file order
+ *
+ * - STRING_POOL: every string (scene name, class names) without null terminator
+ * - CLASS_TABLE: an array of SceneSnapshotClass, one entry per different class
+ * - OBJECT_TABLE: an array of SceneSnapshotObject, one entry per Object
+ * - OBJECT_DATA: the Object::pack() data of every Object
+ * - SCENE_DATA: the Scene::packCustomData() data
+ */
+enum class SceneSnapshotSections : uint8_t
+{
+    STRING_POOL,
+    CLASS_TABLE,
+    OBJECT_TABLE,
+    OBJECT_DATA,
+    SCENE_DATA,
+
+    SECTION_COUNT
+};
+
+enum class SceneSnapshotCompressions : uint8_t
+{
+    NONE,
+    LZ4
+};
+
+struct SceneSnapshotString
+{
+    uint32_t _offset;
+    uint32_t _size;
+};
+
+struct SceneSnapshotSection
+{
+    uint64_t _offset;  ///< Offset from the beginning of the file
+    uint64_t _size;    ///< Stored size
+    uint64_t _rawSize; ///< Size after decompression
+    SceneSnapshotCompressions _compression;
+    std::array<uint8_t, 7> _padding;
+};
+
+struct SceneSnapshotHeader
+{
+    std::array<char, 4> _magic;
+    uint32_t _endianCheck;
+    uint16_t _version;
+    uint16_t _flags;
+    uint32_t _objectCount;
+    uint32_t _classCount;
+    SceneSnapshotString _name;
+    uint32_t _padding;
+    std::array<SceneSnapshotSection, static_cast<std::size_t>(SceneSnapshotSections::SECTION_COUNT)> _sections;
+};
+
+struct SceneSnapshotClass
+{
+    SceneSnapshotString _name;
+};
+
+struct SceneSnapshotObject
+{
+    ObjectSid _sid;
+    uint32_t _classIndex; ///< Index in the class table
+    uint64_t _dataOffset; ///< Offset in the OBJECT_DATA section
+    uint32_t _dataSize;
+    ObjectPlan _plan;
+    ObjectTypes _type;
+    uint8_t _padding;
+};
+
+/**
+ * \struct SceneSnapshotData
+ * \ingroup objectControl
+ * \brief The content of a binary Scene snapshot file, read without creating any Object
+ *
+ * \see ReadSceneSnapshot
+ */
+struct SceneSnapshotData
+{
+    std::string _name;
+    std::vector<std::string> _classNames;
+    std::vector<SceneSnapshotObject> _objects;
+    net::Packet _objectData; ///< The Object::pack() data of every Object
+    net::Packet _sceneData;  ///< The Scene::packCustomData() data
+};
+
+static_assert(sizeof(SceneSnapshotSection) == 32, "SceneSnapshotSection must be tightly packed");
+static_assert(sizeof(SceneSnapshotHeader) == 32 + sizeof(SceneSnapshotSection) * 5,
+              "SceneSnapshotHeader must be tightly packed");
+static_assert(sizeof(SceneSnapshotObject) == 24, "SceneSnapshotObject must be tightly packed");
+
+/**
+ * \brief Save a Scene in a binary snapshot file
+ *
+ * The snapshot is a versioned binary format made of a header followed by aligned sections
+ * (see SceneSnapshotSections). Objects are serialized with Object::pack() and their class is stored
+ * once in the class table by name, so the snapshot stays valid even if classes are registered in another order.
+ *
+ * Fixed size structures are stored in the host byte order, a snapshot is refused on a host with
+ * another byte order.
+ *
+ * \param scene The Scene to save
+ * \param path The path of the file
+ * \param compression The compression applied to every section, a section is stored uncompressed if it doesn't shrink
+ * \return \b true if successful, \b false otherwise
+ */
+FGE_API bool SaveSceneSnapshot(Scene& scene,
+                               std::filesystem::path const& path,
+                               SceneSnapshotCompressions compression = SceneSnapshotCompressions::NONE);
+/**
+ * \brief Load a Scene from a binary snapshot file
+ *
+ * The file is memory mapped, uncompressed tables are read in place without any copy.
+ *
+ * \warning This function clear everything in the Scene before the loading.
+ *
+ * \param scene The Scene that receive the data
+ * \param path The path of the file
+ * \param ignoreSid If \b true, the SID in the file is ignored and new one is generated for every Object
+ * \return \b true if successful, \b false otherwise
+ */
+FGE_API bool LoadSceneSnapshot(Scene& scene, std::filesystem::path const& path, bool ignoreSid = false);
+
+/**
+ * \brief Read a binary snapshot file without creating any Object
+ *
+ * The sections are validated and decompressed but classes are not resolved. As no Scene is involved,
+ * this can be done in another thread, the Object are then created with the LoadSceneSnapshot overload
+ * taking a SceneSnapshotData.
+ *
+ * \param path The path of the file
+ * \param data The content of the snapshot
+ * \return \b true if successful, \b false otherwise
+ */
+FGE_API bool ReadSceneSnapshot(std::filesystem::path const& path, SceneSnapshotData& data);
+/**
+ * \brief Load a Scene from a snapshot previously read with ReadSceneSnapshot
+ *
+ * \warning This function clear everything in the Scene before the loading.
+ *
+ * \param scene The Scene that receive the data
+ * \param data The content of the snapshot
+ * \param ignoreSid If \b true, the SID in the snapshot is ignored and new one is generated for every Object
+ * \return \b true if successful, \b false otherwise
+ */
+FGE_API bool LoadSceneSnapshot(Scene& scene, SceneSnapshotData const& data, bool ignoreSid = false);
+
+} // namespace fge
+
+#endif // _FGE_C_SCENESNAPSHOT_HPP_INCLUDED
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _FGE_C_STRINGID_HPP_INCLUDED
+#define _FGE_C_STRINGID_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "FastEngine/string_hash.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace fge
+{
+
+/**
+ * \class StringId
+ * \ingroup utility
+ * \brief A string identified by its hash
+ *
+ * Comparing two StringId is an integer comparison, they are used as keys by the hot lookups (tags, properties,
+ * class names, commands ...).
+ *
+ * Constructing a StringId only hash the string. In order to retrieve the string from the id, it must be
+ * interned once with InternString() or the _strid literal, the string based APIs of the engine intern their keys.
+ */
+class FGE_API StringId
+{
+public:
+    using Value = uint64_t;
+
+    constexpr StringId() = default;
+    constexpr explicit StringId(std::string_view str) :
+            g_value(fge::HashFnv1a(str))
+    {}
+
+    /**
+     * \brief Create a StringId from a raw value, useful for serialization
+     *
+     * \param value The raw value
+     * \return The StringId
+     */
+    [[nodiscard]] static constexpr StringId FromValue(Value value)
+    {
+        StringId id;
+        id.g_value = value;
+        return id;
+    }
+
+    [[nodiscard]] constexpr Value getValue() const { return this->g_value; }
+    [[nodiscard]] constexpr bool isValid() const { return this->g_value != 0; }
+
+    /**
+     * \brief Retrieve the interned string of this id
+     *
+     * \return The string or an empty string if the id was never interned
+     */
+    [[nodiscard]] std::string_view getString() const;
+
+    [[nodiscard]] constexpr bool operator==(StringId const& r) const = default;
+    [[nodiscard]] constexpr auto operator<=>(StringId const& r) const = default;
+
+private:
+    Value g_value{0};
+};
+
+/**
+ * \ingroup utility
+ * \brief Intern a string in the global string table
+ *
+ * The string table is thread-safe and never shrink, an interned string stay valid until the end of the program.
+ * Two different strings with the same hash can't be told apart by their ids, so a collision throw an fge::Exception.
+ *
+ * \param str The string
+ * \return The StringId of the string
+ */
+FGE_API fge::StringId InternString(std::string_view str);
+/**
+ * \ingroup utility
+ * \brief Get the number of interned strings
+ *
+ * \return The number of strings in the global string table
+ */
+FGE_API std::size_t GetInternedStringCount();
+
+/**
+ * \struct StringLiteral
+ * \ingroup utility
+ * \brief A string literal usable as a template parameter
+ */
+template<std::size_t N>
+struct StringLiteral
+{
+    constexpr StringLiteral(char const (&str)[N]) { std::copy_n(str, N, this->_data); }
+
+    [[nodiscard]] constexpr std::string_view view() const { return {this->_data, N - 1}; }
+
+    char _data[N];
+};
+
+namespace priv
+{
+
+template<fge::StringLiteral TString>
+struct StringIdRegistrar
+{
+    //A function-local static is initialized on first use, so a literal used during the static initialization of
+    //another translation unit is already interned
+    [[nodiscard]] static fge::StringId get()
+    {
+        static fge::StringId const id = fge::InternString(TString.view());
+        return id;
+    }
+};
+
+} // namespace priv
+
+namespace literals
+{
+
+/**
+ * \ingroup utility
+ * \brief Create a StringId from a literal, the hash is computed at compile-time
+ *
+ * At runtime, the string is also interned the first time the literal is evaluated.
+ */
+template<fge::StringLiteral TString>
+[[nodiscard]] constexpr fge::StringId operator""_strid()
+{
+    if (!std::is_constant_evaluated())
+    {
+        return fge::priv::StringIdRegistrar<TString>::get();
+    }
+    return fge::StringId{TString.view()};
+}
+
+} // namespace literals
+
+} // namespace fge
+
+template<>
+struct std::hash<fge::StringId>
+{
+    [[nodiscard]] std::size_t operator()(fge::StringId const& id) const noexcept
+    {
+        return static_cast<std::size_t>(id.getValue());
+    }
+};
+
+#endif // _FGE_C_STRINGID_HPP_INCLUDED
@@ -18,26 +18,48 @@
 #define _FGE_C_TAGLIST_HPP_INCLUDED
 
 #include "FastEngine/fge_extern.hpp"
-#include <set>
-#include <string>
+#include "FastEngine/C_stringId.hpp"
+#include <string_view>
+#include <vector>
 
 namespace fge
 {
 
+class Object;
+
+/**
+ * \class TagList
+ * \ingroup utility
+ * \brief A small list of unique tags
+ *
+ * Tags are stored as interned StringId, checking a tag is an integer comparison.
+ *
+ * When the TagList is owned by an Object that is inside a Scene, every modification
+ * is reported to the Scene in order to keep its tag index up to date.
+ */
 class FGE_API TagList
 {
 public:
-    using TagListType = std::set<std::string, std::less<>>;
+    using TagListType = std::vector<fge::StringId>;
 
     TagList() = default;
+    explicit TagList(fge::Object* owner);
+    TagList(TagList const& r);
+    TagList(TagList&& r) noexcept;
     ~TagList() = default;
 
+    TagList& operator=(TagList const& r);
+    TagList& operator=(TagList&& r) noexcept;
+
     void clear();
 
     void add(std::string_view tag);
+    void add(fge::StringId tag);
     void del(std::string_view tag);
+    void del(fge::StringId tag);
 
     [[nodiscard]] bool check(std::string_view tag) const;
+    [[nodiscard]] bool check(fge::StringId tag) const;
 
     [[nodiscard]] std::size_t getSize() const;
 
@@ -45,6 +67,9 @@ public:
     [[nodiscard]] fge::TagList::TagListType::const_iterator end() const;
 
 private:
+    void notifyOwner(fge::StringId tag, bool added) const;
+
+    fge::Object* g_owner{nullptr};
     fge::TagList::TagListType g_tags;
 };
 
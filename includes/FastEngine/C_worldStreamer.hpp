@@ -0,0 +1,199 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _FGE_C_WORLDSTREAMER_HPP_INCLUDED
+#define _FGE_C_WORLDSTREAMER_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "FastEngine/C_callback.hpp"
+#include "FastEngine/C_rect.hpp"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/C_sceneSnapshot.hpp"
+#include "FastEngine/C_tilemap.hpp"
+#include "FastEngine/C_vector.hpp"
+#include "json.hpp"
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#define FGE_WORLDSTREAMER_DEFAULT_CELL_SIZE 1024.0f
+#define FGE_WORLDSTREAMER_DEFAULT_LOAD_DISTANCE 512.0f
+#define FGE_WORLDSTREAMER_DEFAULT_UNLOAD_DISTANCE 1024.0f
+#define FGE_WORLDSTREAMER_DEFAULT_MAX_CONCURRENT_LOADS 2
+
+#define FGE_WORLDSTREAMER_OBJECTS_EXTENSION ".fges"
+#define FGE_WORLDSTREAMER_TILES_EXTENSION ".json"
+
+namespace fge
+{
+
+/**
+ * \struct WorldStreamerConfig
+ * \ingroup objectControl
+ * \brief Tuning parameters of a WorldStreamer
+ *
+ * - _cellSize: the world size of a cell
+ * - _loadDistance: a cell closer than this distance to an interest point is loaded
+ * - _unloadDistance: a cell farther than this distance to every interest point is unloaded,
+ *   must be greater than _loadDistance to avoid loading/unloading a cell continuously (hysteresis)
+ * - _memoryBudget: the maximal estimated memory of the loaded cells in bytes, 0 for unlimited
+ * - _maxConcurrentLoads: the maximal number of cells loaded at the same time in background
+ * - _tilePlan: the base plan of the generated tile layers
+ */
+struct WorldStreamerConfig
+{
+    fge::Vector2f _cellSize{FGE_WORLDSTREAMER_DEFAULT_CELL_SIZE};
+    float _loadDistance{FGE_WORLDSTREAMER_DEFAULT_LOAD_DISTANCE};
+    float _unloadDistance{FGE_WORLDSTREAMER_DEFAULT_UNLOAD_DISTANCE};
+    std::size_t _memoryBudget{0};
+    std::size_t _maxConcurrentLoads{FGE_WORLDSTREAMER_DEFAULT_MAX_CONCURRENT_LOADS};
+    fge::ObjectPlan _tilePlan{FGE_SCENE_PLAN_HIDE_BACK};
+};
+
+/**
+ * \class WorldStreamer
+ * \ingroup objectControl
+ * \brief Stream the regions of a world in a Scene depending on some interest points
+ *
+ * The world is split in a grid of cells, every cell can be backed by 2 files in the world directory:
+ * - "cell_<x>_<y>.fges": a binary Scene snapshot with the objects of the cell (see SaveSceneSnapshot)
+ * - "cell_<x>_<y>.json": a TileMap chunk, its tile layers are generated at the cell origin
+ *
+ * A missing file is simply ignored, a cell without any file is an empty cell.
+ *
+ * Every update, the cells around the interest points (the view center on a client, the players on a server, ...)
+ * are loaded asynchronously, nearest first. Only the files are read and parsed in a background thread (see
+ * ReadSceneSnapshot), the objects and the tile layers are created during a later update by the thread that
+ * own the Scene. Objects of a cell keep their saved SID unless it is already taken in the target Scene.
+ *
+ * \warning Objects of a cell are created in a private staging Scene and then transferred in the target Scene,
+ * Object::first is called with the staging Scene so objects that need the target Scene must use
+ * Object::transfered. Object::callbackRegister is called during the transfer if the target Scene
+ * have a callback context.
+ *
+ * Cells that are too far from every interest point are unloaded, their objects are removed with Scene::delObject.
+ * When the estimated memory of the loaded cells exceed the budget, the farthest cells outside the load distance are
+ * unloaded first and no new cell is loaded. The memory of a cell is estimated from the size of its files.
+ */
+class FGE_API WorldStreamer
+{
+public:
+    enum class CellStates : uint8_t
+    {
+        UNLOADED,
+        LOADING,
+        LOADED
+    };
+
+    WorldStreamer(fge::Scene& scene, std::filesystem::path directory, WorldStreamerConfig const& config = {});
+    WorldStreamer(WorldStreamer const& r) = delete;
+    WorldStreamer(WorldStreamer&& r) noexcept = delete;
+    ~WorldStreamer();
+
+    WorldStreamer& operator=(WorldStreamer const& r) = delete;
+    WorldStreamer& operator=(WorldStreamer&& r) noexcept = delete;
+
+    void setConfig(WorldStreamerConfig const& config);
+    [[nodiscard]] WorldStreamerConfig const& getConfig() const;
+
+    [[nodiscard]] fge::Scene& getScene() const;
+    [[nodiscard]] std::filesystem::path const& getDirectory() const;
+
+    /**
+     * \brief Update the streaming with some interest points
+     *
+     * This must be called from the thread that own the Scene, generally once per frame.
+     * Finished loadings are transferred in the Scene, far cells are unloaded and new cells are requested.
+     *
+     * \param interestPoints The world positions around which cells must be loaded
+     */
+    void update(std::span<fge::Vector2f const> interestPoints);
+    /**
+     * \brief Update the streaming with one interest point
+     *
+     * \see update(std::span<fge::Vector2f const>)
+     *
+     * \param interestPoint The world position around which cells must be loaded
+     */
+    void update(fge::Vector2f const& interestPoint);
+
+    /**
+     * \brief Unload every cell
+     *
+     * Pending loadings are waited and discarded.
+     */
+    void unloadAll();
+
+    [[nodiscard]] fge::Vector2i getCellCoord(fge::Vector2f const& position) const;
+    [[nodiscard]] fge::RectFloat getCellBounds(fge::Vector2i const& cell) const;
+    [[nodiscard]] CellStates getCellState(fge::Vector2i const& cell) const;
+
+    [[nodiscard]] std::filesystem::path getCellObjectsPath(fge::Vector2i const& cell) const;
+    [[nodiscard]] std::filesystem::path getCellTilesPath(fge::Vector2i const& cell) const;
+
+    [[nodiscard]] std::size_t getLoadedCellCount() const;
+    [[nodiscard]] std::size_t getLoadingCellCount() const;
+    /**
+     * \brief Get the estimated memory of the loaded cells
+     *
+     * \return The memory in bytes
+     */
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+    fge::CallbackHandler<fge::WorldStreamer&, fge::Vector2i const&> _onCellLoaded;
+    fge::CallbackHandler<fge::WorldStreamer&, fge::Vector2i const&> _onCellUnloaded;
+
+private:
+    struct LoadedData
+    {
+        std::optional<fge::SceneSnapshotData> _objects;
+        std::optional<nlohmann::json> _tiles;
+        std::size_t _objectsMemorySize{0};
+        std::size_t _tilesMemorySize{0};
+    };
+
+    struct Cell
+    {
+        CellStates _state{CellStates::UNLOADED};
+        std::future<LoadedData> _loading;
+        std::vector<fge::ObjectDataWeak> _objects;
+        std::shared_ptr<fge::TileMap> _tileMap;
+        std::size_t _memorySize{0};
+    };
+
+    using CellMap = std::unordered_map<fge::Vector2i, Cell, fge::Vector2iHash>;
+
+    [[nodiscard]] float getCellDistance(fge::Vector2i const& cell, std::span<fge::Vector2f const> points) const;
+
+    void integrateCell(fge::Vector2i const& cell, Cell& data, LoadedData&& loadedData);
+    void unloadCell(fge::Vector2i const& cell, Cell& data);
+
+    fge::Scene* g_scene;
+    std::filesystem::path g_directory;
+    WorldStreamerConfig g_config;
+
+    CellMap g_cells;
+    std::size_t g_loadingCount{0};
+    std::size_t g_memoryUsage{0};
+};
+
+} // namespace fge
+
+#endif // _FGE_C_WORLDSTREAMER_HPP_INCLUDED
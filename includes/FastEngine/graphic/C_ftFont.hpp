@@ -27,18 +27,42 @@
 #include "FastEngine/fge_extern.hpp"
 #include "FastEngine/C_rect.hpp"
 #include "FastEngine/graphic/C_glyph.hpp"
+#include "FastEngine/graphic/C_skylinePacker.hpp"
 #include "FastEngine/graphic/C_surface.hpp"
 #include "FastEngine/vulkan/C_textureImage.hpp"
 #include <filesystem>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+#define FGE_FONT_PAGE_DEFAULT_SIZE 128
+#define FGE_FONT_GLYPH_PADDING 2
+#define FGE_FONT_GLYPH_CACHE_MAGIC {'F', 'G', 'E', 'G'}
+#define FGE_FONT_GLYPH_CACHE_VERSION 2
+#define FGE_FONT_GLYPH_CACHE_FLAG_SDF 0x0001
+
+#define FGE_FONT_SDF_BASE_SIZE 48
+#define FGE_FONT_SDF_SPREAD 8
+#define FGE_FONT_SDF_GLYPH_PADDING FGE_FONT_SDF_SPREAD //!< Shadow offsets up to the spread stay in the padding
+
 namespace fge
 {
 
 using CharacterSize = uint16_t;
 
+/**
+ * \brief Build a string containing every code point of a range
+ *
+ * Useful to bake a charset with FreeTypeFont::bakeGlyphs(), e.g. MakeCodePointRange(0x20, 0xFF) for Latin-1.
+ *
+ * \param first The first code point
+ * \param last The last code point (included)
+ * \return The code points
+ */
+FGE_API std::u32string MakeCodePointRange(char32_t first, char32_t last);
+
 class FGE_API FreeTypeFont
 {
 public:
@@ -47,6 +71,15 @@ public:
         std::string family;
     };
 
+    /**
+     * \brief How the glyphs are rasterized
+     */
+    enum class RenderModes : uint8_t
+    {
+        BITMAP, ///< One page of coverage bitmaps per character size
+        SDF     ///< One page of signed distance fields for every character size
+    };
+
     FreeTypeFont();
     FreeTypeFont(FreeTypeFont const& r) = delete;
     ~FreeTypeFont();
@@ -67,7 +100,80 @@ public:
     float getUnderlinePosition(fge::CharacterSize characterSize) const;
     float getUnderlineThickness(fge::CharacterSize characterSize) const;
 
+    /**
+     * \brief Change how the glyphs are rasterized
+     *
+     * In SDF mode, every glyph is rasterized once at FGE_FONT_SDF_BASE_SIZE as a signed distance field
+     * (the distance to the outline is stored in the alpha channel, 0.5 being the edge and
+     * FGE_FONT_SDF_SPREAD pixels the maximum distance). Every character size then share the same page and
+     * getGlyph() scale the glyph metrics to the requested size. The glyphs are not hinted in this mode and
+     * must be drawn with the FGE_SHADER_DEFAULT_SDF_FRAGMENT shader.
+     *
+     * Every page is cleared when the mode change.
+     *
+     * \param mode The new render mode
+     * \return \b false if the mode is not supported by the font (SDF need a scalable font)
+     */
+    bool setRenderMode(RenderModes mode);
+    [[nodiscard]] RenderModes getRenderMode() const;
+    /**
+     * \brief Get the scale between a character size and the size of the glyphs in its page
+     *
+     * \param characterSize The character size
+     * \return characterSize / FGE_FONT_SDF_BASE_SIZE in SDF mode, 1 otherwise
+     */
+    [[nodiscard]] float getGlyphScale(fge::CharacterSize characterSize) const;
+
     fge::vulkan::TextureImage const& getTexture(fge::CharacterSize characterSize) const;
+    /**
+     * \brief Get the revision of the page of a character size
+     *
+     * The revision changes every time the glyph texture coordinates of the page are invalidated:
+     * when the page is created, when its texture is enlarged or when it is replaced by a glyph cache.
+     * Adding a glyph to a page doesn't change its revision.
+     *
+     * \param characterSize The character size of the page
+     * \return The revision of the page
+     */
+    [[nodiscard]] uint32_t getPageRevision(fge::CharacterSize characterSize) const;
+
+    /**
+     * \brief Rasterize glyphs in advance for some character sizes
+     *
+     * Glyphs are normally rasterized the first time they are used, which can cause hitches.
+     * This function rasterize every missing glyph, enlarge the page texture at most once and upload it
+     * once per character size.
+     *
+     * In SDF mode, the character sizes are ignored as every glyph is rasterized once in the shared page.
+     *
+     * \param codePoints The code points to rasterize
+     * \param characterSizes The character sizes
+     * \param bold \b true to rasterize the bold glyphs
+     * \param outlineThickness The outline thickness of the glyphs
+     * \return The number of glyphs that were rasterized
+     */
+    std::size_t bakeGlyphs(std::u32string_view codePoints,
+                           std::span<fge::CharacterSize const> characterSizes,
+                           bool bold = false,
+                           float outlineThickness = 0.0f) const;
+
+    /**
+     * \brief Save every page (glyph table and pixels) in a glyph cache file
+     *
+     * \param filePath The path of the file
+     * \return \b true if the file was saved
+     */
+    bool saveGlyphCache(std::filesystem::path const& filePath) const;
+    /**
+     * \brief Load the pages of a glyph cache file, so glyphs don't have to be rasterized again
+     *
+     * The font must be loaded first, a cache made from another font (family, style or glyph count)
+     * or with another render mode is refused. Loaded pages replace the existing pages of the same character size.
+     *
+     * \param filePath The path of the file
+     * \return \b true if the cache was loaded
+     */
+    bool loadGlyphCache(std::filesystem::path const& filePath);
 
     void setSmooth(bool smooth);
     bool isSmooth() const;
@@ -75,40 +181,39 @@ public:
     [[nodiscard]] std::vector<long> getAvailableSize() const;
 
 private:
-    struct Row
-    {
-        Row(unsigned int rowTop, unsigned int rowHeight) :
-                _width(0),
-                _top(rowTop),
-                _height(rowHeight)
-        {}
-
-        unsigned int _width;  //!< Current width of the row
-        unsigned int _top;    //!< Y position of the row into the texture
-        unsigned int _height; //!< Height of the row
-    };
-
     using GlyphTable = std::unordered_map<uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
 
     struct Page
     {
-        explicit Page(bool smooth);
+        Page(bool smooth, uint32_t revision);
 
         GlyphTable _glyphs;                 //!< Table mapping code points to their corresponding glyph
+        std::vector<uint8_t> _alpha;        //!< CPU copy of the texture alpha (glyphs are white), sized like the packer
         fge::vulkan::TextureImage _texture; //!< Texture containing the pixels of the glyphs
-        unsigned int _nextRow;              //!< Y position of the next new row in the texture
-        std::vector<Row> _rows;             //!< List containing the position of all the existing rows
+        fge::SkylinePacker _packer;         //!< Free space of the texture
+        uint32_t _revision;                 //!< Changed every time the texture coordinates are invalidated
     };
 
     using PageTable =
             std::unordered_map<fge::CharacterSize, Page>; //!< Table mapping a character size to its page (texture)
+    using SdfGlyphTable = std::unordered_map<fge::CharacterSize, GlyphTable>;
 
     void cleanup();
 
     Page& loadPage(fge::CharacterSize characterSize) const;
+    [[nodiscard]] fge::CharacterSize getPageSize(fge::CharacterSize characterSize) const;
+    [[nodiscard]] bool isPageSmooth() const;
+    Glyph const& findGlyph(uint32_t codePoint, fge::CharacterSize pageSize, bool bold, float outlineThickness) const;
     Glyph loadGlyph(uint32_t codePoint, fge::CharacterSize characterSize, bool bold, float outlineThickness) const;
+    bool rasterizeGlyph(uint32_t codePoint,
+                        fge::CharacterSize characterSize,
+                        bool bold,
+                        float outlineThickness,
+                        Glyph& glyph) const;
+    void placeGlyph(Page& page, Glyph& glyph, fge::Surface const& bitmap, bool updateTexture) const;
 
     fge::RectInt findGlyphRect(Page& page, unsigned int width, unsigned int height) const;
+    bool resizePage(Page& page, fge::Vector2i const& size) const;
 
     bool setCurrentSize(fge::CharacterSize characterSize) const;
 
@@ -117,7 +222,10 @@ private:
     void* g_stroker;   //!< Pointer to the stroker (it is typeless to avoid exposing implementation details)
     bool g_isSmooth;   //!< Status of the smooth filter
     Info g_info;       //!< Information about the font
+    RenderModes g_renderMode;             //!< How the glyphs are rasterized
     mutable PageTable g_pages;            //!< Table containing the glyphs pages by character size
+    mutable SdfGlyphTable g_sdfGlyphs;    //!< Glyphs of the SDF page scaled to each character size
+    mutable uint32_t g_pageRevision;      //!< Last given page revision, never reset
     mutable fge::Surface g_surfaceBuffer; //!< Surface holding a glyph's pixels before being written to the texture
 };
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _FGE_GRAPHIC_C_SKYLINEPACKER_HPP_INCLUDED
+#define _FGE_GRAPHIC_C_SKYLINEPACKER_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "FastEngine/C_rect.hpp"
+#include "FastEngine/C_vector.hpp"
+#include <optional>
+#include <vector>
+
+namespace fge
+{
+
+/**
+ * \class SkylinePacker
+ * \ingroup graphics
+ * \brief Pack rectangles into a 2D area with the skyline bottom-left heuristic
+ *
+ * The packer keeps the top edge (the skyline) of the already placed rectangles as a list of horizontal segments.
+ * A new rectangle is placed on the segment where its top is the lowest, so placing a rectangle only
+ * looks at the skyline segments and not at every placed rectangle.
+ *
+ * The area can grow without moving the already placed rectangles.
+ */
+class FGE_API SkylinePacker
+{
+public:
+    /**
+     * \brief An horizontal segment of the skyline
+     */
+    struct Node
+    {
+        int _x{0};
+        int _y{0};
+        int _width{0};
+    };
+
+    SkylinePacker() = default;
+    explicit SkylinePacker(fge::Vector2i const& size);
+
+    /**
+     * \brief Remove every rectangle and set a new size
+     *
+     * \param size The new size of the area
+     */
+    void reset(fge::Vector2i const& size);
+    /**
+     * \brief Restore a previously saved skyline
+     *
+     * \param size The size of the area
+     * \param nodes The skyline, sorted by x and covering the whole width
+     * \param usedArea The area of the placed rectangles
+     * \return \b true if the skyline is valid for the size, \b false otherwise (the packer is left unchanged)
+     */
+    bool restore(fge::Vector2i const& size, std::vector<Node> nodes, std::size_t usedArea);
+
+    /**
+     * \brief Find a place for a rectangle and mark it as used
+     *
+     * \param width The width of the rectangle
+     * \param height The height of the rectangle
+     * \return The placed rectangle or std::nullopt if there is not enough space
+     */
+    [[nodiscard]] std::optional<fge::RectInt> insert(int width, int height);
+    /**
+     * \brief Enlarge the area, the already placed rectangles are kept at the same position
+     *
+     * \param size The new size, a dimension smaller than the current one is ignored
+     */
+    void grow(fge::Vector2i const& size);
+
+    [[nodiscard]] fge::Vector2i const& getSize() const;
+    [[nodiscard]] std::vector<Node> const& getNodes() const;
+    [[nodiscard]] std::size_t getUsedArea() const;
+    /**
+     * \brief Get the ratio of the area used by the placed rectangles
+     *
+     * \return The occupancy between 0.0f and 1.0f
+     */
+    [[nodiscard]] float getOccupancy() const;
+
+private:
+    [[nodiscard]] std::optional<int> fit(std::size_t index, int width, int height) const;
+    void mergeNodes();
+
+    fge::Vector2i g_size{0, 0};
+    std::vector<Node> g_nodes;
+    std::size_t g_usedArea{0};
+};
+
+} // namespace fge
+
+#endif // _FGE_GRAPHIC_C_SKYLINEPACKER_HPP_INCLUDED
@@ -100,6 +100,23 @@ public:
      */
     void createMaskFromColor(fge::Color const& color, uint8_t alpha = 0);
 
+    /**
+     * \brief Multiply the color channels of every pixel by its alpha
+     *
+     * The surface must have 32 bits pixels with the alpha as the last byte (like SDL_PIXELFORMAT_RGBA32).
+     *
+     * \return true if the surface was premultiplied
+     */
+    bool premultiplyAlpha();
+    /**
+     * \brief Divide the color channels of every pixel by its alpha, the opposite of premultiplyAlpha()
+     *
+     * Some precision is lost for pixels with a low alpha.
+     *
+     * \return true if the surface was unpremultiplied
+     */
+    bool unpremultiplyAlpha();
+
     bool setPixel(int x, int y, fge::Color const& color);
     [[nodiscard]] std::optional<fge::Color> getPixel(int x, int y) const;
 
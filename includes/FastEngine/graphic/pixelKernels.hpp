@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _FGE_GRAPHIC_PIXELKERNELS_HPP_INCLUDED
+#define _FGE_GRAPHIC_PIXELKERNELS_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace fge::pixel
+{
+
+/**
+ * Row kernels working on raw 32 bits pixels
+ * \ingroup graphics
+ *
+ * Every kernel works on a single row of pixels, so a surface with a pitch different from its
+ * width can be processed row by row.
+ *
+ * The implementation is chosen at compile time: AVX2 (when the library is built with FGE_ENABLE_AVX2),
+ * SSE2, NEON or a scalar fallback. Every implementation produce the same results.
+ *
+ * Kernels that need the alpha channel expect the alpha to be the fourth byte of a pixel in memory,
+ * like SDL_PIXELFORMAT_RGBA32 or SDL_PIXELFORMAT_BGRA32.
+ * @{
+ */
+
+/**
+ * \brief Get the name of the instruction set used by the kernels
+ *
+ * \return "AVX2", "SSE2", "NEON" or "scalar"
+ */
+FGE_API char const* GetKernelsInstructionSet();
+
+/**
+ * \brief Reverse the order of the pixels of a row
+ *
+ * \param row The row of pixels
+ * \param count The number of pixels in the row
+ */
+FGE_API void ReverseRow(uint32_t* row, std::size_t count);
+/**
+ * \brief Swap the pixels of two non-overlapping rows
+ *
+ * \param rowA The first row of pixels
+ * \param rowB The second row of pixels
+ * \param count The number of pixels in a row
+ */
+FGE_API void SwapRows(uint32_t* rowA, uint32_t* rowB, std::size_t count);
+/**
+ * \brief Set every pixel of a row to the same value
+ *
+ * \param row The row of pixels
+ * \param count The number of pixels in the row
+ * \param pixel The pixel value
+ */
+FGE_API void FillRow(uint32_t* row, std::size_t count, uint32_t pixel);
+/**
+ * \brief Replace every pixel equal to a key by another value (color keying)
+ *
+ * \param row The row of pixels
+ * \param count The number of pixels in the row
+ * \param key The pixel value to replace
+ * \param replacement The new pixel value
+ */
+FGE_API void ReplaceRow(uint32_t* row, std::size_t count, uint32_t key, uint32_t replacement);
+/**
+ * \brief Multiply the color channels of every pixel by its alpha
+ *
+ * Every channel is rounded to the nearest value of (channel * alpha / 255).
+ *
+ * \param row The row of pixels
+ * \param count The number of pixels in the row
+ */
+FGE_API void PremultiplyRow(uint32_t* row, std::size_t count);
+/**
+ * \brief Divide the color channels of every pixel by its alpha, the opposite of PremultiplyRow
+ *
+ * Channels of a fully transparent pixel are set to 0.
+ *
+ * \param row The row of pixels
+ * \param count The number of pixels in the row
+ */
+FGE_API void UnpremultiplyRow(uint32_t* row, std::size_t count);
+/**
+ * \brief Compute a row of the next mip level with a 2x2 box filter
+ *
+ * The destination row have max(srcCount / 2, 1) pixels, every one of them is the rounded average of
+ * 2x2 source pixels. When srcCount is odd, the last source column is ignored (or repeated if it is the only one).
+ * When the source have a single row, rowA and rowB can be the same.
+ *
+ * \param rowA The first source row
+ * \param rowB The second source row
+ * \param srcCount The number of pixels in a source row
+ * \param dst The destination row
+ */
+FGE_API void DownsampleRows(uint32_t const* rowA, uint32_t const* rowB, std::size_t srcCount, uint32_t* dst);
+
+/**
+ * @}
+ */
+
+} // namespace fge::pixel
+
+#endif //_FGE_GRAPHIC_PIXELKERNELS_HPP_INCLUDED
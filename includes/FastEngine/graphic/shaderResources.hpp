@@ -31,10 +31,12 @@ namespace fge::res
 FGE_API extern char const gDefaultVertexShader[];
 FGE_API extern char const gDefaultFragmentShader[];
 FGE_API extern char const gDefaultFragmentTextureShader[];
+FGE_API extern char const gDefaultSdfFragmentShader[];
 
 FGE_API extern unsigned int const gDefaultVertexShaderSize;
 FGE_API extern unsigned int const gDefaultFragmentShaderSize;
 FGE_API extern unsigned int const gDefaultFragmentTextureShaderSize;
+FGE_API extern unsigned int const gDefaultSdfFragmentShaderSize;
 
 /**
  * @}
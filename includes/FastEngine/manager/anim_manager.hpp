@@ -19,6 +19,7 @@
 
 #include "FastEngine/fge_extern.hpp"
 
+#include "FastEngine/C_rect.hpp"
 #include "FastEngine/C_vector.hpp"
 #include "FastEngine/manager/C_baseManager.hpp"
 #include "FastEngine/textureType.hpp"
@@ -26,6 +27,9 @@
 
 #define FGE_ANIM_DEFAULT_TICKS 100
 
+#define FGE_ANIM_ATLAS_MAX_SIZE 4096
+#define FGE_ANIM_ATLAS_PADDING 1
+
 #define FGE_ANIM_BAD FGE_MANAGER_BAD
 
 namespace fge::anim
@@ -39,7 +43,7 @@ namespace fge::anim
 enum class AnimationType
 {
     ANIM_TYPE_TILESET,       ///< Tileset type, you have just one texture with multiple frame in it
-    ANIM_TYPE_SEPARATE_FILES ///< Separate files, every frame is in a different file
+    ANIM_TYPE_SEPARATE_FILES ///< Separate files, every frame is in a different file packed in one atlas texture
 };
 
 /**
@@ -52,6 +56,7 @@ struct AnimationFrame
     std::shared_ptr<fge::TextureType> _texture; ///< The shared pointer texture of the frame
     std::filesystem::path _path;                ///< The file path of the texture
     fge::Vector2u _texturePosition; ///< The tileset grid position, only useful if the type is ANIM_TYPE_TILESET
+    fge::RectInt _textureRect; ///< The rectangle in the texture, only useful if the type is ANIM_TYPE_SEPARATE_FILES
 
     uint32_t _ticks; ///< The number of ticks that the frame will be displayed, by default 1 tick take 100 ms.
 };
@@ -105,6 +110,10 @@ public:
      * The specified file must be a valid json file that contains the information of the animation
      * and its groups.
      *
+     * With the "separate" type, every distinct frame file is packed into one atlas texture shared by all
+     * the frames of the animation, the frames then carry their rectangle in the atlas. If the frames do not
+     * fit in an atlas of FGE_ANIM_ATLAS_MAX_SIZE pixels (or the device limit), every frame get its own texture.
+     *
      * Here is an example of a valid json file:
      * \code{.json}
      * {
@@ -19,6 +19,7 @@
 
 #include "FastEngine/fge_extern.hpp"
 
+#include "FastEngine/C_stringId.hpp"
 #include "FastEngine/object/C_object.hpp"
 #include <memory>
 #include <string>
@@ -40,9 +41,11 @@ public:
     [[nodiscard]] virtual fge::Object* duplicate(fge::Object const* obj) const = 0;
 
     [[nodiscard]] std::string const& getClassName() const { return this->g_className; }
+    [[nodiscard]] fge::StringId getClassNameId() const { return this->g_classNameId; }
 
 protected:
     std::string g_className;
+    fge::StringId g_classNameId;
 };
 template<class T>
 class Stamp : public BaseStamp
@@ -52,6 +55,7 @@ public:
     {
         T obj;
         this->g_className = obj.getClassName();
+        this->g_classNameId = fge::InternString(this->g_className);
     }
 
     [[nodiscard]] fge::Object* createNew() const final { return new T(); }
@@ -71,6 +75,7 @@ inline bool RegisterNewClass()
 }
 
 FGE_API bool Check(std::string_view className);
+FGE_API bool Check(fge::StringId className);
 FGE_API bool Check(fge::reg::ClassId classId);
 
 FGE_API fge::Object* Duplicate(fge::Object const* obj);
@@ -81,12 +86,15 @@ FGE_API bool Replace(fge::reg::ClassId classId, std::unique_ptr<fge::reg::BaseSt
 FGE_API std::size_t GetRegisterSize();
 
 FGE_API fge::Object* GetNewClassOf(std::string_view className);
+FGE_API fge::Object* GetNewClassOf(fge::StringId className);
 FGE_API fge::Object* GetNewClassOf(fge::reg::ClassId classId);
 
 FGE_API fge::reg::ClassId GetClassId(std::string_view className);
+FGE_API fge::reg::ClassId GetClassId(fge::StringId className);
 FGE_API std::string GetClassName(fge::reg::ClassId classId);
 
 FGE_API fge::reg::BaseStamp* GetStampOf(std::string_view className);
+FGE_API fge::reg::BaseStamp* GetStampOf(fge::StringId className);
 FGE_API fge::reg::BaseStamp* GetStampOf(fge::reg::ClassId classId);
 
 } // namespace fge::reg
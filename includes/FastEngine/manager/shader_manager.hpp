@@ -26,6 +26,7 @@
 #define FGE_SHADER_DEFAULT_VERTEX "FGE:VERTEX"
 #define FGE_SHADER_DEFAULT_NOTEXTURE_FRAGMENT "FGE:NT_FRAG"
 #define FGE_SHADER_DEFAULT_FRAGMENT "FGE:FRAG"
+#define FGE_SHADER_DEFAULT_SDF_FRAGMENT "FGE:SDF_FRAG"
 
 namespace fge::shader
 {
@@ -58,10 +59,12 @@ public:
      * A bad shader is created with this function, it is used when a shader is not found.
      * You also have to provide a default vertex and fragments shaders.
      *
-     * 3 default shaders are created :
+     * 4 default shaders are created :
      * FGE_SHADER_DEFAULT_VERTEX : The default vertex shader (in shaderResources.hpp gDefaultVertexShader)
      * FGE_SHADER_DEFAULT_NOTEXTURE_FRAGMENT : The default fragment shader with no texture attached (in shaderResources.hpp gDefaultFragmentShader)
      * FGE_SHADER_DEFAULT_FRAGMENT : The default fragment shader (in shaderResources.hpp gDefaultFragmentTextureShader)
+     * FGE_SHADER_DEFAULT_SDF_FRAGMENT : The fragment shader of signed distance field fonts, with outline and shadow
+     * (in shaderResources.hpp gDefaultSdfFragmentShader)
      *
      * \return \b true if the shader manager is correctly initialized, \b false otherwise
      */
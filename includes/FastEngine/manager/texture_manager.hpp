@@ -22,6 +22,7 @@
 #include "FastEngine/graphic/C_surface.hpp"
 #include "FastEngine/manager/C_baseManager.hpp"
 #include "FastEngine/textureType.hpp"
+#include "FastEngine/vulkan/C_textureData.hpp"
 #include <vector>
 
 #define FGE_TEXTURE_BAD FGE_MANAGER_BAD
@@ -81,9 +82,22 @@ public:
      * \return \b true if the texture was loaded, \b false otherwise
      */
     bool loadFromSurface(std::string_view name, fge::Surface const& surface);
+    /**
+     * \brief Load a texture from a texture data
+     *
+     * The levels of the data are uploaded as is, compressed data is never decoded.
+     * On the server, only uncompressed data can be loaded and only the first level is kept.
+     *
+     * \param name The name of the texture to load
+     * \param data The texture data to load
+     * \return \b true if the texture was loaded, \b false otherwise
+     */
+    bool loadFromTextureData(std::string_view name, fge::vulkan::TextureData const& data);
     /**
      * \brief Load a texture from a file
      *
+     * KTX2 and DDS files are loaded with fge::vulkan::TextureData, any other format is loaded with SDL_image.
+     *
      * \param name The name of the texture to load
      * \param path The path of the file to load
      * \return \b true if the texture was loaded, \b false otherwise
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _FGE_C_BANDWIDTHLIMITER_HPP_INCLUDED
+#define _FGE_C_BANDWIDTHLIMITER_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#define FGE_NET_BANDWIDTH_DEFAULT_MIN_RATE 16384
+#define FGE_NET_BANDWIDTH_DEFAULT_BURST_SIZE 16384
+#define FGE_NET_BANDWIDTH_DEFAULT_DECREASE_FACTOR 0.75f
+#define FGE_NET_BANDWIDTH_DEFAULT_RECOVERY_RATIO 0.1f
+#define FGE_NET_BANDWIDTH_LOSS_COOLDOWN                                                                                \
+    std::chrono::milliseconds                                                                                          \
+    {                                                                                                                  \
+        250                                                                                                            \
+    }
+
+namespace fge::net
+{
+
+/**
+ * \struct BandwidthLimiterConfig
+ * \ingroup network
+ * \brief Tuning parameters of a BandwidthLimiter
+ *
+ * - _maxRate: the maximum rate in bytes per second, 0 disable the limiter
+ * - _minRate: the adaptive rate never goes below this rate
+ * - _burstSize: the capacity of the token bucket in bytes
+ * - _adaptive: if \b true, the rate is estimated from the lost packets
+ * - _decreaseFactor: the rate is multiplied by this factor when a loss is reported
+ * - _recoveryRatio: the ratio of _maxRate added every second without loss
+ */
+struct BandwidthLimiterConfig
+{
+    uint32_t _maxRate{0};
+    uint32_t _minRate{FGE_NET_BANDWIDTH_DEFAULT_MIN_RATE};
+    uint32_t _burstSize{FGE_NET_BANDWIDTH_DEFAULT_BURST_SIZE};
+    bool _adaptive{true};
+    float _decreaseFactor{FGE_NET_BANDWIDTH_DEFAULT_DECREASE_FACTOR};
+    float _recoveryRatio{FGE_NET_BANDWIDTH_DEFAULT_RECOVERY_RATIO};
+};
+
+/**
+ * \class BandwidthLimiter
+ * \ingroup network
+ * \brief A token bucket limiting the transmission rate of a client
+ *
+ * Tokens (bytes) are refilled at the current rate up to the burst size. A packet can be sent as long as
+ * the bucket is not empty, its size is then consumed and the bucket can go in debt, so big packets are never
+ * blocked forever.
+ *
+ * When adaptive, the rate follow an AIMD (additive increase, multiplicative decrease) estimation:
+ * every reported loss decrease the rate (at most once per FGE_NET_BANDWIDTH_LOSS_COOLDOWN) and
+ * the rate slowly goes back to the maximum rate when there is no loss.
+ *
+ * The limiter is thread-safe, losses are generally reported by another thread than the transmission one.
+ */
+class FGE_API BandwidthLimiter
+{
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    BandwidthLimiter() = default;
+
+    void setConfig(BandwidthLimiterConfig const& config);
+    [[nodiscard]] BandwidthLimiterConfig getConfig() const;
+    [[nodiscard]] bool isEnabled() const;
+
+    /**
+     * \brief Check if a packet can be sent now
+     *
+     * A refused packet is accounted as a throttled transmission.
+     *
+     * \param timePoint The current time
+     * \return \b true if the packet can be sent
+     */
+    [[nodiscard]] bool tryAcquire(TimePoint const& timePoint = std::chrono::steady_clock::now());
+    /**
+     * \brief Consume the size of a sent packet
+     *
+     * \param size The size of the sent packet in bytes
+     */
+    void consume(std::size_t size);
+    /**
+     * \brief Report a lost packet, decreasing the rate if adaptive
+     *
+     * \param timePoint The current time
+     */
+    void reportLoss(TimePoint const& timePoint = std::chrono::steady_clock::now());
+
+    /**
+     * \brief Get the current rate
+     *
+     * \return The rate in bytes per second, 0 if the limiter is disabled
+     */
+    [[nodiscard]] uint32_t getRate() const;
+    [[nodiscard]] uint64_t getSentPackets() const;
+    [[nodiscard]] uint64_t getSentBytes() const;
+    [[nodiscard]] uint64_t getThrottledCount() const;
+    [[nodiscard]] uint64_t getLossCount() const;
+
+    void resetCounters();
+
+private:
+    void refill(TimePoint const& timePoint);
+
+    mutable std::mutex g_mutex;
+    BandwidthLimiterConfig g_config;
+
+    double g_rate{0.0};
+    double g_tokens{0.0};
+    TimePoint g_lastRefill{};
+    TimePoint g_lastLoss{};
+
+    uint64_t g_sentPackets{0};
+    uint64_t g_sentBytes{0};
+    uint64_t g_throttledCount{0};
+    uint64_t g_lossCount{0};
+};
+
+} // namespace fge::net
+
+#endif // _FGE_C_BANDWIDTHLIMITER_HPP_INCLUDED
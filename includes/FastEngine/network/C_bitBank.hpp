@@ -63,6 +63,25 @@ public:
      * \return The value of the bit or 0 if out of range
      */
     [[nodiscard]] bool get(std::size_t index) const;
+    /**
+     * \brief Write a group of bits
+     *
+     * This function write the \b count least significant bits of \b value starting at the bit \b index.
+     * Bits that would be written out of range are ignored.
+     *
+     * \param index The index of the first bit to write
+     * \param value The value to write
+     * \param count The number of bits to write (max 64)
+     */
+    void setBits(std::size_t index, uint64_t value, std::size_t count);
+    /**
+     * \brief Read a group of bits
+     *
+     * \param index The index of the first bit to read
+     * \param count The number of bits to read (max 64)
+     * \return The read value, out of range bits are read as 0
+     */
+    [[nodiscard]] uint64_t getBits(std::size_t index, std::size_t count) const;
     /**
      * \brief Get the specified byte
      *
@@ -83,13 +102,29 @@ public:
      *
      * \param pck The network packet to pack the bank data into
      */
-    void pack(fge::net::Packet& pck);
+    void pack(fge::net::Packet& pck) const;
+    /**
+     * \brief Pack only the first bytes of the bank into the packet
+     *
+     * Useful when only a part of the bank is used, see setBits().
+     *
+     * \param pck The network packet to pack the bank data into
+     * \param size The number of bytes to pack (clamped to the bank size)
+     */
+    void pack(fge::net::Packet& pck, std::size_t size) const;
     /**
      * \brief Unpack the bank data from the packet
      *
      * \param pck The network packet to unpack the bank data from
      */
-    void unpack(fge::net::Packet& pck);
+    void unpack(fge::net::Packet const& pck);
+    /**
+     * \brief Unpack only the first bytes of the bank from the packet
+     *
+     * \param pck The network packet to unpack the bank data from
+     * \param size The number of bytes to unpack (clamped to the bank size)
+     */
+    void unpack(fge::net::Packet const& pck, std::size_t size);
 
 private:
     uint8_t g_data[TNbytes]{0};
@@ -31,7 +31,15 @@ void BitBank<TNbytes>::set(std::size_t index, bool flag)
 {
     if (index < TNbytes * 8)
     {
-        this->g_data[index / 8] = static_cast<uint8_t>(flag) << (index % 8);
+        uint8_t const mask = static_cast<uint8_t>(0x01 << (index % 8));
+        if (flag)
+        {
+            this->g_data[index / 8] |= mask;
+        }
+        else
+        {
+            this->g_data[index / 8] &= static_cast<uint8_t>(~mask);
+        }
     }
 }
 template<std::size_t TNbytes>
@@ -43,6 +51,27 @@ bool BitBank<TNbytes>::get(std::size_t index) const
     }
     return false;
 }
+template<std::size_t TNbytes>
+void BitBank<TNbytes>::setBits(std::size_t index, uint64_t value, std::size_t count)
+{
+    count = count > 64 ? 64 : count;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        this->set(index + i, ((value >> i) & 0x01) > 0);
+    }
+}
+template<std::size_t TNbytes>
+uint64_t BitBank<TNbytes>::getBits(std::size_t index, std::size_t count) const
+{
+    count = count > 64 ? 64 : count;
+    uint64_t value = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        value |= static_cast<uint64_t>(this->get(index + i)) << i;
+    }
+    return value;
+}
+
 template<std::size_t TNbytes>
 uint8_t BitBank<TNbytes>::getByte(std::size_t index) const
 {
@@ -60,14 +89,24 @@ std::size_t BitBank<TNbytes>::getSize() const
 }
 
 template<std::size_t TNbytes>
-void BitBank<TNbytes>::pack(fge::net::Packet& pck)
+void BitBank<TNbytes>::pack(fge::net::Packet& pck) const
 {
     pck.append(&this->g_data, TNbytes);
 }
 template<std::size_t TNbytes>
-void BitBank<TNbytes>::unpack(fge::net::Packet& pck)
+void BitBank<TNbytes>::pack(fge::net::Packet& pck, std::size_t size) const
+{
+    pck.append(&this->g_data, size > TNbytes ? TNbytes : size);
+}
+template<std::size_t TNbytes>
+void BitBank<TNbytes>::unpack(fge::net::Packet const& pck)
 {
     pck.read(&this->g_data, TNbytes);
 }
+template<std::size_t TNbytes>
+void BitBank<TNbytes>::unpack(fge::net::Packet const& pck, std::size_t size)
+{
+    pck.read(&this->g_data, size > TNbytes ? TNbytes : size);
+}
 
 } // namespace fge
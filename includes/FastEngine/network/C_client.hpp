@@ -19,6 +19,9 @@
 
 #include "FastEngine/fge_extern.hpp"
 #include "C_identity.hpp"
+#include "FastEngine/C_compressorLZ4.hpp"
+#include "FastEngine/network/C_bandwidthLimiter.hpp"
+#include "FastEngine/network/C_compressionPolicy.hpp"
 #include "FastEngine/C_event.hpp"
 #include "FastEngine/C_propertyList.hpp"
 #include "FastEngine/network/C_netCommand.hpp"
@@ -109,6 +112,15 @@ public:
      * \return Optionally a full timestamp offset
      */
     [[nodiscard]] std::optional<FullTimestampOffset> getClockOffset() const;
+    /**
+     * \brief Estimate the current time of the other side clock
+     *
+     * This is the time base used to sample an InterpolationBuffer with server timestamps.
+     *
+     * \param localTimestamp A local full timestamp, generally Client::getFullTimestamp_ms()
+     * \return Optionally the corresponding full timestamp of the other side
+     */
+    [[nodiscard]] std::optional<FullTimestamp> getOtherSideTimestamp_ms(FullTimestamp localTimestamp) const;
     /**
      * \brief Retrieve the latency
      *
@@ -175,6 +187,28 @@ struct ClientContext
     PacketCache _cache;
     PacketReorderer _reorderer;
     CommandQueue _commands;
+
+    CompressorLZ4 _compressor;            ///< Used by the transmission thread
+    CompressorLZ4HC _compressorHC;        ///< Used by the transmission thread, its big context is shared per thread
+    CompressorLZ4 _decompressor;          ///< Used by the reception thread
+    CompressionPolicy _compressionPolicy; ///< Choose the codec for every transmitted packet
+    BandwidthLimiter _bandwidthLimiter;   ///< Limit the transmission rate, estimated from the lost packets
+};
+
+/**
+ * \struct ClientQueueMetrics
+ * \brief A snapshot of the transmission queue of a Client
+ */
+struct ClientQueueMetrics
+{
+    /// Pending packets by priority
+    std::array<std::size_t, ProtocolPacket::PriorityCount> _pendingPackets{};
+    std::size_t _pendingForcedPackets{0}; ///< Pending fragments and retransmissions
+    std::size_t _pendingBytes{0};         ///< Size of all pending packets (before compression)
+    uint64_t _sentPackets{0};             ///< Sent packets since the last reset of the bandwidth limiter
+    uint64_t _sentBytes{0};               ///< Sent bytes since the last reset of the bandwidth limiter
+    uint64_t _throttledCount{0};          ///< Transmissions delayed by the bandwidth limiter
+    uint32_t _bandwidthRate{0};           ///< The current rate in bytes per second, 0 when not limited
 };
 
 class FGE_API ClientStatus
@@ -369,20 +403,31 @@ public:
      *
      * The packet will be sent when the network thread is ready to send it.
      * The network thread is ready to send a packet when the time interval between the last sent packet
-     * is greater than the latency of the server->client.
+     * is greater than the latency of the server->client and the bandwidth limiter allows it.
      *
-     * The current realm will be set and the current countId will be incremented and set to the packet.
-     * - on the client side, advanceClientPacketCountId() will be called
-     * - on the server side, advanceCurrentPacketCountId() will be called
+     * Every priority (see ProtocolPacket::getPriority) has its own queue, a packet is always sent before the
+     * pending packets of a lower priority.
      *
      * \param pck The packet to send with eventual options
      */
     void pushPacket(TransmitPacketPtr pck);
+    /**
+     * \brief Add a Packet in front of every pending packets
+     *
+     * This is used for fragments and retransmissions, the packet must already have its realm and counters.
+     *
+     * \param pck The packet to send
+     */
     void pushForcedFrontPacket(TransmitPacketPtr pck);
     [[nodiscard]] bool isReadyToAcceptMorePendingPackets() const;
     /**
      * \brief Pop a packet from the queue
      *
+     * The forced packets are popped first, then the packet with the highest priority.
+     * As packets can be reordered by their priority, the current realm and countId are set to the packet here:
+     * - the packet counter of the HOST target is advanced
+     * - the reordered packet counter of the HOST target is advanced if the packet can be reordered
+     *
      * \return The popped packet or nullptr if the queue is empty
      */
     TransmitPacketPtr popPacket();
@@ -393,6 +438,7 @@ public:
      */
     bool isPendingPacketsEmpty() const;
     void allowMorePendingPackets(bool allow);
+    [[nodiscard]] ClientQueueMetrics getQueueMetrics() const;
 
     void disconnect(bool pushDisconnectPacket = true);
 
@@ -413,6 +459,16 @@ public:
 
     void acknowledgeReception(ReceivedPacketPtr const& packet);
     [[nodiscard]] std::unordered_set<PacketCache::Label, PacketCache::Label::Hash> const& getAcknowledgedList() const;
+    /**
+     * \brief Acknowledge the reception of a fragment
+     *
+     * Fragments are acknowledged individually in order to only retransmit the lost ones.
+     *
+     * \param packet The received fragment
+     */
+    void acknowledgeFragmentReception(ReceivedPacketPtr const& packet);
+    [[nodiscard]] std::unordered_set<PacketCache::Label, PacketCache::Label::Hash> const&
+    getAcknowledgedFragmentList() const;
     void clearAcknowledgedList();
 
     void clearLostPacketCount();
@@ -447,7 +503,9 @@ private:
     Latency_ms g_STOCLatency_ms;
     std::chrono::steady_clock::time_point g_lastPacketTimePoint;
 
-    std::deque<TransmitPacketPtr> g_pendingTransmitPackets;
+    std::deque<TransmitPacketPtr> g_pendingForcedPackets;
+    std::array<std::deque<TransmitPacketPtr>, ProtocolPacket::PriorityCount> g_pendingTransmitPackets;
+    std::size_t g_pendingBytes{0};
     mutable std::recursive_mutex g_mutex;
 
     std::chrono::steady_clock::time_point g_lastRealmChangeTimePoint;
@@ -459,6 +517,7 @@ private:
     ProtocolPacket::CounterType g_peerReorderedPacketCounter{0};
 
     std::unordered_set<PacketCache::Label, PacketCache::Label::Hash> g_acknowledgedPackets;
+    std::unordered_set<PacketCache::Label, PacketCache::Label::Hash> g_acknowledgedFragments;
     uint32_t g_lostPacketCount{0};
     uint32_t g_lostPacketThreshold{FGE_NET_DEFAULT_lOST_PACKET_THRESHOLD};
 
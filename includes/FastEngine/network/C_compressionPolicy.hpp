@@ -0,0 +1,195 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _FGE_C_COMPRESSIONPOLICY_HPP_INCLUDED
+#define _FGE_C_COMPRESSIONPOLICY_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "FastEngine/C_compressorLZ4.hpp"
+#include "FastEngine/network/C_protocol.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#define FGE_NET_COMPRESSION_DEFAULT_MIN_PAYLOAD_SIZE 64
+#define FGE_NET_COMPRESSION_DEFAULT_HC_MIN_PAYLOAD_SIZE 1024
+#define FGE_NET_COMPRESSION_DEFAULT_MIN_GAIN 0.05f
+#define FGE_NET_COMPRESSION_DEFAULT_MAX_CPU_TIME_PER_SAVED_BYTE_NS 50.0f
+#define FGE_NET_COMPRESSION_DEFAULT_PROBE_INTERVAL 64
+#define FGE_NET_COMPRESSION_ESTIMATE_SMOOTHING 0.1f
+
+namespace fge::net
+{
+
+/**
+ * \class CompressionStats
+ * \ingroup network
+ * \brief Thread-safe compression statistics
+ *
+ * Statistics are updated by the transmission thread and can be read from anywhere.
+ */
+class FGE_API CompressionStats
+{
+public:
+    CompressionStats() = default;
+
+    void add(std::size_t rawSize, std::size_t compressedSize, std::chrono::nanoseconds cpuTime);
+    void reset();
+
+    [[nodiscard]] uint64_t getPacketCount() const;
+    [[nodiscard]] uint64_t getRawBytes() const;
+    [[nodiscard]] uint64_t getCompressedBytes() const;
+    [[nodiscard]] std::chrono::nanoseconds getCpuTime() const;
+
+    /**
+     * \brief Get the compression ratio (compressed size / raw size)
+     *
+     * \return The ratio, 1.0 if nothing was compressed yet
+     */
+    [[nodiscard]] float getRatio() const;
+    [[nodiscard]] std::chrono::nanoseconds getMeanCpuTime() const;
+
+private:
+    std::atomic<uint64_t> g_packetCount{0};
+    std::atomic<uint64_t> g_rawBytes{0};
+    std::atomic<uint64_t> g_compressedBytes{0};
+    std::atomic<uint64_t> g_cpuTime_ns{0};
+};
+
+/**
+ * \struct CompressionPolicyConfig
+ * \ingroup network
+ * \brief Tuning parameters of a CompressionPolicy
+ *
+ * - _minPayloadSize: smaller payloads are never compressed
+ * - _highCompressionMinPayloadSize: LZ4HC is only considered for bigger payloads
+ * - _minGain: minimal estimated relative size reduction needed to compress
+ * - _maxCpuTimePerSavedByte_ns: maximal estimated CPU time accepted per saved byte
+ * - _probeInterval: a rejected codec is tried again every N eligible packets to refresh its estimate
+ */
+struct CompressionPolicyConfig
+{
+    bool _enabled{true};
+    std::size_t _minPayloadSize{FGE_NET_COMPRESSION_DEFAULT_MIN_PAYLOAD_SIZE};
+    std::size_t _highCompressionMinPayloadSize{FGE_NET_COMPRESSION_DEFAULT_HC_MIN_PAYLOAD_SIZE};
+    float _minGain{FGE_NET_COMPRESSION_DEFAULT_MIN_GAIN};
+    float _maxCpuTimePerSavedByte_ns{FGE_NET_COMPRESSION_DEFAULT_MAX_CPU_TIME_PER_SAVED_BYTE_NS};
+    uint32_t _probeInterval{FGE_NET_COMPRESSION_DEFAULT_PROBE_INTERVAL};
+};
+
+/**
+ * \class CompressionPolicy
+ * \ingroup network
+ * \brief Choose the compression codec of every transmitted packet of a client
+ *
+ * The policy keeps a running estimate of the compression ratio and the CPU time per byte of every codec.
+ * A codec is chosen only if its estimated gain is worth the estimated CPU time, the codec that
+ * save the most bytes is preferred. Rejected codecs are periodically probed again, the probe result
+ * replace the previous estimate in order to follow the evolution of the transmitted data.
+ *
+ * Counters can be read from any thread, the policy itself is meant to be used by the transmission thread.
+ */
+class FGE_API CompressionPolicy
+{
+public:
+    using Codecs = ProtocolPacket::CompressionCodecs;
+
+    enum class SkipReasons
+    {
+        DISABLED,
+        TOO_SMALL,
+        NOT_PROFITABLE,
+        EXPANDED,
+
+        SKIP_REASONS_COUNT
+    };
+
+    struct Estimate
+    {
+        float _ratio{1.0f};
+        float _cpuTimePerByte_ns{0.0f};
+        bool _valid{false};
+    };
+
+    CompressionPolicy() = default;
+
+    void setConfig(CompressionPolicyConfig const& config);
+    [[nodiscard]] CompressionPolicyConfig getConfig() const;
+
+    /**
+     * \brief Choose a codec for a payload
+     *
+     * \param payloadSize The payload size (without the header)
+     * \return The chosen codec, NONE if the payload should not be compressed
+     */
+    [[nodiscard]] Codecs choose(std::size_t payloadSize);
+    /**
+     * \brief Update the running estimate of a codec
+     *
+     * \param codec The codec used
+     * \param rawSize The raw payload size
+     * \param compressedSize The compressed payload size
+     * \param cpuTime The time spent compressing
+     */
+    void report(Codecs codec, std::size_t rawSize, std::size_t compressedSize, std::chrono::nanoseconds cpuTime);
+
+    /**
+     * \brief Choose a codec and compress the packet with it
+     *
+     * \param packet The packet to compress
+     * \param lz4 The compressor used for the LZ4 codec
+     * \param lz4hc The compressor used for the LZ4HC codec
+     * \return \b false if the compression failed
+     */
+    [[nodiscard]] bool compress(ProtocolPacket& packet, CompressorLZ4& lz4, CompressorLZ4HC& lz4hc);
+
+    /**
+     * \brief Get statistics of a codec
+     *
+     * Packets sent uncompressed are accounted in the NONE codec statistics.
+     *
+     * \param codec The codec
+     * \return The codec statistics
+     */
+    [[nodiscard]] CompressionStats const& getStats(Codecs codec) const;
+    [[nodiscard]] uint64_t getSkipCount(SkipReasons reason) const;
+    [[nodiscard]] Estimate getEstimate(Codecs codec) const;
+    /**
+     * \brief Get the overall ratio of all transmitted payloads (compressed or not)
+     *
+     * \return The overall ratio, 1.0 if nothing was transmitted yet
+     */
+    [[nodiscard]] float getOverallRatio() const;
+
+    void resetCounters();
+
+private:
+    [[nodiscard]] bool isAcceptable(Codecs codec, std::size_t payloadSize) const;
+    [[nodiscard]] bool shouldProbe(Codecs codec);
+
+    mutable std::mutex g_mutex;
+    CompressionPolicyConfig g_config;
+    std::array<Estimate, ProtocolPacket::CompressionCodecCount> g_estimates{};
+    std::array<uint32_t, ProtocolPacket::CompressionCodecCount> g_probeCounters{};
+
+    std::array<CompressionStats, ProtocolPacket::CompressionCodecCount> g_stats;
+    std::array<std::atomic<uint64_t>, static_cast<std::size_t>(SkipReasons::SKIP_REASONS_COUNT)> g_skipCounters{};
+};
+
+} // namespace fge::net
+
+#endif // _FGE_C_COMPRESSIONPOLICY_HPP_INCLUDED
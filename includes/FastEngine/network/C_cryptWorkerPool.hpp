@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _FGE_C_CRYPTWORKERPOOL_HPP_INCLUDED
+#define _FGE_C_CRYPTWORKERPOOL_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "FastEngine/network/C_clientList.hpp"
+#include "FastEngine/network/C_identity.hpp"
+#include "FastEngine/network/C_protocol.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define FGE_SERVER_DEFAULT_CRYPT_THREAD_COUNT 0
+
+namespace fge::net
+{
+
+/**
+ * \class CryptWorkerPool
+ * \ingroup network
+ * \brief A pool of threads that encrypt/decrypt packets of encrypted clients
+ *
+ * Jobs are sharded by client identity, so every job of a client is always handled by the same
+ * worker. This preserve the per-session ordering and ensure that a DTLS session is never
+ * used by two threads at the same time.
+ *
+ * Encrypted packets are kept until the socket thread retrieve them with popEncrypted() in order to
+ * send them by batch. Decrypted packets are given back with the decrypted callback, called from the worker thread.
+ */
+class FGE_API CryptWorkerPool
+{
+public:
+    using DecryptedCallback = std::function<void(ClientSharedPtr const&, ReceivedPacketPtr&&)>;
+    using EncryptedCallback = std::function<void()>;
+
+    struct EncryptedPacket
+    {
+        TransmitPacketPtr _packet;
+        Identity _identity;
+    };
+
+    CryptWorkerPool() = default;
+    CryptWorkerPool(CryptWorkerPool const& r) = delete;
+    CryptWorkerPool(CryptWorkerPool&& r) noexcept = delete;
+    ~CryptWorkerPool();
+
+    CryptWorkerPool& operator=(CryptWorkerPool const& r) = delete;
+    CryptWorkerPool& operator=(CryptWorkerPool&& r) noexcept = delete;
+
+    /**
+     * \brief Start the worker threads
+     *
+     * \param threadCount The number of workers, must be greater than 0
+     * \param onDecrypted Called from a worker thread with every successfully decrypted packet
+     * \param onEncrypted Called from a worker thread when new encrypted packets are available
+     * \return \b true if the pool has been started
+     */
+    bool start(std::size_t threadCount, DecryptedCallback onDecrypted, EncryptedCallback onEncrypted);
+    /**
+     * \brief Stop the worker threads, pending jobs are discarded
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const;
+    [[nodiscard]] std::size_t getThreadCount() const;
+
+    void pushEncrypt(ClientSharedPtr const& client, Identity const& identity, TransmitPacketPtr&& packet);
+    void pushDecrypt(ClientSharedPtr const& client, ReceivedPacketPtr&& packet);
+
+    /**
+     * \brief Retrieve all encrypted packets
+     *
+     * \param packets The output container, encrypted packets are appended to it
+     * \return The number of retrieved packets
+     */
+    std::size_t popEncrypted(std::vector<EncryptedPacket>& packets);
+
+private:
+    struct Job
+    {
+        enum class Types
+        {
+            ENCRYPT,
+            DECRYPT
+        };
+
+        Types _type;
+        ClientSharedPtr _client;
+        Identity _identity;
+        std::unique_ptr<ProtocolPacket> _packet;
+    };
+
+    struct Worker
+    {
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _notifier;
+        std::deque<Job> _jobs;
+    };
+
+    void threadWorker(Worker& worker);
+    void pushJob(Job&& job);
+
+    std::vector<std::unique_ptr<Worker>> g_workers;
+    std::atomic_bool g_running{false};
+
+    DecryptedCallback g_onDecrypted;
+    EncryptedCallback g_onEncrypted;
+
+    std::mutex g_mutexEncrypted;
+    std::vector<EncryptedPacket> g_encryptedPackets;
+};
+
+} // namespace fge::net
+
+#endif // _FGE_C_CRYPTWORKERPOOL_HPP_INCLUDED
@@ -0,0 +1,228 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _FGE_C_INTERPOLATION_HPP_INCLUDED
+#define _FGE_C_INTERPOLATION_HPP_INCLUDED
+
+#include "FastEngine/network/C_client.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+
+#define FGE_NET_INTERPOLATION_DEFAULT_CAPACITY 32
+#define FGE_NET_INTERPOLATION_DEFAULT_RENDER_DELAY                                                                     \
+    std::chrono::milliseconds                                                                                          \
+    {                                                                                                                  \
+        100                                                                                                            \
+    }
+#define FGE_NET_INTERPOLATION_DEFAULT_MAX_EXTRAPOLATION                                                                \
+    std::chrono::milliseconds                                                                                          \
+    {                                                                                                                  \
+        50                                                                                                             \
+    }
+#define FGE_NET_PREDICTION_DEFAULT_CAPACITY 128
+
+namespace fge::net
+{
+
+/**
+ * \struct InterpolationConfig
+ * \ingroup network
+ * \brief The parameters of an InterpolationBuffer
+ */
+struct InterpolationConfig
+{
+    std::chrono::milliseconds _renderDelay{FGE_NET_INTERPOLATION_DEFAULT_RENDER_DELAY}; ///< Sampling delay
+    std::chrono::milliseconds _maxExtrapolation{FGE_NET_INTERPOLATION_DEFAULT_MAX_EXTRAPOLATION};
+    std::size_t _capacity{FGE_NET_INTERPOLATION_DEFAULT_CAPACITY}; ///< The maximum number of kept samples
+};
+
+/**
+ * \brief The default interpolation of a value, \b T must support the +, - and * (with a float) operators
+ *
+ * Specialize this structure for a type that can't be linearly interpolated.
+ */
+template<class T>
+struct InterpolationLerp
+{
+    [[nodiscard]] static T lerp(T const& a, T const& b, float t) { return a + (b - a) * t; }
+};
+
+enum class InterpolationStates : uint8_t
+{
+    EMPTY,        ///< No sample, the value is untouched
+    INTERPOLATED, ///< The time is between 2 samples
+    EXTRAPOLATED, ///< The time is after the last sample but in the extrapolation limit
+    CLAMPED       ///< The time is out of the samples range (and of the extrapolation limit), the nearest value is used
+};
+
+/**
+ * \class InterpolationBuffer
+ * \ingroup network
+ * \brief A buffer of timestamped server values that can be sampled at any time
+ *
+ * Samples are pushed with the server time of their snapshot (see Scene::getLastReceivedNetSnapshotTimestamp) and
+ * sampled at the estimated server time (see OneWayLatencyPlanner::getOtherSideTimestamp_ms) minus a render delay.
+ * The render delay keep the sampled time between 2 received values even with some jitter or packet loss, the value
+ * is extrapolated from the 2 last samples when the buffer run dry.
+ *
+ * \tparam T The type of the value
+ * \tparam TLerp The interpolation of the value
+ */
+template<class T, class TLerp = InterpolationLerp<T>>
+class InterpolationBuffer
+{
+public:
+    struct Sample
+    {
+        FullTimestamp _serverTime;
+        T _value;
+    };
+
+    explicit InterpolationBuffer(InterpolationConfig const& config = {});
+
+    void setConfig(InterpolationConfig const& config);
+    [[nodiscard]] InterpolationConfig const& getConfig() const;
+
+    /**
+     * \brief Push a new sample
+     *
+     * Samples can be pushed out of order, a sample with an already known server time replace the old one.
+     * The oldest samples are removed when the capacity is reached.
+     *
+     * \param serverTime The server time of the value in ms
+     * \param value The value
+     */
+    void push(FullTimestamp serverTime, T const& value);
+    void clear();
+
+    [[nodiscard]] std::size_t getSize() const;
+    [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] std::optional<Sample> getLastSample() const;
+
+    /**
+     * \brief Sample the value at a precise server time
+     *
+     * \param serverTime The server time in ms
+     * \param value The sampled value
+     * \return The state of the sampling
+     */
+    InterpolationStates sample(FullTimestamp serverTime, T& value) const;
+    /**
+     * \brief Sample the value at the estimated server time minus the render delay
+     *
+     * \param serverNow The estimated current server time in ms
+     * \param value The sampled value
+     * \return The state of the sampling
+     */
+    InterpolationStates sampleDelayed(FullTimestamp serverNow, T& value) const;
+
+    /**
+     * \brief Remove the samples that can't be used anymore by a sampling at the provided server time
+     *
+     * The last sample before the time is kept as it is still required for the interpolation.
+     *
+     * \param serverTime The server time in ms
+     */
+    void removeOlderThan(FullTimestamp serverTime);
+
+private:
+    InterpolationConfig g_config;
+    std::deque<Sample> g_samples;
+};
+
+using InputId = uint32_t; ///< 0 is reserved for "no input"
+
+/**
+ * \class PredictionBuffer
+ * \ingroup network
+ * \brief A client side prediction and reconciliation helper
+ *
+ * The client apply its inputs directly on its local state (prediction) and push them in this buffer
+ * with the predicted state before sending them to the server. The server send back its authoritative state
+ * with the id of the last processed input, then reconcile:
+ * - remove the inputs processed by the server,
+ * - compare the authoritative state with the predicted one for the same input,
+ * - if they are different, replay every pending input from the authoritative state.
+ *
+ * When the prediction was right nothing is replayed, so the local state is never corrected for nothing.
+ *
+ * \tparam TInput The type of an input
+ * \tparam TState The type of the predicted state
+ */
+template<class TInput, class TState>
+class PredictionBuffer
+{
+public:
+    struct Entry
+    {
+        InputId _id;
+        TInput _input;
+        TState _predictedState; ///< The state after applying this input
+    };
+
+    explicit PredictionBuffer(std::size_t capacity = FGE_NET_PREDICTION_DEFAULT_CAPACITY);
+
+    /**
+     * \brief Push a new predicted input
+     *
+     * The oldest input is forgotten when the capacity is reached.
+     *
+     * \param input The input
+     * \param predictedState The state after applying the input
+     * \return The id of the input, that must be sent to the server with the input
+     */
+    InputId push(TInput const& input, TState const& predictedState);
+    void clear();
+
+    /**
+     * \brief Reconcile the prediction with an authoritative state
+     *
+     * \param lastProcessedId The id of the last input processed by the server for this state
+     * \param authoritativeState The authoritative state
+     * \param simulate A function with the signature TState(TState const& state, TInput const& input)
+     * \param compare A function with the signature bool(TState const& a, TState const& b) that return \b true
+     * if the states are the same, a tolerance can be used here
+     * \return The corrected current state if a correction is required, std::nullopt otherwise
+     */
+    template<class TSimulate, class TCompare = std::equal_to<TState>>
+    std::optional<TState> reconcile(InputId lastProcessedId,
+                                    TState const& authoritativeState,
+                                    TSimulate&& simulate,
+                                    TCompare&& compare = TCompare{});
+
+    [[nodiscard]] std::deque<Entry> const& getPendingInputs() const;
+    [[nodiscard]] InputId getLastInputId() const;
+    [[nodiscard]] InputId getLastProcessedId() const;
+    [[nodiscard]] std::size_t getCapacity() const;
+
+private:
+    std::size_t g_capacity;
+    std::deque<Entry> g_pendingInputs;
+    InputId g_lastInputId{0};
+    InputId g_lastProcessedId{0};
+    std::optional<TState> g_processedState; ///< The predicted state of the last processed input
+};
+
+} // namespace fge::net
+
+#include "C_interpolation.inl"
+
+#endif // _FGE_C_INTERPOLATION_HPP_INCLUDED
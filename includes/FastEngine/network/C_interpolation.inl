@@ -0,0 +1,246 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+namespace fge::net
+{
+
+///InterpolationBuffer
+
+template<class T, class TLerp>
+InterpolationBuffer<T, TLerp>::InterpolationBuffer(InterpolationConfig const& config) :
+        g_config(config)
+{}
+
+template<class T, class TLerp>
+void InterpolationBuffer<T, TLerp>::setConfig(InterpolationConfig const& config)
+{
+    this->g_config = config;
+    while (this->g_samples.size() > std::max<std::size_t>(this->g_config._capacity, 1))
+    {
+        this->g_samples.pop_front();
+    }
+}
+template<class T, class TLerp>
+InterpolationConfig const& InterpolationBuffer<T, TLerp>::getConfig() const
+{
+    return this->g_config;
+}
+
+template<class T, class TLerp>
+void InterpolationBuffer<T, TLerp>::push(FullTimestamp serverTime, T const& value)
+{
+    auto it = std::lower_bound(this->g_samples.begin(), this->g_samples.end(), serverTime,
+                               [](Sample const& sample, FullTimestamp time) { return sample._serverTime < time; });
+    if (it != this->g_samples.end() && it->_serverTime == serverTime)
+    {
+        it->_value = value;
+        return;
+    }
+    this->g_samples.insert(it, Sample{serverTime, value});
+
+    while (this->g_samples.size() > std::max<std::size_t>(this->g_config._capacity, 1))
+    {
+        this->g_samples.pop_front();
+    }
+}
+template<class T, class TLerp>
+void InterpolationBuffer<T, TLerp>::clear()
+{
+    this->g_samples.clear();
+}
+
+template<class T, class TLerp>
+std::size_t InterpolationBuffer<T, TLerp>::getSize() const
+{
+    return this->g_samples.size();
+}
+template<class T, class TLerp>
+bool InterpolationBuffer<T, TLerp>::isEmpty() const
+{
+    return this->g_samples.empty();
+}
+template<class T, class TLerp>
+std::optional<typename InterpolationBuffer<T, TLerp>::Sample> InterpolationBuffer<T, TLerp>::getLastSample() const
+{
+    if (this->g_samples.empty())
+    {
+        return std::nullopt;
+    }
+    return this->g_samples.back();
+}
+
+template<class T, class TLerp>
+InterpolationStates InterpolationBuffer<T, TLerp>::sample(FullTimestamp serverTime, T& value) const
+{
+    if (this->g_samples.empty())
+    {
+        return InterpolationStates::EMPTY;
+    }
+
+    auto const getFactor = [](Sample const& a, Sample const& b, FullTimestamp time) {
+        return static_cast<float>(static_cast<double>(time - a._serverTime) /
+                                  static_cast<double>(b._serverTime - a._serverTime));
+    };
+
+    //First sample after the time
+    auto it = std::upper_bound(this->g_samples.begin(), this->g_samples.end(), serverTime,
+                               [](FullTimestamp time, Sample const& sample) { return time < sample._serverTime; });
+
+    if (it == this->g_samples.begin())
+    {
+        value = it->_value;
+        return InterpolationStates::CLAMPED;
+    }
+
+    if (it != this->g_samples.end())
+    {
+        auto const& previous = *std::prev(it);
+        value = TLerp::lerp(previous._value, it->_value, getFactor(previous, *it, serverTime));
+        return InterpolationStates::INTERPOLATED;
+    }
+
+    auto const& last = this->g_samples.back();
+    if (serverTime == last._serverTime)
+    {
+        value = last._value;
+        return InterpolationStates::INTERPOLATED;
+    }
+    if (this->g_samples.size() < 2)
+    {
+        value = last._value;
+        return InterpolationStates::CLAMPED;
+    }
+
+    //Extrapolation from the 2 last samples
+    auto const& previous = this->g_samples[this->g_samples.size() - 2];
+    auto const maxTime = last._serverTime + static_cast<FullTimestamp>(this->g_config._maxExtrapolation.count());
+    bool const clamped = serverTime > maxTime;
+
+    value = TLerp::lerp(previous._value, last._value, getFactor(previous, last, clamped ? maxTime : serverTime));
+    return clamped ? InterpolationStates::CLAMPED : InterpolationStates::EXTRAPOLATED;
+}
+template<class T, class TLerp>
+InterpolationStates InterpolationBuffer<T, TLerp>::sampleDelayed(FullTimestamp serverNow, T& value) const
+{
+    auto const renderDelay = static_cast<FullTimestamp>(this->g_config._renderDelay.count());
+    return this->sample(serverNow > renderDelay ? serverNow - renderDelay : 0, value);
+}
+
+template<class T, class TLerp>
+void InterpolationBuffer<T, TLerp>::removeOlderThan(FullTimestamp serverTime)
+{
+    while (this->g_samples.size() >= 2 && this->g_samples[1]._serverTime <= serverTime)
+    {
+        this->g_samples.pop_front();
+    }
+}
+
+///PredictionBuffer
+
+template<class TInput, class TState>
+PredictionBuffer<TInput, TState>::PredictionBuffer(std::size_t capacity) :
+        g_capacity(std::max<std::size_t>(capacity, 1))
+{}
+
+template<class TInput, class TState>
+InputId PredictionBuffer<TInput, TState>::push(TInput const& input, TState const& predictedState)
+{
+    if (++this->g_lastInputId == 0)
+    { //0 is reserved
+        ++this->g_lastInputId;
+    }
+
+    this->g_pendingInputs.push_back(Entry{this->g_lastInputId, input, predictedState});
+    if (this->g_pendingInputs.size() > this->g_capacity)
+    {
+        this->g_pendingInputs.pop_front();
+    }
+    return this->g_lastInputId;
+}
+template<class TInput, class TState>
+void PredictionBuffer<TInput, TState>::clear()
+{
+    this->g_pendingInputs.clear();
+    this->g_processedState.reset();
+}
+
+template<class TInput, class TState>
+template<class TSimulate, class TCompare>
+std::optional<TState> PredictionBuffer<TInput, TState>::reconcile(InputId lastProcessedId,
+                                                                  TState const& authoritativeState,
+                                                                  TSimulate&& simulate,
+                                                                  TCompare&& compare)
+{
+    if (lastProcessedId < this->g_lastProcessedId)
+    { //Out of order state
+        return std::nullopt;
+    }
+
+    if (lastProcessedId != this->g_lastProcessedId)
+    {
+        this->g_lastProcessedId = lastProcessedId;
+        this->g_processedState.reset();
+
+        while (!this->g_pendingInputs.empty() && this->g_pendingInputs.front()._id <= lastProcessedId)
+        {
+            if (this->g_pendingInputs.front()._id == lastProcessedId)
+            {
+                this->g_processedState = std::move(this->g_pendingInputs.front()._predictedState);
+            }
+            this->g_pendingInputs.pop_front();
+        }
+    }
+
+    if (this->g_processedState && compare(*this->g_processedState, authoritativeState))
+    { //The prediction was right
+        return std::nullopt;
+    }
+    this->g_processedState = authoritativeState;
+
+    //Replaying the pending inputs from the authoritative state
+    TState state = authoritativeState;
+    for (auto& entry: this->g_pendingInputs)
+    {
+        state = simulate(static_cast<TState const&>(state), static_cast<TInput const&>(entry._input));
+        entry._predictedState = state;
+    }
+    return state;
+}
+
+template<class TInput, class TState>
+std::deque<typename PredictionBuffer<TInput, TState>::Entry> const&
+PredictionBuffer<TInput, TState>::getPendingInputs() const
+{
+    return this->g_pendingInputs;
+}
+template<class TInput, class TState>
+InputId PredictionBuffer<TInput, TState>::getLastInputId() const
+{
+    return this->g_lastInputId;
+}
+template<class TInput, class TState>
+InputId PredictionBuffer<TInput, TState>::getLastProcessedId() const
+{
+    return this->g_lastProcessedId;
+}
+template<class TInput, class TState>
+std::size_t PredictionBuffer<TInput, TState>::getCapacity() const
+{
+    return this->g_capacity;
+}
+
+} // namespace fge::net
@@ -0,0 +1,175 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _FGE_C_LINKCONDITIONER_HPP_INCLUDED
+#define _FGE_C_LINKCONDITIONER_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "FastEngine/C_random.hpp"
+#include "FastEngine/network/C_identity.hpp"
+#include "FastEngine/network/C_packet.hpp"
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#define FGE_NET_LINK_CONDITIONER_DEFAULT_QUEUE_LIMIT 262144
+#define FGE_NET_LINK_CONDITIONER_REORDER_DELAY                                                                         \
+    std::chrono::milliseconds                                                                                          \
+    {                                                                                                                  \
+        10                                                                                                             \
+    }
+
+namespace fge::net
+{
+
+/**
+ * \struct LinkConditionerConfig
+ * \ingroup network
+ * \brief Simulated network conditions of a LinkConditioner
+ *
+ * - _enabled: if \b false, datagrams go through without any change
+ * - _latency: the base delay added to every datagram
+ * - _jitter: a random delay between -_jitter and +_jitter added to the latency
+ * - _lossRate: the probability [0, 1] of a datagram to be dropped
+ * - _duplicateRate: the probability [0, 1] of a datagram to be received twice
+ * - _reorderRate: the probability [0, 1] of a datagram to be held for an extra FGE_NET_LINK_CONDITIONER_REORDER_DELAY
+ * - _bandwidth: the link capacity in bytes per second, 0 for unlimited
+ * - _queueLimit: the maximum number of bytes waiting for the link capacity, extra datagrams are dropped
+ */
+struct LinkConditionerConfig
+{
+    bool _enabled{false};
+    std::chrono::milliseconds _latency{0};
+    std::chrono::milliseconds _jitter{0};
+    float _lossRate{0.0f};
+    float _duplicateRate{0.0f};
+    float _reorderRate{0.0f};
+    uint32_t _bandwidth{0};
+    uint32_t _queueLimit{FGE_NET_LINK_CONDITIONER_DEFAULT_QUEUE_LIMIT};
+};
+
+struct LinkConditionerStats
+{
+    uint64_t _receivedCount{0};   ///< Datagrams received from the socket
+    uint64_t _deliveredCount{0};  ///< Datagrams delivered to the network manager
+    uint64_t _lostCount{0};       ///< Datagrams dropped by the loss rate
+    uint64_t _overflowCount{0};   ///< Datagrams dropped by the queue limit
+    uint64_t _duplicatedCount{0}; ///< Extra copies of duplicated datagrams
+    uint64_t _reorderedCount{0};  ///< Datagrams held for reordering
+};
+
+/**
+ * \class LinkConditioner
+ * \ingroup network
+ * \brief A runtime network simulator inserted between a socket and a network manager
+ *
+ * Every received datagram is pushed in the conditioner that decide its fate (drop, duplication, delay) and
+ * the datagrams are popped once their delivery time is reached. This allow testing the network code with
+ * bad conditions on a loopback interface.
+ *
+ * The conditioner is thread-safe, the config can be changed while the network manager is running.
+ */
+class FGE_API LinkConditioner
+{
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    LinkConditioner();
+
+    void setConfig(LinkConditionerConfig const& config);
+    [[nodiscard]] LinkConditionerConfig getConfig() const;
+    [[nodiscard]] bool isEnabled() const;
+
+    /**
+     * \brief Set the seed of the random decisions, useful for reproducible tests
+     *
+     * \param seed The seed
+     */
+    void setSeed(uint64_t seed);
+
+    /**
+     * \brief Push a received datagram
+     *
+     * \param pck The datagram, moved only if the conditioner is enabled
+     * \param id The source of the datagram
+     * \param timePoint The current time
+     * \return \b true if the datagram have been taken by the conditioner, \b false if it must be handled directly
+     */
+    [[nodiscard]] bool
+    push(Packet& pck, Identity const& id, TimePoint const& timePoint = std::chrono::steady_clock::now());
+    /**
+     * \brief Pop the next datagram that reached its delivery time
+     *
+     * When the conditioner is disabled, the held datagrams are delivered without waiting.
+     *
+     * \param pck The datagram
+     * \param id The source of the datagram
+     * \param timePoint The current time
+     * \return \b true if a datagram have been popped
+     */
+    [[nodiscard]] bool pop(Packet& pck, Identity& id, TimePoint const& timePoint = std::chrono::steady_clock::now());
+
+    /**
+     * \brief Get the time to wait before the next delivery
+     *
+     * \param maxWait_ms The maximum wait time
+     * \param timePoint The current time
+     * \return The wait time in ms, between 0 and \b maxWait_ms
+     */
+    [[nodiscard]] uint32_t getWaitTime_ms(uint32_t maxWait_ms,
+                                          TimePoint const& timePoint = std::chrono::steady_clock::now()) const;
+    [[nodiscard]] std::size_t getPendingCount() const;
+
+    [[nodiscard]] LinkConditionerStats getStats() const;
+    void resetStats();
+
+    void clear();
+
+private:
+    struct Datagram
+    {
+        TimePoint _deliveryTime;
+        uint64_t _order; ///< Keep the push order for datagrams with the same delivery time
+        Packet _packet;
+        Identity _id;
+    };
+    struct DatagramCompare
+    {
+        [[nodiscard]] bool operator()(Datagram const& a, Datagram const& b) const
+        {
+            return a._deliveryTime != b._deliveryTime ? a._deliveryTime > b._deliveryTime : a._order > b._order;
+        }
+    };
+
+    [[nodiscard]] bool chance(float probability);
+    void schedule(Packet&& pck, Identity const& id, TimePoint const& timePoint);
+
+    mutable std::mutex g_mutex;
+    LinkConditionerConfig g_config;
+    fge::LocalRandom g_random;
+
+    std::vector<Datagram> g_datagrams; ///< A min heap of the delivery times
+    uint64_t g_order{0};
+    TimePoint g_linkFreeTime{};
+
+    LinkConditionerStats g_stats;
+};
+
+} // namespace fge::net
+
+#endif // _FGE_C_LINKCONDITIONER_HPP_INCLUDED
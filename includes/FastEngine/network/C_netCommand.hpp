@@ -18,6 +18,7 @@
 #define _FGE_C_NETCOMMAND_HPP_INCLUDED
 
 #include "FastEngine/fge_extern.hpp"
+#include "FastEngine/C_compressorLZ4.hpp"
 #include "FastEngine/network/C_protocol.hpp"
 #include <condition_variable>
 #include <deque>
@@ -160,6 +161,9 @@ public:
     void setVersioningString(std::string_view versioningString);
     [[nodiscard]] std::string const& getVersioningString() const;
 
+    void setCompressionDictionary(CompressorLZ4DictionaryPtr dictionary);
+    [[nodiscard]] CompressorLZ4DictionaryPtr const& getCompressionDictionary() const;
+
     [[nodiscard]] NetCommandTypes getType() const override { return NetCommandTypes::CONNECT; }
 
     void internalUpdate(TransmitPacketPtr& buffPacket,
@@ -195,6 +199,7 @@ private:
     bool g_mtuTested{false};
     std::future<uint16_t> g_mtuFuture;
     std::string g_versioningString;
+    CompressorLZ4DictionaryPtr g_compressionDictionary;
 };
 
 class FGE_API NetConnectHandlerCommand final : public NetCommand
@@ -20,12 +20,14 @@
 #include "FastEngine/fge_extern.hpp"
 #include "C_identity.hpp"
 #include "C_packet.hpp"
+#include "C_quantized.hpp"
 #include "FastEngine/C_callback.hpp"
 #include "FastEngine/C_dataAccessor.hpp"
 #include "FastEngine/C_flag.hpp"
 #include "FastEngine/C_propertyList.hpp"
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -219,6 +221,15 @@ public:
      * \return \b true if the value is forced to be modified, \b false otherwise
      */
     [[nodiscard]] bool isForced() const;
+    /**
+     * \brief Get the number of times a clients checkup found the value modified
+     *
+     * While this number is unchanged and check() return \b false, the value is the same as the one
+     * of the last checkup that found it modified.
+     *
+     * \return The modification revision
+     */
+    [[nodiscard]] uint32_t getModificationRevision() const;
 
     void clearExplicitUpdateFlag();
     /**
@@ -254,6 +265,24 @@ protected:
     bool _g_waitingUpdate{false};
     bool _g_force{false};
     std::chrono::microseconds _g_lastUpdateTime{0};
+    uint32_t _g_modificationRevision{0};
+};
+
+/**
+ * \struct NetworkTypeDefaultPolicy
+ * \ingroup network
+ * \brief The default NetworkType policy, the value is (un)packed with the Packet operators
+ *
+ * A policy describe how a NetworkType (un)pack its value, a custom policy must provide
+ * the same static methods.
+ *
+ * \see NetworkTypeQuantizePolicy
+ */
+template<class T>
+struct NetworkTypeDefaultPolicy
+{
+    static void pack(Packet& pck, T const& value) { pck << value; }
+    [[nodiscard]] static bool unpack(Packet const& pck, T& value) { return static_cast<bool>(pck >> value); }
 };
 
 /**
@@ -262,8 +291,9 @@ protected:
  * \brief The default network type for most trivial types
  *
  * \tparam T The type of the value
+ * \tparam TPolicy The policy used to (un)pack the value
  */
-template<class T>
+template<class T, class TPolicy = NetworkTypeDefaultPolicy<T>>
 class NetworkType : public NetworkTypeBase
 {
 public:
@@ -324,7 +354,7 @@ private:
 class FGE_API NetworkTypeTag : public NetworkTypeBase
 {
 public:
-    NetworkTypeTag(fge::TagList* source, std::string tag);
+    NetworkTypeTag(fge::TagList* source, std::string_view tag);
     ~NetworkTypeTag() override = default;
 
     void const* getSource() const override;
@@ -339,7 +369,7 @@ public:
 
 private:
     fge::TagList* g_typeSource;
-    std::string g_tag;
+    fge::StringId g_tag;
 };
 
 /**
@@ -368,10 +398,24 @@ public:
     void setErrorRange(float range);
     float getErrorRange() const;
 
+    /**
+     * \brief Set the quantization used to (un)pack the value
+     *
+     * By default, the value is not quantized. The server and the client must use the same quantization.
+     *
+     * \param range The quantization range or std::nullopt to disable the quantization
+     */
+    void setQuantization(std::optional<QuantizeRange> const& range);
+    [[nodiscard]] std::optional<QuantizeRange> const& getQuantization() const;
+
 private:
+    void packValue(Packet& pck) const;
+    [[nodiscard]] bool unpackValue(Packet const& pck);
+
     fge::Vector2f g_typeCopy;
     fge::DataAccessor<fge::Vector2f> g_typeSource;
     float g_errorRange;
+    std::optional<QuantizeRange> g_quantization;
 };
 /**
  * \class NetworkTypeSmoothFloat
@@ -398,10 +442,24 @@ public:
     void setErrorRange(float range);
     float getErrorRange() const;
 
+    /**
+     * \brief Set the quantization used to (un)pack the value
+     *
+     * By default, the value is not quantized. The server and the client must use the same quantization.
+     *
+     * \param range The quantization range or std::nullopt to disable the quantization
+     */
+    void setQuantization(std::optional<QuantizeRange> const& range);
+    [[nodiscard]] std::optional<QuantizeRange> const& getQuantization() const;
+
 private:
+    void packValue(Packet& pck) const;
+    [[nodiscard]] bool unpackValue(Packet const& pck);
+
     float g_typeCopy;
     fge::DataAccessor<float> g_typeSource;
     float g_errorRange;
+    std::optional<QuantizeRange> g_quantization;
 };
 
 /**
@@ -461,6 +519,7 @@ public:
 private:
     fge::PropertyList* g_typeSource;
     std::string g_vname;
+    fge::StringId g_vnameId;
 };
 
 /**
@@ -19,21 +19,21 @@ namespace fge::net
 
 ///NetworkType
 
-template<class T>
-NetworkType<T>::NetworkType(fge::DataAccessor<T> source) :
+template<class T, class TPolicy>
+NetworkType<T, TPolicy>::NetworkType(fge::DataAccessor<T> source) :
         g_typeCopy(source._getter()),
         g_typeSource(std::move(source))
 {}
 
-template<class T>
-void const* NetworkType<T>::getSource() const
+template<class T, class TPolicy>
+void const* NetworkType<T, TPolicy>::getSource() const
 {
     return &this->g_typeSource;
 }
-template<class T>
-bool NetworkType<T>::applyData(Packet const& pck)
+template<class T, class TPolicy>
+bool NetworkType<T, TPolicy>::applyData(Packet const& pck)
 {
-    if (pck >> this->g_typeCopy)
+    if (TPolicy::unpack(pck, this->g_typeCopy))
     {
         this->g_typeSource._setter(this->g_typeCopy);
         this->setLastUpdateTime();
@@ -43,31 +43,31 @@ bool NetworkType<T>::applyData(Packet const& pck)
     }
     return false;
 }
-template<class T>
-void NetworkType<T>::packData(Packet& pck, Identity const& id)
+template<class T, class TPolicy>
+void NetworkType<T, TPolicy>::packData(Packet& pck, Identity const& id)
 {
     if (this->clearModificationFlag(id))
     {
-        pck << this->g_typeSource._getter();
+        TPolicy::pack(pck, this->g_typeSource._getter());
     }
 }
-template<class T>
-void NetworkType<T>::packData(Packet& pck)
+template<class T, class TPolicy>
+void NetworkType<T, TPolicy>::packData(Packet& pck)
 {
-    pck << this->g_typeSource._getter();
+    TPolicy::pack(pck, this->g_typeSource._getter());
 }
-template<class T>
-bool NetworkType<T>::check() const
+template<class T, class TPolicy>
+bool NetworkType<T, TPolicy>::check() const
 {
     return (this->g_typeSource._getter() != this->g_typeCopy) || this->_g_force;
 }
-template<class T>
-void NetworkType<T>::forceCheck()
+template<class T, class TPolicy>
+void NetworkType<T, TPolicy>::forceCheck()
 {
     this->_g_force = true;
 }
-template<class T>
-void NetworkType<T>::forceUncheck()
+template<class T, class TPolicy>
+void NetworkType<T, TPolicy>::forceUncheck()
 {
     this->_g_force = false;
     this->g_typeCopy = this->g_typeSource._getter();
@@ -132,9 +132,10 @@ void NetworkTypeProperty<T>::forceUncheck()
 template<class T>
 NetworkTypePropertyList<T>::NetworkTypePropertyList(fge::PropertyList* source, std::string const& vname) :
         g_typeSource(source),
-        g_vname(vname)
+        g_vname(vname),
+        g_vnameId(fge::InternString(vname))
 {
-    fge::Property& property = source->getProperty(vname);
+    fge::Property& property = source->getProperty(this->g_vnameId);
     property.setType<T>();
 }
 
@@ -147,7 +148,7 @@ void const* NetworkTypePropertyList<T>::getSource() const
 template<class T>
 bool NetworkTypePropertyList<T>::applyData(Packet const& pck)
 {
-    fge::Property& property = this->g_typeSource->getProperty(this->g_vname);
+    fge::Property& property = this->g_typeSource->getProperty(this->g_vnameId);
 
     pck >> property.setType<T>();
 
@@ -161,14 +162,14 @@ void NetworkTypePropertyList<T>::packData(Packet& pck, Identity const& id)
 {
     if (this->clearModificationFlag(id))
     {
-        fge::Property& property = this->g_typeSource->getProperty(this->g_vname);
+        fge::Property& property = this->g_typeSource->getProperty(this->g_vnameId);
         pck << property.setType<T>();
     }
 }
 template<class T>
 void NetworkTypePropertyList<T>::packData(Packet& pck)
 {
-    fge::Property& property = this->g_typeSource->getProperty(this->g_vname);
+    fge::Property& property = this->g_typeSource->getProperty(this->g_vnameId);
 
     pck << property.setType<T>();
 }
@@ -176,17 +177,17 @@ void NetworkTypePropertyList<T>::packData(Packet& pck)
 template<class T>
 bool NetworkTypePropertyList<T>::check() const
 {
-    return this->g_typeSource->getProperty(this->g_vname).isModified();
+    return this->g_typeSource->getProperty(this->g_vnameId).isModified();
 }
 template<class T>
 void NetworkTypePropertyList<T>::forceCheck()
 {
-    this->g_typeSource->getProperty(this->g_vname).setModifiedFlag(true);
+    this->g_typeSource->getProperty(this->g_vnameId).setModifiedFlag(true);
 }
 template<class T>
 void NetworkTypePropertyList<T>::forceUncheck()
 {
-    this->g_typeSource->getProperty(this->g_vname).setModifiedFlag(false);
+    this->g_typeSource->getProperty(this->g_vnameId).setModifiedFlag(false);
 }
 
 template<class T>
@@ -33,12 +33,14 @@
 #include <list>
 #include <span>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "FastEngine/C_vector.hpp"
 #include "FastEngine/graphic/C_color.hpp"
 
 #define FGE_PACKET_DEFAULT_RESERVESIZE 4096
+#define FGE_PACKET_VARINT_MAXSIZE(_intType) ((sizeof(_intType) * 8 + 6) / 7)
 
 namespace fge::net
 {
@@ -48,6 +50,62 @@ class SocketUdp;
 
 using SizeType = uint16_t;
 
+/**
+ * \brief Zig-zag encode a signed integer
+ *
+ * Map signed integers to unsigned integers so that numbers with a small absolute value
+ * (e.g. -1) also have a small encoded value (e.g. 1).
+ *
+ * \param value The signed value to encode
+ * \return The encoded unsigned value
+ */
+template<class TInt>
+[[nodiscard]] constexpr std::make_unsigned_t<TInt> ZigZagEncode(TInt value)
+{
+    static_assert(std::is_integral_v<TInt> && std::is_signed_v<TInt>, "TInt must be a signed integer");
+    using TUnsigned = std::make_unsigned_t<TInt>;
+    return static_cast<TUnsigned>((static_cast<TUnsigned>(value) << 1) ^
+                                  static_cast<TUnsigned>(value >> (sizeof(TInt) * 8 - 1)));
+}
+/**
+ * \brief Zig-zag decode an unsigned integer previously encoded with ZigZagEncode()
+ *
+ * \param value The encoded unsigned value
+ * \return The decoded signed value
+ */
+template<class TInt>
+[[nodiscard]] constexpr TInt ZigZagDecode(std::make_unsigned_t<TInt> value)
+{
+    static_assert(std::is_integral_v<TInt> && std::is_signed_v<TInt>, "TInt must be a signed integer");
+    using TUnsigned = std::make_unsigned_t<TInt>;
+    return static_cast<TInt>((value >> 1) ^ static_cast<TUnsigned>(-static_cast<TInt>(value & 0x01)));
+}
+
+/**
+ * \struct VarInt
+ * \ingroup network
+ * \brief Opt-in wrapper to (un)pack an integer as a variable length integer
+ *
+ * The integer is encoded with LEB128, signed integers are zig-zag encoded first.
+ * Small values (like most sizes, ids or counters) will only take 1 or 2 bytes.
+ *
+ * \code
+ * pck << fge::net::VarInt<fge::net::SizeType>{count};
+ *
+ * fge::net::VarInt<fge::net::SizeType> count;
+ * pck >> count;
+ * \endcode
+ *
+ * \tparam TInt The integer type
+ */
+template<class TInt>
+struct VarInt
+{
+    static_assert(std::is_integral_v<TInt> && !std::is_same_v<TInt, bool>, "TInt must be an integer");
+
+    TInt _value{0};
+};
+
 class FGE_API Packet
 {
 public:
@@ -60,6 +118,18 @@ public:
     Packet& operator=(Packet const& pck) = default;
     Packet& operator=(Packet&& pck) noexcept;
 
+    /**
+     * \brief Create a read-only packet that refers to external data without copying it
+     *
+     * The data must outlive the packet and every copy of it.
+     * The first modification of the packet (including a non-const getData()) copies the data into its own buffer.
+     *
+     * \param data The data to read from
+     * \return A packet viewing the data
+     */
+    [[nodiscard]] static Packet View(std::span<uint8_t const> data);
+    [[nodiscard]] bool isView() const;
+
     void clear();
     void flush();
     void reserve(std::size_t reserveSize);
@@ -77,6 +147,11 @@ public:
     bool read(std::size_t pos, void* buff, std::size_t size) const;   //Will read to network byte order
     bool unpack(std::size_t pos, void* buff, std::size_t size) const; //Will read and auto convert to host byte order
 
+    template<class TInt>
+    Packet& packVarint(TInt value); //Will push as a LEB128 variable length integer (zig-zag for signed)
+    template<class TInt>
+    Packet const& unpackVarint(TInt& value) const; //Will read a LEB128 variable length integer (zig-zag for signed)
+
     Packet& shrink(std::size_t size);
     bool erase(std::size_t pos, std::size_t size);
     Packet const& skip(std::size_t size) const;
@@ -150,6 +225,9 @@ public:
     template<class TData>
     inline Packet& operator<<(std::unique_ptr<TData> const& data);
 
+    template<class TInt>
+    inline Packet& operator<<(VarInt<TInt> const& data);
+
     ///
 
     inline Packet const& operator>>(bool& data) const;
@@ -197,6 +275,9 @@ public:
     template<class TData>
     inline Packet const& operator>>(std::unique_ptr<TData>& data) const;
 
+    template<class TInt>
+    inline Packet const& operator>>(VarInt<TInt>& data) const;
+
     bool operator==(Packet const& right) const = delete;
     bool operator!=(Packet const& right) const = delete;
 
@@ -212,7 +293,15 @@ protected:
     bool _g_transmitCacheValid;
 
 private:
+    [[nodiscard]] inline std::span<uint8_t const> getReadSpan() const
+    {
+        return this->g_isView ? this->g_view : std::span<uint8_t const>{this->g_data};
+    }
+    void detachView();
+
     std::vector<uint8_t> g_data;
+    std::span<uint8_t const> g_view;
+    bool g_isView{false};
     mutable std::size_t g_readPos;
     mutable bool g_valid;
 };
@@ -19,6 +19,80 @@ namespace fge
 namespace net
 {
 
+template<class TInt>
+fge::net::Packet& Packet::packVarint(TInt value)
+{
+    static_assert(std::is_integral_v<TInt> && !std::is_same_v<TInt, bool>, "TInt must be an integer");
+    using TUnsigned = std::make_unsigned_t<TInt>;
+
+    TUnsigned raw;
+    if constexpr (std::is_signed_v<TInt>)
+    {
+        raw = fge::net::ZigZagEncode(value);
+    }
+    else
+    {
+        raw = value;
+    }
+
+    uint8_t buffer[FGE_PACKET_VARINT_MAXSIZE(TInt)];
+    std::size_t size = 0;
+    do
+    {
+        auto byte = static_cast<uint8_t>(raw & 0x7F);
+        raw >>= 7;
+        if (raw != 0)
+        {
+            byte |= 0x80;
+        }
+        buffer[size++] = byte;
+    } while (raw != 0);
+
+    return this->append(buffer, size);
+}
+template<class TInt>
+fge::net::Packet const& Packet::unpackVarint(TInt& value) const
+{
+    static_assert(std::is_integral_v<TInt> && !std::is_same_v<TInt, bool>, "TInt must be an integer");
+    using TUnsigned = std::make_unsigned_t<TInt>;
+
+    TUnsigned raw = 0;
+    for (std::size_t i = 0; i < FGE_PACKET_VARINT_MAXSIZE(TInt); ++i)
+    {
+        uint8_t byte;
+        if (!this->read(&byte, sizeof(uint8_t)))
+        {
+            return *this;
+        }
+
+        std::size_t const shift = i * 7;
+        //Reject bits that can't fit in the integer
+        if (shift + 7 > sizeof(TInt) * 8 && (byte & 0x7F) >> (sizeof(TInt) * 8 - shift) != 0)
+        {
+            this->invalidate();
+            return *this;
+        }
+        raw |= static_cast<TUnsigned>(static_cast<TUnsigned>(byte & 0x7F) << shift);
+
+        if ((byte & 0x80) == 0)
+        {
+            if constexpr (std::is_signed_v<TInt>)
+            {
+                value = fge::net::ZigZagDecode<TInt>(raw);
+            }
+            else
+            {
+                value = raw;
+            }
+            return *this;
+        }
+    }
+
+    //Too many bytes
+    this->invalidate();
+    return *this;
+}
+
 fge::net::Packet& Packet::operator<<(bool data)
 {
     uint8_t a = data ? 1 : 0;
@@ -146,6 +220,12 @@ fge::net::Packet& Packet::operator<<(std::unique_ptr<TData> const& data)
     return *this << *data;
 }
 
+template<class TInt>
+fge::net::Packet& Packet::operator<<(VarInt<TInt> const& data)
+{
+    return this->packVarint(data._value);
+}
+
 ///
 
 fge::net::Packet const& Packet::operator>>(bool& data) const
@@ -304,5 +384,11 @@ fge::net::Packet const& Packet::operator>>(std::unique_ptr<TData>& data) const
     return *this >> *data;
 }
 
+template<class TInt>
+fge::net::Packet const& Packet::operator>>(VarInt<TInt>& data) const
+{
+    return this->unpackVarint(data._value);
+}
+
 } // namespace net
 } // namespace fge
@@ -46,6 +46,8 @@
 #define FGE_NET_PACKET_CACHE_MAX 100
 #define FGE_NET_PACKET_CACHE_MIN_LATENCY_MS 10
 
+#define FGE_NET_DEFRAGMENTATION_CACHE_MAX 16
+
 #define FGE_NET_DEFAULT_REALM 0
 #define FGE_NET_DEFAULT_PACKET_REORDERER_CACHE_SIZE 5
 #define FGE_NET_PACKET_REORDERER_CACHE_COMPUTE(_clientReturnRate, _serverTickRate)                                     \
@@ -109,6 +111,36 @@ public:
         std::size_t _argument; ///< The option argument
     };
 
+    /**
+     * \enum CompressionCodecs
+     * \brief The codec used to compress the payload
+     *
+     * When the packet is compressed, the codec is stored as the first byte after the header.
+     */
+    enum class CompressionCodecs : uint8_t
+    {
+        NONE = 0,
+        LZ4 = 1,
+        LZ4HC = 2
+    };
+    constexpr static std::size_t CompressionCodecCount = 3;
+
+    /**
+     * \enum Priorities
+     * \brief The priority class of a packet in the Client transmission queue
+     *
+     * A pending packet is always sent before the pending packets of a lower priority.
+     * When no priority is set, it is deduced from the packet header, see getPriority.
+     */
+    enum class Priorities : uint8_t
+    {
+        CONTROL = 0, ///< Internal protocol packets (MTU, handshake, return packets ...)
+        RELIABLE,    ///< Packets that must not be discarded
+        STATE,       ///< Regular state updates
+        BULK         ///< Large and non-urgent data, like full synchronisations
+    };
+    constexpr static std::size_t PriorityCount = 4;
+
     using IdType = uint16_t;
     using RealmType = uint16_t;
     using CounterType = uint16_t;
@@ -171,6 +203,17 @@ public:
     inline ProtocolPacket& doNotReorder();
     inline ProtocolPacket& doNotFragment();
 
+    inline ProtocolPacket& setPriority(Priorities priority);
+    /**
+     * \brief Get the priority of the packet
+     *
+     * If no priority have been set, internal packets are CONTROL, packets with the
+     * FGE_NET_HEADER_DO_NOT_DISCARD_FLAG are RELIABLE and the others are STATE.
+     *
+     * \return The priority of the packet
+     */
+    [[nodiscard]] inline Priorities getPriority() const;
+
     inline ProtocolPacket& setRealm(RealmType realm);
     inline ProtocolPacket& setCounter(CounterType counter);
     inline ProtocolPacket& setReorderedCounter(CounterType counter);
@@ -182,8 +225,28 @@ public:
     [[nodiscard]] inline std::vector<Option> const& options() const;
     [[nodiscard]] inline std::vector<Option>& options();
 
-    [[nodiscard]] bool compress(Compressor& compressor);
+    /**
+     * \brief Compress the payload of the packet
+     *
+     * If the compressed payload (with the codec byte) is not smaller than the raw payload,
+     * the packet is left uncompressed and this function still return \b true. You can check
+     * the compressed flag to know if the compression was applied.
+     *
+     * \param compressor The compressor to use
+     * \param codec The codec that correspond to the compressor, stored in the packet
+     * \return \b false if the compression failed
+     */
+    [[nodiscard]] bool compress(Compressor& compressor, CompressionCodecs codec = CompressionCodecs::LZ4);
+    /**
+     * \brief Decompress the payload of the packet
+     *
+     * LZ4 and LZ4HC share the same block format, so a CompressorLZ4 can decompress both codecs.
+     *
+     * \param compressor The compressor to use, it must be able to decode the stored codec
+     * \return \b false if the decompression failed or if the codec is unknown
+     */
     [[nodiscard]] bool decompress(Compressor& compressor);
+    [[nodiscard]] std::optional<CompressionCodecs> retrieveCompressionCodec() const;
 
     inline void markForEncryption();
     inline void unmarkForEncryption();
@@ -240,6 +303,8 @@ private:
     bool g_markedAsLocallyReordered{false};
     bool g_markedAsCached{false};
 
+    std::optional<Priorities> g_priority;
+
     std::vector<Option> g_options;
 };
 
@@ -286,6 +351,43 @@ struct InternalFragmentedPacketData
     uint8_t _fragmentTotal;
 };
 
+/**
+ * \struct FragmentView
+ * \ingroup network
+ * \brief A fragment that reference a part of a shared packet
+ *
+ * The view doesn't own a copy of its payload, it only keep the offset and the size of its part into
+ * the original packet. The wire packet (fragment header + payload) is built with materialize() when
+ * the fragment is sent, allowing a lost fragment to be retransmitted alone without fragmenting
+ * the original packet again.
+ */
+struct FGE_API FragmentView
+{
+    std::shared_ptr<ProtocolPacket const> _source;
+    std::size_t _offset{0};
+    std::size_t _size{0};
+    ProtocolPacket::RealmType _realm{0}; ///< The fragment realm, it is the counter of the original packet
+    ProtocolPacket::CounterType _index{0};
+    decltype(InternalFragmentedPacketData::_fragmentTotal) _total{0};
+
+    /**
+     * \brief Build the fragment packet that can be sent
+     *
+     * \return A new fragment packet
+     */
+    [[nodiscard]] TransmitPacketPtr materialize() const;
+};
+
+/**
+ * \brief Split a packet into fragment views
+ *
+ * \param packet The packet to fragment, compressed and with options already applied
+ * \param mtu The MTU of the peer
+ * \return The fragment views, empty if the packet is small enough to be sent as is
+ */
+[[nodiscard]] FGE_API std::vector<FragmentView> CreateFragmentViews(std::shared_ptr<ProtocolPacket const> const& packet,
+                                                                    uint16_t mtu);
+
 class PacketDefragmentation
 {
 public:
@@ -469,9 +571,25 @@ public:
 
     //Transmit
     void push(TransmitPacketPtr const& packet);
+    /**
+     * \brief Cache every fragment individually
+     *
+     * Fragments are acknowledged with acknowledgeFragmentReception() and only the lost ones are retransmitted.
+     *
+     * \param fragments The fragment views
+     */
+    void push(std::span<FragmentView const> fragments);
 
     //Receive
     void acknowledgeReception(std::span<Label> labels);
+    /**
+     * \brief Acknowledge fragments
+     *
+     * A fragment label is composed of the fragment index as the counter and the fragment realm as the realm.
+     *
+     * \param labels The fragment labels
+     */
+    void acknowledgeFragmentReception(std::span<Label> labels);
 
     //Check for unacknowledged packet
     bool process(std::chrono::steady_clock::time_point const& timePoint, Client& client);
@@ -481,15 +599,22 @@ private:
     {
         Data() = default;
         explicit Data(TransmitPacketPtr&& packet);
+        explicit Data(FragmentView const& fragment);
 
         Data& operator=(TransmitPacketPtr&& packet);
 
+        [[nodiscard]] TransmitPacketPtr copyPacket() const;
+
         TransmitPacketPtr _packet;
+        FragmentView _fragment;
+        bool _isFragment{false};
         Label _label;
         std::chrono::steady_clock::time_point _time{};
         unsigned int _tryCount{0};
     };
 
+    void acknowledge(std::span<Label> labels, bool fragments);
+
     mutable std::mutex g_mutex;
 
     std::vector<Data> g_cache;
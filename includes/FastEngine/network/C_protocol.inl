@@ -64,6 +64,8 @@ inline ProtocolPacket::ProtocolPacket(ProtocolPacket const& r) :
         g_markedAsLocallyReordered(r.g_markedAsLocallyReordered),
         g_markedAsCached(r.g_markedAsCached),
 
+        g_priority(r.g_priority),
+
         g_options(r.g_options)
 {}
 inline ProtocolPacket::ProtocolPacket(ProtocolPacket&& r) noexcept :
@@ -80,6 +82,8 @@ inline ProtocolPacket::ProtocolPacket(ProtocolPacket&& r) noexcept :
         g_markedAsLocallyReordered(r.g_markedAsLocallyReordered),
         g_markedAsCached(r.g_markedAsCached),
 
+        g_priority(r.g_priority),
+
         g_options(std::move(r.g_options))
 {}
 
@@ -261,6 +265,30 @@ inline ProtocolPacket& ProtocolPacket::doNotFragment()
     return this->addFlags(FGE_NET_HEADER_DO_NOT_FRAGMENT_FLAG);
 }
 
+inline ProtocolPacket& ProtocolPacket::setPriority(Priorities priority)
+{
+    this->g_priority = priority;
+    return *this;
+}
+inline ProtocolPacket::Priorities ProtocolPacket::getPriority() const
+{
+    if (this->g_priority)
+    {
+        return *this->g_priority;
+    }
+
+    auto const id = this->retrieveHeaderId();
+    if (id && *id >= FGE_NET_INTERNAL_ID_START && *id <= FGE_NET_INTERNAL_ID_MAX)
+    {
+        return Priorities::CONTROL;
+    }
+    if (this->checkFlags(FGE_NET_HEADER_DO_NOT_DISCARD_FLAG))
+    {
+        return Priorities::RELIABLE;
+    }
+    return Priorities::STATE;
+}
+
 inline ProtocolPacket& ProtocolPacket::setRealm(RealmType realm)
 {
     this->pack(RealmPosition, &realm, sizeof(RealmType));
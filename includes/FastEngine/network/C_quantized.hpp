@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _FGE_C_QUANTIZED_HPP_INCLUDED
+#define _FGE_C_QUANTIZED_HPP_INCLUDED
+
+#include "FastEngine/network/C_bitBank.hpp"
+#include "FastEngine/network/C_packet.hpp"
+#include <array>
+
+namespace fge::net
+{
+
+/**
+ * \struct QuantizeRange
+ * \ingroup network
+ * \brief Describe how a floating point value is quantized on the network
+ *
+ * The value is clamped to [_min, _max] and mapped to an unsigned integer of \b _bits bits.
+ * The precision is then (_max - _min) / (2^_bits - 1).
+ */
+struct QuantizeRange
+{
+    float _min{0.0f};
+    float _max{1.0f};
+    uint8_t _bits{16}; ///< Number of bits, between 1 and 32, other values are clamped (see getBits)
+
+    /**
+     * \brief Get the number of bits used for one value
+     *
+     * \return _bits clamped between 1 and 32
+     */
+    [[nodiscard]] constexpr uint8_t getBits() const;
+    [[nodiscard]] constexpr uint32_t getMaxQuantizedValue() const;
+    [[nodiscard]] constexpr float getPrecision() const;
+
+    [[nodiscard]] constexpr uint32_t quantize(float value) const;
+    [[nodiscard]] constexpr float dequantize(uint32_t value) const;
+
+    /**
+     * \brief Get the number of bytes needed to pack a certain number of values
+     *
+     * \param count The number of values
+     * \return The size in bytes
+     */
+    [[nodiscard]] constexpr std::size_t getPackedSize(std::size_t count) const;
+};
+
+/**
+ * \brief Quantize and pack multiple values into the packet
+ *
+ * All values are packed together with a BitBank, so no bits are wasted between them.
+ *
+ * \param pck The packet
+ * \param range The quantization range
+ * \param values The values to pack
+ */
+template<std::size_t TCount>
+void PackQuantized(Packet& pck, QuantizeRange const& range, std::array<float, TCount> const& values);
+/**
+ * \brief Unpack multiple values packed with PackQuantized()
+ *
+ * \param pck The packet
+ * \param range The quantization range, must be the same as the one used to pack
+ * \param values The unpacked values
+ * \return \b true if the values have been extracted, \b false otherwise
+ */
+template<std::size_t TCount>
+bool UnpackQuantized(Packet const& pck, QuantizeRange const& range, std::array<float, TCount>& values);
+
+/**
+ * \struct Quantized
+ * \ingroup network
+ * \brief Opt-in wrapper to (un)pack a floating point value as a quantized value
+ *
+ * \code
+ * pck << fge::net::Quantized<float, -1.0f, 1.0f, 10>{value};
+ * \endcode
+ *
+ * \tparam T The floating point type
+ * \tparam TMin The minimum value
+ * \tparam TMax The maximum value
+ * \tparam TBits The number of bits used on the network
+ */
+template<class T, T TMin, T TMax, uint8_t TBits>
+struct Quantized
+{
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+    static_assert(TBits > 0 && TBits <= 32, "TBits must be between 1 and 32");
+    static_assert(TMin < TMax, "TMin must be lower than TMax");
+
+    static constexpr QuantizeRange Range{static_cast<float>(TMin), static_cast<float>(TMax), TBits};
+
+    T _value{TMin};
+};
+
+/**
+ * \struct QuantizedVector2
+ * \ingroup network
+ * \brief Same as Quantized but for a 2D vector, both components are packed together
+ */
+template<class T, T TMin, T TMax, uint8_t TBits>
+struct QuantizedVector2
+{
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+    static_assert(TBits > 0 && TBits <= 32, "TBits must be between 1 and 32");
+    static_assert(TMin < TMax, "TMin must be lower than TMax");
+
+    static constexpr QuantizeRange Range{static_cast<float>(TMin), static_cast<float>(TMax), TBits};
+
+    fge::Vector2<T> _value{TMin};
+};
+
+template<class T, T TMin, T TMax, uint8_t TBits>
+Packet& operator<<(Packet& pck, Quantized<T, TMin, TMax, TBits> const& data);
+template<class T, T TMin, T TMax, uint8_t TBits>
+Packet const& operator>>(Packet const& pck, Quantized<T, TMin, TMax, TBits>& data);
+
+template<class T, T TMin, T TMax, uint8_t TBits>
+Packet& operator<<(Packet& pck, QuantizedVector2<T, TMin, TMax, TBits> const& data);
+template<class T, T TMin, T TMax, uint8_t TBits>
+Packet const& operator>>(Packet const& pck, QuantizedVector2<T, TMin, TMax, TBits>& data);
+
+/**
+ * \struct NetworkTypeQuantizePolicy
+ * \ingroup network
+ * \brief A NetworkType policy that quantize float, Vector2f and Vector3f values
+ *
+ * \code
+ * this->_netList.push<fge::net::NetworkType<fge::Vector2f, fge::net::NetworkTypeQuantizePolicy<0.0f, 4096.0f, 18>>>(
+ *         fge::DataAccessor<fge::Vector2f>{...});
+ * \endcode
+ */
+template<float TMin, float TMax, uint8_t TBits>
+struct NetworkTypeQuantizePolicy
+{
+    static_assert(TBits > 0 && TBits <= 32, "TBits must be between 1 and 32");
+    static_assert(TMin < TMax, "TMin must be lower than TMax");
+
+    static constexpr QuantizeRange Range{TMin, TMax, TBits};
+
+    static void pack(Packet& pck, float value);
+    static void pack(Packet& pck, fge::Vector2f const& value);
+    static void pack(Packet& pck, fge::Vector3f const& value);
+
+    [[nodiscard]] static bool unpack(Packet const& pck, float& value);
+    [[nodiscard]] static bool unpack(Packet const& pck, fge::Vector2f& value);
+    [[nodiscard]] static bool unpack(Packet const& pck, fge::Vector3f& value);
+};
+
+} // namespace fge::net
+
+#include "C_quantized.inl"
+
+#endif // _FGE_C_QUANTIZED_HPP_INCLUDED
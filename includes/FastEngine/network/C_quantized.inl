@@ -0,0 +1,191 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace fge::net
+{
+
+//QuantizeRange
+
+constexpr uint8_t QuantizeRange::getBits() const
+{
+    return this->_bits < 1 ? 1 : (this->_bits > 32 ? 32 : this->_bits);
+}
+constexpr uint32_t QuantizeRange::getMaxQuantizedValue() const
+{
+    auto const bits = this->getBits();
+    return bits == 32 ? 0xFFFFFFFF : (static_cast<uint32_t>(1) << bits) - 1;
+}
+constexpr float QuantizeRange::getPrecision() const
+{
+    return static_cast<float>(static_cast<double>(this->_max - this->_min) /
+                              static_cast<double>(this->getMaxQuantizedValue()));
+}
+
+constexpr uint32_t QuantizeRange::quantize(float value) const
+{
+    if (!(value > this->_min))
+    { //Also handle NaN
+        return 0;
+    }
+    if (value >= this->_max)
+    {
+        return this->getMaxQuantizedValue();
+    }
+
+    double const normalized =
+            static_cast<double>(value - this->_min) / static_cast<double>(this->_max - this->_min);
+    return static_cast<uint32_t>(normalized * static_cast<double>(this->getMaxQuantizedValue()) + 0.5);
+}
+constexpr float QuantizeRange::dequantize(uint32_t value) const
+{
+    uint32_t const maxValue = this->getMaxQuantizedValue();
+    value = value > maxValue ? maxValue : value;
+
+    double const normalized = static_cast<double>(value) / static_cast<double>(maxValue);
+    return static_cast<float>(static_cast<double>(this->_min) +
+                              normalized * static_cast<double>(this->_max - this->_min));
+}
+
+constexpr std::size_t QuantizeRange::getPackedSize(std::size_t count) const
+{
+    return (count * this->getBits() + 7) / 8;
+}
+
+//Functions
+
+template<std::size_t TCount>
+void PackQuantized(Packet& pck, QuantizeRange const& range, std::array<float, TCount> const& values)
+{
+    auto const bits = range.getBits();
+    fge::BitBank<TCount * sizeof(uint32_t)> bank;
+    for (std::size_t i = 0; i < TCount; ++i)
+    {
+        bank.setBits(i * bits, range.quantize(values[i]), bits);
+    }
+    bank.pack(pck, range.getPackedSize(TCount));
+}
+template<std::size_t TCount>
+bool UnpackQuantized(Packet const& pck, QuantizeRange const& range, std::array<float, TCount>& values)
+{
+    fge::BitBank<TCount * sizeof(uint32_t)> bank;
+    bank.unpack(pck, range.getPackedSize(TCount));
+    if (!pck.isValid())
+    {
+        return false;
+    }
+
+    auto const bits = range.getBits();
+    for (std::size_t i = 0; i < TCount; ++i)
+    {
+        values[i] = range.dequantize(static_cast<uint32_t>(bank.getBits(i * bits, bits)));
+    }
+    return true;
+}
+
+//Quantized
+
+template<class T, T TMin, T TMax, uint8_t TBits>
+Packet& operator<<(Packet& pck, Quantized<T, TMin, TMax, TBits> const& data)
+{
+    using TData = Quantized<T, TMin, TMax, TBits>;
+    fge::net::PackQuantized<1>(pck, TData::Range, {static_cast<float>(data._value)});
+    return pck;
+}
+template<class T, T TMin, T TMax, uint8_t TBits>
+Packet const& operator>>(Packet const& pck, Quantized<T, TMin, TMax, TBits>& data)
+{
+    using TData = Quantized<T, TMin, TMax, TBits>;
+    std::array<float, 1> values{};
+    if (fge::net::UnpackQuantized(pck, TData::Range, values))
+    {
+        data._value = static_cast<T>(values[0]);
+    }
+    return pck;
+}
+
+template<class T, T TMin, T TMax, uint8_t TBits>
+Packet& operator<<(Packet& pck, QuantizedVector2<T, TMin, TMax, TBits> const& data)
+{
+    using TData = QuantizedVector2<T, TMin, TMax, TBits>;
+    fge::net::PackQuantized<2>(pck, TData::Range,
+                               {static_cast<float>(data._value.x), static_cast<float>(data._value.y)});
+    return pck;
+}
+template<class T, T TMin, T TMax, uint8_t TBits>
+Packet const& operator>>(Packet const& pck, QuantizedVector2<T, TMin, TMax, TBits>& data)
+{
+    using TData = QuantizedVector2<T, TMin, TMax, TBits>;
+    std::array<float, 2> values{};
+    if (fge::net::UnpackQuantized(pck, TData::Range, values))
+    {
+        data._value = {static_cast<T>(values[0]), static_cast<T>(values[1])};
+    }
+    return pck;
+}
+
+//NetworkTypeQuantizePolicy
+
+template<float TMin, float TMax, uint8_t TBits>
+void NetworkTypeQuantizePolicy<TMin, TMax, TBits>::pack(Packet& pck, float value)
+{
+    fge::net::PackQuantized<1>(pck, Range, {value});
+}
+template<float TMin, float TMax, uint8_t TBits>
+void NetworkTypeQuantizePolicy<TMin, TMax, TBits>::pack(Packet& pck, fge::Vector2f const& value)
+{
+    fge::net::PackQuantized<2>(pck, Range, {value.x, value.y});
+}
+template<float TMin, float TMax, uint8_t TBits>
+void NetworkTypeQuantizePolicy<TMin, TMax, TBits>::pack(Packet& pck, fge::Vector3f const& value)
+{
+    fge::net::PackQuantized<3>(pck, Range, {value.x, value.y, value.z});
+}
+
+template<float TMin, float TMax, uint8_t TBits>
+bool NetworkTypeQuantizePolicy<TMin, TMax, TBits>::unpack(Packet const& pck, float& value)
+{
+    std::array<float, 1> values{};
+    if (fge::net::UnpackQuantized(pck, Range, values))
+    {
+        value = values[0];
+        return true;
+    }
+    return false;
+}
+template<float TMin, float TMax, uint8_t TBits>
+bool NetworkTypeQuantizePolicy<TMin, TMax, TBits>::unpack(Packet const& pck, fge::Vector2f& value)
+{
+    std::array<float, 2> values{};
+    if (fge::net::UnpackQuantized(pck, Range, values))
+    {
+        value = {values[0], values[1]};
+        return true;
+    }
+    return false;
+}
+template<float TMin, float TMax, uint8_t TBits>
+bool NetworkTypeQuantizePolicy<TMin, TMax, TBits>::unpack(Packet const& pck, fge::Vector3f& value)
+{
+    std::array<float, 3> values{};
+    if (fge::net::UnpackQuantized(pck, Range, values))
+    {
+        value = {values[0], values[1], values[2]};
+        return true;
+    }
+    return false;
+}
+
+} // namespace fge::net
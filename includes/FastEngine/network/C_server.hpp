@@ -21,6 +21,8 @@
 #include "C_socket.hpp"
 #include "FastEngine/C_flag.hpp"
 #include "FastEngine/network/C_clientList.hpp"
+#include "FastEngine/network/C_cryptWorkerPool.hpp"
+#include "FastEngine/network/C_linkConditioner.hpp"
 #include "FastEngine/network/C_netCommand.hpp"
 #include "FastEngine/network/C_packet.hpp"
 #include "FastEngine/network/C_protocol.hpp"
@@ -207,6 +209,30 @@ public:
     void setVersioningString(std::string_view versioningString);
     [[nodiscard]] std::string const& getVersioningString() const;
 
+    /**
+     * \brief Set the compression dictionary
+     *
+     * The dictionary is negotiated during the handshake, clients that don't provide the same
+     * dictionary id will fall back to dictionary-less compression.
+     * This should be set before starting the server.
+     *
+     * \param dictionary The shared dictionary or \b nullptr to disable it
+     */
+    void setCompressionDictionary(CompressorLZ4DictionaryPtr dictionary);
+    [[nodiscard]] CompressorLZ4DictionaryPtr getCompressionDictionary() const;
+
+    /**
+     * \brief Set the number of threads used to encrypt/decrypt packets
+     *
+     * By default (0), encryption and decryption are done directly by the transmission and reception threads.
+     * Otherwise a CryptWorkerPool is started with the server, jobs are sharded by client.
+     * This must be set before starting the server.
+     *
+     * \param count The number of crypt threads
+     */
+    void setCryptThreadCount(std::size_t count);
+    [[nodiscard]] std::size_t getCryptThreadCount() const;
+
     [[nodiscard]] bool
     start(Port bindPort, IpAddress const& bindIp, IpAddress::Types addressType = IpAddress::Types::None);
     [[nodiscard]] bool start(IpAddress::Types addressType = IpAddress::Types::None);
@@ -258,10 +284,24 @@ public:
 
     [[nodiscard]] void* getCryptContext() const;
 
+    /**
+     * \brief Get the link conditioner applied to the received datagrams
+     *
+     * The conditioner is disabled by default, it can be enabled at runtime to simulate bad network conditions.
+     *
+     * \return The link conditioner
+     */
+    [[nodiscard]] LinkConditioner& getLinkConditioner();
+    [[nodiscard]] LinkConditioner const& getLinkConditioner() const;
+
 private:
     void threadReception();
     void threadTransmission();
 
+    void startCryptPool();
+    [[nodiscard]] static bool prepareReceivedPacket(ProtocolPacket& packet, Compressor& decompressor);
+    void pushReceivedPacket(ReceivedPacketPtr&& packet);
+
     std::unique_ptr<std::thread> g_threadReception;
     std::unique_ptr<std::thread> g_threadTransmission;
 
@@ -269,6 +309,9 @@ private:
 
     mutable std::mutex g_mutexServer;
 
+    CryptWorkerPool g_cryptPool;
+    std::size_t g_cryptThreadCount{FGE_SERVER_DEFAULT_CRYPT_THREAD_COUNT};
+
     std::vector<std::unique_ptr<ServerNetFluxUdp>> g_fluxes;
     ServerNetFluxUdp g_defaultFlux;
     std::queue<std::pair<TransmitPacketPtr, Identity>> g_transmissionQueue;
@@ -277,10 +320,12 @@ private:
 
     SocketUdp g_socket;
     bool g_running;
+    LinkConditioner g_linkConditioner;
 
     void* g_crypt_ctx;
 
     std::string g_versioningString;
+    CompressorLZ4DictionaryPtr g_compressionDictionary;
 };
 
 /**
@@ -311,6 +356,17 @@ public:
     void notifyTransmission();
     [[nodiscard]] bool isRunning() const;
 
+    /**
+     * \brief Set the compression dictionary
+     *
+     * The dictionary id is sent during the handshake on the next connect(), it is only used if the server
+     * have the same dictionary.
+     *
+     * \param dictionary The shared dictionary or \b nullptr to disable it
+     */
+    void setCompressionDictionary(CompressorLZ4DictionaryPtr dictionary);
+    [[nodiscard]] CompressorLZ4DictionaryPtr getCompressionDictionary() const;
+
     [[nodiscard]] std::future<uint16_t> retrieveMTU();
     [[nodiscard]] std::future<bool> connect(std::string_view versioningString = std::string_view{});
     [[nodiscard]] std::future<void> disconnect();
@@ -321,6 +377,16 @@ public:
 
     [[nodiscard]] Identity const& getClientIdentity() const;
 
+    /**
+     * \brief Get the link conditioner applied to the received datagrams
+     *
+     * The conditioner is disabled by default, it can be enabled at runtime to simulate bad network conditions.
+     *
+     * \return The link conditioner
+     */
+    [[nodiscard]] LinkConditioner& getLinkConditioner();
+    [[nodiscard]] LinkConditioner const& getLinkConditioner() const;
+
     template<class TPacket = Packet>
     void sendTo(TransmitPacketPtr& pck, Identity const& id);
 
@@ -368,10 +434,13 @@ private:
 
     SocketUdp g_socket;
     bool g_running{false};
+    LinkConditioner g_linkConditioner;
 
     Identity g_clientIdentity;
 
-    std::recursive_mutex g_mutexCommands;
+    mutable std::recursive_mutex g_mutexCommands;
+
+    CompressorLZ4DictionaryPtr g_compressionDictionary;
 
     bool g_returnPacketEnabled{false};
     TransmitPacketPtr g_returnPacket;
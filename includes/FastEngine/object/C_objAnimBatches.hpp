@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _FGE_C_OBJANIMBATCHES_HPP_INCLUDED
+#define _FGE_C_OBJANIMBATCHES_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "C_objAnim.hpp"
+#include "C_objSpriteBatches.hpp"
+#include "FastEngine/accessor/C_animation.hpp"
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#define FGE_OBJANIMBATCHES_CLASSNAME "FGE:OBJ:ANIMBATCHES"
+
+namespace fge
+{
+
+/**
+ * \class ObjAnimationBatches
+ * \ingroup objectControl
+ * \brief Many instances of the same animation updated and drawn at once
+ *
+ * Every instance share the AnimationData of the object, the frames of every group are resolved once
+ * into a table of texture rectangles and texture indices. The instances are stored as a structure of
+ * arrays: the frame timers are advanced in one branchless pass over contiguous arrays and only the
+ * instances that reach the end of their frame are updated.
+ *
+ * The instances are drawn in one instanced draw call with the ObjSpriteBatches pipeline, the textures of the
+ * animation (the tileset or the frames atlas) are the textures of the batches.
+ *
+ * \see ObjAnimation, ObjSpriteBatches
+ */
+class FGE_API ObjAnimationBatches : public fge::ObjSpriteBatches
+{
+public:
+    using Index = fge::Animation::Index;
+
+    ObjAnimationBatches();
+    explicit ObjAnimationBatches(fge::Animation const& animation);
+
+    FGE_OBJ_DEFAULT_COPYMETHOD(fge::ObjAnimationBatches)
+
+    /**
+     * \brief Set the animation shared by every instance
+     *
+     * The frame table and the textures are rebuilt, the instances keep their group and frame
+     * index if they are still valid.
+     *
+     * \param animation The animation
+     */
+    void setAnimation(fge::Animation const& animation);
+    [[nodiscard]] fge::Animation const& getAnimation() const;
+
+    void setTickDuration(std::chrono::milliseconds const& tms);
+    [[nodiscard]] std::chrono::microseconds const& getTickDuration() const;
+
+    /**
+     * \brief Add an animated instance
+     *
+     * \param groupIndex The group of the instance
+     * \param frameIndex The beginning frame of the instance
+     * \return The transformable of the instance
+     */
+    fge::Transformable& addInstance(Index groupIndex = 0, Index frameIndex = 0);
+    void resizeInstances(std::size_t size);
+    void clearInstances();
+    [[nodiscard]] std::size_t getInstanceCount() const;
+
+    bool setInstanceGroup(std::size_t index, Index groupIndex);
+    bool setInstanceGroup(std::size_t index, std::string_view group);
+    void setInstanceFrame(std::size_t index, Index frameIndex);
+    [[nodiscard]] std::optional<Index> getInstanceGroup(std::size_t index) const;
+    [[nodiscard]] std::optional<Index> getInstanceFrame(std::size_t index) const;
+
+    void setInstancePause(std::size_t index, bool flag);
+    void setInstanceLoop(std::size_t index, bool flag);
+    void setInstanceReverse(std::size_t index, bool flag);
+    void setInstanceHorizontalFlip(std::size_t index, bool flag);
+    [[nodiscard]] bool isInstancePaused(std::size_t index) const;
+    [[nodiscard]] bool isInstanceLoop(std::size_t index) const;
+    [[nodiscard]] bool isInstanceReverse(std::size_t index) const;
+    [[nodiscard]] bool isInstanceHorizontalFlipped(std::size_t index) const;
+
+    FGE_OBJ_UPDATE_DECLARE
+
+    void save(nlohmann::json& jsonObject) override;
+    void load(nlohmann::json& jsonObject, std::filesystem::path const& filePath) override;
+    void pack(fge::net::Packet& pck) override;
+    void unpack(fge::net::Packet const& pck) override;
+
+    char const* getClassName() const override;
+    char const* getReadableClassName() const override;
+
+private:
+    //The sprites and the textures are driven by the animation, so their management is hidden
+    using fge::ObjSpriteBatches::addSprite;
+    using fge::ObjSpriteBatches::addTexture;
+    using fge::ObjSpriteBatches::clear;
+    using fge::ObjSpriteBatches::clearTexture;
+    using fge::ObjSpriteBatches::resize;
+    using fge::ObjSpriteBatches::setSpriteTexture;
+    using fge::ObjSpriteBatches::setTexture;
+    using fge::ObjSpriteBatches::setTextureRect;
+
+    enum InstanceFlags : uint8_t
+    {
+        INSTANCE_FLAG_NONE = 0,
+        INSTANCE_FLAG_LOOP = 1 << 0,
+        INSTANCE_FLAG_REVERSE = 1 << 1,
+        INSTANCE_FLAG_FLIP_HORIZONTAL = 1 << 2
+    };
+
+    struct FrameData
+    {
+        fge::RectInt _textureRect;
+        uint32_t _textureIndex{0};
+        uint32_t _ticks{0};
+    };
+    struct GroupData
+    {
+        uint32_t _firstFrame{0};
+        Index _frameCount{0};
+    };
+
+    void refreshFrameTable();
+    [[nodiscard]] uint32_t getTextureIndex(std::shared_ptr<fge::TextureType> const& texture);
+    void advanceInstance(std::size_t index);
+    void applyFrame(std::size_t index);
+    [[nodiscard]] FrameData const* getFrameData(Index groupIndex, Index frameIndex) const;
+
+    fge::Animation g_animation;
+    std::chrono::microseconds g_tickDuration;
+
+    std::vector<FrameData> g_frameTable;
+    std::vector<GroupData> g_groupTable;
+
+    //Instances as a structure of arrays
+    std::vector<uint32_t> g_elapsedTimes;   ///< Elapsed time of the current frame in microseconds
+    std::vector<uint32_t> g_frameDurations; ///< Duration of the current frame in microseconds
+    std::vector<uint32_t> g_running;        ///< 1 if the instance is running, 0 if paused
+    std::vector<Index> g_groupIndices;
+    std::vector<Index> g_frameIndices;
+    std::vector<uint8_t> g_flags;
+};
+
+} // namespace fge
+
+#endif // _FGE_C_OBJANIMBATCHES_HPP_INCLUDED
@@ -56,6 +56,7 @@ public:
     void setTextureRect(std::size_t index, fge::RectInt const& rectangle);
     void setColor(std::size_t index, fge::Color const& color);
     void setSpriteTexture(std::size_t spriteIndex, uint32_t textureIndex);
+    [[nodiscard]] std::optional<uint32_t> getSpriteTexture(std::size_t spriteIndex) const;
     [[nodiscard]] std::size_t getSpriteCount() const;
 
     [[nodiscard]] std::optional<fge::RectInt> getTextureRect(std::size_t index) const;
@@ -55,7 +55,8 @@ public:
                       fge::Vector2f const& size,
                       fge::Glyph const& glyph,
                       fge::Vector2i const& textureSize,
-                      float italicShear);
+                      float italicShear,
+                      float padding = 1.0f);
 
     void draw(fge::TransformUboData const& externalTransform,
               fge::RenderTarget const& target,
@@ -124,6 +125,24 @@ public:
 
     void setOutlineThickness(float thickness);
 
+    /**
+     * \brief Set the color of the text shadow
+     *
+     * The shadow is only drawn when the font is in SDF render mode, a transparent color disable it.
+     *
+     * \param color The shadow color
+     */
+    void setShadowColor(fge::Color const& color);
+    /**
+     * \brief Set the offset of the text shadow
+     *
+     * The shadow is drawn inside the glyph quads, so the offset is limited to the SDF spread
+     * (FGE_FONT_SDF_SPREAD pixels at FGE_FONT_SDF_BASE_SIZE).
+     *
+     * \param offset The shadow offset in pixels
+     */
+    void setShadowOffset(fge::Vector2f const& offset);
+
     tiny_utf8::string const& getString() const;
 
     fge::CharacterSize getCharacterSize() const;
@@ -140,6 +159,9 @@ public:
 
     float getOutlineThickness() const;
 
+    [[nodiscard]] fge::Color const& getShadowColor() const;
+    [[nodiscard]] fge::Vector2f const& getShadowOffset() const;
+
     fge::Vector2f findCharacterPos(std::size_t index) const;
 
     std::vector<fge::Character>& getCharacters();
@@ -170,11 +192,13 @@ private:
     fge::Color g_fillColor{255, 255, 255};              /// Text fill color
     fge::Color g_outlineColor{0, 0, 0};                 /// Text outline color
     float g_outlineThickness{0.0f};                     /// Thickness of the text's outline
+    fge::Color g_shadowColor{0, 0, 0, 0};               /// Text shadow color (SDF fonts only)
+    fge::Vector2f g_shadowOffset{0.0f, 0.0f};           /// Offset of the text's shadow (SDF fonts only)
 
     mutable std::vector<Character> g_characters;
     mutable fge::RectFloat g_bounds;                    /// Bounding rectangle of the text (in local coordinates)
     mutable bool g_geometryNeedUpdate{false};           /// Does the geometry need to be recomputed?
-    mutable uint32_t g_fontTextureModificationCount{0}; /// The font texture id
+    mutable uint32_t g_fontPageRevision{0};             /// The font page revision of the last geometry update
 };
 
 } // namespace fge
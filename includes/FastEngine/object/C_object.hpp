@@ -20,6 +20,7 @@
 #include "FastEngine/fge_extern.hpp"
 #include "C_childObjectsAccessor.hpp"
 #include "FastEngine/C_event.hpp"
+#include "FastEngine/C_objectPool.hpp"
 #include "FastEngine/C_propertyList.hpp"
 #include "FastEngine/C_quad.hpp"
 #include "FastEngine/C_rect.hpp"
@@ -17,11 +17,33 @@
 #ifndef _FGE_STRING_HASH_HPP_INCLUDED
 #define _FGE_STRING_HASH_HPP_INCLUDED
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace fge
 {
 
+/**
+ * \ingroup utility
+ * \brief Compute the 64bits FNV-1a hash of a string
+ *
+ * The hash is stable between runs and platforms and can be computed at compile-time.
+ *
+ * \param str The string to hash
+ * \return The hash
+ */
+[[nodiscard]] constexpr uint64_t HashFnv1a(std::string_view str)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (char const c: str)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 struct StringHash
 {
     using is_transparent = void;
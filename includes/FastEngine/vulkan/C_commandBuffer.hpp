@@ -132,6 +132,18 @@ public:
                            uint32_t height,
                            int32_t offsetX = 0,
                            int32_t offsetY = 0);
+    /**
+     * \brief Copy a buffer to an image with multiple regions
+     *
+     * Useful to copy every mip level of an image from a single buffer.
+     * The destination image must be in the VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL layout.
+     *
+     * \param buffer The buffer
+     * \param image The image
+     * \param regions An array of copy regions
+     * \param regionCount The number of regions
+     */
+    void copyBufferToImage(VkBuffer buffer, VkImage image, VkBufferImageCopy const* regions, uint32_t regionCount);
     /**
      * \brief Copy an image to a buffer
      *
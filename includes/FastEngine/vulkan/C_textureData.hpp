@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _FGE_VULKAN_C_TEXTUREDATA_HPP_INCLUDED
+#define _FGE_VULKAN_C_TEXTUREDATA_HPP_INCLUDED
+
+#include "FastEngine/fge_extern.hpp"
+#include "volk.h"
+#include "FastEngine/C_vector.hpp"
+#include "SDL_surface.h"
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#define FGE_TEXTURE_DATA_MIPMAPS_LEVELS_AUTO 0
+
+namespace fge::vulkan
+{
+
+/**
+ * \class TextureData
+ * \ingroup vulkan
+ * \brief CPU side texture with its mip chain, ready to be uploaded in a TextureImage
+ *
+ * The texture can be created from a surface, the mip chain is then generated on the CPU with
+ * a 2x2 box filter (see fge::pixel::DownsampleRows).
+ *
+ * It can also be loaded from a KTX2 or a DDS file containing BC1, BC3, BC7 or RGBA8 levels,
+ * the levels are kept as they are in the file, compressed data is never decoded.
+ * Only 2D textures without supercompression are supported. sRGB formats are loaded as their UNORM
+ * equivalent, like every other texture of the engine.
+ *
+ * \see TextureImage::create(TextureData const&)
+ */
+class FGE_API TextureData
+{
+public:
+    struct Level
+    {
+        fge::Vector2i _size;
+        std::size_t _offset{0};
+        std::size_t _byteSize{0};
+    };
+
+    TextureData() = default;
+
+    /**
+     * \brief Remove every level
+     */
+    void clear();
+
+    /**
+     * \brief Create an RGBA8 texture from a surface and generate its mip chain
+     *
+     * \param surface A surface with 32 bits pixels, the bytes order is kept as is (RGBA32 is expected)
+     * \param levels The number of mip levels, FGE_TEXTURE_DATA_MIPMAPS_LEVELS_AUTO for a full chain
+     * \return \b true if the texture was created
+     */
+    bool create(SDL_Surface const* surface, uint32_t levels = FGE_TEXTURE_DATA_MIPMAPS_LEVELS_AUTO);
+    /**
+     * \brief Load a KTX2 or DDS file, the format is detected with the file header
+     *
+     * \param filePath The path of the file
+     * \return \b true if the file was loaded
+     */
+    bool loadFromFile(std::filesystem::path const& filePath);
+    /**
+     * \brief Load a KTX2 or DDS file from memory
+     *
+     * \param data The file data
+     * \param size The size of the data
+     * \return \b true if the data was loaded
+     */
+    bool loadFromMemory(void const* data, std::size_t size);
+
+    [[nodiscard]] bool isValid() const;
+    [[nodiscard]] VkFormat getFormat() const;
+    [[nodiscard]] bool isCompressed() const;
+    [[nodiscard]] fge::Vector2i getSize() const;
+
+    [[nodiscard]] uint32_t getLevelCount() const;
+    [[nodiscard]] Level const& getLevel(uint32_t level) const;
+    [[nodiscard]] uint8_t const* getLevelData(uint32_t level) const;
+    /**
+     * \brief Get the data of every level, tightly packed from the largest level to the smallest one
+     *
+     * \return The levels data
+     */
+    [[nodiscard]] std::vector<uint8_t> const& getData() const;
+
+    /**
+     * \brief Check if a format is supported by TextureData
+     *
+     * \param format The format
+     * \return \b true if the format is supported
+     */
+    [[nodiscard]] static bool IsSupportedFormat(VkFormat format);
+    [[nodiscard]] static bool IsCompressedFormat(VkFormat format);
+    /**
+     * \brief Compute the byte size of a level, compressed formats are stored by 4x4 blocks
+     *
+     * \param format The format of the level
+     * \param size The size of the level in pixels
+     * \return The byte size of the level, 0 if the format is not supported
+     */
+    [[nodiscard]] static std::size_t ComputeLevelByteSize(VkFormat format, fge::Vector2i const& size);
+    [[nodiscard]] static uint32_t ComputeMipLevels(fge::Vector2i const& size);
+
+private:
+    bool loadKTX2(uint8_t const* data, std::size_t size);
+    bool loadDDS(uint8_t const* data, std::size_t size);
+
+    VkFormat g_format{VK_FORMAT_UNDEFINED};
+    std::vector<Level> g_levels;
+    std::vector<uint8_t> g_data;
+};
+
+} // namespace fge::vulkan
+
+#endif //_FGE_VULKAN_C_TEXTUREDATA_HPP_INCLUDED
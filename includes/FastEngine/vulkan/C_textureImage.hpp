@@ -32,6 +32,8 @@
 namespace fge::vulkan
 {
 
+class TextureData;
+
 class FGE_API TextureImage : public ContextAware
 {
 public:
@@ -46,6 +48,17 @@ public:
     bool create(glm::vec<2, int> const& size, uint32_t levels = 1);
     bool create(SDL_Surface* surface, uint32_t levels = 1);
     bool create(TextureImage const& texture, uint32_t levels = FGE_TEXTURE_IMAGE_MIPMAPS_LEVELS_AUTO);
+    /**
+     * \brief Create the texture from CPU side data, every level of the data is uploaded as it is
+     *
+     * Compressed formats (BCn) are uploaded without being decoded, this need the device textureCompressionBC
+     * feature. A compressed texture can only be sampled: copyToSurface(), update() and generateMipmaps()
+     * have no effect on it.
+     *
+     * \param data The texture data with its mip chain
+     * \return \b true if the texture was created, \b false if the data is invalid or the format is not supported
+     */
+    bool create(TextureData const& data);
     void destroy() final;
     [[nodiscard]] bool isCreated() const;
 
@@ -61,7 +74,14 @@ public:
 
     [[nodiscard]] glm::vec<2, int> const& getSize() const;
     [[nodiscard]] VkExtent2D getExtent() const;
+    /**
+     * \brief Get the number of bytes per pixel
+     *
+     * \return The number of bytes per pixel, 0 for a compressed format
+     */
     [[nodiscard]] int getBytesPerPixel() const;
+    [[nodiscard]] VkFormat getFormat() const;
+    [[nodiscard]] bool isCompressed() const;
 
     [[nodiscard]] VkImage getTextureImage() const;
     [[nodiscard]] VmaAllocation getTextureImageAllocation() const;
@@ -94,6 +114,7 @@ private:
 
     glm::vec<2, int> g_textureSize;
     int g_textureBytesPerPixel;
+    VkFormat g_format;
 
     VkFilter g_filter;
     bool g_normalizedCoordinates;
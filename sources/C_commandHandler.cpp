@@ -27,12 +27,12 @@ CommandHandler::CommandHandler()
 
 bool CommandHandler::addCmd(std::string_view name, fge::CommandFunction cmdfunc)
 {
-    auto it = this->g_cmdDataMap.find(name);
+    auto it = this->g_cmdDataMap.find(fge::StringId{name});
 
     if (it == this->g_cmdDataMap.end())
     {
         auto& cmdData = this->g_cmdData.emplace_back(std::move(cmdfunc), name);
-        this->g_cmdDataMap[cmdData._name] = this->g_cmdData.size() - 1;
+        this->g_cmdDataMap[cmdData._id] = this->g_cmdData.size() - 1;
         return true;
     }
     return false;
@@ -40,7 +40,7 @@ bool CommandHandler::addCmd(std::string_view name, fge::CommandFunction cmdfunc)
 
 void CommandHandler::delCmd(std::string_view name)
 {
-    auto it = this->g_cmdDataMap.find(name);
+    auto it = this->g_cmdDataMap.find(fge::StringId{name});
 
     if (it != this->g_cmdDataMap.end())
     {
@@ -49,14 +49,14 @@ void CommandHandler::delCmd(std::string_view name)
 
         for (std::size_t i = 0; i < this->g_cmdData.size(); ++i)
         {
-            this->g_cmdDataMap[this->g_cmdData[i]._name] = i;
+            this->g_cmdDataMap[this->g_cmdData[i]._id] = i;
         }
     }
 }
 
 bool CommandHandler::replaceCmd(std::string_view name, fge::CommandFunction cmdfunc)
 {
-    auto it = this->g_cmdDataMap.find(name);
+    auto it = this->g_cmdDataMap.find(fge::StringId{name});
 
     if (it != this->g_cmdDataMap.end())
     {
@@ -75,7 +75,12 @@ void CommandHandler::clearCmd()
 fge::Property
 CommandHandler::callCmd(std::string_view name, fge::Object* caller, fge::Property const& arg, fge::Scene* callerScene)
 {
-    auto it = this->g_cmdDataMap.find(name);
+    return this->callCmd(fge::StringId{name}, caller, arg, callerScene);
+}
+fge::Property
+CommandHandler::callCmd(fge::StringId id, fge::Object* caller, fge::Property const& arg, fge::Scene* callerScene)
+{
+    auto it = this->g_cmdDataMap.find(id);
 
     if (it != this->g_cmdDataMap.end())
     {
@@ -95,7 +100,11 @@ CommandHandler::callCmd(std::size_t index, fge::Object* caller, fge::Property co
 
 std::size_t CommandHandler::getCmdIndex(std::string_view name) const
 {
-    auto it = this->g_cmdDataMap.find(name);
+    return this->getCmdIndex(fge::StringId{name});
+}
+std::size_t CommandHandler::getCmdIndex(fge::StringId id) const
+{
+    auto it = this->g_cmdDataMap.find(id);
 
     if (it != this->g_cmdDataMap.end())
     {
@@ -114,7 +123,11 @@ std::string_view CommandHandler::getCmdName(std::size_t index) const
 
 fge::CommandHandler::CommandData const* CommandHandler::getCmd(std::string_view name) const
 {
-    auto it = this->g_cmdDataMap.find(name);
+    return this->getCmd(fge::StringId{name});
+}
+fge::CommandHandler::CommandData const* CommandHandler::getCmd(fge::StringId id) const
+{
+    auto it = this->g_cmdDataMap.find(id);
 
     if (it != this->g_cmdDataMap.end())
     {
@@ -16,15 +16,120 @@
 
 #include "FastEngine/C_compressorLZ4.hpp"
 #include "FastEngine/fge_endian.hpp"
+#define LZ4_STATIC_LINKING_ONLY
+#define LZ4_HC_STATIC_LINKING_ONLY
 #include "lz4.h"
 #include "lz4hc.h"
 #include <algorithm>
+#include <fstream>
 
 namespace fge
 {
 
+namespace
+{
+
+CompressorLZ4Dictionary::Id ComputeDictionaryId(std::span<uint8_t const> const& data)
+{
+    //FNV-1a 32bits
+    uint32_t hash = 2166136261u;
+    for (auto const byte: data)
+    {
+        hash ^= byte;
+        hash *= 16777619u;
+    }
+    return hash == FGE_COMPRESSOR_LZ4_DICTIONARY_NONE ? 1 : hash;
+}
+
+} // namespace
+
+//CompressorLZ4Dictionary
+
+CompressorLZ4Dictionary::CompressorLZ4Dictionary(std::span<uint8_t const> const& data)
+{
+    this->loadFromMemory(data);
+}
+
+void CompressorLZ4Dictionary::loadFromMemory(std::span<uint8_t const> const& data)
+{
+    if (data.empty())
+    {
+        this->clear();
+        return;
+    }
+
+    //Only the last 64KB are used by LZ4
+    auto const size = std::min<std::size_t>(data.size(), FGE_COMPRESSOR_LZ4_DICTIONARY_MAX_SIZE);
+    this->g_data.assign(data.end() - static_cast<std::ptrdiff_t>(size), data.end());
+    this->g_id = ComputeDictionaryId(this->g_data);
+}
+bool CompressorLZ4Dictionary::loadFromFile(std::filesystem::path const& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+
+    auto const fileSize = file.tellg();
+    if (fileSize <= 0)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(fileSize));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), fileSize))
+    {
+        return false;
+    }
+
+    this->loadFromMemory(buffer);
+    return true;
+}
+void CompressorLZ4Dictionary::clear()
+{
+    this->g_data.clear();
+    this->g_id = FGE_COMPRESSOR_LZ4_DICTIONARY_NONE;
+}
+
+CompressorLZ4Dictionary::Id CompressorLZ4Dictionary::getId() const
+{
+    return this->g_id;
+}
+std::vector<uint8_t> const& CompressorLZ4Dictionary::getData() const
+{
+    return this->g_data;
+}
+bool CompressorLZ4Dictionary::isEmpty() const
+{
+    return this->g_data.empty();
+}
+
 //CompressorLZ4
 
+struct CompressorLZ4::StreamContext
+{
+    StreamContext()
+    {
+        LZ4_initStream(&this->_stream, sizeof(LZ4_stream_t));
+        LZ4_initStream(&this->_dictionaryStream, sizeof(LZ4_stream_t));
+    }
+
+    LZ4_stream_t _stream;
+    LZ4_stream_t _dictionaryStream;
+    CompressorLZ4DictionaryPtr _loadedDictionary; ///< The dictionary stream reference this data, so we keep it alive
+};
+
+CompressorLZ4::CompressorLZ4() = default;
+CompressorLZ4::CompressorLZ4(CompressorLZ4 const& r) :
+        Compressor(r),
+        g_maxUncompressedSize(r.g_maxUncompressedSize),
+        g_dictionary(r.g_dictionary)
+{}
+CompressorLZ4::CompressorLZ4(CompressorLZ4&& r) noexcept = default;
+CompressorLZ4::~CompressorLZ4() = default;
+
 std::optional<CompressorLZ4::ErrorString> CompressorLZ4::compress(std::span<uint8_t const> const& rawData)
 {
     if (rawData.empty())
@@ -47,9 +152,31 @@ std::optional<CompressorLZ4::ErrorString> CompressorLZ4::compress(std::span<uint
 
     this->_g_buffer.resize(dataDstSize + sizeof(uint32_t));
 
-    auto const dataCompressedSize =
-            LZ4_compress_default(dataSrc, reinterpret_cast<char*>(this->_g_buffer.data()) + sizeof(uint32_t),
-                                 static_cast<int>(rawData.size()), dataDstSize);
+    if (!this->g_streamContext)
+    {
+        this->g_streamContext = std::make_unique<StreamContext>();
+    }
+    auto& context = *this->g_streamContext;
+
+    //Every block must be independent, so we start a new stream each time, attaching the dictionary if any
+    bool const haveDictionary = this->getDictionaryId() != FGE_COMPRESSOR_LZ4_DICTIONARY_NONE;
+    if (context._loadedDictionary != this->g_dictionary)
+    {
+        if (haveDictionary)
+        {
+            auto const& dictionaryData = this->g_dictionary->getData();
+            LZ4_loadDict(&context._dictionaryStream, reinterpret_cast<char const*>(dictionaryData.data()),
+                         static_cast<int>(dictionaryData.size()));
+        }
+        context._loadedDictionary = this->g_dictionary;
+    }
+
+    LZ4_resetStream_fast(&context._stream);
+    LZ4_attach_dictionary(&context._stream, haveDictionary ? &context._dictionaryStream : nullptr);
+
+    auto const dataCompressedSize = LZ4_compress_fast_continue(
+            &context._stream, dataSrc, reinterpret_cast<char*>(this->_g_buffer.data()) + sizeof(uint32_t),
+            static_cast<int>(rawData.size()), dataDstSize, 1);
     if (dataCompressedSize <= 0)
     {
         this->_g_lastCompressionSize = 0;
@@ -83,9 +210,21 @@ std::optional<CompressorLZ4::ErrorString> CompressorLZ4::uncompress(std::span<ui
 
     this->_g_buffer.resize(dataUncompressedSize + FGE_COMPRESSOR_LZ4_EXTRA_BYTES);
 
-    auto const dataUncompressedFinalSize = LZ4_decompress_safe(
-            dataSrc + sizeof(uint32_t), reinterpret_cast<char*>(this->_g_buffer.data()),
-            static_cast<int>(data.size() - sizeof(uint32_t)), static_cast<int>(this->_g_buffer.size()));
+    int dataUncompressedFinalSize = 0;
+    if (this->getDictionaryId() != FGE_COMPRESSOR_LZ4_DICTIONARY_NONE)
+    {
+        auto const& dictionaryData = this->g_dictionary->getData();
+        dataUncompressedFinalSize = LZ4_decompress_safe_usingDict(
+                dataSrc + sizeof(uint32_t), reinterpret_cast<char*>(this->_g_buffer.data()),
+                static_cast<int>(data.size() - sizeof(uint32_t)), static_cast<int>(this->_g_buffer.size()),
+                reinterpret_cast<char const*>(dictionaryData.data()), static_cast<int>(dictionaryData.size()));
+    }
+    else
+    {
+        dataUncompressedFinalSize = LZ4_decompress_safe(
+                dataSrc + sizeof(uint32_t), reinterpret_cast<char*>(this->_g_buffer.data()),
+                static_cast<int>(data.size() - sizeof(uint32_t)), static_cast<int>(this->_g_buffer.size()));
+    }
 
     if (dataUncompressedFinalSize <= 0)
     {
@@ -106,8 +245,53 @@ uint32_t CompressorLZ4::getMaxUncompressedSize() const
     return this->g_maxUncompressedSize;
 }
 
+void CompressorLZ4::setDictionary(CompressorLZ4DictionaryPtr dictionary)
+{
+    this->g_dictionary = std::move(dictionary);
+}
+CompressorLZ4DictionaryPtr const& CompressorLZ4::getDictionary() const
+{
+    return this->g_dictionary;
+}
+CompressorLZ4Dictionary::Id CompressorLZ4::getDictionaryId() const
+{
+    return this->g_dictionary ? this->g_dictionary->getId() : FGE_COMPRESSOR_LZ4_DICTIONARY_NONE;
+}
+
 //CompressorLZ4HC
 
+namespace
+{
+
+struct StreamContextHC
+{
+    StreamContextHC()
+    {
+        LZ4_initStreamHC(&this->_stream, sizeof(LZ4_streamHC_t));
+        LZ4_initStreamHC(&this->_dictionaryStream, sizeof(LZ4_streamHC_t));
+    }
+
+    LZ4_streamHC_t _stream;
+    LZ4_streamHC_t _dictionaryStream;
+    CompressorLZ4DictionaryPtr _loadedDictionary; ///< The dictionary stream reference this data, so we keep it alive
+    int _loadedCompressionLevel{0};
+};
+
+//Every block is independent, so the big stream context is only a scratch shared by the compressors of a thread
+thread_local std::unique_ptr<StreamContextHC> gStreamContextHC;
+
+} // namespace
+
+CompressorLZ4HC::CompressorLZ4HC() = default;
+CompressorLZ4HC::CompressorLZ4HC(CompressorLZ4HC const& r) :
+        Compressor(r),
+        g_maxUncompressedSize(r.g_maxUncompressedSize),
+        g_compressionLevel(r.g_compressionLevel),
+        g_dictionary(r.g_dictionary)
+{}
+CompressorLZ4HC::CompressorLZ4HC(CompressorLZ4HC&& r) noexcept = default;
+CompressorLZ4HC::~CompressorLZ4HC() = default;
+
 std::optional<CompressorLZ4HC::ErrorString> CompressorLZ4HC::compress(std::span<uint8_t const> const& rawData)
 {
     if (rawData.empty())
@@ -130,9 +314,34 @@ std::optional<CompressorLZ4HC::ErrorString> CompressorLZ4HC::compress(std::span<
 
     this->_g_buffer.resize(dataDstSize + sizeof(uint32_t));
 
-    auto const dataCompressedSize =
-            LZ4_compress_HC(dataSrc, reinterpret_cast<char*>(this->_g_buffer.data()) + sizeof(uint32_t),
-                            static_cast<int>(rawData.size()), dataDstSize, this->g_compressionLevel);
+    if (!gStreamContextHC)
+    {
+        gStreamContextHC = std::make_unique<StreamContextHC>();
+    }
+    auto& context = *gStreamContextHC;
+
+    //Every block must be independent, so we start a new stream each time, attaching the dictionary if any
+    bool const haveDictionary = this->getDictionaryId() != FGE_COMPRESSOR_LZ4_DICTIONARY_NONE;
+    if (context._loadedDictionary != this->g_dictionary ||
+        context._loadedCompressionLevel != this->g_compressionLevel)
+    {
+        if (haveDictionary)
+        {
+            auto const& dictionaryData = this->g_dictionary->getData();
+            LZ4_resetStreamHC_fast(&context._dictionaryStream, this->g_compressionLevel);
+            LZ4_loadDictHC(&context._dictionaryStream, reinterpret_cast<char const*>(dictionaryData.data()),
+                           static_cast<int>(dictionaryData.size()));
+        }
+        context._loadedDictionary = this->g_dictionary;
+        context._loadedCompressionLevel = this->g_compressionLevel;
+    }
+
+    LZ4_resetStreamHC_fast(&context._stream, this->g_compressionLevel);
+    LZ4_attach_HC_dictionary(&context._stream, haveDictionary ? &context._dictionaryStream : nullptr);
+
+    auto const dataCompressedSize = LZ4_compress_HC_continue(
+            &context._stream, dataSrc, reinterpret_cast<char*>(this->_g_buffer.data()) + sizeof(uint32_t),
+            static_cast<int>(rawData.size()), dataDstSize);
     if (dataCompressedSize <= 0)
     {
         this->_g_lastCompressionSize = 0;
@@ -166,9 +375,21 @@ std::optional<CompressorLZ4HC::ErrorString> CompressorLZ4HC::uncompress(std::spa
 
     this->_g_buffer.resize(dataUncompressedSize + FGE_COMPRESSOR_LZ4_EXTRA_BYTES);
 
-    auto const dataUncompressedFinalSize = LZ4_decompress_safe(
-            dataSrc + sizeof(uint32_t), reinterpret_cast<char*>(this->_g_buffer.data()),
-            static_cast<int>(data.size() - sizeof(uint32_t)), static_cast<int>(this->_g_buffer.size()));
+    int dataUncompressedFinalSize = 0;
+    if (this->getDictionaryId() != FGE_COMPRESSOR_LZ4_DICTIONARY_NONE)
+    {
+        auto const& dictionaryData = this->g_dictionary->getData();
+        dataUncompressedFinalSize = LZ4_decompress_safe_usingDict(
+                dataSrc + sizeof(uint32_t), reinterpret_cast<char*>(this->_g_buffer.data()),
+                static_cast<int>(data.size() - sizeof(uint32_t)), static_cast<int>(this->_g_buffer.size()),
+                reinterpret_cast<char const*>(dictionaryData.data()), static_cast<int>(dictionaryData.size()));
+    }
+    else
+    {
+        dataUncompressedFinalSize = LZ4_decompress_safe(
+                dataSrc + sizeof(uint32_t), reinterpret_cast<char*>(this->_g_buffer.data()),
+                static_cast<int>(data.size() - sizeof(uint32_t)), static_cast<int>(this->_g_buffer.size()));
+    }
 
     if (dataUncompressedFinalSize <= 0)
     {
@@ -198,4 +419,17 @@ int CompressorLZ4HC::getCompressionLevel() const
     return this->g_compressionLevel;
 }
 
+void CompressorLZ4HC::setDictionary(CompressorLZ4DictionaryPtr dictionary)
+{
+    this->g_dictionary = std::move(dictionary);
+}
+CompressorLZ4DictionaryPtr const& CompressorLZ4HC::getDictionary() const
+{
+    return this->g_dictionary;
+}
+CompressorLZ4Dictionary::Id CompressorLZ4HC::getDictionaryId() const
+{
+    return this->g_dictionary ? this->g_dictionary->getId() : FGE_COMPRESSOR_LZ4_DICTIONARY_NONE;
+}
+
 } // namespace fge
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/C_objectPool.hpp"
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <unordered_map>
+
+namespace fge
+{
+
+//FixedSizePool
+
+FixedSizePool::FixedSizePool(std::size_t blockSize, std::size_t blockAlignment, std::size_t blocksPerChunk) :
+        g_blockAlignment(std::max(blockAlignment, alignof(FreeBlock))),
+        g_blocksPerChunk(std::max<std::size_t>(blocksPerChunk, 1))
+{
+    //Every block must be able to hold a free list node and keep the alignment of the next block
+    blockSize = std::max(blockSize, sizeof(FreeBlock));
+    this->g_blockSize = (blockSize + this->g_blockAlignment - 1) / this->g_blockAlignment * this->g_blockAlignment;
+}
+FixedSizePool::~FixedSizePool()
+{
+    for (auto* chunk: this->g_chunks)
+    {
+        ::operator delete(chunk, std::align_val_t{this->g_blockAlignment});
+    }
+}
+
+void* FixedSizePool::allocate()
+{
+    std::scoped_lock const lock(this->g_mutex);
+
+    if (this->g_freeList == nullptr)
+    {
+        this->allocateChunk();
+    }
+
+    auto* block = this->g_freeList;
+    this->g_freeList = block->_next;
+    ++this->g_usedBlockCount;
+    return block;
+}
+void FixedSizePool::deallocate(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    std::scoped_lock const lock(this->g_mutex);
+
+    auto* block = static_cast<FreeBlock*>(ptr);
+    block->_next = this->g_freeList;
+    this->g_freeList = block;
+    --this->g_usedBlockCount;
+}
+
+std::size_t FixedSizePool::getBlockSize() const
+{
+    return this->g_blockSize;
+}
+std::size_t FixedSizePool::getUsedBlockCount() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_usedBlockCount;
+}
+std::size_t FixedSizePool::getCapacity() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_chunks.size() * this->g_blocksPerChunk;
+}
+std::size_t FixedSizePool::getChunkCount() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_chunks.size();
+}
+
+void FixedSizePool::allocateChunk()
+{
+    auto* chunk = static_cast<std::byte*>(
+            ::operator new(this->g_blockSize * this->g_blocksPerChunk, std::align_val_t{this->g_blockAlignment}));
+    this->g_chunks.push_back(chunk);
+
+    //Linking the blocks in order, so the first allocations are contiguous
+    for (std::size_t i = this->g_blocksPerChunk; i-- > 0;)
+    {
+        auto* block = reinterpret_cast<FreeBlock*>(chunk + i * this->g_blockSize);
+        block->_next = this->g_freeList;
+        this->g_freeList = block;
+    }
+}
+
+//Registry
+
+fge::FixedSizePool& GetObjectPool(std::type_index type, std::size_t blockSize, std::size_t blockAlignment)
+{
+    //Never destroyed, see the function documentation
+    static auto* mutex = new std::mutex();
+    static auto* pools = new std::unordered_map<std::type_index, std::unique_ptr<fge::FixedSizePool>>();
+
+    std::scoped_lock const lock(*mutex);
+    auto& pool = (*pools)[type];
+    if (!pool)
+    {
+        pool = std::make_unique<fge::FixedSizePool>(blockSize, blockAlignment);
+    }
+    return *pool;
+}
+
+std::pmr::memory_resource* GetObjectDataMemoryResource()
+{
+    //Never destroyed, see the function documentation
+    static auto* resource = new std::pmr::synchronized_pool_resource();
+    return resource;
+}
+
+} // namespace fge
@@ -15,6 +15,7 @@
  */
 
 #include "FastEngine/C_property.hpp"
+#include <memory>
 
 namespace fge
 {
@@ -29,10 +30,10 @@ Property::Property(fge::Property const& val) :
     case fge::Property::Types::PTYPE_NULL:
         break;
     case fge::Property::Types::PTYPE_STRING:
-        this->g_data._ptr = new std::string{*reinterpret_cast<std::string*>(val.g_data._ptr)};
+        this->emplaceString(*val.getString());
         break;
     case fge::Property::Types::PTYPE_CLASS:
-        this->g_data._ptr = reinterpret_cast<fge::PropertyClassWrapper*>(val.g_data._ptr)->copy();
+        this->copyClassFrom(val.getClassWrapper());
         break;
 
     default:
@@ -41,19 +42,15 @@ Property::Property(fge::Property const& val) :
     }
 }
 Property::Property(fge::Property&& val) noexcept :
-        g_type(val.g_type),
-        g_data(val.g_data),
-        g_isSigned(val.g_isSigned),
         g_isModified(true)
 {
-    val.g_type = fge::Property::Types::PTYPE_NULL;
+    this->moveFrom(val);
 }
 
 Property::Property(char const* val) :
-        g_type{fge::Property::Types::PTYPE_STRING},
         g_isModified(true)
 {
-    this->g_data._ptr = new std::string{val};
+    this->emplaceString(val);
 }
 
 Property::~Property()
@@ -65,14 +62,29 @@ void Property::clear()
 {
     if (this->g_type == fge::Property::Types::PTYPE_STRING)
     {
-        delete reinterpret_cast<std::string*>(this->g_data._ptr);
+        if constexpr (IsStringStoredInline)
+        {
+            std::destroy_at(this->getString());
+        }
+        else
+        {
+            delete this->getString();
+        }
     }
     else if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        delete reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr);
+        if (this->g_isInline)
+        {
+            std::destroy_at(this->getClassWrapper());
+        }
+        else
+        {
+            delete this->getClassWrapper();
+        }
     }
 
     this->g_type = fge::Property::Types::PTYPE_NULL;
+    this->g_isInline = false;
 }
 
 bool Property::operator==(fge::Property const& val) const
@@ -115,15 +127,13 @@ bool Property::operator==(fge::Property const& val) const
             return this->g_data._d == val.g_data._d;
             break;
         case fge::Property::Types::PTYPE_STRING:
-            return *reinterpret_cast<std::string*>(this->g_data._ptr) ==
-                   *reinterpret_cast<std::string*>(val.g_data._ptr);
+            return *this->getString() == *val.getString();
             break;
         case fge::Property::Types::PTYPE_POINTER:
             return this->g_data._ptr == val.g_data._ptr;
             break;
         case fge::Property::Types::PTYPE_CLASS:
-            return reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)
-                    ->compare(reinterpret_cast<fge::PropertyClassWrapper*>(val.g_data._ptr));
+            return this->getClassWrapper()->compare(val.getClassWrapper());
             break;
         }
     }
@@ -159,7 +169,7 @@ void Property::setType(fge::Property::Types type)
         this->clear();
         if (type == fge::Property::Types::PTYPE_STRING)
         {
-            this->g_data._ptr = new std::string();
+            this->emplaceString();
         }
         this->g_type = type;
     }
@@ -174,7 +184,7 @@ std::type_info const& Property::getClassType() const
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        return reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType();
+        return *this->g_classType;
     }
     return typeid(nullptr);
 }
@@ -208,14 +218,14 @@ std::string Property::toString() const
         return fge::string::ToStr(this->g_data._d);
         break;
     case fge::Property::Types::PTYPE_STRING:
-        return *reinterpret_cast<std::string*>(this->g_data._ptr);
+        return *this->getString();
         break;
 
     case fge::Property::Types::PTYPE_POINTER:
         return fge::string::ToStr(this->g_data._ptr);
         break;
     case fge::Property::Types::PTYPE_CLASS:
-        return reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->toString();
+        return this->getClassWrapper()->toString();
         break;
 
     default:
@@ -233,12 +243,11 @@ bool Property::set(fge::Property const& val)
         case fge::Property::Types::PTYPE_NULL:
             break;
         case fge::Property::Types::PTYPE_STRING:
-            *reinterpret_cast<std::string*>(this->g_data._ptr) = *reinterpret_cast<std::string*>(val.g_data._ptr);
+            *this->getString() = *val.getString();
             this->g_isModified = true;
             break;
         case fge::Property::Types::PTYPE_CLASS:
-            if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)
-                        ->tryToCopy(reinterpret_cast<fge::PropertyClassWrapper*>(val.g_data._ptr)))
+            if (this->getClassWrapper()->tryToCopy(val.getClassWrapper()))
             {
                 this->g_isModified = true;
             }
@@ -262,10 +271,10 @@ bool Property::set(fge::Property const& val)
         case fge::Property::Types::PTYPE_NULL:
             break;
         case fge::Property::Types::PTYPE_STRING:
-            this->g_data._ptr = new std::string(*reinterpret_cast<std::string*>(val.g_data._ptr));
+            this->emplaceString(*val.getString());
             break;
         case fge::Property::Types::PTYPE_CLASS:
-            this->g_data._ptr = reinterpret_cast<fge::PropertyClassWrapper*>(val.g_data._ptr)->copy();
+            this->copyClassFrom(val.getClassWrapper());
             break;
 
         default:
@@ -281,48 +290,11 @@ bool Property::set(fge::Property const& val)
 }
 bool Property::set(fge::Property&& val)
 {
-    if (this->g_type == val.g_type)
-    {
-        switch (val.g_type)
-        {
-        case fge::Property::Types::PTYPE_NULL:
-            break;
-        case fge::Property::Types::PTYPE_STRING:
-        case fge::Property::Types::PTYPE_CLASS:
-            this->g_data._ptr = val.g_data._ptr;
-            this->g_isModified = true;
-            break;
-
-        default:
-            this->g_isSigned = val.g_isSigned;
-            this->g_data = val.g_data;
-            this->g_isModified = true;
-            break;
-        }
-
-        val.g_type = fge::Property::Types::PTYPE_NULL;
-        return true;
-    }
-    else if (this->g_type == fge::Property::Types::PTYPE_NULL)
+    if (this->g_type == val.g_type || this->g_type == fge::Property::Types::PTYPE_NULL)
     {
+        this->clear();
+        this->moveFrom(val);
         this->g_isModified = true;
-        this->g_type = val.g_type;
-        switch (val.g_type)
-        {
-        case fge::Property::Types::PTYPE_NULL:
-            break;
-        case fge::Property::Types::PTYPE_STRING:
-        case fge::Property::Types::PTYPE_CLASS:
-            this->g_data._ptr = val.g_data._ptr;
-            break;
-
-        default:
-            this->g_isSigned = val.g_isSigned;
-            this->g_data = val.g_data;
-            break;
-        }
-
-        val.g_type = fge::Property::Types::PTYPE_NULL;
         return true;
     }
 
@@ -335,13 +307,12 @@ bool Property::set(char const* val)
     {
         if (this->g_type == fge::Property::Types::PTYPE_NULL)
         {
-            this->g_type = fge::Property::Types::PTYPE_STRING;
-            this->g_data._ptr = new std::string(val);
+            this->emplaceString(val);
             return true;
         }
         return false;
     }
-    *reinterpret_cast<std::string*>(this->g_data._ptr) = val;
+    *this->getString() = val;
     return true;
 }
 
@@ -350,31 +321,25 @@ fge::ParrayType& Property::setArrayType()
     if (this->g_type != fge::Property::Types::PTYPE_CLASS)
     {
         this->clear();
-        this->g_type = fge::Property::Types::PTYPE_CLASS;
-        this->g_data._ptr =
-                static_cast<fge::PropertyClassWrapper*>(new fge::PropertyClassWrapperType<fge::ParrayType>());
+        return this->emplaceClass<fge::ParrayType>();
     }
-    else
+
+    if (*this->g_classType != typeid(fge::ParrayType))
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() != typeid(fge::ParrayType))
-        {
-            this->clear();
-            this->g_type = fge::Property::Types::PTYPE_CLASS;
-            this->g_data._ptr =
-                    static_cast<fge::PropertyClassWrapper*>(new fge::PropertyClassWrapperType<fge::ParrayType>());
-        }
+        this->clear();
+        return this->emplaceClass<fge::ParrayType>();
     }
 
-    return reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)->_data;
+    return this->getArray()->_data;
 }
 
 bool Property::resize(std::size_t n)
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)->_data.resize(n);
+            this->getArray()->_data.resize(n);
             return true;
         }
     }
@@ -384,9 +349,9 @@ bool Property::reserve(std::size_t n)
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)->_data.reserve(n);
+            this->getArray()->_data.reserve(n);
             return true;
         }
     }
@@ -397,10 +362,9 @@ bool Property::pushData(fge::Property const& value)
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)
-                    ->_data.emplace_back(value);
+            this->getArray()->_data.emplace_back(value);
             return true;
         }
     }
@@ -410,10 +374,9 @@ bool Property::pushData(fge::Property&& value)
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)
-                    ->_data.emplace_back(std::move(value));
+            this->getArray()->_data.emplace_back(std::move(value));
             return true;
         }
     }
@@ -424,9 +387,9 @@ bool Property::setData(std::size_t index, fge::Property const& value)
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)->_data[index] = value;
+            this->getArray()->_data[index] = value;
             return true;
         }
     }
@@ -436,10 +399,9 @@ bool Property::setData(std::size_t index, fge::Property&& value)
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)->_data[index] =
-                    std::move(value);
+            this->getArray()->_data[index] = std::move(value);
             return true;
         }
     }
@@ -450,13 +412,11 @@ fge::Property* Property::getData(std::size_t index)
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            if (reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)->_data.size() >
-                index)
+            if (this->getArray()->_data.size() > index)
             {
-                return &reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)
-                                ->_data[index];
+                return &this->getArray()->_data[index];
             }
         }
     }
@@ -466,13 +426,11 @@ fge::Property const* Property::getData(std::size_t index) const
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            if (reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)->_data.size() >
-                index)
+            if (this->getArray()->_data.size() > index)
             {
-                return &reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)
-                                ->_data[index];
+                return &this->getArray()->_data[index];
             }
         }
     }
@@ -483,9 +441,9 @@ std::size_t Property::getDataSize() const
 {
     if (this->g_type == fge::Property::Types::PTYPE_CLASS)
     {
-        if (reinterpret_cast<fge::PropertyClassWrapper*>(this->g_data._ptr)->getType() == typeid(fge::ParrayType))
+        if (*this->g_classType == typeid(fge::ParrayType))
         {
-            return reinterpret_cast<fge::PropertyClassWrapperType<fge::ParrayType>*>(this->g_data._ptr)->_data.size();
+            return this->getArray()->_data.size();
         }
     }
     return 0;
@@ -509,4 +467,67 @@ void Property::setModifiedFlag(bool flag)
     this->g_isModified = flag;
 }
 
+std::string* Property::getString() const
+{
+    if constexpr (IsStringStoredInline)
+    {
+        return std::launder(reinterpret_cast<std::string*>(const_cast<std::byte*>(this->g_data._buffer)));
+    }
+    else
+    {
+        return static_cast<std::string*>(this->g_data._ptr);
+    }
+}
+
+fge::PropertyClassWrapper* Property::getClassWrapper() const
+{
+    if (this->g_isInline)
+    {
+        return std::launder(reinterpret_cast<fge::PropertyClassWrapper*>(const_cast<std::byte*>(this->g_data._buffer)));
+    }
+    return static_cast<fge::PropertyClassWrapper*>(this->g_data._ptr);
+}
+fge::PropertyClassWrapperType<fge::ParrayType>* Property::getArray() const
+{
+    return this->getClassWrapper<fge::ParrayType>();
+}
+void Property::copyClassFrom(fge::PropertyClassWrapper const* wrapper)
+{
+    this->g_type = fge::Property::Types::PTYPE_CLASS;
+    this->g_classType = &wrapper->getType();
+
+    auto* newWrapper = wrapper->copy(this->g_data._buffer);
+    this->g_isInline = newWrapper == static_cast<void*>(this->g_data._buffer);
+    if (!this->g_isInline)
+    {
+        this->g_data._ptr = newWrapper;
+    }
+}
+void Property::moveFrom(fge::Property& val)
+{
+    this->g_type = val.g_type;
+    this->g_classType = val.g_classType;
+    this->g_isSigned = val.g_isSigned;
+
+    if (val.g_type == fge::Property::Types::PTYPE_STRING && IsStringStoredInline)
+    {
+        this->emplaceString(std::move(*val.getString()));
+        val.clear();
+        return;
+    }
+    if (val.g_type == fge::Property::Types::PTYPE_CLASS && val.g_isInline)
+    {
+        (void) val.getClassWrapper()->move(this->g_data._buffer);
+        this->g_isInline = true;
+        val.clear();
+        return;
+    }
+
+    //Scalars and heap allocated values are moved by copying the data
+    this->g_data = val.g_data;
+    this->g_isInline = false;
+    val.g_type = fge::Property::Types::PTYPE_NULL;
+    val.g_isInline = false;
+}
+
 } // namespace fge
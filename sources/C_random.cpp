@@ -15,10 +15,170 @@
  */
 
 #include "FastEngine/C_random.hpp"
+#include <algorithm>
+#include <atomic>
 
 namespace fge
 {
 
+namespace
+{
+
+constexpr uint64_t SplitMix64Increment = 0x9E3779B97F4A7C15;
+
+uint64_t SplitMix64(uint64_t& state)
+{
+    uint64_t z = (state += SplitMix64Increment);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+    return z ^ (z >> 31);
+}
+
+std::atomic<uint64_t> gThreadRandomSeed{
+        static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count())};
+std::atomic<uint64_t> gThreadRandomStreamCount{0};
+
+uint64_t CreateThreadRandomSeed()
+{
+    uint64_t state = gThreadRandomSeed + gThreadRandomStreamCount.fetch_add(1) * SplitMix64Increment;
+    return SplitMix64(state);
+}
+
+} // namespace
+
+//Xoshiro256ss
+
+Xoshiro256ss::Xoshiro256ss() :
+        Xoshiro256ss(0)
+{}
+Xoshiro256ss::Xoshiro256ss(uint64_t seed)
+{
+    this->seed(seed);
+}
+
+void Xoshiro256ss::seed(uint64_t seed)
+{
+    for (auto& state: this->g_state)
+    {
+        state = SplitMix64(seed);
+    }
+    this->g_bulkReady = false;
+}
+
+void Xoshiro256ss::discard(unsigned long long count)
+{
+    for (unsigned long long i = 0; i < count; ++i)
+    {
+        (*this)();
+    }
+}
+
+void Xoshiro256ss::jump()
+{
+    constexpr std::array<uint64_t, 4> jumpPolynomial{0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA,
+                                                     0x39ABDC4529B1661C};
+
+    std::array<uint64_t, 4> state{};
+    for (auto const word: jumpPolynomial)
+    {
+        for (int b = 0; b < 64; ++b)
+        {
+            if ((word & (uint64_t{1} << b)) != 0)
+            {
+                for (std::size_t i = 0; i < state.size(); ++i)
+                {
+                    state[i] ^= this->g_state[i];
+                }
+            }
+            (*this)();
+        }
+    }
+    this->g_state = state;
+}
+
+void Xoshiro256ss::generate(std::span<result_type> values)
+{
+    if (values.size() < FGE_RANDOM_BULK_MIN_SIZE)
+    {
+        for (auto& value: values)
+        {
+            value = (*this)();
+        }
+        return;
+    }
+
+    if (!this->g_bulkReady)
+    {
+        this->initBulk();
+    }
+
+    //Local copies, so the compiler knows that the state doesn't alias the output
+    auto s0 = this->g_bulkState[0];
+    auto s1 = this->g_bulkState[1];
+    auto s2 = this->g_bulkState[2];
+    auto s3 = this->g_bulkState[3];
+    std::array<uint64_t, FGE_RANDOM_BULK_LANES> result{};
+
+    for (std::size_t i = 0; i < values.size(); i += FGE_RANDOM_BULK_LANES)
+    {
+        for (std::size_t lane = 0; lane < FGE_RANDOM_BULK_LANES; ++lane)
+        {
+            result[lane] = std::rotl(s1[lane] * 5, 7) * 9;
+            auto const t = s1[lane] << 17;
+
+            s2[lane] ^= s0[lane];
+            s3[lane] ^= s1[lane];
+            s1[lane] ^= s2[lane];
+            s0[lane] ^= s3[lane];
+
+            s2[lane] ^= t;
+            s3[lane] = std::rotl(s3[lane], 45);
+        }
+
+        auto const count = std::min<std::size_t>(FGE_RANDOM_BULK_LANES, values.size() - i);
+        std::copy_n(result.begin(), count, values.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    this->g_bulkState = {s0, s1, s2, s3};
+}
+
+bool Xoshiro256ss::operator==(Xoshiro256ss const& r) const
+{
+    if (this->g_state != r.g_state || this->g_bulkReady != r.g_bulkReady)
+    {
+        return false;
+    }
+    return !this->g_bulkReady || this->g_bulkState == r.g_bulkState;
+}
+
+void Xoshiro256ss::initBulk()
+{
+    //Every bulk stream is 2^128 values after the previous one, the main stream stay before them
+    Xoshiro256ss lane = *this;
+    for (std::size_t i = 0; i < FGE_RANDOM_BULK_LANES; ++i)
+    {
+        lane.jump();
+        for (std::size_t j = 0; j < lane.g_state.size(); ++j)
+        {
+            this->g_bulkState[j][i] = lane.g_state[j];
+        }
+    }
+    this->g_bulkReady = true;
+}
+
+//Random
+
 fge::Random<std::mt19937_64> _random;
 
+fge::LocalRandom& GetThreadRandom()
+{
+    thread_local fge::LocalRandom random{CreateThreadRandomSeed()};
+    return random;
+}
+void SetThreadRandomSeed(uint64_t seed)
+{
+    gThreadRandomSeed = seed;
+    gThreadRandomStreamCount = 0;
+}
+
 } // namespace fge
@@ -16,18 +16,58 @@
 
 #include "FastEngine/C_scene.hpp"
 #include "FastEngine/C_guiElement.hpp"
-#include "FastEngine/C_random.hpp"
+#include "FastEngine/C_sceneSnapshot.hpp"
 #include "FastEngine/extra/extra_function.hpp"
 #include "FastEngine/manager/network_manager.hpp"
 #include "FastEngine/manager/reg_manager.hpp"
 #include "FastEngine/network/C_clientList.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace fge
 {
 
+namespace
+{
+
+void EraseFromIndex(fge::ObjectIndexMap& index, fge::StringId key, fge::ObjectData const* data)
+{
+    auto it = index.find(key);
+    if (it == index.end())
+    {
+        return;
+    }
+
+    auto& objects = it->second;
+    auto objectIt = std::find_if(objects.begin(), objects.end(),
+                                 [data](fge::ObjectDataShared const& object) { return object.get() == data; });
+    if (objectIt != objects.end())
+    {
+        objects.erase(objectIt);
+    }
+    if (objects.empty())
+    {
+        index.erase(it);
+    }
+}
+
+} // namespace
+
 //ObjectContainerHashMap
 
-ObjectContainerHashMap::ObjectContainerHashMap(ObjectContainer& objects)
+ObjectContainerHashMap::ObjectContainerHashMap(std::pmr::memory_resource* resource) :
+        g_objectMap(resource)
+{}
+ObjectContainerHashMap::ObjectContainerHashMap(ObjectContainer& objects) :
+        g_objectMap(objects.get_allocator().resource())
 {
     this->reMap(objects);
 }
@@ -121,6 +161,153 @@ std::size_t ObjectContainerHashMap::size() const
     return this->g_objectMap.size();
 }
 
+//Scene::LoadWorkerPool
+
+/**
+ * \brief The threads used to deserialize Object in parallel
+ *
+ * The threads are kept alive between the loads and wait for the next one, the calling thread also takes
+ * part in the work.
+ */
+struct Scene::LoadWorkerPool
+{
+    explicit LoadWorkerPool(std::size_t workerCount)
+    {
+        this->_threads.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; ++i)
+        {
+            this->_threads.emplace_back(&LoadWorkerPool::threadWorker, this);
+        }
+    }
+    LoadWorkerPool(LoadWorkerPool const& r) = delete;
+    LoadWorkerPool(LoadWorkerPool&& r) noexcept = delete;
+    ~LoadWorkerPool()
+    {
+        {
+            std::scoped_lock const lock(this->_mutex);
+            this->_running = false;
+        }
+        this->_notifier.notify_all();
+        for (auto& thread: this->_threads)
+        {
+            thread.join();
+        }
+    }
+
+    LoadWorkerPool& operator=(LoadWorkerPool const& r) = delete;
+    LoadWorkerPool& operator=(LoadWorkerPool&& r) noexcept = delete;
+
+    /**
+     * \brief Call func(index) for every index in [0, count) by splitting the range in contiguous chunks
+     *
+     * An exception thrown by func is re-thrown once every chunk is done.
+     */
+    template<class TFunc>
+    void parallelFor(std::size_t count, TFunc const& func)
+    {
+        auto const threadCount = std::min(this->_threads.size() + 1, count);
+        if (threadCount <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                func(i);
+            }
+            return;
+        }
+
+        std::vector<std::exception_ptr> exceptions(threadCount);
+        auto const chunkSize = (count + threadCount - 1) / threadCount;
+
+        std::function<void(std::size_t)> const runChunk = [&](std::size_t chunkIndex) {
+            try
+            {
+                auto const end = std::min(count, (chunkIndex + 1) * chunkSize);
+                for (std::size_t i = chunkIndex * chunkSize; i < end; ++i)
+                {
+                    func(i);
+                }
+            }
+            catch (...)
+            {
+                exceptions[chunkIndex] = std::current_exception();
+            }
+        };
+        this->run(threadCount, runChunk);
+
+        for (auto const& exception: exceptions)
+        {
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t getWorkerCount() const { return this->_threads.size(); }
+
+private:
+    void run(std::size_t chunkCount, std::function<void(std::size_t)> const& runChunk)
+    {
+        {
+            std::scoped_lock const lock(this->_mutex);
+            this->_runChunk = &runChunk;
+            this->_chunkCount = chunkCount;
+            this->_nextChunk = 0;
+            this->_activeWorkers = this->_threads.size();
+            ++this->_generation;
+        }
+        this->_notifier.notify_all();
+
+        this->runChunks();
+
+        std::unique_lock lock(this->_mutex);
+        this->_doneNotifier.wait(lock, [&]() { return this->_activeWorkers == 0; });
+        this->_runChunk = nullptr;
+    }
+    void runChunks()
+    {
+        for (auto chunk = this->_nextChunk++; chunk < this->_chunkCount; chunk = this->_nextChunk++)
+        {
+            (*this->_runChunk)(chunk);
+        }
+    }
+    void threadWorker()
+    {
+        uint64_t generation = 0;
+        std::unique_lock lock(this->_mutex);
+        while (true)
+        {
+            this->_notifier.wait(lock, [&]() { return !this->_running || this->_generation != generation; });
+            if (!this->_running)
+            {
+                return;
+            }
+            generation = this->_generation;
+
+            lock.unlock();
+            this->runChunks();
+            lock.lock();
+
+            if (--this->_activeWorkers == 0)
+            {
+                this->_doneNotifier.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _notifier;
+    std::condition_variable _doneNotifier;
+    bool _running{true};
+    uint64_t _generation{0}; ///< Incremented for every run, wake up the threads
+    std::size_t _activeWorkers{0};
+
+    std::function<void(std::size_t)> const* _runChunk{nullptr};
+    std::size_t _chunkCount{0};
+    std::atomic_size_t _nextChunk{0};
+};
+
 //Scene
 
 Scene::Scene() :
@@ -135,7 +322,20 @@ Scene::Scene() :
         g_deleteMe(false),
         g_updatedObjectIterator(),
 
-        g_callbackContext({nullptr, nullptr})
+        g_objectResource(),
+        g_objects(&this->g_objectResource),
+        g_objectsHashMap(&this->g_objectResource),
+
+        g_callbackContext({nullptr, nullptr}),
+        g_loadThreadCount(0),
+        g_packObjectSizes(false),
+        g_interestConfig(),
+        g_interestEnabled(false),
+        g_netSnapshots(),
+        g_lastNetSnapshotId(0),
+        g_lastReceivedNetSnapshotId(0),
+        g_lastReceivedNetSnapshotTimestamp(0),
+        g_random(fge::GetThreadRandom().rand<uint64_t>())
 {
     this->g_updatedObjectIterator = this->g_objects.end();
 }
@@ -151,7 +351,20 @@ Scene::Scene(std::string sceneName) :
         g_deleteMe(false),
         g_updatedObjectIterator(),
 
-        g_callbackContext({nullptr, nullptr})
+        g_objectResource(),
+        g_objects(&this->g_objectResource),
+        g_objectsHashMap(&this->g_objectResource),
+
+        g_callbackContext({nullptr, nullptr}),
+        g_loadThreadCount(0),
+        g_packObjectSizes(false),
+        g_interestConfig(),
+        g_interestEnabled(false),
+        g_netSnapshots(),
+        g_lastNetSnapshotId(0),
+        g_lastReceivedNetSnapshotId(0),
+        g_lastReceivedNetSnapshotTimestamp(0),
+        g_random(fge::GetThreadRandom().rand<uint64_t>())
 {
     this->g_updatedObjectIterator = this->g_objects.end();
 }
@@ -171,7 +384,20 @@ Scene::Scene(Scene const& r) :
         g_deleteMe(false),
         g_updatedObjectIterator(),
 
-        g_callbackContext(r.g_callbackContext)
+        g_objectResource(),
+        g_objects(&this->g_objectResource),
+        g_objectsHashMap(&this->g_objectResource),
+
+        g_callbackContext(r.g_callbackContext),
+        g_loadThreadCount(r.g_loadThreadCount),
+        g_packObjectSizes(r.g_packObjectSizes),
+        g_interestConfig(r.g_interestConfig),
+        g_interestEnabled(r.g_interestEnabled),
+        g_netSnapshots(),
+        g_lastNetSnapshotId(0),
+        g_lastReceivedNetSnapshotId(0),
+        g_lastReceivedNetSnapshotTimestamp(0),
+        g_random(fge::GetThreadRandom().rand<uint64_t>())
 {
     for (auto const& objectData: r.g_objects)
     {
@@ -204,6 +430,15 @@ Scene& Scene::operator=(Scene const& r)
     this->g_deleteMe = false;
 
     this->g_callbackContext = r.g_callbackContext;
+    this->g_loadThreadCount = r.g_loadThreadCount;
+    this->g_packObjectSizes = r.g_packObjectSizes;
+    this->g_interestConfig = r.g_interestConfig;
+    this->g_interestEnabled = r.g_interestEnabled;
+    this->g_netSnapshots.clear();
+    this->g_lastNetSnapshotId = 0;
+    this->g_lastReceivedNetSnapshotId = 0;
+    this->g_lastReceivedNetSnapshotTimestamp = 0;
+    this->g_random.setSeed(fge::GetThreadRandom().rand<uint64_t>());
 
     for (auto const& objectData: r.g_objects)
     {
@@ -265,6 +500,7 @@ void Scene::update(fge::RenderTarget& target,
             {
                 updatedObject->g_object->_children.clear();
             }
+            this->index_delObject(updatedObject);
             updatedObject->g_boundScene = nullptr;
             updatedObject->g_object->_myObjectData.reset();
 
@@ -449,7 +685,7 @@ fge::ObjectDataShared Scene::newObject(fge::ObjectPtr&& newObject,
                                        bool silent,
                                        fge::EnumFlags<ObjectContextFlags> contextFlags)
 {
-    auto newObjectData = std::make_shared<fge::ObjectData>(this, std::move(newObject), sid, plan, type);
+    auto newObjectData = fge::MakeObjectData(this, std::move(newObject), sid, plan, type);
     newObjectData->g_contextFlags = contextFlags;
     return this->newObject(std::move(newObjectData), silent);
 }
@@ -472,6 +708,7 @@ fge::ObjectDataShared Scene::newObject(fge::ObjectDataShared const& objectData,
     it = this->g_objects.insert(it, objectData);
     objectData->g_boundScene = this;
     objectData->g_object->_myObjectData = objectData;
+    this->index_addObject(objectData);
     if (!this->g_objectsHashMap.newObject(generatedSid, it))
     {
         //Something went wrong, we can do a re-map
@@ -510,11 +747,12 @@ fge::ObjectDataShared Scene::duplicateObject(fge::ObjectSid sid, fge::ObjectSid
         return nullptr;
     }
 
-    fge::ObjectDataShared newObject = std::make_shared<fge::ObjectData>();
+    fge::ObjectDataShared newObject = fge::MakeObjectData();
     newObject->g_object.reset(object->g_object->copy());
     newObject->g_plan = object->g_plan;
     newObject->g_sid = newSid;
     newObject->g_type = object->g_type;
+    newObject->g_classNameId = object->g_classNameId;
 
     return this->newObject(newObject);
 }
@@ -534,6 +772,7 @@ fge::ObjectDataShared Scene::transferObject(fge::ObjectSid sid, fge::Scene& newS
 
     auto object = *objectIt.value();
 
+    this->index_delObject(object);
     this->hash_updatePlanDataMap(object->g_plan, objectIt.value(), true);
     this->g_objects.erase(objectIt.value());
     this->g_objectsHashMap.delObject(object->g_sid);
@@ -579,6 +818,7 @@ bool Scene::delObject(fge::ObjectSid sid)
     {
         object->g_object->_children.clear();
     }
+    this->index_delObject(object);
     object->g_boundScene = nullptr;
     object->g_object->_myObjectData.reset();
 
@@ -619,6 +859,7 @@ std::size_t Scene::delAllObject(bool ignoreGuiObject)
         {
             object->g_object->_children.clear();
         }
+        this->index_delObject(object);
         object->g_boundScene = nullptr;
         object->g_object->_myObjectData.reset();
         this->hash_updatePlanDataMap(object->g_plan, it, true);
@@ -704,12 +945,14 @@ bool Scene::setObject(fge::ObjectSid sid, fge::ObjectPtr&& newObject)
     {
         object->g_object->_children.clear();
     }
+    this->index_delObject(object);
     object->g_boundScene = nullptr;
     object->g_object->_myObjectData.reset();
 
-    object = std::make_shared<fge::ObjectData>(this, std::move(newObject), object->g_sid, object->g_plan,
-                                               object->g_type);
+    object = fge::MakeObjectData(this, std::move(newObject), object->g_sid, object->g_plan, object->g_type);
+    *objectIt.value() = object;
     object->g_object->_myObjectData = object;
+    this->index_addObject(object);
     object->g_object->first(*this);
 
     if (object->g_object->_callbackContextMode == fge::Object::CallbackContextModes::CONTEXT_AUTO &&
@@ -916,29 +1159,38 @@ std::size_t Scene::getAllObj_FromLocalZone(fge::RectInt const& zone,
 
 std::size_t Scene::getAllObj_ByClass(std::string_view class_name, fge::ObjectContainer& buff) const
 {
-    std::size_t objCount = 0;
-    for (auto const& data: this->g_objects)
+    return this->getAllObj_ByClass(fge::StringId{class_name}, buff);
+}
+std::size_t Scene::getAllObj_ByClass(fge::StringId class_name, fge::ObjectContainer& buff) const
+{
+    auto it = this->g_classIndex.find(class_name);
+    if (it == this->g_classIndex.end())
     {
-        if (data->g_object->getClassName() == class_name)
-        {
-            ++objCount;
-            buff.push_back(data);
-        }
+        return 0;
     }
-    return objCount;
+
+    buff.insert(buff.end(), it->second.begin(), it->second.end());
+    return it->second.size();
+}
+std::size_t Scene::getAllObj_ByClass(fge::reg::ClassId class_id, fge::ObjectContainer& buff) const
+{
+    auto const* stamp = fge::reg::GetStampOf(class_id);
+    return stamp != nullptr ? this->getAllObj_ByClass(stamp->getClassNameId(), buff) : 0;
 }
 std::size_t Scene::getAllObj_ByTag(std::string_view tag_name, fge::ObjectContainer& buff) const
 {
-    std::size_t objCount = 0;
-    for (auto const& data: this->g_objects)
+    return this->getAllObj_ByTag(fge::StringId{tag_name}, buff);
+}
+std::size_t Scene::getAllObj_ByTag(fge::StringId tag_name, fge::ObjectContainer& buff) const
+{
+    auto it = this->g_tagIndex.find(tag_name);
+    if (it == this->g_tagIndex.end())
     {
-        if (data->g_object->_tags.check(tag_name))
-        {
-            ++objCount;
-            buff.push_back(data);
-        }
+        return 0;
     }
-    return objCount;
+
+    buff.insert(buff.end(), it->second.begin(), it->second.end());
+    return it->second.size();
 }
 
 fge::ObjectDataShared Scene::getFirstObj_ByPosition(fge::Vector2f const& pos) const
@@ -1009,25 +1261,26 @@ fge::ObjectDataShared Scene::getFirstObj_FromLocalZone(fge::RectInt const& zone,
 
 fge::ObjectDataShared Scene::getFirstObj_ByClass(std::string_view class_name) const
 {
-    for (auto const& data: this->g_objects)
-    {
-        if (data->g_object->getClassName() == class_name)
-        {
-            return data;
-        }
-    }
-    return nullptr;
+    return this->getFirstObj_ByClass(fge::StringId{class_name});
+}
+fge::ObjectDataShared Scene::getFirstObj_ByClass(fge::StringId class_name) const
+{
+    auto it = this->g_classIndex.find(class_name);
+    return it != this->g_classIndex.end() ? it->second.front() : nullptr;
+}
+fge::ObjectDataShared Scene::getFirstObj_ByClass(fge::reg::ClassId class_id) const
+{
+    auto const* stamp = fge::reg::GetStampOf(class_id);
+    return stamp != nullptr ? this->getFirstObj_ByClass(stamp->getClassNameId()) : nullptr;
 }
 fge::ObjectDataShared Scene::getFirstObj_ByTag(std::string_view tag_name) const
 {
-    for (auto const& data: this->g_objects)
-    {
-        if (data->g_object->_tags.check(tag_name))
-        {
-            return data;
-        }
-    }
-    return nullptr;
+    return this->getFirstObj_ByTag(fge::StringId{tag_name});
+}
+fge::ObjectDataShared Scene::getFirstObj_ByTag(fge::StringId tag_name) const
+{
+    auto it = this->g_tagIndex.find(tag_name);
+    return it != this->g_tagIndex.end() ? it->second.front() : nullptr;
 }
 
 /** Static id **/
@@ -1061,7 +1314,7 @@ fge::ObjectSid Scene::generateSid(fge::ObjectSid wanted_sid, fge::ObjectTypes ty
 
     while (true) ///TODO: not that great
     {
-        auto new_sid = _random.range<ObjectSid>(0, (FGE_SCENE_BAD_SID - 1) &
+        auto new_sid = this->g_random.range<ObjectSid>(0, (FGE_SCENE_BAD_SID - 1) &
                                                            ~static_cast<DefaultSIDRanges_t>(DefaultSIDRanges::MASK));
 
         switch (type)
@@ -1103,6 +1356,7 @@ void Scene::signalObject(fge::ObjectSid sid, int8_t signal)
 
 void Scene::pack(fge::net::Packet& pck, fge::net::Identity const& id)
 {
+    PerClientSync* clientSync = nullptr;
     if (id._ip.getType() != net::IpAddress::Types::None && id._port != FGE_ANYPORT && id._port != 0)
     {
         auto result = this->g_perClientSyncs.emplace(std::piecewise_construct, std::forward_as_tuple(id),
@@ -1113,7 +1367,11 @@ void Scene::pack(fge::net::Packet& pck, fge::net::Identity const& id)
             std::queue<SceneNetEvent>().swap(result.first->second._networkEvents);
             this->forceUncheckClient(id);
         }
+        clientSync = &result.first->second;
+        //The relevant set is rebuilt with the packed Object
+        clientSync->_relevantObjects.clear();
     }
+    bool const interestManaged = clientSync != nullptr && this->isInterestManaged(*clientSync);
 
     //update count
     pck << this->g_updateCount;
@@ -1128,6 +1386,10 @@ void Scene::pack(fge::net::Packet& pck, fge::net::Identity const& id)
         this->_netList[i]->packData(pck);
     }
 
+    //object data size flag
+    bool const packObjectSizes = this->g_packObjectSizes;
+    pck << packObjectSizes;
+
     //object size
     net::SizeType objectSize = 0;
     std::size_t const objectSizePos = pck.getDataSize();
@@ -1149,16 +1411,40 @@ void Scene::pack(fge::net::Packet& pck, fge::net::Identity const& id)
             continue; //Object is ignored for this client
         }
 
+        if (interestManaged)
+        {
+            float const distance = fge::GetDistanceBetween(*clientSync->_viewpoint, data->g_object->getPosition());
+            if (distance > this->g_interestConfig._enterDistance)
+            {
+                continue; //Object is not relevant for this client
+            }
+            clientSync->_relevantObjects.emplace(data->g_sid,
+                                                 PerClientSync::Interest{clientSync->_packCount, distance});
+        }
+
         //SID
         pck << data->g_sid;
         //CLASS
-        pck << reg::GetClassId(data->g_object->getClassName());
+        pck << reg::GetClassId(data->g_classNameId);
         //PLAN
         pck << data->g_plan;
         //TYPE
         pck << data->g_type;
 
-        data->g_object->pack(pck);
+        if (packObjectSizes)
+        { //DATA SIZE, allow the Object data to be unpacked independently
+            uint32_t dataSize = 0;
+            std::size_t const dataSizePos = pck.getDataSize();
+            pck.pack(&dataSize, sizeof(dataSize)); //Will be rewritten
+
+            data->g_object->pack(pck);
+            dataSize = static_cast<uint32_t>(pck.getDataSize() - dataSizePos - sizeof(dataSize));
+            pck.pack(dataSizePos, &dataSize, sizeof(dataSize)); //Rewriting size
+        }
+        else
+        {
+            data->g_object->pack(pck);
+        }
         ++objectSize;
     }
     pck.pack(objectSizePos, &objectSize, sizeof(objectSize)); //Rewriting size
@@ -1170,10 +1456,20 @@ std::optional<fge::net::Error> Scene::unpack(fge::net::Packet const& pck, bool c
     ObjectPlan buffPlan{FGE_SCENE_PLAN_DEFAULT};
     ObjectSid buffSid{FGE_SCENE_BAD_SID};
 
+    struct ObjectUnpack
+    {
+        fge::Object* _object;
+        std::size_t _dataPos;
+        uint32_t _dataSize;
+    };
+    std::vector<ObjectUnpack> unpackList;
+    bool hasObjectSizes = false;
+    bool parallel = false;
+
     using namespace fge::net::rules;
 
     //update count
-    return RValid(pck, &this->g_updateCount)
+    auto const error = RValid(pck, &this->g_updateCount)
             .and_then([&](auto& chain) {
         //scene name
         return RStringRange(0, FGE_SCENE_LIMIT_NAMESIZE, chain, &this->g_name);
@@ -1195,6 +1491,9 @@ std::optional<fge::net::Error> Scene::unpack(fge::net::Packet const& pck, bool c
         {
             this->delAllObject(true);
         }
+        //object data size flag
+        pck >> hasObjectSizes;
+        parallel = hasObjectSizes && this->g_loadThreadCount > 1;
         //object size
         return RValid<net::SizeType>(chain);
     })
@@ -1221,7 +1520,7 @@ std::optional<fge::net::Error> Scene::unpack(fge::net::Packet const& pck, bool c
             { //Object already exist
                 if (buffObject->g_contextFlags.has(OBJ_CONTEXT_NETWORK))
                 {
-                    if (fge::reg::GetClassId(buffObject->g_object->getClassName()) != buffClass)
+                    if (fge::reg::GetClassId(buffObject->g_classNameId) != buffClass)
                     { //Class changed
                         this->delObject(buffSid);
                         buffObject = this->newObject(fge::ObjectPtr{fge::reg::GetNewClassOf(buffClass)}, buffPlan,
@@ -1246,20 +1545,69 @@ std::optional<fge::net::Error> Scene::unpack(fge::net::Packet const& pck, bool c
                 return chain.invalidate("unknown class ID / SID", func);
             }
 
-            buffObject->g_object->unpack(pck);
+            if (!hasObjectSizes)
+            {
+                buffObject->g_object->unpack(pck);
+                return chain;
+            }
+
+            //DATA SIZE
+            uint32_t dataSize = 0;
+            pck >> dataSize;
+            auto const dataPos = pck.getReadPos();
+            if (!pck.isValid() || pck.getDataSize() - dataPos < dataSize)
+            {
+                return chain.invalidate("bad object data size", func);
+            }
+
+            if (parallel)
+            { //Unpacked later
+                unpackList.push_back({buffObject->g_object.get(), dataPos, dataSize});
+            }
+            else
+            {
+                buffObject->g_object->unpack(pck);
+            }
+            pck.setReadPos(dataPos + dataSize);
 
             return chain;
         }).end();
     }).end();
+
+    if (unpackList.empty())
+    {
+        return error;
+    }
+
+    //Every Object is inserted, deserializing them in parallel from a view over their own slice of the packet.
+    //On error, the Objects inserted before it are still unpacked like with the serial unpack.
+    auto const unpackObject = [&](std::size_t index) {
+        auto const& objectUnpack = unpackList[index];
+        auto const slice = fge::net::Packet::View({pck.getData(objectUnpack._dataPos), objectUnpack._dataSize});
+        objectUnpack._object->unpack(slice);
+    };
+    if (unpackList.size() >= FGE_SCENE_PARALLEL_LOAD_MIN_OBJECTS)
+    {
+        this->getLoadWorkerPool().parallelFor(unpackList.size(), unpackObject);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < unpackList.size(); ++i)
+        {
+            unpackObject(i);
+        }
+    }
+    return error;
 }
 void Scene::packModification(fge::net::Packet& pck, fge::net::Identity const& id)
 {
     //update count range
     auto it = this->g_perClientSyncs.find(id);
-    if (it != this->g_perClientSyncs.end())
+    PerClientSync* clientSync = it != this->g_perClientSyncs.end() ? &it->second : nullptr;
+    if (clientSync != nullptr)
     {
-        pck << it->second._lastUpdateCount << this->g_updateCount;
-        it->second._lastUpdateCount = this->g_updateCount; //keep track of last update count for the client
+        pck << clientSync->_lastUpdateCount << this->g_updateCount;
+        clientSync->_lastUpdateCount = this->g_updateCount; //keep track of last update count for the client
     }
     else
     { //Should not really happen as clientCheckup is generally called before
@@ -1303,24 +1651,12 @@ void Scene::packModification(fge::net::Packet& pck, fge::net::Identity const& id
                                          sizeof(std::underlying_type_t<fge::ObjectTypes>) + sizeof(fge::net::SizeType);
     pck.append(reservedSize);
 
-    for (auto const& data: this->g_objects)
-    {
-        if (data->g_object->_netSyncMode != Object::NetSyncModes::FULL_SYNC &&
-            data->g_object->_netSyncMode != Object::NetSyncModes::DELTA_SYNC)
-        {
-            continue;
-        }
-
-        if (data->g_object->_netList.isIgnored(id))
-        {
-            continue;
-        }
-
+    auto const packObject = [&](fge::ObjectData const& data) {
         //MODIF COUNT/OBJECT DATA
         fge::net::SizeType countModification = 0;
-        for (std::size_t i = 0; i < data->getObject()->_netList.size(); ++i)
+        for (std::size_t i = 0; i < data.getObject()->_netList.size(); ++i)
         {
-            fge::net::NetworkTypeBase* netType = data->getObject()->_netList[i];
+            fge::net::NetworkTypeBase* netType = data.getObject()->_netList[i];
 
             if (netType->checkClient(id))
             {
@@ -1331,29 +1667,108 @@ void Scene::packModification(fge::net::Packet& pck, fge::net::Identity const& id
             }
         }
 
-        if (countModification > 0)
+        if (countModification == 0)
         {
-            //SID
-            pck.pack(dataPos, &data->g_sid, sizeof(fge::ObjectSid));
-            //CLASS
-            fge::reg::ClassId tmpClass = fge::reg::GetClassId(data->getObject()->getClassName());
-            pck.pack(dataPos + sizeof(fge::ObjectSid), &tmpClass, sizeof(fge::reg::ClassId));
-            //PLAN
-            pck.pack(dataPos + sizeof(fge::ObjectSid) + sizeof(fge::reg::ClassId), &data->g_plan,
-                     sizeof(fge::ObjectPlan));
-            //TYPE
-            fge::ObjectTypes tmpType = data->g_type;
-            pck.pack(dataPos + sizeof(fge::ObjectSid) + sizeof(fge::reg::ClassId) + sizeof(fge::ObjectPlan), &tmpType,
-                     sizeof(tmpType));
-
-            pck.pack(dataPos + sizeof(fge::ObjectSid) + sizeof(fge::reg::ClassId) + sizeof(fge::ObjectPlan) +
-                             sizeof(tmpType),
-                     &countModification, sizeof(countModification));
-
-            dataPos = pck.getDataSize();
-            pck.append(reservedSize);
+            return false;
+        }
 
-            ++countObject;
+        //SID
+        pck.pack(dataPos, &data.g_sid, sizeof(fge::ObjectSid));
+        //CLASS
+        fge::reg::ClassId tmpClass = fge::reg::GetClassId(data.getClassNameId());
+        pck.pack(dataPos + sizeof(fge::ObjectSid), &tmpClass, sizeof(fge::reg::ClassId));
+        //PLAN
+        pck.pack(dataPos + sizeof(fge::ObjectSid) + sizeof(fge::reg::ClassId), &data.g_plan, sizeof(fge::ObjectPlan));
+        //TYPE
+        fge::ObjectTypes tmpType = data.g_type;
+        pck.pack(dataPos + sizeof(fge::ObjectSid) + sizeof(fge::reg::ClassId) + sizeof(fge::ObjectPlan), &tmpType,
+                 sizeof(tmpType));
+
+        pck.pack(dataPos + sizeof(fge::ObjectSid) + sizeof(fge::reg::ClassId) + sizeof(fge::ObjectPlan) +
+                         sizeof(tmpType),
+                 &countModification, sizeof(countModification));
+
+        dataPos = pck.getDataSize();
+        pck.append(reservedSize);
+
+        ++countObject;
+        return true;
+    };
+
+    if (clientSync != nullptr && this->isInterestManaged(*clientSync))
+    {
+        ++clientSync->_packCount;
+
+        //Gathering the relevant Object with pending modifications
+        struct Candidate
+        {
+            fge::ObjectData const* _data;
+            PerClientSync::Interest* _interest;
+            float _priority;
+        };
+        std::vector<Candidate> candidates;
+        candidates.reserve(clientSync->_relevantObjects.size());
+
+        for (auto& relevantObject: clientSync->_relevantObjects)
+        {
+            auto const data = this->g_objectsHashMap.retrieve(relevantObject.first);
+            if (!data || !this->isInterestSubject(*data) || data->g_object->_netList.isIgnored(id))
+            {
+                continue;
+            }
+
+            auto const& netList = data->g_object->_netList;
+            bool modified = false;
+            for (std::size_t i = 0; i < netList.size() && !modified; ++i)
+            {
+                modified = netList[i]->checkClient(id);
+            }
+            if (!modified)
+            {
+                continue;
+            }
+
+            //Closest and most stale first
+            auto const staleness = clientSync->_packCount - relevantObject.second._lastPackCount;
+            float const priority = static_cast<float>(staleness) /
+                                   (1.0f + relevantObject.second._distance / this->g_interestConfig._cellSize);
+            candidates.push_back({data.get(), &relevantObject.second, priority});
+        }
+
+        std::sort(candidates.begin(), candidates.end(),
+                  [](Candidate const& a, Candidate const& b) { return a._priority > b._priority; });
+
+        std::size_t const budgetStartPos = pck.getDataSize();
+        for (auto const& candidate: candidates)
+        {
+            if (this->g_interestConfig._byteBudget != 0 && countObject > 0 &&
+                pck.getDataSize() - budgetStartPos >= this->g_interestConfig._byteBudget)
+            {
+                break; //The remaining modifications are kept for the next call
+            }
+
+            if (packObject(*candidate._data))
+            {
+                candidate._interest->_lastPackCount = clientSync->_packCount;
+            }
+        }
+    }
+    else
+    {
+        for (auto const& data: this->g_objects)
+        {
+            if (data->g_object->_netSyncMode != Object::NetSyncModes::FULL_SYNC &&
+                data->g_object->_netSyncMode != Object::NetSyncModes::DELTA_SYNC)
+            {
+                continue;
+            }
+
+            if (data->g_object->_netList.isIgnored(id))
+            {
+                continue;
+            }
+
+            packObject(*data);
         }
     }
 
@@ -1365,8 +1780,6 @@ Scene::unpackModification(fge::net::Packet const& pck, UpdateCountRange& range,
 {
     constexpr char const* const func = __func__;
 
-    using namespace fge::net::rules;
-
     //update count range
     pck >> range._last >> range._now;
     if (!pck)
@@ -1387,6 +1800,14 @@ Scene::unpackModification(fge::net::Packet const& pck, UpdateCountRange& range,
         this->g_updateCount = range._now;
     }
 
+    return this->unpackModificationBody(pck);
+}
+std::optional<fge::net::Error> Scene::unpackModificationBody(fge::net::Packet const& pck)
+{
+    constexpr char const* const func = __func__;
+
+    using namespace fge::net::rules;
+
     //scene name
     return RStringRange(0, FGE_SCENE_LIMIT_NAMESIZE, pck, &this->g_name)
             .and_then([&](auto& chain) {
@@ -1426,7 +1847,7 @@ Scene::unpackModification(fge::net::Packet const& pck, UpdateCountRange& range,
         { //Object already exist
             if (buffObject->g_contextFlags.has(OBJ_CONTEXT_NETWORK))
             {
-                if (fge::reg::GetClassId(buffObject->g_object->getClassName()) != buffClass)
+                if (fge::reg::GetClassId(buffObject->g_classNameId) != buffClass)
                 { //Class changed
                     this->delObject(buffSid);
                     buffObject = this->newObject(fge::ObjectPtr{fge::reg::GetNewClassOf(buffClass)}, buffPlan, buffSid,
@@ -1586,14 +2007,48 @@ void Scene::clientsCheckup(fge::net::ClientList const& clients, bool force)
             }
         }
     }
+
+    this->updateInterest();
 }
 
 /** SceneNetEvent **/
 
 void Scene::pushEvent(fge::SceneNetEvent const& netEvent)
 {
+    bool isSubject = true;
+    if (this->g_interestEnabled && netEvent._sid != FGE_SCENE_BAD_SID)
+    {
+        auto const data = this->g_objectsHashMap.retrieve(netEvent._sid);
+        isSubject = !data || this->isInterestSubject(*data);
+    }
+
     for (auto& clientSync: this->g_perClientSyncs)
     {
+        if (isSubject && this->isInterestManaged(clientSync.second))
+        { //Only events of relevant Object are pushed, creations are handled by updateInterest
+            auto& relevantObjects = clientSync.second._relevantObjects;
+            switch (netEvent._event)
+            {
+            case SceneNetEvent::Events::OBJECT_CREATED:
+                continue;
+            case SceneNetEvent::Events::OBJECT_DELETED:
+                if (netEvent._sid == FGE_SCENE_BAD_SID)
+                {
+                    relevantObjects.clear();
+                }
+                else if (relevantObjects.erase(netEvent._sid) == 0)
+                {
+                    continue;
+                }
+                break;
+            default:
+                if (!relevantObjects.contains(netEvent._sid))
+                {
+                    continue;
+                }
+                break;
+            }
+        }
         clientSync.second._networkEvents.push(netEvent);
     }
 }
@@ -1674,7 +2129,7 @@ void Scene::packWatchedEvent(fge::net::Packet& pck, fge::net::Identity const& id
                 //SID
                 pck << data->g_sid;
                 //CLASS
-                pck << fge::reg::GetClassId(data->g_object->getClassName());
+                pck << fge::reg::GetClassId(data->g_classNameId);
                 //PLAN
                 pck << data->g_plan;
                 //TYPE
@@ -1783,21 +2238,515 @@ std::optional<fge::net::Error> Scene::unpackWatchedEvent(fge::net::Packet const&
     }).end();
 }
 
-/** Linked renderTarget **/
-void Scene::setLinkedRenderTarget(fge::RenderTarget* target)
+/** Interest management **/
+void Scene::enableInterestManagement(fge::SceneInterestConfig const& config)
 {
-    this->g_linkedRenderTarget = target;
+    this->g_interestConfig = config;
+    this->g_interestConfig._cellSize = std::max(this->g_interestConfig._cellSize, 1.0f);
+    this->g_interestConfig._leaveDistance =
+            std::max(this->g_interestConfig._leaveDistance, this->g_interestConfig._enterDistance);
+    this->g_interestEnabled = true;
 }
-fge::RenderTarget const* Scene::getLinkedRenderTarget() const
+void Scene::disableInterestManagement()
 {
-    return this->g_linkedRenderTarget;
+    this->g_interestEnabled = false;
+    for (auto& clientSync: this->g_perClientSyncs)
+    {
+        clientSync.second._viewpoint.reset();
+        clientSync.second._relevantObjects.clear();
+    }
 }
-fge::RenderTarget* Scene::getLinkedRenderTarget()
+bool Scene::isInterestManagementEnabled() const
 {
-    return this->g_linkedRenderTarget;
+    return this->g_interestEnabled;
 }
-
-fge::View const* Scene::getRelatedView() const
+fge::SceneInterestConfig const& Scene::getInterestConfig() const
+{
+    return this->g_interestConfig;
+}
+
+bool Scene::setClientViewpoint(fge::net::Identity const& id, fge::Vector2f const& viewpoint)
+{
+    auto it = this->g_perClientSyncs.find(id);
+    if (it == this->g_perClientSyncs.end())
+    {
+        return false;
+    }
+
+    auto& clientSync = it->second;
+    if (!clientSync._viewpoint)
+    { //The client is assumed to know every synchronised Object
+        clientSync._relevantObjects.clear();
+        for (auto const& data: this->g_objects)
+        {
+            if (this->isInterestSubject(*data) && !data->g_object->_netList.isIgnored(id))
+            {
+                clientSync._relevantObjects.emplace(
+                        data->g_sid,
+                        PerClientSync::Interest{clientSync._packCount,
+                                                fge::GetDistanceBetween(viewpoint, data->g_object->getPosition())});
+            }
+        }
+    }
+    clientSync._viewpoint = viewpoint;
+    return true;
+}
+void Scene::clearClientViewpoint(fge::net::Identity const& id)
+{
+    auto it = this->g_perClientSyncs.find(id);
+    if (it != this->g_perClientSyncs.end())
+    {
+        it->second._viewpoint.reset();
+        it->second._relevantObjects.clear();
+    }
+}
+std::optional<fge::Vector2f> Scene::getClientViewpoint(fge::net::Identity const& id) const
+{
+    auto it = this->g_perClientSyncs.find(id);
+    if (it != this->g_perClientSyncs.end())
+    {
+        return it->second._viewpoint;
+    }
+    return std::nullopt;
+}
+bool Scene::isRelevantFor(fge::ObjectSid sid, fge::net::Identity const& id) const
+{
+    auto it = this->g_perClientSyncs.find(id);
+    if (it == this->g_perClientSyncs.end() || !this->isInterestManaged(it->second))
+    {
+        return true;
+    }
+    return it->second._relevantObjects.contains(sid);
+}
+
+void Scene::updateInterest()
+{
+    if (!this->g_interestEnabled)
+    {
+        return;
+    }
+
+    float const cellSize = this->g_interestConfig._cellSize;
+    float const enterDistance = this->g_interestConfig._enterDistance;
+    float const leaveDistance = this->g_interestConfig._leaveDistance;
+
+    auto const getCellKey = [](int32_t x, int32_t y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    };
+    auto const getCell = [&](float position) { return static_cast<int32_t>(std::floor(position / cellSize)); };
+
+    //Spatial grid of the synchronised Object
+    std::unordered_map<uint64_t, std::vector<fge::ObjectData const*>> grid;
+    for (auto const& data: this->g_objects)
+    {
+        if (this->isInterestSubject(*data))
+        {
+            auto const position = data->g_object->getPosition();
+            grid[getCellKey(getCell(position.x), getCell(position.y))].push_back(data.get());
+        }
+    }
+
+    for (auto& [id, clientSync]: this->g_perClientSyncs)
+    {
+        if (!this->isInterestManaged(clientSync))
+        {
+            continue;
+        }
+
+        auto const& viewpoint = *clientSync._viewpoint;
+        auto& relevantObjects = clientSync._relevantObjects;
+        std::unordered_map<fge::ObjectSid, PerClientSync::Interest> newRelevantObjects;
+        newRelevantObjects.reserve(relevantObjects.size());
+
+        auto const checkCell = [&](std::vector<fge::ObjectData const*> const& cell) {
+            for (auto const* data: cell)
+            {
+                if (data->g_object->_netList.isIgnored(id))
+                {
+                    continue;
+                }
+
+                float const distance = fge::GetDistanceBetween(viewpoint, data->g_object->getPosition());
+                auto const oldIt = relevantObjects.find(data->g_sid);
+                if (oldIt != relevantObjects.end())
+                { //Hysteresis, the Object stay relevant until the leave distance
+                    if (distance <= leaveDistance)
+                    {
+                        auto interest = oldIt->second;
+                        interest._distance = distance;
+                        newRelevantObjects.emplace(data->g_sid, interest);
+                    }
+                }
+                else if (distance <= enterDistance)
+                {
+                    newRelevantObjects.emplace(
+                            data->g_sid,
+                            PerClientSync::Interest{clientSync._packCount, distance, this->g_lastNetSnapshotId});
+                    clientSync._networkEvents.push({fge::SceneNetEvent::Events::OBJECT_CREATED, data->g_sid});
+                }
+            }
+        };
+
+        //Every Object in the leave distance is in this range of cells
+        int32_t const minX = getCell(viewpoint.x - leaveDistance);
+        int32_t const maxX = getCell(viewpoint.x + leaveDistance);
+        int32_t const minY = getCell(viewpoint.y - leaveDistance);
+        int32_t const maxY = getCell(viewpoint.y + leaveDistance);
+        auto const cellCount = static_cast<uint64_t>(maxX - minX + 1) * static_cast<uint64_t>(maxY - minY + 1);
+
+        if (cellCount <= grid.size())
+        {
+            for (int32_t x = minX; x <= maxX; ++x)
+            {
+                for (int32_t y = minY; y <= maxY; ++y)
+                {
+                    auto const cellIt = grid.find(getCellKey(x, y));
+                    if (cellIt != grid.end())
+                    {
+                        checkCell(cellIt->second);
+                    }
+                }
+            }
+        }
+        else
+        { //The range is bigger than the grid, the distance check is enough
+            for (auto const& cell: grid)
+            {
+                checkCell(cell.second);
+            }
+        }
+
+        for (auto const& relevantObject: relevantObjects)
+        {
+            if (!newRelevantObjects.contains(relevantObject.first))
+            {
+                clientSync._networkEvents.push({fge::SceneNetEvent::Events::OBJECT_DELETED, relevantObject.first});
+            }
+        }
+        relevantObjects.swap(newRelevantObjects);
+    }
+}
+
+bool Scene::isInterestSubject(fge::ObjectData const& data) const
+{
+    return data.g_type != fge::ObjectTypes::GUI && (data.g_object->_netSyncMode == Object::NetSyncModes::FULL_SYNC ||
+                                                    data.g_object->_netSyncMode == Object::NetSyncModes::DELTA_SYNC);
+}
+bool Scene::isInterestManaged(PerClientSync const& clientSync) const
+{
+    return this->g_interestEnabled && clientSync._viewpoint.has_value();
+}
+
+/** Network snapshot **/
+Scene::NetSnapshotId Scene::captureNetSnapshot()
+{
+    static_assert(FGE_SCENE_NET_SNAPSHOT_RING_SIZE >= 2, "the ring must keep at least the previous snapshot");
+
+    if (this->g_netSnapshots.empty())
+    {
+        this->g_netSnapshots.resize(FGE_SCENE_NET_SNAPSHOT_RING_SIZE);
+    }
+
+    NetSnapshot const* previous = this->getNetSnapshot(this->g_lastNetSnapshotId);
+
+    if (++this->g_lastNetSnapshotId == 0)
+    { //0 is reserved
+        ++this->g_lastNetSnapshotId;
+    }
+    auto const snapshotId = this->g_lastNetSnapshotId;
+
+    //The slot is reused in order to keep the allocated memory
+    auto& snapshot = this->g_netSnapshots[snapshotId % FGE_SCENE_NET_SNAPSHOT_RING_SIZE];
+    snapshot._id = snapshotId;
+    snapshot._timestamp = fge::net::Client::getFullTimestamp_ms();
+    snapshot._data.clear();
+    snapshot._fields.clear();
+    snapshot._objects.clear();
+    snapshot._objectIndices.clear();
+
+    //Serialize every value and compare it with the same value of the previous snapshot
+    auto const captureFields = [&](fge::net::NetworkTypeHandler& netList, std::size_t previousFirstField,
+                                   std::size_t previousFieldCount) {
+        bool const hasPrevious = previous != nullptr && previousFieldCount == netList.size();
+
+        for (std::size_t i = 0; i < netList.size(); ++i)
+        {
+            auto* netType = netList[i];
+            auto const revision = netType->getModificationRevision();
+            bool const unmodified = !netType->check();
+            auto const offset = snapshot._data.getDataSize();
+
+            if (hasPrevious)
+            {
+                auto const& previousField = previous->_fields[previousFirstField + i];
+                if (unmodified && previousField._unmodified && previousField._revision == revision)
+                { //The value is the same as in the previous snapshot, its data is reused
+                    snapshot._data.append(previous->_data.getData(previousField._offset), previousField._size);
+                    snapshot._fields.push_back(
+                            {offset, previousField._size, previousField._lastChange, revision, true});
+                    continue;
+                }
+            }
+
+            netType->packData(snapshot._data);
+            auto const size = snapshot._data.getDataSize() - offset;
+
+            NetSnapshotId lastChange = snapshotId;
+            if (hasPrevious)
+            {
+                auto const& previousField = previous->_fields[previousFirstField + i];
+                if (previousField._size == size &&
+                    std::memcmp(previous->_data.getData(previousField._offset), snapshot._data.getData(offset),
+                                size) == 0)
+                {
+                    lastChange = previousField._lastChange;
+                }
+            }
+
+            snapshot._fields.push_back({offset, size, lastChange, revision, unmodified});
+        }
+    };
+
+    //scene data
+    captureFields(this->_netList, 0, previous != nullptr ? previous->_sceneFieldCount : 0);
+    snapshot._sceneFieldCount = snapshot._fields.size();
+
+    //object data
+    for (auto const& data: this->g_objects)
+    {
+        if (data->g_object->_netSyncMode != Object::NetSyncModes::FULL_SYNC &&
+            data->g_object->_netSyncMode != Object::NetSyncModes::DELTA_SYNC)
+        {
+            continue;
+        }
+
+        NetSnapshot::ObjectEntry entry{};
+        entry._sid = data->g_sid;
+        entry._class = fge::reg::GetClassId(data->g_classNameId);
+        entry._plan = data->g_plan;
+        entry._type = data->g_type;
+        entry._firstField = snapshot._fields.size();
+        entry._fieldCount = data->g_object->_netList.size();
+
+        //A new Object or an Object with another class have every value changed
+        NetSnapshot::ObjectEntry const* previousEntry = nullptr;
+        if (previous != nullptr)
+        {
+            auto const it = previous->_objectIndices.find(entry._sid);
+            if (it != previous->_objectIndices.end() && previous->_objects[it->second]._class == entry._class)
+            {
+                previousEntry = &previous->_objects[it->second];
+            }
+        }
+
+        captureFields(data->g_object->_netList, previousEntry != nullptr ? previousEntry->_firstField : 0,
+                      previousEntry != nullptr ? previousEntry->_fieldCount : 0);
+
+        snapshot._objectIndices.emplace(entry._sid, snapshot._objects.size());
+        snapshot._objects.push_back(entry);
+    }
+
+    return snapshotId;
+}
+Scene::NetSnapshotId Scene::getLastNetSnapshotId() const
+{
+    return this->g_lastNetSnapshotId;
+}
+bool Scene::acknowledgeNetSnapshot(fge::net::Identity const& id, NetSnapshotId snapshotId)
+{
+    auto it = this->g_perClientSyncs.find(id);
+    if (it == this->g_perClientSyncs.end())
+    {
+        return false;
+    }
+
+    auto& acknowledgedSnapshot = it->second._acknowledgedSnapshot;
+    if (snapshotId <= acknowledgedSnapshot || snapshotId > this->g_lastNetSnapshotId)
+    {
+        return false;
+    }
+    acknowledgedSnapshot = snapshotId;
+    return true;
+}
+Scene::NetSnapshotId Scene::getAcknowledgedNetSnapshot(fge::net::Identity const& id) const
+{
+    auto it = this->g_perClientSyncs.find(id);
+    return it != this->g_perClientSyncs.end() ? it->second._acknowledgedSnapshot : 0;
+}
+void Scene::packNetSnapshotDelta(fge::net::Packet& pck, fge::net::Identity const& id)
+{
+    if (this->g_lastNetSnapshotId == 0)
+    {
+        this->captureNetSnapshot();
+    }
+    auto const& snapshot = *this->getNetSnapshot(this->g_lastNetSnapshotId);
+
+    auto it = this->g_perClientSyncs.find(id);
+    PerClientSync const* clientSync = it != this->g_perClientSyncs.end() ? &it->second : nullptr;
+
+    //A baseline that is no longer in the ring is the same as no baseline, every value is packed
+    NetSnapshotId baselineId = clientSync != nullptr ? clientSync->_acknowledgedSnapshot : 0;
+    if (this->getNetSnapshot(baselineId) == nullptr)
+    {
+        baselineId = 0;
+    }
+
+    //snapshot range
+    pck << snapshot._id << baselineId << snapshot._timestamp;
+
+    //Every value that changed after the baseline is packed, this include the values that changed and then came back
+    //to their baseline value, as the client can have received a more recent snapshot than its acknowledged one.
+    auto const packFields = [&](std::size_t firstField, std::size_t fieldCount, bool full) {
+        fge::net::SizeType countModification = 0;
+
+        std::size_t const rewritePos = pck.getDataSize();
+        pck.pack(&countModification, sizeof(countModification)); //Will be rewritten
+
+        for (std::size_t i = 0; i < fieldCount; ++i)
+        {
+            auto const& field = snapshot._fields[firstField + i];
+            if (full || field._lastChange > baselineId)
+            {
+                pck << static_cast<fge::net::SizeType>(i);
+                pck.append(snapshot._data.getData(field._offset), field._size);
+
+                ++countModification;
+            }
+        }
+        pck.pack(rewritePos, &countModification, sizeof(countModification)); //Rewriting size
+        return countModification;
+    };
+
+    //scene name
+    pck << this->g_name;
+
+    //scene data
+    if (this->_netList.isIgnored(id))
+    {
+        pck << fge::net::SizeType{0};
+    }
+    else
+    {
+        packFields(0, snapshot._sceneFieldCount, baselineId == 0);
+    }
+
+    //object data
+    fge::net::SizeType countObject = 0;
+
+    std::size_t const countObjectPos = pck.getDataSize();
+    pck.pack(&countObject, sizeof(countObject)); //Will be rewritten
+
+    bool const interestManaged = clientSync != nullptr && this->isInterestManaged(*clientSync);
+    for (auto const& entry: snapshot._objects)
+    {
+        bool full = baselineId == 0;
+        if (interestManaged)
+        {
+            auto const interestIt = clientSync->_relevantObjects.find(entry._sid);
+            if (interestIt == clientSync->_relevantObjects.end())
+            {
+                continue;
+            }
+            //The Object became relevant after the baseline, the client can have an outdated version of it
+            full = full || baselineId <= interestIt->second._enterSnapshot;
+        }
+
+        //Deleted Object are handled by SceneNetEvent
+        auto const data = this->g_objectsHashMap.retrieve(entry._sid);
+        if (!data || data->g_object->_netList.isIgnored(id))
+        {
+            continue;
+        }
+
+        std::size_t const entryPos = pck.getDataSize();
+        //SID
+        pck << entry._sid;
+        //CLASS
+        pck << entry._class;
+        //PLAN
+        pck << entry._plan;
+        //TYPE
+        pck << entry._type;
+
+        //MODIF COUNT/OBJECT DATA
+        if (packFields(entry._firstField, entry._fieldCount, full) == 0)
+        {
+            pck.shrink(pck.getDataSize() - entryPos);
+            continue;
+        }
+
+        ++countObject;
+    }
+
+    pck.pack(countObjectPos, &countObject, sizeof(countObject)); //Rewriting size
+}
+std::optional<fge::net::Error> Scene::unpackNetSnapshotDelta(fge::net::Packet const& pck)
+{
+    constexpr char const* const func = __func__;
+
+    //snapshot range
+    NetSnapshotId snapshotId{0};
+    NetSnapshotId baselineId{0};
+    uint64_t timestamp{0};
+    pck >> snapshotId >> baselineId >> timestamp;
+    if (!pck)
+    {
+        return net::Error{net::Error::Types::ERR_EXTRACT, pck.getReadPos(), "received bad snapshot range", func};
+    }
+
+    if (snapshotId <= this->g_lastReceivedNetSnapshotId)
+    {
+        return net::Error{net::Error::Types::ERR_SCENE_OLD_PACKET, pck.getReadPos(),
+                          "old network snapshot for this scene", func};
+    }
+    if (baselineId > this->g_lastReceivedNetSnapshotId)
+    {
+        return net::Error{net::Error::Types::ERR_DATA, pck.getReadPos(), "unknown network snapshot baseline", func};
+    }
+
+    auto err = this->unpackModificationBody(pck);
+    if (!err)
+    {
+        this->g_lastReceivedNetSnapshotId = snapshotId;
+        this->g_lastReceivedNetSnapshotTimestamp = timestamp;
+    }
+    return err;
+}
+Scene::NetSnapshotId Scene::getLastReceivedNetSnapshotId() const
+{
+    return this->g_lastReceivedNetSnapshotId;
+}
+uint64_t Scene::getLastReceivedNetSnapshotTimestamp() const
+{
+    return this->g_lastReceivedNetSnapshotTimestamp;
+}
+
+Scene::NetSnapshot const* Scene::getNetSnapshot(NetSnapshotId snapshotId) const
+{
+    if (snapshotId == 0 || this->g_netSnapshots.empty())
+    {
+        return nullptr;
+    }
+
+    auto const& snapshot = this->g_netSnapshots[snapshotId % FGE_SCENE_NET_SNAPSHOT_RING_SIZE];
+    return snapshot._id == snapshotId ? &snapshot : nullptr;
+}
+
+/** Linked renderTarget **/
+void Scene::setLinkedRenderTarget(fge::RenderTarget* target)
+{
+    this->g_linkedRenderTarget = target;
+}
+fge::RenderTarget const* Scene::getLinkedRenderTarget() const
+{
+    return this->g_linkedRenderTarget;
+}
+fge::RenderTarget* Scene::getLinkedRenderTarget()
+{
+    return this->g_linkedRenderTarget;
+}
+
+fge::View const* Scene::getRelatedView() const
 {
     if (auto ownView = this->getOwnView())
     {
@@ -1819,6 +2768,46 @@ fge::CallbackContext Scene::getCallbackContext() const
     return this->g_callbackContext;
 }
 
+void Scene::setLoadThreadCount(std::size_t count)
+{
+    if (count != this->g_loadThreadCount)
+    { //Created again on the next parallel load
+        this->g_loadWorkerPool.reset();
+    }
+    this->g_loadThreadCount = count;
+}
+std::size_t Scene::getLoadThreadCount() const
+{
+    return this->g_loadThreadCount;
+}
+void Scene::setPackObjectSizes(bool enable)
+{
+    this->g_packObjectSizes = enable;
+}
+bool Scene::isPackingObjectSizes() const
+{
+    return this->g_packObjectSizes;
+}
+Scene::LoadWorkerPool& Scene::getLoadWorkerPool()
+{
+    //The calling thread also takes part in the work
+    auto const workerCount = this->g_loadThreadCount > 1 ? this->g_loadThreadCount - 1 : 0;
+    if (!this->g_loadWorkerPool || this->g_loadWorkerPool->getWorkerCount() != workerCount)
+    {
+        this->g_loadWorkerPool = std::make_unique<LoadWorkerPool>(workerCount);
+    }
+    return *this->g_loadWorkerPool;
+}
+
+void Scene::setRandomSeed(uint64_t seed)
+{
+    this->g_random.setSeed(seed);
+}
+fge::LocalRandom& Scene::getRandom() const
+{
+    return this->g_random;
+}
+
 /** Save/Load in file **/
 
 void Scene::save(nlohmann::json& jsonObject)
@@ -1852,6 +2841,17 @@ bool Scene::load(nlohmann::json& jsonObject, std::filesystem::path const& filePa
     this->loadCustomData(jsonObject["SceneData"]);
 
     nlohmann::json& jsonObjArray = jsonObject["Objects"];
+
+    //Objects are always created and inserted serially, only their deserialization can be done in parallel
+    bool const parallel =
+            this->g_loadThreadCount > 1 && jsonObjArray.size() >= FGE_SCENE_PARALLEL_LOAD_MIN_OBJECTS;
+    std::vector<std::pair<fge::Object*, nlohmann::json*>> loadList;
+    if (parallel)
+    {
+        loadList.reserve(jsonObjArray.size());
+    }
+
+    bool success = true;
     for (auto& it: jsonObjArray)
     {
         fge::ObjectPtr buffObj{fge::reg::GetNewClassOf(it.begin().key())};
@@ -1862,16 +2862,33 @@ bool Scene::load(nlohmann::json& jsonObject, std::filesystem::path const& filePa
 
             auto const sid = ignoreSid ? FGE_SCENE_BAD_SID : objJson["_sid"].get<fge::ObjectSid>();
 
-            this->newObject(std::move(buffObj), objJson["_plan"].get<fge::ObjectPlan>(), sid,
-                            objJson["_type"].get<fge::ObjectTypes>())
-                    ->g_object->load(objJson, filePath);
+            auto* object = this->newObject(std::move(buffObj), objJson["_plan"].get<fge::ObjectPlan>(), sid,
+                                           objJson["_type"].get<fge::ObjectTypes>())
+                                   ->g_object.get();
+            if (parallel)
+            {
+                loadList.emplace_back(object, &objJson);
+            }
+            else
+            {
+                object->load(objJson, filePath);
+            }
         }
         else
         {
-            return false;
+            //Objects inserted before an unknown class are still loaded, like with the serial load
+            success = false;
+            break;
         }
     }
-    return true;
+
+    if (parallel)
+    {
+        this->getLoadWorkerPool().parallelFor(loadList.size(), [&](std::size_t index) {
+            loadList[index].first->load(*loadList[index].second, filePath);
+        });
+    }
+    return success;
 }
 bool Scene::saveInFile(std::filesystem::path const& path, int fieldWidth)
 {
@@ -1888,6 +2905,15 @@ bool Scene::loadFromFile(std::filesystem::path const& path, bool ignoreSid)
     }
     return this->load(inputJson, path, ignoreSid);
 }
+bool Scene::saveSnapshotInFile(std::filesystem::path const& path, bool compress)
+{
+    return SaveSceneSnapshot(*this, path,
+                             compress ? SceneSnapshotCompressions::LZ4 : SceneSnapshotCompressions::NONE);
+}
+bool Scene::loadSnapshotFromFile(std::filesystem::path const& path, bool ignoreSid)
+{
+    return LoadSceneSnapshot(*this, path, ignoreSid);
+}
 
 /** Iterator **/
 fge::ObjectContainer::const_iterator Scene::find(fge::ObjectSid sid) const
@@ -1975,4 +3001,45 @@ fge::ObjectContainer::iterator Scene::hash_getInsertionIteratorFromPlanDataMap(f
     return this->g_objects.end();
 }
 
+void Scene::index_addObject(fge::ObjectDataShared const& data)
+{
+    data->g_indexed = true;
+
+    this->g_classIndex[data->g_classNameId].push_back(data);
+    for (auto const tag: data->g_object->_tags)
+    {
+        this->g_tagIndex[tag].push_back(data);
+    }
+}
+void Scene::index_delObject(fge::ObjectDataShared const& data)
+{
+    if (!data->g_indexed)
+    {
+        return;
+    }
+    data->g_indexed = false;
+
+    EraseFromIndex(this->g_classIndex, data->g_classNameId, data.get());
+    for (auto const tag: data->g_object->_tags)
+    {
+        EraseFromIndex(this->g_tagIndex, tag, data.get());
+    }
+}
+void Scene::index_updateTag(fge::ObjectDataShared const& data, fge::StringId tag, bool added)
+{
+    if (!data->g_indexed || data->g_boundScene != this)
+    { //Child objects are bound to the Scene but not indexed
+        return;
+    }
+
+    if (added)
+    {
+        this->g_tagIndex[tag].push_back(data);
+    }
+    else
+    {
+        EraseFromIndex(this->g_tagIndex, tag, data.get());
+    }
+}
+
 } // namespace fge
@@ -0,0 +1,540 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/C_sceneSnapshot.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+#include "private/fge_debug.hpp"
+#include "lz4.h"
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif //_WIN32
+
+namespace fge
+{
+
+namespace
+{
+
+constexpr std::array<char, 4> gSnapshotMagic = FGE_SCENE_SNAPSHOT_MAGIC;
+
+/**
+ * \brief A read-only memory mapped file
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(MappedFile const& r) = delete;
+    MappedFile(MappedFile&& r) noexcept = delete;
+    ~MappedFile() { this->close(); }
+
+    MappedFile& operator=(MappedFile const& r) = delete;
+    MappedFile& operator=(MappedFile&& r) noexcept = delete;
+
+    [[nodiscard]] bool open(std::filesystem::path const& path)
+    {
+        this->close();
+
+#ifdef _WIN32
+        this->g_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                   FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (this->g_file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(this->g_file, &fileSize) == 0 || fileSize.QuadPart == 0)
+        {
+            this->close();
+            return false;
+        }
+        this->g_size = static_cast<std::size_t>(fileSize.QuadPart);
+
+        this->g_mapping = CreateFileMappingW(this->g_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (this->g_mapping == nullptr)
+        {
+            this->close();
+            return false;
+        }
+
+        this->g_data = static_cast<uint8_t const*>(MapViewOfFile(this->g_mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+        this->g_file = ::open(path.c_str(), O_RDONLY);
+        if (this->g_file < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStat{};
+        if (fstat(this->g_file, &fileStat) != 0 || fileStat.st_size == 0)
+        {
+            this->close();
+            return false;
+        }
+        this->g_size = static_cast<std::size_t>(fileStat.st_size);
+
+        void* data = mmap(nullptr, this->g_size, PROT_READ, MAP_PRIVATE, this->g_file, 0);
+        this->g_data = data == MAP_FAILED ? nullptr : static_cast<uint8_t const*>(data);
+#endif //_WIN32
+
+        if (this->g_data == nullptr)
+        {
+            this->close();
+            return false;
+        }
+        return true;
+    }
+    void close()
+    {
+#ifdef _WIN32
+        if (this->g_data != nullptr)
+        {
+            UnmapViewOfFile(this->g_data);
+        }
+        if (this->g_mapping != nullptr)
+        {
+            CloseHandle(this->g_mapping);
+            this->g_mapping = nullptr;
+        }
+        if (this->g_file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(this->g_file);
+            this->g_file = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (this->g_data != nullptr)
+        {
+            munmap(const_cast<uint8_t*>(this->g_data), this->g_size);
+        }
+        if (this->g_file >= 0)
+        {
+            ::close(this->g_file);
+            this->g_file = -1;
+        }
+#endif //_WIN32
+        this->g_data = nullptr;
+        this->g_size = 0;
+    }
+
+    [[nodiscard]] uint8_t const* getData() const { return this->g_data; }
+    [[nodiscard]] std::size_t getSize() const { return this->g_size; }
+
+private:
+#ifdef _WIN32
+    HANDLE g_file{INVALID_HANDLE_VALUE};
+    HANDLE g_mapping{nullptr};
+#else
+    int g_file{-1};
+#endif //_WIN32
+    uint8_t const* g_data{nullptr};
+    std::size_t g_size{0};
+};
+
+[[nodiscard]] std::size_t AlignSectionOffset(std::size_t offset)
+{
+    return (offset + FGE_SCENE_SNAPSHOT_SECTION_ALIGNMENT - 1) & ~std::size_t{FGE_SCENE_SNAPSHOT_SECTION_ALIGNMENT - 1};
+}
+
+[[nodiscard]] SceneSnapshotString AddString(std::string& pool, std::string_view str)
+{
+    SceneSnapshotString const result{static_cast<uint32_t>(pool.size()), static_cast<uint32_t>(str.size())};
+    pool.append(str);
+    return result;
+}
+
+[[nodiscard]] bool WriteSection(std::ofstream& file,
+                                SceneSnapshotSection& section,
+                                std::span<uint8_t const> rawData,
+                                SceneSnapshotCompressions compression)
+{
+    std::vector<uint8_t> compressedData;
+    std::span<uint8_t const> data = rawData;
+    section._compression = SceneSnapshotCompressions::NONE;
+
+    if (compression == SceneSnapshotCompressions::LZ4 && !rawData.empty() && rawData.size() <= LZ4_MAX_INPUT_SIZE)
+    {
+        compressedData.resize(static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(rawData.size()))));
+        auto const compressedSize = LZ4_compress_default(
+                reinterpret_cast<char const*>(rawData.data()), reinterpret_cast<char*>(compressedData.data()),
+                static_cast<int>(rawData.size()), static_cast<int>(compressedData.size()));
+
+        if (compressedSize > 0 && static_cast<std::size_t>(compressedSize) < rawData.size())
+        { //Only keep the compressed data if it's worth it
+            data = {compressedData.data(), static_cast<std::size_t>(compressedSize)};
+            section._compression = SceneSnapshotCompressions::LZ4;
+        }
+    }
+
+    auto const position = static_cast<std::size_t>(file.tellp());
+    auto const alignedPosition = AlignSectionOffset(position);
+    constexpr std::array<char, FGE_SCENE_SNAPSHOT_SECTION_ALIGNMENT> padding{};
+    file.write(padding.data(), static_cast<std::streamsize>(alignedPosition - position));
+
+    section._offset = alignedPosition;
+    section._size = data.size();
+    section._rawSize = rawData.size();
+
+    file.write(reinterpret_cast<char const*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return file.good();
+}
+
+/**
+ * \brief Retrieve the data of a section
+ *
+ * Uncompressed sections are directly referenced from the mapped file,
+ * compressed ones are decompressed into the provided buffer.
+ */
+[[nodiscard]] bool ReadSection(MappedFile const& file,
+                               SceneSnapshotSection const& section,
+                               std::vector<uint8_t>& buffer,
+                               std::span<uint8_t const>& output)
+{
+    if (section._offset > file.getSize() || section._size > file.getSize() - section._offset)
+    {
+        return false;
+    }
+    auto const* data = file.getData() + section._offset;
+
+    switch (section._compression)
+    {
+    case SceneSnapshotCompressions::NONE:
+        if (section._size != section._rawSize)
+        {
+            return false;
+        }
+        output = {data, static_cast<std::size_t>(section._size)};
+        return true;
+    case SceneSnapshotCompressions::LZ4:
+    {
+        if (section._rawSize > LZ4_MAX_INPUT_SIZE || section._size > LZ4_MAX_INPUT_SIZE)
+        {
+            return false;
+        }
+        buffer.resize(static_cast<std::size_t>(section._rawSize));
+        auto const size =
+                LZ4_decompress_safe(reinterpret_cast<char const*>(data), reinterpret_cast<char*>(buffer.data()),
+                                    static_cast<int>(section._size), static_cast<int>(buffer.size()));
+        if (size < 0 || static_cast<uint64_t>(size) != section._rawSize)
+        {
+            return false;
+        }
+        output = buffer;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+template<class T>
+[[nodiscard]] std::span<T const> CastSection(std::span<uint8_t const> data, std::size_t count)
+{
+    if (data.size() != count * sizeof(T) || reinterpret_cast<std::uintptr_t>(data.data()) % alignof(T) != 0)
+    {
+        return {};
+    }
+    return {reinterpret_cast<T const*>(data.data()), count};
+}
+
+[[nodiscard]] std::optional<std::string_view> GetString(std::span<uint8_t const> pool, SceneSnapshotString const& str)
+{
+    if (str._offset > pool.size() || str._size > pool.size() - str._offset)
+    {
+        return std::nullopt;
+    }
+    return std::string_view{reinterpret_cast<char const*>(pool.data()) + str._offset, str._size};
+}
+
+/**
+ * \brief The sections of an opened snapshot file
+ *
+ * Uncompressed sections directly reference the mapped file, compressed ones reference the buffers.
+ */
+struct SnapshotSections
+{
+    std::string_view _name;
+    std::vector<std::string_view> _classNames;
+    std::span<SceneSnapshotObject const> _objects;
+    std::span<uint8_t const> _objectData;
+    std::span<uint8_t const> _sceneData;
+
+    std::vector<uint8_t> _stringPoolBuffer;
+    std::vector<uint8_t> _classTableBuffer;
+    std::vector<uint8_t> _objectTableBuffer;
+    std::vector<uint8_t> _objectDataBuffer;
+    std::vector<uint8_t> _sceneDataBuffer;
+};
+
+[[nodiscard]] bool ReadSnapshotSections(MappedFile const& file, SnapshotSections& sections)
+{
+    if (file.getSize() < sizeof(SceneSnapshotHeader))
+    {
+        return false;
+    }
+
+    SceneSnapshotHeader header{};
+    std::memcpy(&header, file.getData(), sizeof(header));
+    if (header._magic != gSnapshotMagic || header._endianCheck != FGE_SCENE_SNAPSHOT_ENDIAN_CHECK ||
+        header._version != FGE_SCENE_SNAPSHOT_VERSION)
+    {
+        FGE_DEBUG_PRINT("SceneSnapshot: bad header, wrong version or byte order");
+        return false;
+    }
+
+    auto const getSection = [&](SceneSnapshotSections section) -> SceneSnapshotSection const& {
+        return header._sections[static_cast<std::size_t>(section)];
+    };
+
+    std::span<uint8_t const> stringPool;
+    std::span<uint8_t const> classTableData;
+    std::span<uint8_t const> objectTableData;
+
+    if (!ReadSection(file, getSection(SceneSnapshotSections::STRING_POOL), sections._stringPoolBuffer, stringPool) ||
+        !ReadSection(file, getSection(SceneSnapshotSections::CLASS_TABLE), sections._classTableBuffer,
+                     classTableData) ||
+        !ReadSection(file, getSection(SceneSnapshotSections::OBJECT_TABLE), sections._objectTableBuffer,
+                     objectTableData) ||
+        !ReadSection(file, getSection(SceneSnapshotSections::OBJECT_DATA), sections._objectDataBuffer,
+                     sections._objectData) ||
+        !ReadSection(file, getSection(SceneSnapshotSections::SCENE_DATA), sections._sceneDataBuffer,
+                     sections._sceneData))
+    {
+        FGE_DEBUG_PRINT("SceneSnapshot: corrupted section");
+        return false;
+    }
+
+    auto const classTable = CastSection<SceneSnapshotClass>(classTableData, header._classCount);
+    sections._objects = CastSection<SceneSnapshotObject>(objectTableData, header._objectCount);
+    if (classTable.size() != header._classCount || sections._objects.size() != header._objectCount)
+    {
+        return false;
+    }
+
+    sections._classNames.resize(classTable.size());
+    for (std::size_t i = 0; i < classTable.size(); ++i)
+    {
+        auto const className = GetString(stringPool, classTable[i]._name);
+        if (!className)
+        {
+            return false;
+        }
+        sections._classNames[i] = className.value();
+    }
+
+    auto const sceneName = GetString(stringPool, header._name);
+    if (!sceneName)
+    {
+        return false;
+    }
+    sections._name = sceneName.value();
+    return true;
+}
+
+/**
+ * \brief Create the objects of a snapshot in a Scene
+ */
+[[nodiscard]] bool LoadSnapshotObjects(Scene& scene,
+                                       std::string_view name,
+                                       std::span<std::string_view const> classNames,
+                                       std::span<SceneSnapshotObject const> objects,
+                                       net::Packet const& objectData,
+                                       net::Packet const& sceneData,
+                                       bool ignoreSid)
+{
+    //Resolving every class only once
+    std::vector<reg::ClassId> classIds(classNames.size());
+    for (std::size_t i = 0; i < classNames.size(); ++i)
+    {
+        classIds[i] = reg::GetClassId(classNames[i]);
+        if (classIds[i] == FGE_REG_BADCLASSID)
+        {
+            FGE_DEBUG_PRINT("SceneSnapshot: unknown class {}", classNames[i]);
+            return false;
+        }
+    }
+
+    scene.clear();
+    scene.setName(std::string{name});
+
+    scene.unpackCustomData(sceneData);
+
+    for (auto const& objectEntry: objects)
+    {
+        if (objectEntry._classIndex >= classIds.size() || objectEntry._type >= ObjectTypes::_MAX_ ||
+            objectEntry._dataOffset > objectData.getDataSize() ||
+            objectEntry._dataSize > objectData.getDataSize() - objectEntry._dataOffset)
+        {
+            return false;
+        }
+
+        ObjectPtr object{reg::GetNewClassOf(classIds[objectEntry._classIndex])};
+        auto const sid = ignoreSid ? FGE_SCENE_BAD_SID : objectEntry._sid;
+        auto objectDataShared = scene.newObject(std::move(object), objectEntry._plan, sid, objectEntry._type);
+        if (!objectDataShared)
+        {
+            return false;
+        }
+
+        objectData.setReadPos(static_cast<std::size_t>(objectEntry._dataOffset));
+        objectDataShared->getObject()->unpack(objectData);
+        if (!objectData.isValid() || objectData.getReadPos() > objectEntry._dataOffset + objectEntry._dataSize)
+        {
+            FGE_DEBUG_PRINT("SceneSnapshot: bad object data for class {}",
+                            objectDataShared->getObject()->getClassName());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool SaveSceneSnapshot(Scene& scene, std::filesystem::path const& path, SceneSnapshotCompressions compression)
+{
+    SceneSnapshotHeader header{};
+    header._magic = gSnapshotMagic;
+    header._endianCheck = FGE_SCENE_SNAPSHOT_ENDIAN_CHECK;
+    header._version = FGE_SCENE_SNAPSHOT_VERSION;
+
+    std::string stringPool;
+    std::vector<SceneSnapshotClass> classTable;
+    std::unordered_map<std::string_view, uint32_t> classIndexes;
+    std::vector<SceneSnapshotObject> objectTable;
+    objectTable.reserve(scene.getObjectSize());
+
+    header._name = AddString(stringPool, scene.getName());
+
+    net::Packet objectData;
+    for (auto const& data: scene)
+    {
+        auto* object = data->getObject();
+        std::string_view const className = object->getClassName();
+
+        auto itClass = classIndexes.find(className);
+        if (itClass == classIndexes.end())
+        {
+            itClass = classIndexes.emplace(className, static_cast<uint32_t>(classTable.size())).first;
+            classTable.push_back({AddString(stringPool, className)});
+        }
+
+        auto& objectEntry = objectTable.emplace_back();
+        objectEntry._sid = data->getSid();
+        objectEntry._classIndex = itClass->second;
+        objectEntry._plan = data->getPlan();
+        objectEntry._type = data->getType();
+        objectEntry._dataOffset = objectData.getDataSize();
+
+        object->pack(objectData);
+
+        objectEntry._dataSize = static_cast<uint32_t>(objectData.getDataSize() - objectEntry._dataOffset);
+    }
+
+    net::Packet sceneData;
+    scene.packCustomData(sceneData);
+
+    header._objectCount = static_cast<uint32_t>(objectTable.size());
+    header._classCount = static_cast<uint32_t>(classTable.size());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    //The header is written again at the end with the sections information
+    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+    auto& sections = header._sections;
+    bool valid = true;
+    valid &= WriteSection(file, sections[static_cast<std::size_t>(SceneSnapshotSections::STRING_POOL)],
+                          {reinterpret_cast<uint8_t const*>(stringPool.data()), stringPool.size()}, compression);
+    valid &= WriteSection(file, sections[static_cast<std::size_t>(SceneSnapshotSections::CLASS_TABLE)],
+                          {reinterpret_cast<uint8_t const*>(classTable.data()),
+                           classTable.size() * sizeof(SceneSnapshotClass)},
+                          compression);
+    valid &= WriteSection(file, sections[static_cast<std::size_t>(SceneSnapshotSections::OBJECT_TABLE)],
+                          {reinterpret_cast<uint8_t const*>(objectTable.data()),
+                           objectTable.size() * sizeof(SceneSnapshotObject)},
+                          compression);
+    valid &= WriteSection(file, sections[static_cast<std::size_t>(SceneSnapshotSections::OBJECT_DATA)],
+                          {objectData.getData(), objectData.getDataSize()}, compression);
+    valid &= WriteSection(file, sections[static_cast<std::size_t>(SceneSnapshotSections::SCENE_DATA)],
+                          {sceneData.getData(), sceneData.getDataSize()}, compression);
+    if (!valid)
+    {
+        return false;
+    }
+
+    file.seekp(0);
+    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    return file.good();
+}
+
+bool ReadSceneSnapshot(std::filesystem::path const& path, SceneSnapshotData& data)
+{
+    MappedFile file;
+    SnapshotSections sections;
+    if (!file.open(path) || !ReadSnapshotSections(file, sections))
+    {
+        return false;
+    }
+
+    data._name = sections._name;
+    data._classNames.assign(sections._classNames.begin(), sections._classNames.end());
+    data._objects.assign(sections._objects.begin(), sections._objects.end());
+    data._objectData.clear();
+    data._objectData.append(sections._objectData.data(), sections._objectData.size());
+    data._sceneData.clear();
+    data._sceneData.append(sections._sceneData.data(), sections._sceneData.size());
+    return true;
+}
+
+bool LoadSceneSnapshot(Scene& scene, SceneSnapshotData const& data, bool ignoreSid)
+{
+    std::vector<std::string_view> const classNames(data._classNames.begin(), data._classNames.end());
+    return LoadSnapshotObjects(scene, data._name, classNames, data._objects, data._objectData, data._sceneData,
+                               ignoreSid);
+}
+bool LoadSceneSnapshot(Scene& scene, std::filesystem::path const& path, bool ignoreSid)
+{
+    MappedFile file;
+    SnapshotSections sections;
+    if (!file.open(path) || !ReadSnapshotSections(file, sections))
+    {
+        return false;
+    }
+
+    //Unpack directly from the mapped file (or the decompressed buffers) without copying the data
+    return LoadSnapshotObjects(scene, sections._name, sections._classNames, sections._objects,
+                               net::Packet::View(sections._objectData), net::Packet::View(sections._sceneData),
+                               ignoreSid);
+}
+
+} // namespace fge
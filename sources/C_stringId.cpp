@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/C_stringId.hpp"
+#include "FastEngine/fge_except.hpp"
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace fge
+{
+
+namespace
+{
+
+[[noreturn]] void ThrowCollision(std::string_view interned, std::string_view str)
+{
+    throw fge::Exception{"StringId collision between \"" + std::string{interned} + "\" and \"" + std::string{str} +
+                         "\""};
+}
+
+struct StringTable
+{
+    std::shared_mutex _mutex;
+    std::unordered_map<fge::StringId::Value, std::string> _strings;
+};
+
+StringTable& GetStringTable()
+{
+    //Never destroyed, as interned strings can be used during the static destruction
+    static auto* table = new StringTable();
+    return *table;
+}
+
+} // namespace
+
+std::string_view StringId::getString() const
+{
+    auto& table = GetStringTable();
+    std::shared_lock const lock(table._mutex);
+
+    auto it = table._strings.find(this->g_value);
+    return it != table._strings.end() ? std::string_view{it->second} : std::string_view{};
+}
+
+fge::StringId InternString(std::string_view str)
+{
+    fge::StringId const id{str};
+    auto& table = GetStringTable();
+
+    {
+        std::shared_lock const lock(table._mutex);
+        auto it = table._strings.find(id.getValue());
+        if (it != table._strings.end())
+        {
+            if (it->second != str)
+            {
+                ThrowCollision(it->second, str);
+            }
+            return id;
+        }
+    }
+
+    std::scoped_lock const lock(table._mutex);
+    auto const [it, inserted] = table._strings.try_emplace(id.getValue(), str);
+    if (!inserted && it->second != str)
+    {
+        ThrowCollision(it->second, str);
+    }
+    return id;
+}
+
+std::size_t GetInternedStringCount()
+{
+    auto& table = GetStringTable();
+    std::shared_lock const lock(table._mutex);
+    return table._strings.size();
+}
+
+} // namespace fge
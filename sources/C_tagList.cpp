@@ -15,31 +15,99 @@
  */
 
 #include "FastEngine/C_tagList.hpp"
+#include "FastEngine/C_scene.hpp"
+#include <algorithm>
 
 namespace fge
 {
 
+TagList::TagList(fge::Object* owner) :
+        g_owner(owner)
+{}
+TagList::TagList(TagList const& r) :
+        g_tags(r.g_tags)
+{}
+TagList::TagList(TagList&& r) noexcept :
+        g_tags(std::move(r.g_tags))
+{
+    for (auto const tag: this->g_tags)
+    {
+        r.notifyOwner(tag, false);
+    }
+    r.g_tags.clear();
+}
+
+TagList& TagList::operator=(TagList const& r)
+{
+    if (this != &r)
+    {
+        this->clear();
+        for (auto const tag: r.g_tags)
+        {
+            this->add(tag);
+        }
+    }
+    return *this;
+}
+TagList& TagList::operator=(TagList&& r) noexcept
+{
+    if (this != &r)
+    {
+        this->clear();
+
+        this->g_tags = std::move(r.g_tags);
+        r.g_tags.clear();
+        for (auto const tag: this->g_tags)
+        {
+            r.notifyOwner(tag, false);
+            this->notifyOwner(tag, true);
+        }
+    }
+    return *this;
+}
+
 void TagList::clear()
 {
+    for (auto const tag: this->g_tags)
+    {
+        this->notifyOwner(tag, false);
+    }
     this->g_tags.clear();
 }
 
 void TagList::add(std::string_view tag)
 {
-    this->g_tags.insert(std::string{tag});
+    this->add(fge::InternString(tag));
+}
+void TagList::add(fge::StringId tag)
+{
+    if (!this->check(tag))
+    {
+        this->g_tags.push_back(tag);
+        this->notifyOwner(tag, true);
+    }
 }
 void TagList::del(std::string_view tag)
 {
-    auto it = this->g_tags.find(tag);
+    this->del(fge::StringId{tag});
+}
+void TagList::del(fge::StringId tag)
+{
+    auto it = std::find(this->g_tags.begin(), this->g_tags.end(), tag);
     if (it != this->g_tags.end())
     {
         this->g_tags.erase(it);
+        this->notifyOwner(tag, false);
     }
 }
 
 bool TagList::check(std::string_view tag) const
 {
-    return this->g_tags.find(tag) != this->g_tags.end();
+    return this->check(fge::StringId{tag});
+}
+bool TagList::check(fge::StringId tag) const
+{
+    return std::find(this->g_tags.begin(), this->g_tags.end(), tag) != this->g_tags.end();
 }
 
 std::size_t TagList::getSize() const
@@ -56,4 +124,20 @@ fge::TagList::TagListType::const_iterator TagList::end() const
     return this->g_tags.end();
 }
 
+void TagList::notifyOwner(fge::StringId tag, bool added) const
+{
+    if (this->g_owner == nullptr)
+    {
+        return;
+    }
+
+    if (auto data = this->g_owner->_myObjectData.lock())
+    {
+        if (auto* scene = data->getScene())
+        {
+            scene->index_updateTag(data, tag, added);
+        }
+    }
+}
+
 } // namespace fge
@@ -0,0 +1,436 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/C_worldStreamer.hpp"
+#include "FastEngine/extra/extra_function.hpp"
+#include "private/fge_debug.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace fge
+{
+
+namespace
+{
+
+std::size_t GetFileSize(std::filesystem::path const& path)
+{
+    std::error_code err;
+    auto const size = std::filesystem::file_size(path, err);
+    return err ? 0 : static_cast<std::size_t>(size);
+}
+
+std::filesystem::path GetCellFileName(fge::Vector2i const& cell, char const* extension)
+{
+    return "cell_" + std::to_string(cell.x) + '_' + std::to_string(cell.y) + extension;
+}
+
+std::shared_ptr<fge::TileMap> LoadTileMap(nlohmann::json& tiles, std::filesystem::path const& path)
+{
+    auto tileMap = fge::TileMap::create();
+    try
+    {
+        tileMap->load(tiles, path);
+    }
+    catch ([[maybe_unused]] std::exception const& e)
+    {
+        [[maybe_unused]] std::string_view const error = e.what();
+        FGE_DEBUG_PRINT("can't load the cell tiles: {}", error);
+        return nullptr;
+    }
+    return tileMap;
+}
+
+} // namespace
+
+WorldStreamer::WorldStreamer(fge::Scene& scene, std::filesystem::path directory, WorldStreamerConfig const& config) :
+        g_scene(&scene),
+        g_directory(std::move(directory)),
+        g_config(config)
+{}
+WorldStreamer::~WorldStreamer()
+{
+    //Only wait for the pending loadings, the loaded objects are kept in the Scene
+    for (auto& [cell, data]: this->g_cells)
+    {
+        if (data._state == CellStates::LOADING)
+        {
+            data._loading.wait();
+        }
+    }
+}
+
+void WorldStreamer::setConfig(WorldStreamerConfig const& config)
+{
+    this->g_config = config;
+}
+WorldStreamerConfig const& WorldStreamer::getConfig() const
+{
+    return this->g_config;
+}
+
+fge::Scene& WorldStreamer::getScene() const
+{
+    return *this->g_scene;
+}
+std::filesystem::path const& WorldStreamer::getDirectory() const
+{
+    return this->g_directory;
+}
+
+void WorldStreamer::update(std::span<fge::Vector2f const> interestPoints)
+{
+    //Transferring the finished loadings
+    for (auto& [cell, data]: this->g_cells)
+    {
+        if (data._state != CellStates::LOADING ||
+            data._loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            continue;
+        }
+
+        --this->g_loadingCount;
+        auto loadedData = data._loading.get();
+        if (this->getCellDistance(cell, interestPoints) > this->g_config._unloadDistance)
+        { //Not needed anymore
+            data._state = CellStates::UNLOADED;
+            continue;
+        }
+        this->integrateCell(cell, data, std::move(loadedData));
+    }
+
+    //Unloading far cells
+    for (auto it = this->g_cells.begin(); it != this->g_cells.end();)
+    {
+        if (it->second._state == CellStates::LOADED &&
+            this->getCellDistance(it->first, interestPoints) > this->g_config._unloadDistance)
+        {
+            this->unloadCell(it->first, it->second);
+        }
+
+        if (it->second._state == CellStates::UNLOADED)
+        {
+            it = this->g_cells.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    //Respecting the memory budget by unloading the farthest cells outside the load distance
+    if (this->g_config._memoryBudget != 0 && this->g_memoryUsage > this->g_config._memoryBudget)
+    {
+        std::vector<std::pair<float, CellMap::iterator>> evictables;
+        for (auto it = this->g_cells.begin(); it != this->g_cells.end(); ++it)
+        {
+            if (it->second._state != CellStates::LOADED)
+            {
+                continue;
+            }
+            auto const distance = this->getCellDistance(it->first, interestPoints);
+            if (distance > this->g_config._loadDistance)
+            {
+                evictables.emplace_back(distance, it);
+            }
+        }
+        std::sort(evictables.begin(), evictables.end(),
+                  [](auto const& a, auto const& b) { return a.first > b.first; });
+
+        for (auto& evictable: evictables)
+        {
+            if (this->g_memoryUsage <= this->g_config._memoryBudget)
+            {
+                break;
+            }
+            this->unloadCell(evictable.second->first, evictable.second->second);
+            this->g_cells.erase(evictable.second);
+        }
+    }
+
+    //Requesting the near cells, nearest first
+    if (this->g_config._memoryBudget != 0 && this->g_memoryUsage >= this->g_config._memoryBudget)
+    {
+        return;
+    }
+
+    std::vector<std::pair<float, fge::Vector2i>> requests;
+    for (auto const& point: interestPoints)
+    {
+        auto const minCell = this->getCellCoord(point - fge::Vector2f{this->g_config._loadDistance});
+        auto const maxCell = this->getCellCoord(point + fge::Vector2f{this->g_config._loadDistance});
+
+        for (int32_t y = minCell.y; y <= maxCell.y; ++y)
+        {
+            for (int32_t x = minCell.x; x <= maxCell.x; ++x)
+            {
+                fge::Vector2i const cell{x, y};
+                if (this->g_cells.contains(cell))
+                {
+                    continue;
+                }
+
+                auto const distance = this->getCellDistance(cell, interestPoints);
+                if (distance <= this->g_config._loadDistance)
+                {
+                    requests.emplace_back(distance, cell);
+                }
+            }
+        }
+    }
+    std::sort(requests.begin(), requests.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+
+    for (auto const& request: requests)
+    {
+        if (this->g_loadingCount >= this->g_config._maxConcurrentLoads)
+        {
+            break;
+        }
+
+        auto& data = this->g_cells[request.second];
+        if (data._state != CellStates::UNLOADED)
+        { //Requested by multiple interest points
+            continue;
+        }
+
+        data._state = CellStates::LOADING;
+        data._loading = std::async(std::launch::async, [objectsPath = this->getCellObjectsPath(request.second),
+                                                        tilesPath = this->getCellTilesPath(request.second)]() {
+            LoadedData loadedData;
+
+            //Only reading the files here, the Object and the tiles are created by the thread that own the Scene
+            std::error_code err;
+            if (std::filesystem::is_regular_file(objectsPath, err))
+            {
+                fge::SceneSnapshotData objects;
+                if (fge::ReadSceneSnapshot(objectsPath, objects))
+                {
+                    loadedData._objects = std::move(objects);
+                    loadedData._objectsMemorySize = GetFileSize(objectsPath);
+                }
+                else
+                {
+                    [[maybe_unused]] auto const pathString = objectsPath.string();
+                    FGE_DEBUG_PRINT("can't read the cell objects: {}", pathString);
+                }
+            }
+
+            if (std::filesystem::is_regular_file(tilesPath, err))
+            {
+                nlohmann::json tiles;
+                if (fge::LoadJsonFromFile(tilesPath, tiles))
+                {
+                    loadedData._tiles = std::move(tiles);
+                    loadedData._tilesMemorySize = GetFileSize(tilesPath);
+                }
+                else
+                {
+                    [[maybe_unused]] auto const pathString = tilesPath.string();
+                    FGE_DEBUG_PRINT("can't read the cell tiles: {}", pathString);
+                }
+            }
+
+            return loadedData;
+        });
+        ++this->g_loadingCount;
+    }
+}
+void WorldStreamer::update(fge::Vector2f const& interestPoint)
+{
+    this->update(std::span<fge::Vector2f const>{&interestPoint, 1});
+}
+
+void WorldStreamer::unloadAll()
+{
+    for (auto& [cell, data]: this->g_cells)
+    {
+        if (data._state == CellStates::LOADING)
+        {
+            data._loading.wait();
+            data._loading = {};
+            data._state = CellStates::UNLOADED;
+        }
+        else if (data._state == CellStates::LOADED)
+        {
+            this->unloadCell(cell, data);
+        }
+    }
+    this->g_cells.clear();
+    this->g_loadingCount = 0;
+}
+
+fge::Vector2i WorldStreamer::getCellCoord(fge::Vector2f const& position) const
+{
+    return {static_cast<int32_t>(std::floor(position.x / this->g_config._cellSize.x)),
+            static_cast<int32_t>(std::floor(position.y / this->g_config._cellSize.y))};
+}
+fge::RectFloat WorldStreamer::getCellBounds(fge::Vector2i const& cell) const
+{
+    return {fge::Vector2f{cell} * this->g_config._cellSize, this->g_config._cellSize};
+}
+WorldStreamer::CellStates WorldStreamer::getCellState(fge::Vector2i const& cell) const
+{
+    auto const it = this->g_cells.find(cell);
+    return it != this->g_cells.end() ? it->second._state : CellStates::UNLOADED;
+}
+
+std::filesystem::path WorldStreamer::getCellObjectsPath(fge::Vector2i const& cell) const
+{
+    return this->g_directory / GetCellFileName(cell, FGE_WORLDSTREAMER_OBJECTS_EXTENSION);
+}
+std::filesystem::path WorldStreamer::getCellTilesPath(fge::Vector2i const& cell) const
+{
+    return this->g_directory / GetCellFileName(cell, FGE_WORLDSTREAMER_TILES_EXTENSION);
+}
+
+std::size_t WorldStreamer::getLoadedCellCount() const
+{
+    return static_cast<std::size_t>(std::count_if(this->g_cells.begin(), this->g_cells.end(), [](auto const& cell) {
+        return cell.second._state == CellStates::LOADED;
+    }));
+}
+std::size_t WorldStreamer::getLoadingCellCount() const
+{
+    return this->g_loadingCount;
+}
+std::size_t WorldStreamer::getMemoryUsage() const
+{
+    return this->g_memoryUsage;
+}
+
+float WorldStreamer::getCellDistance(fge::Vector2i const& cell, std::span<fge::Vector2f const> points) const
+{
+    auto const bounds = this->getCellBounds(cell);
+    auto distance = std::numeric_limits<float>::max();
+    for (auto const& point: points)
+    {
+        //Distance between the point and the nearest point of the cell
+        auto const dx = std::max({bounds._x - point.x, 0.0f, point.x - (bounds._x + bounds._width)});
+        auto const dy = std::max({bounds._y - point.y, 0.0f, point.y - (bounds._y + bounds._height)});
+        distance = std::min(distance, std::sqrt(dx * dx + dy * dy));
+    }
+    return distance;
+}
+
+void WorldStreamer::integrateCell(fge::Vector2i const& cell, Cell& data, LoadedData&& loadedData)
+{
+    data._state = CellStates::LOADED;
+    data._memorySize = 0;
+
+    auto const callbackContext = this->g_scene->getCallbackContext();
+
+    //The Object are created in a staging Scene in order to resolve the SID conflicts before the transfer
+    fge::Scene staging;
+    if (loadedData._objects)
+    {
+        if (fge::LoadSceneSnapshot(staging, *loadedData._objects))
+        {
+            data._memorySize += loadedData._objectsMemorySize;
+        }
+        else
+        { //Partially loaded objects are discarded
+            [[maybe_unused]] auto const pathString = this->getCellObjectsPath(cell).string();
+            FGE_DEBUG_PRINT("can't load the cell objects: {}", pathString);
+            staging.clear();
+        }
+    }
+
+    std::vector<fge::ObjectSid> sids;
+    sids.reserve(staging.getObjectSize());
+    for (auto const& objectData: staging)
+    {
+        sids.push_back(objectData->getSid());
+    }
+
+    for (auto sid: sids)
+    {
+        if (this->g_scene->isValid(sid))
+        { //SID already taken, generating a new one that is free in both scenes
+            auto const type = staging.getObject(sid)->getType();
+            fge::ObjectSid newSid;
+            do {
+                newSid = this->g_scene->generateSid(FGE_SCENE_BAD_SID, type);
+            } while (newSid != FGE_SCENE_BAD_SID && staging.isValid(newSid));
+
+            if (newSid == FGE_SCENE_BAD_SID || !staging.setObjectSid(sid, newSid))
+            {
+                continue;
+            }
+            sid = newSid;
+        }
+
+        auto objectData = staging.transferObject(sid, *this->g_scene);
+        if (!objectData)
+        {
+            continue;
+        }
+
+        auto* object = objectData->getObject();
+        if (object->_callbackContextMode == fge::Object::CallbackContextModes::CONTEXT_AUTO &&
+            callbackContext._event != nullptr)
+        {
+            object->callbackRegister(*callbackContext._event, callbackContext._guiElementHandler);
+        }
+        data._objects.emplace_back(objectData);
+    }
+
+    if (loadedData._tiles)
+    {
+        data._tileMap = LoadTileMap(*loadedData._tiles, this->getCellTilesPath(cell));
+    }
+    if (data._tileMap)
+    {
+        data._tileMap->generateObjects(*this->g_scene, this->g_config._tilePlan);
+
+        auto const origin = this->getCellBounds(cell).getPosition();
+        for (auto const& generatedObject: data._tileMap->_generatedObjects)
+        {
+            if (auto objectData = generatedObject.lock())
+            {
+                objectData->getObject()->move(origin);
+                data._objects.push_back(generatedObject);
+            }
+        }
+        data._memorySize += loadedData._tilesMemorySize;
+    }
+
+    this->g_memoryUsage += data._memorySize;
+
+    this->_onCellLoaded.call(*this, cell);
+}
+void WorldStreamer::unloadCell(fge::Vector2i const& cell, Cell& data)
+{
+    for (auto const& object: data._objects)
+    {
+        auto objectData = object.lock();
+        if (objectData && objectData->getScene() == this->g_scene)
+        {
+            this->g_scene->delObject(objectData->getSid());
+        }
+    }
+    data._objects.clear();
+    data._tileMap.reset();
+
+    this->g_memoryUsage -= data._memorySize;
+    data._memorySize = 0;
+    data._state = CellStates::UNLOADED;
+
+    this->_onCellUnloaded.call(*this, cell);
+}
+
+} // namespace fge
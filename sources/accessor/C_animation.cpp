@@ -372,13 +372,10 @@ fge::RectInt Animation::retrieveTextureRect() const
     {
         if (this->isFrameValid())
         {
-            auto gridSize = static_cast<fge::Vector2i>(
-                    data->_groups[this->g_groupIndex]._frames[this->g_frameIndex]._texture->getSize());
-
-            auto rect = fge::RectInt{{0, 0}, gridSize};
+            auto rect = data->_groups[this->g_groupIndex]._frames[this->g_frameIndex]._textureRect;
             if (this->g_flipHorizontal)
             {
-                rect._x = rect._width;
+                rect._x += rect._width;
                 rect._width = -rect._width;
             }
             return rect;
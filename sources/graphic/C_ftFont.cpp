@@ -24,7 +24,13 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
+#include FT_MODULE_H
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
+#include <fstream>
+#include <unordered_set>
 
 namespace fge
 {
@@ -45,14 +51,149 @@ uint64_t BuildGlyphKey(float outlineThickness, bool bold, uint32_t index)
     return (static_cast<uint64_t>(data._out) << 32) | (static_cast<uint64_t>(bold) << 31) | index;
 }
 
+//Copy the alpha channel of a 32 bits glyph surface into the alpha buffer of a page
+void CopyAlpha(SDL_Surface const* src, std::vector<uint8_t>& dst, int dstWidth, int x, int y)
+{
+    for (int h = 0; h < src->h; ++h)
+    {
+        auto const* srcRow = static_cast<uint8_t const*>(src->pixels) + static_cast<std::size_t>(h) * src->pitch;
+        auto* dstRow = dst.data() + static_cast<std::size_t>(y + h) * dstWidth + x;
+        for (int w = 0; w < src->w; ++w)
+        {
+            dstRow[w] = srcRow[w * 4 + 3];
+        }
+    }
+}
+//Glyphs are white, the texture is made from the alpha buffer of a page
+fge::Surface ExpandAlpha(std::vector<uint8_t> const& alpha, fge::Vector2i const& size)
+{
+    fge::Surface surface;
+    if (!surface.create(size.x, size.y, fge::Color(255, 255, 255, 0)))
+    {
+        return surface;
+    }
+
+    auto* pixels = surface.get();
+    for (int y = 0; y < size.y; ++y)
+    {
+        auto* row = static_cast<uint8_t*>(pixels->pixels) + static_cast<std::size_t>(y) * pixels->pitch;
+        auto const* alphaRow = alpha.data() + static_cast<std::size_t>(y) * size.x;
+        for (int x = 0; x < size.x; ++x)
+        {
+            row[x * 4 + 3] = alphaRow[x];
+        }
+    }
+    return surface;
+}
+
+//Glyph cache file, fixed size structures are stored in the host byte order
+
+constexpr uint32_t gGlyphCacheEndianCheck = 0x01020304;
+constexpr int gGlyphCacheMaxPageSize = 1 << 15;
+
+struct GlyphCacheHeader
+{
+    std::array<char, 4> _magic;
+    uint32_t _endianCheck;
+    uint16_t _version;
+    uint16_t _flags;
+    uint32_t _pageCount;
+    uint32_t _faceGlyphCount; ///< Number of glyphs of the font face, used to detect another font
+    uint32_t _faceUnitsPerEM;
+    uint32_t _familySize;
+    uint32_t _styleSize;
+};
+
+struct GlyphCachePage
+{
+    uint16_t _characterSize;
+    uint16_t _padding;
+    int32_t _width;
+    int32_t _height;
+    uint32_t _glyphCount;
+    uint32_t _nodeCount;
+    uint32_t _padding2;
+    uint64_t _usedArea;
+};
+
+struct GlyphCacheGlyph
+{
+    uint64_t _key;
+    float _advance;
+    int32_t _lsbDelta;
+    int32_t _rsbDelta;
+    std::array<float, 4> _bounds;
+    std::array<int32_t, 4> _textureRect;
+    uint32_t _padding;
+};
+
+static_assert(sizeof(GlyphCacheHeader) == 32, "GlyphCacheHeader must be tightly packed");
+static_assert(sizeof(GlyphCachePage) == 32, "GlyphCachePage must be tightly packed");
+static_assert(sizeof(GlyphCacheGlyph) == 56, "GlyphCacheGlyph must be tightly packed");
+static_assert(sizeof(fge::SkylinePacker::Node) == 12, "SkylinePacker::Node must be tightly packed");
+
+template<class T>
+void Write(std::ofstream& file, T const* data, std::size_t count = 1)
+{
+    file.write(reinterpret_cast<char const*>(data), static_cast<std::streamsize>(sizeof(T) * count));
+}
+template<class T>
+[[nodiscard]] bool Read(std::ifstream& file, T* data, std::size_t count = 1)
+{
+    return static_cast<bool>(
+            file.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(sizeof(T) * count)));
+}
+//A glyph texture rectangle (possibly flipped) must stay inside its page
+[[nodiscard]] bool IsInsidePage(std::array<int32_t, 4> const& rect, fge::Vector2i const& size)
+{
+    auto const x = static_cast<int64_t>(rect[0]);
+    auto const y = static_cast<int64_t>(rect[1]);
+    auto const endX = x + rect[2];
+    auto const endY = y + rect[3];
+    return x >= 0 && x <= size.x && endX >= 0 && endX <= size.x && y >= 0 && y <= size.y && endY >= 0 &&
+           endY <= size.y;
+}
+//Number of bytes left in the file, used to refuse a size read from a corrupted file before allocating it
+[[nodiscard]] std::uintmax_t GetRemainingSize(std::ifstream& file, std::uintmax_t fileSize)
+{
+    auto const position = file.tellg();
+    if (position < 0 || static_cast<std::uintmax_t>(position) > fileSize)
+    {
+        return 0;
+    }
+    return fileSize - static_cast<std::uintmax_t>(position);
+}
+
 } //end namespace
 
+std::u32string MakeCodePointRange(char32_t first, char32_t last)
+{
+    std::u32string result;
+    if (last < first)
+    {
+        return result;
+    }
+
+    result.reserve(static_cast<std::size_t>(last - first) + 1);
+    for (char32_t codePoint = first;; ++codePoint)
+    {
+        result.push_back(codePoint);
+        if (codePoint == last)
+        {
+            break;
+        }
+    }
+    return result;
+}
+
 FreeTypeFont::FreeTypeFont() :
         g_face(nullptr),
         g_streamRec(nullptr),
         g_stroker(nullptr),
         g_isSmooth(true),
-        g_info()
+        g_info(),
+        g_renderMode(RenderModes::BITMAP),
+        g_pageRevision(0)
 {}
 FreeTypeFont::~FreeTypeFont()
 {
@@ -92,6 +233,12 @@ bool FreeTypeFont::loadFromFile(std::filesystem::path const& filePath)
     this->g_stroker = stroker;
     this->g_face = face;
 
+    // Bitmap fonts can't be rasterized as distance fields
+    if (!FT_IS_SCALABLE(face))
+    {
+        this->g_renderMode = RenderModes::BITMAP;
+    }
+
     // Store the font information
     this->g_info.family = face->family_name != nullptr ? face->family_name : std::string{};
 
@@ -132,6 +279,12 @@ bool FreeTypeFont::loadFromMemory(void const* data, std::size_t sizeInBytes)
     this->g_stroker = stroker;
     this->g_face = face;
 
+    // Bitmap fonts can't be rasterized as distance fields
+    if (!FT_IS_SCALABLE(face))
+    {
+        this->g_renderMode = RenderModes::BITMAP;
+    }
+
     // Store the font information
     this->g_info.family = face->family_name != nullptr ? face->family_name : std::string{};
 
@@ -145,9 +298,43 @@ FreeTypeFont::Info const& FreeTypeFont::getInfo() const
 
 Glyph const&
 FreeTypeFont::getGlyph(uint32_t codePoint, fge::CharacterSize characterSize, bool bold, float outlineThickness) const
+{
+    if (this->g_renderMode == RenderModes::BITMAP)
+    {
+        return this->findGlyph(codePoint, characterSize, bold, outlineThickness);
+    }
+
+    // SDF: the glyphs of the shared page are scaled to the character size
+    GlyphTable& glyphs = this->g_sdfGlyphs[characterSize];
+
+    auto key = BuildGlyphKey(outlineThickness, bold, FT_Get_Char_Index(static_cast<FT_Face>(g_face), codePoint));
+
+    auto it = glyphs.find(key);
+    if (it != glyphs.end())
+    {
+        return it->second;
+    }
+
+    // The outline thickness is converted to the size of the page
+    float const scale = this->getGlyphScale(characterSize);
+    Glyph glyph = this->findGlyph(codePoint, FGE_FONT_SDF_BASE_SIZE, bold, outlineThickness / scale);
+
+    // Only the metrics are scaled, the texture rectangle stay in the page
+    glyph._advance *= scale;
+    glyph._lsbDelta = static_cast<int>(std::round(static_cast<float>(glyph._lsbDelta) * scale));
+    glyph._rsbDelta = static_cast<int>(std::round(static_cast<float>(glyph._rsbDelta) * scale));
+    glyph._bounds._x *= scale;
+    glyph._bounds._y *= scale;
+    glyph._bounds._width *= scale;
+    glyph._bounds._height *= scale;
+
+    return glyphs.insert(std::make_pair(key, glyph)).first->second;
+}
+Glyph const&
+FreeTypeFont::findGlyph(uint32_t codePoint, fge::CharacterSize pageSize, bool bold, float outlineThickness) const
 {
     // Get the page corresponding to the character size
-    GlyphTable& glyphs = this->loadPage(characterSize)._glyphs;
+    GlyphTable& glyphs = this->loadPage(pageSize)._glyphs;
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
     auto key = BuildGlyphKey(outlineThickness, bold, FT_Get_Char_Index(static_cast<FT_Face>(g_face), codePoint));
@@ -160,7 +347,7 @@ FreeTypeFont::getGlyph(uint32_t codePoint, fge::CharacterSize characterSize, boo
     }
 
     // Not found: we have to load it
-    Glyph const glyph = this->loadGlyph(codePoint, characterSize, bold, outlineThickness);
+    Glyph const glyph = this->loadGlyph(codePoint, pageSize, bold, outlineThickness);
     return glyphs.insert(std::make_pair(key, glyph)).first->second;
 }
 bool FreeTypeFont::hasGlyph(uint32_t codePoint) const
@@ -177,17 +364,23 @@ float FreeTypeFont::getKerning(uint32_t first, uint32_t second, fge::CharacterSi
     }
 
     FT_Face face = static_cast<FT_Face>(this->g_face);
+    if (face == nullptr)
+    {
+        // Invalid font
+        return 0.0f;
+    }
+
+    // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag,
+    // this is done first as the glyphs can be rasterized at another size (in SDF mode)
+    float firstRsbDelta = static_cast<float>(getGlyph(first, characterSize, bold)._rsbDelta);
+    float secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold)._lsbDelta);
 
-    if (face != nullptr && this->setCurrentSize(characterSize))
+    if (this->setCurrentSize(characterSize))
     {
         // Convert the characters to indices
         FT_UInt const index1 = FT_Get_Char_Index(face, first);
         FT_UInt const index2 = FT_Get_Char_Index(face, second);
 
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        float firstRsbDelta = static_cast<float>(getGlyph(first, characterSize, bold)._rsbDelta);
-        float secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold)._lsbDelta);
-
         // Get the kerning vector if present
         FT_Vector kerning;
         kerning.x = kerning.y = 0;
@@ -259,9 +452,314 @@ float FreeTypeFont::getUnderlineThickness(fge::CharacterSize characterSize) cons
     return 0.0f;
 }
 
+bool FreeTypeFont::setRenderMode(RenderModes mode)
+{
+    if (mode == this->g_renderMode)
+    {
+        return true;
+    }
+
+    // Bitmap fonts can't be rasterized as distance fields
+    FT_Face face = static_cast<FT_Face>(this->g_face);
+    if (mode == RenderModes::SDF && face != nullptr && !FT_IS_SCALABLE(face))
+    {
+        return false;
+    }
+
+    this->g_renderMode = mode;
+    this->g_pages.clear();
+    this->g_sdfGlyphs.clear();
+    return true;
+}
+FreeTypeFont::RenderModes FreeTypeFont::getRenderMode() const
+{
+    return this->g_renderMode;
+}
+float FreeTypeFont::getGlyphScale(fge::CharacterSize characterSize) const
+{
+    if (this->g_renderMode == RenderModes::SDF)
+    {
+        return static_cast<float>(characterSize) / static_cast<float>(FGE_FONT_SDF_BASE_SIZE);
+    }
+    return 1.0f;
+}
+
 fge::vulkan::TextureImage const& FreeTypeFont::getTexture(fge::CharacterSize characterSize) const
 {
-    return this->loadPage(characterSize)._texture;
+    return this->loadPage(this->getPageSize(characterSize))._texture;
+}
+uint32_t FreeTypeFont::getPageRevision(fge::CharacterSize characterSize) const
+{
+    return this->loadPage(this->getPageSize(characterSize))._revision;
+}
+
+std::size_t FreeTypeFont::bakeGlyphs(std::u32string_view codePoints,
+                                     std::span<fge::CharacterSize const> characterSizes,
+                                     bool bold,
+                                     float outlineThickness) const
+{
+    FT_Face face = static_cast<FT_Face>(this->g_face);
+    if (face == nullptr)
+    {
+        return 0;
+    }
+
+    struct PendingGlyph
+    {
+        uint64_t _key;
+        Glyph _glyph;
+        fge::Surface _bitmap;
+    };
+
+    // Every glyph goes in the shared page in SDF mode
+    fge::CharacterSize const sdfPageSize[] = {FGE_FONT_SDF_BASE_SIZE};
+    if (this->g_renderMode == RenderModes::SDF)
+    {
+        characterSizes = sdfPageSize;
+    }
+
+    std::size_t count = 0;
+    std::vector<PendingGlyph> pendingGlyphs;
+    std::unordered_set<uint64_t> pendingKeys;
+
+    for (auto const characterSize: characterSizes)
+    {
+        Page& page = this->loadPage(characterSize);
+
+        // Rasterize every missing glyph first, so the page is enlarged and uploaded only once
+        pendingGlyphs.clear();
+        pendingKeys.clear();
+        std::size_t pendingArea = 0;
+        for (auto const codePoint: codePoints)
+        {
+            auto const key = BuildGlyphKey(outlineThickness, bold, FT_Get_Char_Index(face, codePoint));
+            if (page._glyphs.contains(key) || !pendingKeys.insert(key).second)
+            {
+                continue;
+            }
+
+            Glyph glyph;
+            if (this->rasterizeGlyph(codePoint, characterSize, bold, outlineThickness, glyph))
+            {
+                auto const size = this->g_surfaceBuffer.getSize();
+                pendingArea += static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y);
+                pendingGlyphs.push_back({key, glyph, this->g_surfaceBuffer});
+            }
+            else
+            {
+                // Glyph without pixels, like a space
+                page._glyphs.emplace(key, glyph);
+            }
+            ++count;
+        }
+
+        if (pendingGlyphs.empty())
+        {
+            continue;
+        }
+
+        // Enlarge the page for every glyph at once, the packer rarely fill more than 80% of the area
+        auto const maxImageDimension =
+                static_cast<int>(page._texture.getContext().getPhysicalDevice().getMaxImageDimension2D());
+        auto size = page._packer.getSize();
+        while ((page._packer.getUsedArea() + pendingArea) * 5 >
+                       static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4 &&
+               size.x * 2 <= maxImageDimension && size.y * 2 <= maxImageDimension)
+        {
+            size *= 2;
+        }
+        if (size != page._packer.getSize())
+        {
+            this->resizePage(page, size);
+        }
+
+        // The tallest glyphs first give a tighter skyline
+        std::sort(pendingGlyphs.begin(), pendingGlyphs.end(), [](PendingGlyph const& a, PendingGlyph const& b) {
+            return a._bitmap.getSize().y > b._bitmap.getSize().y;
+        });
+        for (auto& pendingGlyph: pendingGlyphs)
+        {
+            this->placeGlyph(page, pendingGlyph._glyph, pendingGlyph._bitmap, false);
+            page._glyphs.emplace(pendingGlyph._key, pendingGlyph._glyph);
+        }
+
+        page._texture.update(ExpandAlpha(page._alpha, page._packer.getSize()).get(), {0, 0});
+    }
+
+    return count;
+}
+
+bool FreeTypeFont::saveGlyphCache(std::filesystem::path const& filePath) const
+{
+    FT_Face face = static_cast<FT_Face>(this->g_face);
+    if (face == nullptr)
+    {
+        return false;
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::string_view const family = face->family_name != nullptr ? face->family_name : "";
+    std::string_view const style = face->style_name != nullptr ? face->style_name : "";
+
+    GlyphCacheHeader header{};
+    header._magic = FGE_FONT_GLYPH_CACHE_MAGIC;
+    header._endianCheck = gGlyphCacheEndianCheck;
+    header._version = FGE_FONT_GLYPH_CACHE_VERSION;
+    header._flags = this->g_renderMode == RenderModes::SDF ? FGE_FONT_GLYPH_CACHE_FLAG_SDF : 0;
+    header._pageCount = static_cast<uint32_t>(this->g_pages.size());
+    header._faceGlyphCount = static_cast<uint32_t>(face->num_glyphs);
+    header._faceUnitsPerEM = face->units_per_EM;
+    header._familySize = static_cast<uint32_t>(family.size());
+    header._styleSize = static_cast<uint32_t>(style.size());
+    Write(file, &header);
+    Write(file, family.data(), family.size());
+    Write(file, style.data(), style.size());
+
+    std::vector<GlyphCacheGlyph> glyphs;
+    for (auto const& [characterSize, page]: this->g_pages)
+    {
+        auto const& nodes = page._packer.getNodes();
+        auto const size = page._packer.getSize();
+
+        GlyphCachePage pageHeader{};
+        pageHeader._characterSize = characterSize;
+        pageHeader._width = size.x;
+        pageHeader._height = size.y;
+        pageHeader._glyphCount = static_cast<uint32_t>(page._glyphs.size());
+        pageHeader._nodeCount = static_cast<uint32_t>(nodes.size());
+        pageHeader._usedArea = page._packer.getUsedArea();
+        Write(file, &pageHeader);
+        Write(file, nodes.data(), nodes.size());
+
+        glyphs.clear();
+        for (auto const& [key, glyph]: page._glyphs)
+        {
+            auto& entry = glyphs.emplace_back();
+            entry._key = key;
+            entry._advance = glyph._advance;
+            entry._lsbDelta = glyph._lsbDelta;
+            entry._rsbDelta = glyph._rsbDelta;
+            entry._bounds = {glyph._bounds._x, glyph._bounds._y, glyph._bounds._width, glyph._bounds._height};
+            entry._textureRect = {glyph._textureRect._x, glyph._textureRect._y, glyph._textureRect._width,
+                                  glyph._textureRect._height};
+        }
+        Write(file, glyphs.data(), glyphs.size());
+        Write(file, page._alpha.data(), page._alpha.size());
+    }
+
+    return file.good();
+}
+bool FreeTypeFont::loadGlyphCache(std::filesystem::path const& filePath)
+{
+    FT_Face face = static_cast<FT_Face>(this->g_face);
+    if (face == nullptr)
+    {
+        return false;
+    }
+
+    std::error_code error;
+    auto const fileSize = std::filesystem::file_size(filePath, error);
+    std::ifstream file(filePath, std::ios::binary);
+    if (error || !file)
+    {
+        return false;
+    }
+
+    std::string_view const family = face->family_name != nullptr ? face->family_name : "";
+    std::string_view const style = face->style_name != nullptr ? face->style_name : "";
+
+    GlyphCacheHeader header{};
+    if (!Read(file, &header) || header._magic != std::array<char, 4> FGE_FONT_GLYPH_CACHE_MAGIC ||
+        header._endianCheck != gGlyphCacheEndianCheck || header._version != FGE_FONT_GLYPH_CACHE_VERSION ||
+        ((header._flags & FGE_FONT_GLYPH_CACHE_FLAG_SDF) != 0) != (this->g_renderMode == RenderModes::SDF) ||
+        header._faceGlyphCount != static_cast<uint32_t>(face->num_glyphs) ||
+        header._faceUnitsPerEM != face->units_per_EM || header._familySize != family.size() ||
+        header._styleSize != style.size())
+    {
+        return false;
+    }
+
+    std::string name(header._familySize + header._styleSize, '\0');
+    if (!Read(file, name.data(), name.size()) || name.compare(0, family.size(), family) != 0 ||
+        name.compare(family.size(), style.size(), style) != 0)
+    {
+        return false;
+    }
+
+    // Every page is read before replacing the current ones, so a bad file doesn't change anything
+    std::vector<std::pair<fge::CharacterSize, Page>> pages;
+    std::vector<fge::SkylinePacker::Node> nodes;
+    std::vector<GlyphCacheGlyph> glyphs;
+    std::vector<uint8_t> alpha;
+    for (uint32_t i = 0; i < header._pageCount; ++i)
+    {
+        GlyphCachePage pageHeader{};
+        if (!Read(file, &pageHeader) || pageHeader._width <= 0 || pageHeader._height <= 0 ||
+            pageHeader._width > gGlyphCacheMaxPageSize || pageHeader._height > gGlyphCacheMaxPageSize ||
+            pageHeader._nodeCount > static_cast<uint32_t>(pageHeader._width))
+        {
+            return false;
+        }
+        fge::Vector2i const size{pageHeader._width, pageHeader._height};
+
+        // The page data must be in the file before being allocated
+        auto const pageDataSize =
+                static_cast<std::uintmax_t>(pageHeader._nodeCount) * sizeof(fge::SkylinePacker::Node) +
+                static_cast<std::uintmax_t>(pageHeader._glyphCount) * sizeof(GlyphCacheGlyph) +
+                static_cast<std::uintmax_t>(size.x) * static_cast<std::uintmax_t>(size.y);
+        if (pageDataSize > GetRemainingSize(file, fileSize))
+        {
+            return false;
+        }
+
+        nodes.resize(pageHeader._nodeCount);
+        glyphs.resize(pageHeader._glyphCount);
+        alpha.resize(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y));
+        if (!Read(file, nodes.data(), nodes.size()) || !Read(file, glyphs.data(), glyphs.size()) ||
+            !Read(file, alpha.data(), alpha.size()))
+        {
+            return false;
+        }
+
+        auto& page = pages.emplace_back(pageHeader._characterSize, Page{this->isPageSmooth(), 0}).second;
+        if (!page._packer.restore(size, nodes, pageHeader._usedArea))
+        {
+            return false;
+        }
+        page._alpha = std::move(alpha);
+
+        for (auto const& entry: glyphs)
+        {
+            if (!IsInsidePage(entry._textureRect, size))
+            {
+                return false;
+            }
+
+            Glyph glyph;
+            glyph._advance = entry._advance;
+            glyph._lsbDelta = entry._lsbDelta;
+            glyph._rsbDelta = entry._rsbDelta;
+            glyph._bounds = {{entry._bounds[0], entry._bounds[1]}, {entry._bounds[2], entry._bounds[3]}};
+            glyph._textureRect = {{entry._textureRect[0], entry._textureRect[1]},
+                                  {entry._textureRect[2], entry._textureRect[3]}};
+            page._glyphs.emplace(entry._key, glyph);
+        }
+    }
+
+    this->g_sdfGlyphs.clear();
+    for (auto& [characterSize, page]: pages)
+    {
+        page._texture.create(ExpandAlpha(page._alpha, page._packer.getSize()).get());
+        page._texture.setFilter(this->isPageSmooth() ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
+        page._revision = ++this->g_pageRevision;
+        this->g_pages.insert_or_assign(characterSize, std::move(page));
+    }
+    return true;
 }
 
 void FreeTypeFont::setSmooth(bool smooth)
@@ -272,7 +770,7 @@ void FreeTypeFont::setSmooth(bool smooth)
 
         for (auto& page: this->g_pages)
         {
-            page.second._texture.setFilter(this->g_isSmooth ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
+            page.second._texture.setFilter(this->isPageSmooth() ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
         }
     }
 }
@@ -330,12 +828,27 @@ void FreeTypeFont::cleanup()
     this->g_stroker = nullptr;
     this->g_streamRec = nullptr;
     this->g_pages.clear();
+    this->g_sdfGlyphs.clear();
     this->g_surfaceBuffer.clear();
 }
 
 FreeTypeFont::Page& FreeTypeFont::loadPage(fge::CharacterSize characterSize) const
 {
-    return this->g_pages.try_emplace(characterSize, this->g_isSmooth).first->second;
+    auto it = this->g_pages.find(characterSize);
+    if (it == this->g_pages.end())
+    {
+        it = this->g_pages.try_emplace(characterSize, this->isPageSmooth(), ++this->g_pageRevision).first;
+    }
+    return it->second;
+}
+fge::CharacterSize FreeTypeFont::getPageSize(fge::CharacterSize characterSize) const
+{
+    return this->g_renderMode == RenderModes::SDF ? FGE_FONT_SDF_BASE_SIZE : characterSize;
+}
+bool FreeTypeFont::isPageSmooth() const
+{
+    // Distance fields must always be interpolated
+    return this->g_isSmooth || this->g_renderMode == RenderModes::SDF;
 }
 
 Glyph FreeTypeFont::loadGlyph(uint32_t codePoint,
@@ -346,35 +859,51 @@ Glyph FreeTypeFont::loadGlyph(uint32_t codePoint,
     // The glyph to return
     Glyph glyph;
 
+    if (this->rasterizeGlyph(codePoint, characterSize, bold, outlineThickness, glyph))
+    {
+        this->placeGlyph(this->loadPage(characterSize), glyph, this->g_surfaceBuffer, true);
+    }
+
+    return glyph;
+}
+
+bool FreeTypeFont::rasterizeGlyph(uint32_t codePoint,
+                                  fge::CharacterSize characterSize,
+                                  bool bold,
+                                  float outlineThickness,
+                                  Glyph& glyph) const
+{
     // First, transform our ugly void* to a FT_Face
     FT_Face face = static_cast<FT_Face>(g_face);
     if (face == nullptr)
     {
-        return glyph;
+        return false;
     }
 
     // Set the character size
     if (!this->setCurrentSize(characterSize))
     {
-        return glyph;
+        return false;
     }
 
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0.0f)
+    // Load the glyph corresponding to the code point,
+    // distance fields are drawn at any scale so they are not hinted and need an outline
+    bool const sdf = this->g_renderMode == RenderModes::SDF;
+    FT_Int32 flags = sdf ? FT_LOAD_NO_HINTING : FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
+    if (outlineThickness != 0.0f || sdf)
     {
         flags |= FT_LOAD_NO_BITMAP;
     }
     if (FT_Load_Char(face, codePoint, flags) != 0)
     {
-        return glyph;
+        return false;
     }
 
     // Retrieve the glyph
     FT_Glyph glyphDesc;
     if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
     {
-        return glyph;
+        return false;
     }
 
     // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
@@ -398,10 +927,39 @@ Glyph FreeTypeFont::loadGlyph(uint32_t codePoint,
         }
     }
 
+    // Compute the glyph's advance offset, it is not rounded for distance fields as they are scaled
+    glyph._advance = sdf ? static_cast<float>(glyphDesc->advance.x) / static_cast<float>(1 << 16)
+                         : static_cast<float>(glyphDesc->advance.x >> 16);
+    if (bold)
+    {
+        glyph._advance += static_cast<float>(weight) / static_cast<float>(1 << 6);
+    }
+
+    glyph._lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph._rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    // The SDF rasterizer refuses empty outlines (like a space)
+    if (sdf && outline && reinterpret_cast<FT_OutlineGlyph>(glyphDesc)->outline.n_contours <= 0)
+    {
+        FT_Done_Glyph(glyphDesc);
+        return false;
+    }
+
+    // The spread is a property of the library, so it is set every time in case of another user changed it
+    if (sdf)
+    {
+        FT_Int spread = FGE_FONT_SDF_SPREAD;
+        FT_Property_Set(static_cast<FT_Library>(fge::font::GetFreetypeLibrary()), "sdf", "spread", &spread);
+    }
+
     // Convert the glyph to a bitmap (i.e. rasterize it)
     // Warning! After this line, do not read any data from glyphDesc directly, use
     // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+    if (FT_Glyph_To_Bitmap(&glyphDesc, sdf ? FT_RENDER_MODE_SDF : FT_RENDER_MODE_NORMAL, nullptr, 1) != 0)
+    {
+        FT_Done_Glyph(glyphDesc);
+        return false;
+    }
     FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
     FT_Bitmap& bitmap = bitmapGlyph->bitmap;
 
@@ -414,41 +972,19 @@ Glyph FreeTypeFont::loadGlyph(uint32_t codePoint,
         }
     }
 
-    // Compute the glyph's advance offset
-    glyph._advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-    {
-        glyph._advance += static_cast<float>(weight) / static_cast<float>(1 << 6);
-    }
-
-    glyph._lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph._rsbDelta = static_cast<int>(face->glyph->rsb_delta);
-
     unsigned int width = bitmap.width;
     unsigned int height = bitmap.rows;
 
-    if ((width > 0) && (height > 0))
+    bool const hasPixels = (width > 0) && (height > 0);
+    if (hasPixels)
     {
         // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        unsigned int const padding = 2;
+        // pollute them with pixels from neighbors (distance fields are also sampled with the shadow offset)
+        unsigned int const padding = sdf ? FGE_FONT_SDF_GLYPH_PADDING : FGE_FONT_GLYPH_PADDING;
 
         width += 2 * padding;
         height += 2 * padding;
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = this->loadPage(characterSize);
-
-        // Find a good position for the new glyph into the texture
-        glyph._textureRect = this->findGlyphRect(page, width, height);
-
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph._textureRect._x += static_cast<int>(padding);
-        glyph._textureRect._y += static_cast<int>(padding);
-        glyph._textureRect._width -= static_cast<int>(2 * padding);
-        glyph._textureRect._height -= static_cast<int>(2 * padding);
-
         // Compute the glyph's bounding box
         glyph._bounds._x = static_cast<float>(bitmapGlyph->left);
         glyph._bounds._y = static_cast<float>(-bitmapGlyph->top);
@@ -457,124 +993,118 @@ Glyph FreeTypeFont::loadGlyph(uint32_t codePoint,
 
         // Resize the pixel buffer to the new size and fill it with transparent white pixels
         this->g_surfaceBuffer.create(width, height, fge::Color(255, 255, 255, 0));
+        auto* surface = this->g_surfaceBuffer.get();
 
-        // Extract the glyph's pixels from the bitmap
+        // Extract the glyph's pixels from the bitmap, the alpha is the 4th byte of a RGBA32 pixel
         uint8_t const* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        for (unsigned int y = padding; y < height - padding; ++y)
         {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < height - padding; ++y)
+            auto* row = static_cast<uint8_t*>(surface->pixels) + static_cast<std::size_t>(y) * surface->pitch;
+            if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
             {
+                // Pixels are 1 bit monochrome values
                 for (unsigned int x = padding; x < width - padding; ++x)
                 {
                     if ((pixels[(x - padding) / 8] & (1 << (7 - ((x - padding) % 8)))) > 0)
                     {
-                        this->g_surfaceBuffer.setPixel(x, y, fge::Color::White);
+                        row[x * 4 + 3] = 255;
                     }
                 }
-                pixels += bitmap.pitch;
             }
-        }
-        else
-        {
-            // Pixels are 8 bits gray levels
-            for (unsigned int y = padding; y < height - padding; ++y)
+            else
             {
+                // Pixels are 8 bits gray levels
                 for (unsigned int x = padding; x < width - padding; ++x)
                 {
-                    this->g_surfaceBuffer.setPixel(x, y, fge::Color(255, 255, 255, pixels[x - padding]));
+                    row[x * 4 + 3] = pixels[x - padding];
                 }
-                pixels += bitmap.pitch;
             }
+            pixels += bitmap.pitch;
         }
-
-        // Write the pixels to the texture
-        unsigned int const x = static_cast<unsigned int>(glyph._textureRect._x) - padding;
-        unsigned int const y = static_cast<unsigned int>(glyph._textureRect._y) - padding;
-        page._texture.update(this->g_surfaceBuffer.get(), {x, y});
     }
 
     // Delete the FT glyph
     FT_Done_Glyph(glyphDesc);
 
-    // Done :)
-    return glyph;
+    return hasPixels;
 }
 
-fge::RectInt FreeTypeFont::findGlyphRect(Page& page, unsigned int width, unsigned int height) const
+void FreeTypeFont::placeGlyph(Page& page, Glyph& glyph, fge::Surface const& bitmap, bool updateTexture) const
 {
-    // Find the line that fits well the glyph
-    Row* row = nullptr;
-    float bestRatio = 0;
-    for (auto it = page._rows.begin(); it != page._rows.end(); ++it)
-    {
-        float const ratio = static_cast<float>(height) / static_cast<float>(it->_height);
+    auto const padding = static_cast<int>(this->g_renderMode == RenderModes::SDF ? FGE_FONT_SDF_GLYPH_PADDING
+                                                                                 : FGE_FONT_GLYPH_PADDING);
+    auto const size = bitmap.getSize();
 
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f))
-        {
-            continue;
-        }
+    // Find a good position for the new glyph into the texture
+    glyph._textureRect =
+            this->findGlyphRect(page, static_cast<unsigned int>(size.x), static_cast<unsigned int>(size.y));
+    bool const placed = glyph._textureRect._width == size.x && glyph._textureRect._height == size.y;
 
-        // Check if there's enough horizontal space left in the row
-        if (width > page._texture.getSize().x - it->_width)
+    // Write the pixels to the page
+    if (placed)
+    {
+        CopyAlpha(bitmap.get(), page._alpha, page._packer.getSize().x, glyph._textureRect._x, glyph._textureRect._y);
+        if (updateTexture)
         {
-            continue;
+            page._texture.update(bitmap.get(), {glyph._textureRect._x, glyph._textureRect._y});
         }
+    }
 
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio)
-        {
-            continue;
-        }
+    // Make sure the texture data is positioned in the center
+    // of the allocated texture rectangle
+    glyph._textureRect._x += padding;
+    glyph._textureRect._y += padding;
+    glyph._textureRect._width -= 2 * padding;
+    glyph._textureRect._height -= 2 * padding;
+}
 
-        // The current row passed all the tests: we can select it
-        row = &(*it);
-        bestRatio = ratio;
-    }
+fge::RectInt FreeTypeFont::findGlyphRect(Page& page, unsigned int width, unsigned int height) const
+{
+    auto rect = page._packer.insert(static_cast<int>(width), static_cast<int>(height));
 
-    // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (row == nullptr)
+    while (!rect)
     {
-        unsigned int const rowHeight = height + height / 10;
-        while ((page._nextRow + rowHeight >= static_cast<unsigned int>(page._texture.getSize().y)) ||
-               (width >= static_cast<unsigned int>(page._texture.getSize().x)))
-        {
-            // Not enough space: resize the texture if possible
-            unsigned int const textureWidth = page._texture.getSize().x;
-            unsigned int const textureHeight = page._texture.getSize().y;
-
-            auto maxImageDimension = page._texture.getContext().getPhysicalDevice().getMaxImageDimension2D();
+        // Not enough space: resize the texture if possible
+        auto const size = page._packer.getSize();
+        auto const maxImageDimension =
+                static_cast<int>(page._texture.getContext().getPhysicalDevice().getMaxImageDimension2D());
 
-            if ((textureWidth * 2 <= maxImageDimension) && (textureHeight * 2 <= maxImageDimension))
-            {
-                // Make the texture 2 times bigger
-                fge::vulkan::TextureImage newTexture{page._texture.getContext()};
-                newTexture.create({textureWidth * 2, textureHeight * 2});
-                newTexture.setFilter(g_isSmooth ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
-                newTexture.update(page._texture, {0, 0});
-                page._texture = std::move(newTexture);
-            }
-            else
-            {
-                // Oops, we've reached the maximum texture size...
-                return {{0, 0}, {2, 2}};
-            }
+        if (size.x * 2 > maxImageDimension || size.y * 2 > maxImageDimension || !this->resizePage(page, size * 2))
+        {
+            // Oops, we've reached the maximum texture size...
+            return {{0, 0}, {2, 2}};
         }
 
-        // We can now create the new row
-        page._rows.emplace_back(page._nextRow, rowHeight);
-        page._nextRow += rowHeight;
-        row = &page._rows.back();
+        rect = page._packer.insert(static_cast<int>(width), static_cast<int>(height));
     }
 
-    // Find the glyph's rectangle on the selected row
-    fge::RectInt rect(fge::Rect<unsigned int>({row->_width, row->_top}, {width, height}));
+    return *rect;
+}
 
-    // Update the row information
-    row->_width += width;
+bool FreeTypeFont::resizePage(Page& page, fge::Vector2i const& size) const
+{
+    auto const oldSize = page._packer.getSize();
+    std::vector<uint8_t> alpha(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y), 0);
 
-    return rect;
+    // Glyphs keep their position, only the texture coordinates are invalidated
+    for (int y = 0; y < oldSize.y; ++y)
+    {
+        std::memcpy(alpha.data() + static_cast<std::size_t>(y) * size.x,
+                    page._alpha.data() + static_cast<std::size_t>(y) * oldSize.x, static_cast<std::size_t>(oldSize.x));
+    }
+
+    auto const surface = ExpandAlpha(alpha, size);
+    if (surface.get() == nullptr)
+    {
+        return false;
+    }
+    page._alpha = std::move(alpha);
+    page._packer.grow(size);
+
+    page._texture.create(surface.get());
+    page._texture.setFilter(this->isPageSmooth() ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
+    page._revision = ++this->g_pageRevision;
+    return true;
 }
 
 bool FreeTypeFont::setCurrentSize(fge::CharacterSize characterSize) const
@@ -594,25 +1124,26 @@ bool FreeTypeFont::setCurrentSize(fge::CharacterSize characterSize) const
     return true;
 }
 
-FreeTypeFont::Page::Page(bool smooth) :
+FreeTypeFont::Page::Page(bool smooth, uint32_t revision) :
         _texture(fge::vulkan::GetActiveContext()),
-        _nextRow(3)
+        _packer({FGE_FONT_PAGE_DEFAULT_SIZE, FGE_FONT_PAGE_DEFAULT_SIZE}),
+        _revision(revision)
 {
     // Make sure that the texture is initialized by default
-    fge::Surface surface;
-    surface.create(128, 128, fge::Color(255, 255, 255, 0));
+    this->_alpha.assign(static_cast<std::size_t>(FGE_FONT_PAGE_DEFAULT_SIZE) * FGE_FONT_PAGE_DEFAULT_SIZE, 0);
 
     // Reserve a 2x2 white square for texturing underlines
     for (int x = 0; x < 2; ++x)
     {
         for (int y = 0; y < 2; ++y)
         {
-            surface.setPixel(x, y, fge::Color(255, 255, 255, 255));
+            this->_alpha[static_cast<std::size_t>(y) * FGE_FONT_PAGE_DEFAULT_SIZE + x] = 255;
         }
     }
+    (void) this->_packer.insert(3, 3);
 
     // Create the texture
-    this->_texture.create(surface.get());
+    this->_texture.create(ExpandAlpha(this->_alpha, this->_packer.getSize()).get());
     this->_texture.setFilter(smooth ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
 }
 
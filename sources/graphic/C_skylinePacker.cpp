@@ -0,0 +1,192 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/graphic/C_skylinePacker.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace fge
+{
+
+SkylinePacker::SkylinePacker(fge::Vector2i const& size)
+{
+    this->reset(size);
+}
+
+void SkylinePacker::reset(fge::Vector2i const& size)
+{
+    this->g_size = {std::max(size.x, 0), std::max(size.y, 0)};
+    this->g_nodes.clear();
+    if (this->g_size.x > 0)
+    {
+        this->g_nodes.push_back({0, 0, this->g_size.x});
+    }
+    this->g_usedArea = 0;
+}
+bool SkylinePacker::restore(fge::Vector2i const& size, std::vector<Node> nodes, std::size_t usedArea)
+{
+    //The nodes must be contiguous and inside the area
+    int x = 0;
+    for (auto const& node: nodes)
+    {
+        if (node._x != x || node._width <= 0 || node._y < 0 || node._y > size.y)
+        {
+            return false;
+        }
+        x += node._width;
+    }
+    if (x != size.x || usedArea > static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y))
+    {
+        return false;
+    }
+
+    this->g_size = size;
+    this->g_nodes = std::move(nodes);
+    this->g_usedArea = usedArea;
+    return true;
+}
+
+std::optional<fge::RectInt> SkylinePacker::insert(int width, int height)
+{
+    if (width <= 0 || height <= 0)
+    {
+        return std::nullopt;
+    }
+
+    //Bottom-left: the lowest top, then the narrowest segment to keep the wide ones for the wide rectangles
+    std::size_t bestIndex = this->g_nodes.size();
+    int bestTop = std::numeric_limits<int>::max();
+    int bestWidth = std::numeric_limits<int>::max();
+    int bestY = 0;
+
+    for (std::size_t i = 0; i < this->g_nodes.size(); ++i)
+    {
+        auto const y = this->fit(i, width, height);
+        if (!y)
+        {
+            continue;
+        }
+
+        auto const top = *y + height;
+        if (top < bestTop || (top == bestTop && this->g_nodes[i]._width < bestWidth))
+        {
+            bestIndex = i;
+            bestTop = top;
+            bestWidth = this->g_nodes[i]._width;
+            bestY = *y;
+        }
+    }
+
+    if (bestIndex == this->g_nodes.size())
+    {
+        return std::nullopt;
+    }
+
+    fge::RectInt const rect{{this->g_nodes[bestIndex]._x, bestY}, {width, height}};
+
+    //The new segment replace the covered part of the skyline
+    this->g_nodes.insert(this->g_nodes.begin() + static_cast<std::ptrdiff_t>(bestIndex), {rect._x, bestTop, width});
+    auto const right = rect._x + width;
+    for (std::size_t i = bestIndex + 1; i < this->g_nodes.size();)
+    {
+        auto& node = this->g_nodes[i];
+        if (node._x >= right)
+        {
+            break;
+        }
+
+        auto const shrink = right - node._x;
+        if (node._width <= shrink)
+        {
+            this->g_nodes.erase(this->g_nodes.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        node._x += shrink;
+        node._width -= shrink;
+        break;
+    }
+    this->mergeNodes();
+
+    this->g_usedArea += static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+    return rect;
+}
+void SkylinePacker::grow(fge::Vector2i const& size)
+{
+    if (size.x > this->g_size.x)
+    {
+        this->g_nodes.push_back({this->g_size.x, 0, size.x - this->g_size.x});
+        this->g_size.x = size.x;
+        this->mergeNodes();
+    }
+    this->g_size.y = std::max(this->g_size.y, size.y);
+}
+
+fge::Vector2i const& SkylinePacker::getSize() const
+{
+    return this->g_size;
+}
+std::vector<SkylinePacker::Node> const& SkylinePacker::getNodes() const
+{
+    return this->g_nodes;
+}
+std::size_t SkylinePacker::getUsedArea() const
+{
+    return this->g_usedArea;
+}
+float SkylinePacker::getOccupancy() const
+{
+    auto const area = static_cast<std::size_t>(this->g_size.x) * static_cast<std::size_t>(this->g_size.y);
+    return area == 0 ? 0.0f : static_cast<float>(this->g_usedArea) / static_cast<float>(area);
+}
+
+std::optional<int> SkylinePacker::fit(std::size_t index, int width, int height) const
+{
+    auto const x = this->g_nodes[index]._x;
+    if (x + width > this->g_size.x)
+    {
+        return std::nullopt;
+    }
+
+    //The rectangle rest on the highest segment under it
+    int y = 0;
+    int remainingWidth = width;
+    for (std::size_t i = index; remainingWidth > 0; ++i)
+    {
+        y = std::max(y, this->g_nodes[i]._y);
+        if (y + height > this->g_size.y)
+        {
+            return std::nullopt;
+        }
+        remainingWidth -= this->g_nodes[i]._width;
+    }
+    return y;
+}
+void SkylinePacker::mergeNodes()
+{
+    for (std::size_t i = 1; i < this->g_nodes.size();)
+    {
+        if (this->g_nodes[i - 1]._y == this->g_nodes[i]._y)
+        {
+            this->g_nodes[i - 1]._width += this->g_nodes[i]._width;
+            this->g_nodes.erase(this->g_nodes.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        ++i;
+    }
+}
+
+} // namespace fge
@@ -15,13 +15,98 @@
  */
 
 #include "FastEngine/graphic/C_surface.hpp"
+#include "FastEngine/graphic/pixelKernels.hpp"
 #include "SDL_image.h"
 #include "glm/ext/scalar_constants.hpp"
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace fge
 {
 
+namespace
+{
+
+bool HasDirectPixelAccess(SDL_Surface const* surface)
+{
+    return surface != nullptr && surface->format->BytesPerPixel == 4;
+}
+bool HasLastByteAlpha(SDL_Surface const* surface)
+{
+    //The alpha must be the fourth byte of a pixel in memory for the premultiply kernels
+    return HasDirectPixelAccess(surface) && surface->format->Amask == SDL_SwapLE32(0xFF000000u);
+}
+
+uint32_t* GetRow(SDL_Surface* surface, int y)
+{
+    return reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(surface->pixels) +
+                                       static_cast<std::ptrdiff_t>(y) * surface->pitch);
+}
+
+int64_t IntegerSqrt(int64_t value)
+{
+    auto root = static_cast<int64_t>(std::sqrt(static_cast<double>(value)));
+    while (root * root > value)
+    {
+        --root;
+    }
+    while ((root + 1) * (root + 1) <= value)
+    {
+        ++root;
+    }
+    return root;
+}
+
+/*
+ * Call func(row, y, begin, end) for every horizontal span of pixels with a distance to the center
+ * between innerRadius and outerRadius (inclusive), the spans are clipped to the surface.
+ * This replace a square root per pixel by a square root per row.
+ */
+template<class TFunc>
+void ForEachCircleSpan(SDL_Surface* surface,
+                       int x,
+                       int y,
+                       unsigned int innerRadius,
+                       unsigned int outerRadius,
+                       TFunc&& func)
+{
+    auto const innerRadius2 = static_cast<int64_t>(innerRadius) * innerRadius;
+    auto const outerRadius2 = static_cast<int64_t>(outerRadius) * outerRadius;
+
+    auto const callClipped = [&](uint32_t* row, int h, int64_t begin, int64_t end) {
+        begin = std::max<int64_t>(begin, 0);
+        end = std::min<int64_t>(end, surface->w);
+        if (begin < end)
+        {
+            func(row, h, static_cast<int>(begin), static_cast<int>(end));
+        }
+    };
+
+    auto const firstRow = static_cast<int>(std::max<int64_t>(static_cast<int64_t>(y) - outerRadius, 0));
+    auto const lastRow = static_cast<int>(std::min<int64_t>(static_cast<int64_t>(y) + outerRadius, surface->h - 1));
+    for (int h = firstRow; h <= lastRow; ++h)
+    {
+        auto const dy2 = static_cast<int64_t>(h - y) * (h - y);
+        auto const outerHalf = IntegerSqrt(outerRadius2 - dy2);
+        auto* row = GetRow(surface, h);
+
+        if (dy2 < innerRadius2)
+        {
+            //Largest distance on x that is still strictly inside the inner radius
+            auto const innerHalf = IntegerSqrt(innerRadius2 - dy2 - 1);
+            callClipped(row, h, static_cast<int64_t>(x) - outerHalf, static_cast<int64_t>(x) - innerHalf);
+            callClipped(row, h, static_cast<int64_t>(x) + innerHalf + 1, static_cast<int64_t>(x) + outerHalf + 1);
+        }
+        else
+        {
+            callClipped(row, h, static_cast<int64_t>(x) - outerHalf, static_cast<int64_t>(x) + outerHalf + 1);
+        }
+    }
+}
+
+} // namespace
+
 Surface::Surface() :
         g_surface(nullptr)
 {}
@@ -137,23 +222,45 @@ fge::Vector2i Surface::getSize() const
 
 void Surface::createMaskFromColor(fge::Color const& color, uint8_t alpha)
 {
-    if (this->g_surface == nullptr)
+    if (!HasDirectPixelAccess(this->g_surface))
     {
         return;
     }
 
+    auto const key = SDL_MapRGBA(this->g_surface->format, color._r, color._g, color._b, color._a);
+    auto const replacement = SDL_MapRGBA(this->g_surface->format, color._r, color._g, color._b, alpha);
+
     for (int h = 0; h < this->g_surface->h; ++h)
     {
-        for (int w = 0; w < this->g_surface->w; ++w)
-        {
-            auto pixel = this->getPixel(w, h).value();
-            if (pixel == color)
-            {
-                pixel._a = alpha;
-                this->setPixel(w, h, pixel);
-            }
-        }
+        fge::pixel::ReplaceRow(GetRow(this->g_surface, h), this->g_surface->w, key, replacement);
+    }
+}
+
+bool Surface::premultiplyAlpha()
+{
+    if (!HasLastByteAlpha(this->g_surface))
+    {
+        return false;
+    }
+
+    for (int h = 0; h < this->g_surface->h; ++h)
+    {
+        fge::pixel::PremultiplyRow(GetRow(this->g_surface, h), this->g_surface->w);
+    }
+    return true;
+}
+bool Surface::unpremultiplyAlpha()
+{
+    if (!HasLastByteAlpha(this->g_surface))
+    {
+        return false;
     }
+
+    for (int h = 0; h < this->g_surface->h; ++h)
+    {
+        fge::pixel::UnpremultiplyRow(GetRow(this->g_surface, h), this->g_surface->w);
+    }
+    return true;
 }
 
 bool Surface::setPixel(int x, int y, fge::Color const& color)
@@ -199,60 +306,33 @@ std::optional<fge::Color> Surface::getPixel(int x, int y) const
 
 void Surface::setCircle(int x, int y, unsigned int radius, fge::Color const& color)
 {
-    if (this->g_surface == nullptr || radius == 0)
-    {
-        return;
-    }
-
-    for (int h = 0; h < this->g_surface->h; ++h)
-    {
-        for (int w = 0; w < this->g_surface->w; ++w)
-        {
-            if (std::sqrt((w - x) * (w - x) + (h - y) * (h - y)) <= radius)
-            {
-                this->setPixel(w, h, color);
-            }
-        }
-    }
+    this->addCircle(x, y, radius, color);
 }
 
 void Surface::flipHorizontally()
 {
-    if (this->g_surface == nullptr)
+    if (!HasDirectPixelAccess(this->g_surface))
     {
         return;
     }
 
     for (int h = 0; h < this->g_surface->h; ++h)
     {
-        for (int w = 0; w < this->g_surface->w / 2; ++w)
-        {
-            auto pixelLeft = this->getPixel(w, h).value();
-            auto pixelRight = this->getPixel(this->g_surface->w - w - 1, h).value();
-
-            this->setPixel(w, h, pixelRight);
-            this->setPixel(this->g_surface->w - w - 1, h, pixelLeft);
-        }
+        fge::pixel::ReverseRow(GetRow(this->g_surface, h), this->g_surface->w);
     }
 }
 
 void Surface::flipVertically()
 {
-    if (this->g_surface == nullptr)
+    if (!HasDirectPixelAccess(this->g_surface))
     {
         return;
     }
 
-    for (int w = 0; w < this->g_surface->w; ++w)
+    for (int h = 0; h < this->g_surface->h / 2; ++h)
     {
-        for (int h = 0; h < this->g_surface->h / 2; ++h)
-        {
-            auto pixelTop = this->getPixel(w, h).value();
-            auto pixelBottom = this->getPixel(w, this->g_surface->h - h - 1).value();
-
-            this->setPixel(w, h, pixelBottom);
-            this->setPixel(w, this->g_surface->h - h - 1, pixelTop);
-        }
+        fge::pixel::SwapRows(GetRow(this->g_surface, h), GetRow(this->g_surface, this->g_surface->h - h - 1),
+                             this->g_surface->w);
     }
 }
 
@@ -279,7 +359,7 @@ void Surface::stretch(int width, int height)
 }
 void Surface::shear(float angle, ShearBaseSides side)
 {
-    if (this->g_surface == nullptr)
+    if (!HasDirectPixelAccess(this->g_surface))
     {
         return;
     }
@@ -289,8 +369,10 @@ void Surface::shear(float angle, ShearBaseSides side)
     //Compute the new width after shear
     int const deltaWidth = static_cast<int>(std::tan(std::abs(angle)) * static_cast<float>(this->g_surface->h));
 
-    Surface shearedSurface(deltaWidth + this->g_surface->w, this->g_surface->h, Color::Transparent);
-    if (shearedSurface.get() == nullptr)
+    //Same format as the source, so rows can be copied as they are
+    Surface shearedSurface(SDL_CreateRGBSurfaceWithFormat(0, deltaWidth + this->g_surface->w, this->g_surface->h, 32,
+                                                          this->g_surface->format->format));
+    if (!shearedSurface.fillRect(std::nullopt, Color::Transparent))
     {
         return;
     }
@@ -311,12 +393,10 @@ void Surface::shear(float angle, ShearBaseSides side)
         {
             offset += deltaWidth;
         }
+        offset = std::clamp(offset, 0, deltaWidth);
 
-        for (int w = 0; w < this->g_surface->w; ++w)
-        {
-            auto pixel = this->getPixel(w, h).value();
-            shearedSurface.setPixel(w + offset, h, pixel);
-        }
+        std::memcpy(GetRow(shearedSurface.get(), h) + offset, GetRow(this->g_surface, h),
+                    static_cast<std::size_t>(this->g_surface->w) * sizeof(uint32_t));
     }
 
     *this = std::move(shearedSurface);
@@ -370,22 +450,16 @@ bool Surface::addBorder(int borderSize, fge::Color const& color)
 
 void Surface::addCircle(int x, int y, unsigned int radius, fge::Color const& color)
 {
-    if (this->g_surface == nullptr || radius == 0)
+    if (!HasDirectPixelAccess(this->g_surface) || radius == 0)
     {
         return;
     }
 
-    for (int h = 0; h < this->g_surface->h; ++h)
-    {
-        for (int w = 0; w < this->g_surface->w; ++w)
-        {
-            if (std::sqrt(static_cast<float>((w - x) * (w - x)) + static_cast<float>((h - y) * (h - y))) <=
-                static_cast<float>(radius))
-            {
-                this->setPixel(w, h, color);
-            }
-        }
-    }
+    auto const pixel = SDL_MapRGBA(this->g_surface->format, color._r, color._g, color._b, color._a);
+    ForEachCircleSpan(this->g_surface, x, y, 0, radius,
+                      [pixel](uint32_t* row, [[maybe_unused]] int h, int begin, int end) {
+        fge::pixel::FillRow(row + begin, static_cast<std::size_t>(end - begin), pixel);
+    });
 }
 
 void Surface::addUnfilledCircle(int x,
@@ -396,7 +470,7 @@ void Surface::addUnfilledCircle(int x,
                                 AngleDirections direction,
                                 fge::Color const& color)
 {
-    if (this->g_surface == nullptr || radius == 0)
+    if (!HasDirectPixelAccess(this->g_surface) || radius == 0)
     {
         return;
     }
@@ -421,9 +495,9 @@ void Surface::addUnfilledCircle(int x,
         return;
     }
 
-    for (int h = 0; h < this->g_surface->h; ++h)
-    {
-        for (int w = 0; w < this->g_surface->w; ++w)
+    auto const pixel = SDL_MapRGBA(this->g_surface->format, color._r, color._g, color._b, color._a);
+    ForEachCircleSpan(this->g_surface, x, y, 0, radius, [&](uint32_t* row, int h, int begin, int end) {
+        for (int w = begin; w < end; ++w)
         {
             float angle = std::atan2(static_cast<float>(h - y), static_cast<float>(w - x)) * 180.0f / glm::pi<float>();
             if (angle < 0.0f)
@@ -435,35 +509,26 @@ void Surface::addUnfilledCircle(int x,
                 angle = 360.0f - angle;
             }
 
-            if (std::sqrt(static_cast<float>((w - x) * (w - x)) + static_cast<float>((h - y) * (h - y))) <=
-                        static_cast<float>(radius) &&
-                angle >= startAngle && angle <= endAngle)
+            if (angle >= startAngle && angle <= endAngle)
             {
-                this->setPixel(w, h, color);
+                row[w] = pixel;
             }
         }
-    }
+    });
 }
 
 void Surface::addHollowCircle(int x, int y, unsigned int startRadius, unsigned int endRadius, fge::Color const& color)
 {
-    if (this->g_surface == nullptr || startRadius == 0 || endRadius == 0 || endRadius <= startRadius)
+    if (!HasDirectPixelAccess(this->g_surface) || startRadius == 0 || endRadius == 0 || endRadius <= startRadius)
     {
         return;
     }
 
-    for (int h = 0; h < this->g_surface->h; ++h)
-    {
-        for (int w = 0; w < this->g_surface->w; ++w)
-        {
-            auto const distance =
-                    std::sqrt(static_cast<float>((w - x) * (w - x)) + static_cast<float>((h - y) * (h - y)));
-            if (distance >= static_cast<float>(startRadius) && distance <= static_cast<float>(endRadius))
-            {
-                this->setPixel(w, h, color);
-            }
-        }
-    }
+    auto const pixel = SDL_MapRGBA(this->g_surface->format, color._r, color._g, color._b, color._a);
+    ForEachCircleSpan(this->g_surface, x, y, startRadius, endRadius,
+                      [pixel](uint32_t* row, [[maybe_unused]] int h, int begin, int end) {
+        fge::pixel::FillRow(row + begin, static_cast<std::size_t>(end - begin), pixel);
+    });
 }
 
 void Surface::addUnfilledHollowCircle(int x,
@@ -475,7 +540,7 @@ void Surface::addUnfilledHollowCircle(int x,
                                       AngleDirections direction,
                                       fge::Color const& color)
 {
-    if (this->g_surface == nullptr || startRadius == 0 || endRadius == 0 || endRadius <= startRadius)
+    if (!HasDirectPixelAccess(this->g_surface) || startRadius == 0 || endRadius == 0 || endRadius <= startRadius)
     {
         return;
     }
@@ -500,9 +565,9 @@ void Surface::addUnfilledHollowCircle(int x,
         return;
     }
 
-    for (int h = 0; h < this->g_surface->h; ++h)
-    {
-        for (int w = 0; w < this->g_surface->w; ++w)
+    auto const pixel = SDL_MapRGBA(this->g_surface->format, color._r, color._g, color._b, color._a);
+    ForEachCircleSpan(this->g_surface, x, y, startRadius, endRadius, [&](uint32_t* row, int h, int begin, int end) {
+        for (int w = begin; w < end; ++w)
         {
             float angle = std::atan2(static_cast<float>(h - y), static_cast<float>(w - x)) * 180.0f / glm::pi<float>();
             if (angle < 0.0f)
@@ -514,15 +579,12 @@ void Surface::addUnfilledHollowCircle(int x,
                 angle = 360.0f - angle;
             }
 
-            auto const distance =
-                    std::sqrt(static_cast<float>((w - x) * (w - x)) + static_cast<float>((h - y) * (h - y)));
-            if (distance >= static_cast<float>(startRadius) && distance <= static_cast<float>(endRadius) &&
-                angle >= startAngle && angle <= endAngle)
+            if (angle >= startAngle && angle <= endAngle)
             {
-                this->setPixel(w, h, color);
+                row[w] = pixel;
             }
         }
-    }
+    });
 }
 
 void Surface::set(SDL_Surface* surface)
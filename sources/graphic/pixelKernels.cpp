@@ -0,0 +1,394 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/graphic/pixelKernels.hpp"
+#include <algorithm>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define FGE_PIXEL_AVX2
+    #define FGE_PIXEL_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define FGE_PIXEL_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define FGE_PIXEL_NEON
+#endif
+
+namespace fge::pixel
+{
+
+namespace
+{
+
+//Scalar helpers, used for the remaining pixels of a row and by the scalar fallback
+
+inline uint8_t MultiplyChannel(uint32_t channel, uint32_t alpha)
+{
+    //Exact rounded division by 255
+    uint32_t const t = channel * alpha + 128;
+    return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+}
+
+void PremultiplyScalar(uint32_t* row, std::size_t count)
+{
+    auto* bytes = reinterpret_cast<uint8_t*>(row);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto* pixel = bytes + i * 4;
+        uint32_t const alpha = pixel[3];
+        pixel[0] = MultiplyChannel(pixel[0], alpha);
+        pixel[1] = MultiplyChannel(pixel[1], alpha);
+        pixel[2] = MultiplyChannel(pixel[2], alpha);
+    }
+}
+
+void UnpremultiplyScalar(uint32_t* row, std::size_t count)
+{
+    auto* bytes = reinterpret_cast<uint8_t*>(row);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto* pixel = bytes + i * 4;
+        if (pixel[3] == 0)
+        {
+            pixel[0] = pixel[1] = pixel[2] = 0;
+            continue;
+        }
+
+        //Same operations as the SIMD version, so both give the same results
+        float const scale = 255.0f / static_cast<float>(pixel[3]);
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            pixel[c] = static_cast<uint8_t>(std::min(static_cast<float>(pixel[c]) * scale + 0.5f, 255.0f));
+        }
+    }
+}
+
+#ifdef FGE_PIXEL_SSE2
+inline __m128i PremultiplyPixels16(__m128i pixels16)
+{
+    //pixels16 contains 2 pixels with 16 bits channels, the alpha lane is multiplied by 255 to keep it unchanged
+    __m128i const keepMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+    __m128i const alphaLane = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+
+    __m128i alpha =
+            _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_or_si128(_mm_and_si128(alpha, keepMask), alphaLane);
+
+    __m128i const t = _mm_add_epi16(_mm_mullo_epi16(pixels16, alpha), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+inline __m128i UnpremultiplyPixel32(__m128i pixel32)
+{
+    //pixel32 contains 1 pixel with 32 bits channels
+    __m128i const alphaMask = _mm_setr_epi32(0, 0, 0, -1);
+
+    __m128 const channels = _mm_cvtepi32_ps(pixel32);
+    __m128 const alpha = _mm_shuffle_ps(channels, channels, _MM_SHUFFLE(3, 3, 3, 3));
+    __m128 const scale = _mm_div_ps(_mm_set1_ps(255.0f), alpha);
+
+    __m128 result = _mm_min_ps(_mm_add_ps(_mm_mul_ps(channels, scale), _mm_set1_ps(0.5f)), _mm_set1_ps(255.0f));
+    //A null alpha gives a null color
+    result = _mm_and_ps(result, _mm_cmpneq_ps(alpha, _mm_setzero_ps()));
+
+    __m128i const converted = _mm_cvttps_epi32(result);
+    return _mm_or_si128(_mm_andnot_si128(alphaMask, converted), _mm_and_si128(alphaMask, pixel32));
+}
+#endif //FGE_PIXEL_SSE2
+
+#ifdef FGE_PIXEL_AVX2
+inline __m256i PremultiplyPixels16(__m256i pixels16)
+{
+    __m256i const keepMask = _mm256_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0);
+    __m256i const alphaLane = _mm256_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255);
+
+    __m256i alpha =
+            _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(pixels16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_or_si256(_mm256_and_si256(alpha, keepMask), alphaLane);
+
+    __m256i const t = _mm256_add_epi16(_mm256_mullo_epi16(pixels16, alpha), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+#endif //FGE_PIXEL_AVX2
+
+#ifdef FGE_PIXEL_NEON
+inline uint8x16_t MultiplyChannels(uint8x16_t channels, uint8x16_t alpha)
+{
+    uint16x8_t low = vaddq_u16(vmull_u8(vget_low_u8(channels), vget_low_u8(alpha)), vdupq_n_u16(128));
+    uint16x8_t high = vaddq_u16(vmull_u8(vget_high_u8(channels), vget_high_u8(alpha)), vdupq_n_u16(128));
+    low = vshrq_n_u16(vaddq_u16(low, vshrq_n_u16(low, 8)), 8);
+    high = vshrq_n_u16(vaddq_u16(high, vshrq_n_u16(high, 8)), 8);
+    return vcombine_u8(vmovn_u16(low), vmovn_u16(high));
+}
+#endif //FGE_PIXEL_NEON
+
+} // namespace
+
+char const* GetKernelsInstructionSet()
+{
+#if defined(FGE_PIXEL_AVX2)
+    return "AVX2";
+#elif defined(FGE_PIXEL_SSE2)
+    return "SSE2";
+#elif defined(FGE_PIXEL_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+void ReverseRow(uint32_t* row, std::size_t count)
+{
+    std::size_t left = 0;
+    std::size_t right = count;
+
+    //Blocks are taken from both ends, reversed and swapped
+#ifdef FGE_PIXEL_AVX2
+    __m256i const reverseIndices = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    while (right - left >= 16)
+    {
+        __m256i const blockLeft = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(row + left));
+        __m256i const blockRight = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(row + right - 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + left),
+                            _mm256_permutevar8x32_epi32(blockRight, reverseIndices));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + right - 8),
+                            _mm256_permutevar8x32_epi32(blockLeft, reverseIndices));
+        left += 8;
+        right -= 8;
+    }
+#endif
+#if defined(FGE_PIXEL_SSE2)
+    while (right - left >= 8)
+    {
+        __m128i const blockLeft = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row + left));
+        __m128i const blockRight = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row + right - 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + left),
+                         _mm_shuffle_epi32(blockRight, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + right - 4),
+                         _mm_shuffle_epi32(blockLeft, _MM_SHUFFLE(0, 1, 2, 3)));
+        left += 4;
+        right -= 4;
+    }
+#elif defined(FGE_PIXEL_NEON)
+    auto const reverse = [](uint32x4_t block) {
+        block = vrev64q_u32(block);
+        return vcombine_u32(vget_high_u32(block), vget_low_u32(block));
+    };
+    while (right - left >= 8)
+    {
+        uint32x4_t const blockLeft = vld1q_u32(row + left);
+        uint32x4_t const blockRight = vld1q_u32(row + right - 4);
+        vst1q_u32(row + left, reverse(blockRight));
+        vst1q_u32(row + right - 4, reverse(blockLeft));
+        left += 4;
+        right -= 4;
+    }
+#endif
+    std::reverse(row + left, row + right);
+}
+
+void SwapRows(uint32_t* rowA, uint32_t* rowB, std::size_t count)
+{
+    //Compilers already vectorize this loop with the enabled instruction set
+    std::swap_ranges(rowA, rowA + count, rowB);
+}
+
+void FillRow(uint32_t* row, std::size_t count, uint32_t pixel)
+{
+    //Compilers already vectorize this loop with the enabled instruction set
+    std::fill_n(row, count, pixel);
+}
+
+void ReplaceRow(uint32_t* row, std::size_t count, uint32_t key, uint32_t replacement)
+{
+    std::size_t i = 0;
+
+#if defined(FGE_PIXEL_AVX2)
+    __m256i const keys = _mm256_set1_epi32(static_cast<int>(key));
+    __m256i const replacements = _mm256_set1_epi32(static_cast<int>(replacement));
+    for (; i + 8 <= count; i += 8)
+    {
+        auto* block = reinterpret_cast<__m256i*>(row + i);
+        __m256i const pixels = _mm256_loadu_si256(block);
+        __m256i const mask = _mm256_cmpeq_epi32(pixels, keys);
+        _mm256_storeu_si256(block, _mm256_blendv_epi8(pixels, replacements, mask));
+    }
+#elif defined(FGE_PIXEL_SSE2)
+    __m128i const keys = _mm_set1_epi32(static_cast<int>(key));
+    __m128i const replacements = _mm_set1_epi32(static_cast<int>(replacement));
+    for (; i + 4 <= count; i += 4)
+    {
+        auto* block = reinterpret_cast<__m128i*>(row + i);
+        __m128i const pixels = _mm_loadu_si128(block);
+        __m128i const mask = _mm_cmpeq_epi32(pixels, keys);
+        _mm_storeu_si128(block, _mm_or_si128(_mm_andnot_si128(mask, pixels), _mm_and_si128(mask, replacements)));
+    }
+#elif defined(FGE_PIXEL_NEON)
+    uint32x4_t const keys = vdupq_n_u32(key);
+    uint32x4_t const replacements = vdupq_n_u32(replacement);
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32x4_t const pixels = vld1q_u32(row + i);
+        vst1q_u32(row + i, vbslq_u32(vceqq_u32(pixels, keys), replacements, pixels));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        if (row[i] == key)
+        {
+            row[i] = replacement;
+        }
+    }
+}
+
+void PremultiplyRow(uint32_t* row, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if defined(FGE_PIXEL_AVX2)
+    __m256i const zero = _mm256_setzero_si256();
+    for (; i + 8 <= count; i += 8)
+    {
+        auto* block = reinterpret_cast<__m256i*>(row + i);
+        __m256i const pixels = _mm256_loadu_si256(block);
+        __m256i const low = PremultiplyPixels16(_mm256_unpacklo_epi8(pixels, zero));
+        __m256i const high = PremultiplyPixels16(_mm256_unpackhi_epi8(pixels, zero));
+        //Unpack and pack both work per 128 bits lane, so the pixel order is preserved
+        _mm256_storeu_si256(block, _mm256_packus_epi16(low, high));
+    }
+#elif defined(FGE_PIXEL_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4)
+    {
+        auto* block = reinterpret_cast<__m128i*>(row + i);
+        __m128i const pixels = _mm_loadu_si128(block);
+        __m128i const low = PremultiplyPixels16(_mm_unpacklo_epi8(pixels, zero));
+        __m128i const high = PremultiplyPixels16(_mm_unpackhi_epi8(pixels, zero));
+        _mm_storeu_si128(block, _mm_packus_epi16(low, high));
+    }
+#elif defined(FGE_PIXEL_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        auto* bytes = reinterpret_cast<uint8_t*>(row + i);
+        uint8x16x4_t pixels = vld4q_u8(bytes);
+        pixels.val[0] = MultiplyChannels(pixels.val[0], pixels.val[3]);
+        pixels.val[1] = MultiplyChannels(pixels.val[1], pixels.val[3]);
+        pixels.val[2] = MultiplyChannels(pixels.val[2], pixels.val[3]);
+        vst4q_u8(bytes, pixels);
+    }
+#endif
+
+    PremultiplyScalar(row + i, count - i);
+}
+
+void UnpremultiplyRow(uint32_t* row, std::size_t count)
+{
+    std::size_t i = 0;
+
+    //The division is done with floats, the AVX2 build use the SSE2 kernel as 128 bits lanes hold a single pixel
+#ifdef FGE_PIXEL_SSE2
+    __m128i const zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4)
+    {
+        auto* block = reinterpret_cast<__m128i*>(row + i);
+        __m128i const pixels = _mm_loadu_si128(block);
+        __m128i const low = _mm_unpacklo_epi8(pixels, zero);
+        __m128i const high = _mm_unpackhi_epi8(pixels, zero);
+
+        __m128i const pixel0 = UnpremultiplyPixel32(_mm_unpacklo_epi16(low, zero));
+        __m128i const pixel1 = UnpremultiplyPixel32(_mm_unpackhi_epi16(low, zero));
+        __m128i const pixel2 = UnpremultiplyPixel32(_mm_unpacklo_epi16(high, zero));
+        __m128i const pixel3 = UnpremultiplyPixel32(_mm_unpackhi_epi16(high, zero));
+
+        _mm_storeu_si128(block, _mm_packus_epi16(_mm_packs_epi32(pixel0, pixel1), _mm_packs_epi32(pixel2, pixel3)));
+    }
+#endif
+
+    UnpremultiplyScalar(row + i, count - i);
+}
+
+void DownsampleRows(uint32_t const* rowA, uint32_t const* rowB, std::size_t srcCount, uint32_t* dst)
+{
+    if (srcCount == 0)
+    {
+        return;
+    }
+
+    std::size_t const dstCount = std::max<std::size_t>(srcCount / 2, 1);
+    std::size_t i = 0;
+
+    //Only full 2x2 blocks are handled here, the AVX2 build use the SSE2 kernel
+#if defined(FGE_PIXEL_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const bias = _mm_set1_epi16(2);
+    for (; i + 2 <= dstCount && 2 * i + 4 <= srcCount; i += 2)
+    {
+        __m128i const pixelsA = _mm_loadu_si128(reinterpret_cast<__m128i const*>(rowA + 2 * i));
+        __m128i const pixelsB = _mm_loadu_si128(reinterpret_cast<__m128i const*>(rowB + 2 * i));
+
+        //Vertical sums, 2 pixels per register
+        __m128i const sumLow = _mm_add_epi16(_mm_unpacklo_epi8(pixelsA, zero), _mm_unpacklo_epi8(pixelsB, zero));
+        __m128i const sumHigh = _mm_add_epi16(_mm_unpackhi_epi8(pixelsA, zero), _mm_unpackhi_epi8(pixelsB, zero));
+
+        //Horizontal sums of adjacent pixels
+        __m128i const sum0 = _mm_add_epi16(sumLow, _mm_srli_si128(sumLow, 8));
+        __m128i const sum1 = _mm_add_epi16(sumHigh, _mm_srli_si128(sumHigh, 8));
+
+        __m128i const average = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(sum0, sum1), bias), 2);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(average, average));
+    }
+#elif defined(FGE_PIXEL_NEON)
+    for (; i + 4 <= dstCount && 2 * i + 8 <= srcCount; i += 4)
+    {
+        //Even and odd pixels are deinterleaved
+        uint32x4x2_t const pixelsA = vld2q_u32(rowA + 2 * i);
+        uint32x4x2_t const pixelsB = vld2q_u32(rowB + 2 * i);
+
+        uint8x16_t const evenA = vreinterpretq_u8_u32(pixelsA.val[0]);
+        uint8x16_t const oddA = vreinterpretq_u8_u32(pixelsA.val[1]);
+        uint8x16_t const evenB = vreinterpretq_u8_u32(pixelsB.val[0]);
+        uint8x16_t const oddB = vreinterpretq_u8_u32(pixelsB.val[1]);
+
+        uint16x8_t low = vaddl_u8(vget_low_u8(evenA), vget_low_u8(oddA));
+        low = vaddw_u8(vaddw_u8(low, vget_low_u8(evenB)), vget_low_u8(oddB));
+        uint16x8_t high = vaddl_u8(vget_high_u8(evenA), vget_high_u8(oddA));
+        high = vaddw_u8(vaddw_u8(high, vget_high_u8(evenB)), vget_high_u8(oddB));
+
+        //Rounding shift, (sum + 2) >> 2
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), vcombine_u8(vrshrn_n_u16(low, 2), vrshrn_n_u16(high, 2)));
+    }
+#endif
+
+    auto const* bytesA = reinterpret_cast<uint8_t const*>(rowA);
+    auto const* bytesB = reinterpret_cast<uint8_t const*>(rowB);
+    auto* bytesDst = reinterpret_cast<uint8_t*>(dst);
+    for (; i < dstCount; ++i)
+    {
+        std::size_t const x0 = 2 * i * 4;
+        std::size_t const x1 = std::min(2 * i + 1, srcCount - 1) * 4;
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            uint32_t const sum = bytesA[x0 + c] + bytesA[x1 + c] + bytesB[x0 + c] + bytesB[x1 + c];
+            bytesDst[i * 4 + c] = static_cast<uint8_t>((sum + 2) >> 2);
+        }
+    }
+}
+
+} // namespace fge::pixel
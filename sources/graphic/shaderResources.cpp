@@ -84,6 +84,57 @@ void main() {
 )";
 const unsigned int gDefaultFragmentTextureShaderSize = sizeof(gDefaultFragmentTextureShader)-1;
 
+const char gDefaultSdfFragmentShader[] = R"(
+#version 450
+
+layout(location = 0) in vec4 fragColor;
+layout(location = 1) in vec2 fragTexCoord;
+
+layout(location = 0) out vec4 outColor;
+
+layout(set = 1, binding = 0) uniform sampler2D texSampler;
+
+layout(push_constant) uniform Constants {
+    vec4 outlineColor;
+    vec4 shadowColor;
+    vec2 shadowOffset;
+    float outlineWidth;
+} constants;
+
+const float edgeDistance = 128.0/255.0;
+
+void main() {
+    float dist = texture(texSampler, fragTexCoord).a - edgeDistance;
+    float smoothing = max(fwidth(dist) * 0.7, 0.0001);
+
+    // The empty texels around the glyph (at -edgeDistance) must stay outside of the outline
+    float outlineWidth = clamp(constants.outlineWidth, 0.0, max(edgeDistance - smoothing, 0.0));
+
+    float fillAlpha = smoothstep(-smoothing, smoothing, dist);
+    float outlineAlpha = smoothstep(-smoothing, smoothing, dist + outlineWidth);
+
+    vec4 color = fragColor;
+    if (outlineWidth > 0.0)
+    {
+        color = mix(constants.outlineColor, fragColor, fillAlpha);
+        color.a *= outlineAlpha;
+    }
+    else
+    {
+        color.a *= fillAlpha;
+    }
+
+    float shadowDistance = texture(texSampler, fragTexCoord - constants.shadowOffset).a - edgeDistance;
+    float shadowAlpha = constants.shadowColor.a *
+                        smoothstep(-smoothing, smoothing, shadowDistance + outlineWidth);
+
+    float alpha = color.a + shadowAlpha * (1.0 - color.a);
+    vec3 rgb = color.rgb * color.a + constants.shadowColor.rgb * shadowAlpha * (1.0 - color.a);
+    outColor = vec4(alpha > 0.0 ? rgb / alpha : color.rgb, alpha);
+}
+)";
+const unsigned int gDefaultSdfFragmentShaderSize = sizeof(gDefaultSdfFragmentShader)-1;
+
 // clang-format on
 
 } // namespace fge::res
\ No newline at end of file
@@ -21,10 +21,191 @@
 #include "FastEngine/vulkan/vulkanGlobal.hpp"
 
 #include "json.hpp"
+#include <algorithm>
 
 namespace fge::anim
 {
 
+namespace
+{
+
+struct AtlasEntry
+{
+    std::filesystem::path const* _path{nullptr};
+    fge::Surface _surface;
+    fge::RectInt _rect;
+};
+
+std::shared_ptr<fge::TextureType> CreateTexture(fge::Surface&& surface)
+{
+#ifdef FGE_DEF_SERVER
+    return std::make_shared<fge::TextureType>(std::move(surface));
+#else
+    auto texture = std::make_shared<fge::TextureType>(vulkan::GetActiveContext());
+    if (texture->create(surface.get()))
+    {
+        return texture;
+    }
+    return fge::texture::gManager.getBadElement()->_ptr;
+#endif //FGE_DEF_SERVER
+}
+
+/**
+ * \brief Place the entries in rows of decreasing height
+ *
+ * \param entries The entries to place, their rectangle is set
+ * \param order The entries indices sorted by decreasing height
+ * \param width The width of the atlas
+ * \return The height of the atlas
+ */
+int PackAtlasRows(std::vector<AtlasEntry>& entries, std::vector<std::size_t> const& order, int width)
+{
+    int rowX = 0;
+    int rowY = 0;
+    int rowHeight = 0;
+
+    for (auto const index: order)
+    {
+        auto& entry = entries[index];
+        auto const size = entry._surface.getSize();
+
+        if (rowX + size.x > width)
+        { //Next row
+            rowY += rowHeight + FGE_ANIM_ATLAS_PADDING;
+            rowX = 0;
+            rowHeight = 0;
+        }
+
+        entry._rect = {{rowX, rowY}, size};
+        rowX += size.x + FGE_ANIM_ATLAS_PADDING;
+        rowHeight = std::max(rowHeight, size.y);
+    }
+
+    return rowY + rowHeight;
+}
+
+/**
+ * \brief Load the textures of a separate files animation into one atlas texture
+ *
+ * Every distinct frame file is loaded once, the frames are packed in rows and the frames
+ * of the animation share the resulting texture with their own rectangle.
+ *
+ * \param animData The animation with the frames path set
+ */
+void LoadFramesAtlas(AnimationData& animData)
+{
+    auto const& badTexture = fge::texture::gManager.getBadElement()->_ptr;
+
+    //Loading every distinct file once
+    std::vector<AtlasEntry> entries;
+    std::vector<std::size_t> frameEntries;
+    for (auto const& group: animData._groups)
+    {
+        for (auto const& frame: group._frames)
+        {
+            auto it = std::find_if(entries.begin(), entries.end(),
+                                   [&](AtlasEntry const& entry) { return *entry._path == frame._path; });
+            if (it == entries.end())
+            {
+                auto& entry = entries.emplace_back();
+                entry._path = &frame._path;
+                if (!entry._surface.loadFromFile(frame._path))
+                {
+                    entry._surface.clear();
+                }
+                frameEntries.push_back(entries.size() - 1);
+            }
+            else
+            {
+                frameEntries.push_back(static_cast<std::size_t>(it - entries.begin()));
+            }
+        }
+    }
+
+    std::vector<std::size_t> order;
+    int64_t area = 0;
+    int maxWidth = 0;
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        if (entries[i]._surface.get() != nullptr)
+        {
+            auto const size = entries[i]._surface.getSize();
+            area += static_cast<int64_t>(size.x + FGE_ANIM_ATLAS_PADDING) * (size.y + FGE_ANIM_ATLAS_PADDING);
+            maxWidth = std::max(maxWidth, size.x);
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return entries[a]._surface.getSize().y > entries[b]._surface.getSize().y;
+    });
+
+    int maxSize = FGE_ANIM_ATLAS_MAX_SIZE;
+#ifndef FGE_DEF_SERVER
+    maxSize = std::min(maxSize,
+                       static_cast<int>(vulkan::GetActiveContext().getPhysicalDevice().getMaxImageDimension2D()));
+#endif //FGE_DEF_SERVER
+
+    //Starting with a square atlas, the width is doubled until the height fit
+    int width = 1;
+    while (width < maxWidth || static_cast<int64_t>(width) * width < area)
+    {
+        width *= 2;
+    }
+    int height = 0;
+    for (; width <= maxSize; width *= 2)
+    {
+        height = PackAtlasRows(entries, order, width);
+        if (height <= maxSize)
+        {
+            break;
+        }
+    }
+
+    std::vector<std::shared_ptr<fge::TextureType>> entryTextures(entries.size(), badTexture);
+    if (!order.empty() && width <= maxSize)
+    {
+        fge::Surface atlas{width, height, fge::Color{0, 0, 0, 0}};
+        for (auto const index: order)
+        {
+            auto& entry = entries[index];
+            //Copying the pixels as they are, without blending them with the transparent atlas
+            SDL_SetSurfaceBlendMode(entry._surface.get(), SDL_BLENDMODE_NONE);
+            std::optional<SDL_Rect> dstRect{SDL_Rect{entry._rect._x, entry._rect._y, 0, 0}};
+            atlas.blitSurface(entry._surface, std::nullopt, dstRect);
+        }
+
+        auto atlasTexture = CreateTexture(std::move(atlas));
+        for (auto const index: order)
+        {
+            entryTextures[index] = atlasTexture;
+        }
+    }
+    else
+    { //The frames are too big for an atlas, every frame get its own texture
+        for (auto const index: order)
+        {
+            auto& entry = entries[index];
+            entry._rect = {{0, 0}, entry._surface.getSize()};
+            entryTextures[index] = CreateTexture(std::move(entry._surface));
+        }
+    }
+
+    std::size_t frameIndex = 0;
+    for (auto& group: animData._groups)
+    {
+        for (auto& frame: group._frames)
+        {
+            auto const entryIndex = frameEntries[frameIndex++];
+            frame._texture = entryTextures[entryIndex];
+            frame._textureRect = entryTextures[entryIndex] == badTexture
+                                         ? fge::RectInt{{0, 0}, static_cast<fge::Vector2i>(badTexture->getSize())}
+                                         : entries[entryIndex]._rect;
+        }
+    }
+}
+
+} // namespace
+
 bool AnimationManager::initialize()
 {
     if (this->isInitialized())
@@ -148,23 +329,9 @@ bool AnimationManager::loadFromFile(std::string_view name, std::filesystem::path
                         jsonFrame.value<fge::Vector2u>("position", FGE_NUMERIC_LIMITS_VECTOR_MAX(fge::Vector2u));
                 break;
             case AnimationType::ANIM_TYPE_SEPARATE_FILES:
+                //Textures are loaded once every frame is known, see LoadFramesAtlas
                 frame._path = fge::MakeRelativePathToBasePathIfExist(
                         block->_path, jsonFrame.value<std::filesystem::path>("path", {}));
-                {
-                    fge::Surface textureSurface;
-                    if (textureSurface.loadFromFile(frame._path))
-                    {
-#ifdef FGE_DEF_SERVER
-                        frame._texture = std::make_shared<fge::TextureType>(std::move(textureSurface));
-#else
-                        auto texture = std::make_shared<fge::TextureType>(vulkan::GetActiveContext());
-                        if (texture->create(textureSurface.get()))
-                        {
-                            frame._texture = std::move(texture);
-                        }
-#endif //FGE_DEF_SERVER
-                    }
-                }
                 break;
             }
 
@@ -174,6 +341,11 @@ bool AnimationManager::loadFromFile(std::string_view name, std::filesystem::path
         animData._groups.push_back(std::move(group));
     }
 
+    if (type == AnimationType::ANIM_TYPE_SEPARATE_FILES)
+    {
+        LoadFramesAtlas(animData);
+    }
+
     return this->push(name, std::move(block));
 }
 
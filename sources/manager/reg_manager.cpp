@@ -15,7 +15,6 @@
  */
 
 #include "FastEngine/manager/reg_manager.hpp"
-#include "FastEngine/string_hash.hpp"
 
 #include "FastEngine/C_scene.hpp"
 #include <unordered_map>
@@ -27,7 +26,7 @@ namespace fge::reg
 namespace
 {
 
-using ClassNameMapType = std::unordered_map<std::string, fge::reg::ClassId, fge::StringHash, std::equal_to<>>;
+using ClassNameMapType = std::unordered_map<fge::StringId, fge::reg::ClassId>;
 using ClassIdMapType = std::vector<std::unique_ptr<fge::reg::BaseStamp>>;
 
 ClassNameMapType _dataClassNameMap;
@@ -43,18 +42,22 @@ void ClearAll()
 
 bool RegisterNewClass(std::unique_ptr<fge::reg::BaseStamp>&& newStamp)
 {
-    if (fge::reg::Check(newStamp->getClassName()))
+    if (fge::reg::Check(newStamp->getClassNameId()))
     {
         return false;
     }
 
-    _dataClassNameMap[newStamp->getClassName()] = static_cast<fge::reg::ClassId>(_dataClassIdMap.size());
+    _dataClassNameMap[newStamp->getClassNameId()] = static_cast<fge::reg::ClassId>(_dataClassIdMap.size());
     _dataClassIdMap.push_back(std::move(newStamp));
 
     return true;
 }
 
 bool Check(std::string_view className)
+{
+    return fge::reg::Check(fge::StringId{className});
+}
+bool Check(fge::StringId className)
 {
     return _dataClassNameMap.find(className) != _dataClassNameMap.cend();
 }
@@ -65,7 +68,7 @@ bool Check(fge::reg::ClassId classId)
 
 fge::Object* Duplicate(fge::Object const* obj)
 {
-    auto it = _dataClassNameMap.find(obj->getClassName());
+    auto it = _dataClassNameMap.find(fge::StringId{obj->getClassName()});
 
     if (it != _dataClassNameMap.cend())
     {
@@ -76,7 +79,7 @@ fge::Object* Duplicate(fge::Object const* obj)
 
 bool Replace(std::string_view className, std::unique_ptr<fge::reg::BaseStamp>&& newStamp)
 {
-    auto it = _dataClassNameMap.find(className);
+    auto it = _dataClassNameMap.find(fge::StringId{className});
 
     if (it != _dataClassNameMap.cend())
     {
@@ -101,6 +104,10 @@ std::size_t GetRegisterSize()
 }
 
 fge::Object* GetNewClassOf(std::string_view className)
+{
+    return fge::reg::GetNewClassOf(fge::StringId{className});
+}
+fge::Object* GetNewClassOf(fge::StringId className)
 {
     auto it = _dataClassNameMap.find(className);
 
@@ -120,6 +127,10 @@ fge::Object* GetNewClassOf(fge::reg::ClassId classId)
 }
 
 fge::reg::ClassId GetClassId(std::string_view className)
+{
+    return fge::reg::GetClassId(fge::StringId{className});
+}
+fge::reg::ClassId GetClassId(fge::StringId className)
 {
     auto it = _dataClassNameMap.find(className);
 
@@ -139,6 +150,10 @@ std::string GetClassName(fge::reg::ClassId classId)
 }
 
 fge::reg::BaseStamp* GetStampOf(std::string_view className)
+{
+    return fge::reg::GetStampOf(fge::StringId{className});
+}
+fge::reg::BaseStamp* GetStampOf(fge::StringId className)
 {
     auto it = _dataClassNameMap.find(className);
 
@@ -268,6 +268,14 @@ bool ShaderManager::initialize()
         this->_g_badElement.reset();
         return false;
     }
+    if (!this->loadFromMemory(FGE_SHADER_DEFAULT_SDF_FRAGMENT, fge::res::gDefaultSdfFragmentShader,
+                              static_cast<int>(fge::res::gDefaultSdfFragmentShaderSize),
+                              fge::vulkan::Shader::Type::SHADER_FRAGMENT, ShaderInputTypes::SHADER_GLSL))
+    {
+        this->unloadAll();
+        this->_g_badElement.reset();
+        return false;
+    }
 
     return true;
 }
@@ -17,6 +17,9 @@
 #include "FastEngine/manager/texture_manager.hpp"
 #include "FastEngine/vulkan/vulkanGlobal.hpp"
 #include "SDL_image.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
 
 namespace fge::texture
 {
@@ -27,6 +30,14 @@ namespace
 std::mutex gSDLImageHandlerMutex;
 unsigned int gSDLImageHandlerCounter = 0;
 
+bool IsTextureDataFile(std::filesystem::path const& path)
+{
+    auto extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".ktx2" || extension == ".dds";
+}
+
 } // namespace
 
 bool TextureManager::initialize()
@@ -113,8 +124,64 @@ bool TextureManager::loadFromSurface(std::string_view name, fge::Surface const&
     return this->push(name, std::move(block));
 }
 
+bool TextureManager::loadFromTextureData(std::string_view name, fge::vulkan::TextureData const& data)
+{
+    if (name.empty() || !data.isValid())
+    {
+        return false;
+    }
+
+#ifdef FGE_DEF_SERVER
+    if (data.isCompressed())
+    {
+        return false;
+    }
+
+    auto const& level = data.getLevel(0);
+    auto tmpTexture = std::make_shared<DataType>();
+    if (!tmpTexture->create(level._size.x, level._size.y))
+    {
+        return false;
+    }
+
+    auto* surface = tmpTexture->get();
+    auto const* levelData = data.getLevelData(0);
+    auto const rowSize = static_cast<std::size_t>(level._size.x) * 4;
+    for (int y = 0; y < level._size.y; ++y)
+    {
+        std::memcpy(static_cast<uint8_t*>(surface->pixels) + static_cast<std::size_t>(y) * surface->pitch,
+                    levelData + static_cast<std::size_t>(y) * rowSize, rowSize);
+    }
+#else
+    auto tmpTexture = std::make_shared<DataType>(vulkan::GetActiveContext());
+
+    if (!tmpTexture->create(data))
+    {
+        return false;
+    }
+#endif //FGE_DEF_SERVER
+
+    DataBlockPointer block = std::make_shared<DataBlockType>();
+    block->_ptr = std::move(tmpTexture);
+    block->_valid = true;
+
+    return this->push(name, std::move(block));
+}
+
 bool TextureManager::loadFromFile(std::string_view name, std::filesystem::path const& path)
 {
+    if (IsTextureDataFile(path))
+    {
+        fge::vulkan::TextureData tmpData;
+
+        if (!tmpData.loadFromFile(path))
+        {
+            return false;
+        }
+
+        return this->loadFromTextureData(name, tmpData);
+    }
+
     fge::Surface tmpSurface;
 
     if (!tmpSurface.loadFromFile(path))
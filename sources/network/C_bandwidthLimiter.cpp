@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/network/C_bandwidthLimiter.hpp"
+#include <algorithm>
+
+namespace fge::net
+{
+
+void BandwidthLimiter::setConfig(BandwidthLimiterConfig const& config)
+{
+    std::scoped_lock const lock(this->g_mutex);
+    this->g_config = config;
+    this->g_config._minRate = std::min(this->g_config._minRate, this->g_config._maxRate);
+    this->g_rate = static_cast<double>(this->g_config._maxRate);
+    this->g_tokens = static_cast<double>(this->g_config._burstSize);
+    this->g_lastRefill = std::chrono::steady_clock::now();
+    this->g_lastLoss = {};
+}
+BandwidthLimiterConfig BandwidthLimiter::getConfig() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_config;
+}
+bool BandwidthLimiter::isEnabled() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_config._maxRate != 0;
+}
+
+bool BandwidthLimiter::tryAcquire(TimePoint const& timePoint)
+{
+    std::scoped_lock const lock(this->g_mutex);
+    if (this->g_config._maxRate == 0)
+    {
+        return true;
+    }
+
+    this->refill(timePoint);
+    if (this->g_tokens > 0.0)
+    {
+        return true;
+    }
+    ++this->g_throttledCount;
+    return false;
+}
+void BandwidthLimiter::consume(std::size_t size)
+{
+    std::scoped_lock const lock(this->g_mutex);
+    ++this->g_sentPackets;
+    this->g_sentBytes += size;
+    if (this->g_config._maxRate != 0)
+    {
+        this->g_tokens -= static_cast<double>(size);
+    }
+}
+void BandwidthLimiter::reportLoss(TimePoint const& timePoint)
+{
+    std::scoped_lock const lock(this->g_mutex);
+    ++this->g_lossCount;
+    if (this->g_config._maxRate == 0 || !this->g_config._adaptive)
+    {
+        return;
+    }
+
+    //A burst of losses is generally caused by the same congestion
+    if (timePoint - this->g_lastLoss < FGE_NET_BANDWIDTH_LOSS_COOLDOWN)
+    {
+        return;
+    }
+    this->refill(timePoint);
+    this->g_lastLoss = timePoint;
+    this->g_rate = std::max(this->g_rate * static_cast<double>(this->g_config._decreaseFactor),
+                            static_cast<double>(this->g_config._minRate));
+}
+
+uint32_t BandwidthLimiter::getRate() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return static_cast<uint32_t>(this->g_rate);
+}
+uint64_t BandwidthLimiter::getSentPackets() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_sentPackets;
+}
+uint64_t BandwidthLimiter::getSentBytes() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_sentBytes;
+}
+uint64_t BandwidthLimiter::getThrottledCount() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_throttledCount;
+}
+uint64_t BandwidthLimiter::getLossCount() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_lossCount;
+}
+
+void BandwidthLimiter::resetCounters()
+{
+    std::scoped_lock const lock(this->g_mutex);
+    this->g_sentPackets = 0;
+    this->g_sentBytes = 0;
+    this->g_throttledCount = 0;
+    this->g_lossCount = 0;
+}
+
+void BandwidthLimiter::refill(TimePoint const& timePoint)
+{
+    if (timePoint <= this->g_lastRefill)
+    {
+        return;
+    }
+    double const elapsed = std::chrono::duration<double>(timePoint - this->g_lastRefill).count();
+    this->g_lastRefill = timePoint;
+
+    //Additive increase when there is no recent loss
+    auto const maxRate = static_cast<double>(this->g_config._maxRate);
+    if (this->g_config._adaptive && this->g_rate < maxRate &&
+        timePoint - this->g_lastLoss >= FGE_NET_BANDWIDTH_LOSS_COOLDOWN)
+    {
+        this->g_rate = std::min(
+                this->g_rate + maxRate * static_cast<double>(this->g_config._recoveryRatio) * elapsed, maxRate);
+    }
+
+    this->g_tokens =
+            std::min(this->g_tokens + this->g_rate * elapsed, static_cast<double>(this->g_config._burstSize));
+}
+
+} // namespace fge::net
@@ -17,6 +17,7 @@
 #include "FastEngine/network/C_client.hpp"
 #include "FastEngine/network/C_server.hpp"
 #include "private/fge_crypt.hpp"
+#include <algorithm>
 #include <limits>
 
 #include "private/fge_debug.hpp"
@@ -223,7 +224,12 @@ Latency_ms Client::computeLatency_ms(Timestamp const& sentTimestamp, Timestamp c
 void Client::clearPackets()
 {
     std::scoped_lock const lck(this->g_mutex);
-    this->g_pendingTransmitPackets.clear();
+    this->g_pendingForcedPackets.clear();
+    for (auto& queue: this->g_pendingTransmitPackets)
+    {
+        queue.clear();
+    }
+    this->g_pendingBytes = 0;
 }
 void Client::pushPacket(TransmitPacketPtr pck)
 {
@@ -240,19 +246,12 @@ void Client::pushPacket(TransmitPacketPtr pck)
 
     std::scoped_lock const lck(this->g_mutex);
 
-    pck->setRealm(this->getCurrentRealm());
-    pck->setCounter(this->advancePacketCounter(Targets::HOST));
-
-    if (!pck->checkFlags(FGE_NET_HEADER_DO_NOT_REORDER_FLAG))
-    {
-        pck->setReorderedCounter(this->advanceReorderedPacketCounter(Targets::HOST));
-    }
-
     if (this->g_status.isInEncryptedState())
     {
         pck->markForEncryption();
     }
-    this->g_pendingTransmitPackets.push_back(std::move(pck));
+    this->g_pendingBytes += pck->getDataSize();
+    this->g_pendingTransmitPackets[static_cast<std::size_t>(pck->getPriority())].push_back(std::move(pck));
 }
 void Client::pushForcedFrontPacket(TransmitPacketPtr pck)
 {
@@ -263,35 +262,78 @@ void Client::pushForcedFrontPacket(TransmitPacketPtr pck)
     }
 
     std::scoped_lock const lck(this->g_mutex);
-    this->g_pendingTransmitPackets.push_front(std::move(pck));
+    this->g_pendingBytes += pck->getDataSize();
+    this->g_pendingForcedPackets.push_front(std::move(pck));
 }
 bool Client::isReadyToAcceptMorePendingPackets() const
 {
     std::scoped_lock const lck(this->g_mutex);
-    return this->g_allowMorePackets && this->g_pendingTransmitPackets.empty();
+    return this->g_allowMorePackets && this->isPendingPacketsEmpty();
 }
 TransmitPacketPtr Client::popPacket()
 {
     std::scoped_lock const lck(this->g_mutex);
 
-    if (this->g_pendingTransmitPackets.empty())
+    TransmitPacketPtr packet;
+    if (!this->g_pendingForcedPackets.empty())
+    { //Already have a realm and counters
+        packet = std::move(this->g_pendingForcedPackets.front());
+        this->g_pendingForcedPackets.pop_front();
+    }
+    else
     {
-        return nullptr;
+        auto queue = std::ranges::find_if(this->g_pendingTransmitPackets,
+                                          [](auto const& pendingQueue) { return !pendingQueue.empty(); });
+        if (queue == this->g_pendingTransmitPackets.end())
+        {
+            return nullptr;
+        }
+        packet = std::move(queue->front());
+        queue->pop_front();
+
+        //Counters are set in the transmission order, so the peer don't see prioritized packets as reordered
+        packet->setRealm(this->getCurrentRealm());
+        packet->setCounter(this->advancePacketCounter(Targets::HOST));
+        if (!packet->checkFlags(FGE_NET_HEADER_DO_NOT_REORDER_FLAG))
+        {
+            packet->setReorderedCounter(this->advanceReorderedPacketCounter(Targets::HOST));
+        }
     }
-    auto packet = std::move(this->g_pendingTransmitPackets.front());
-    this->g_pendingTransmitPackets.pop_front();
+
+    this->g_pendingBytes -= std::min(this->g_pendingBytes, packet->getDataSize());
     return packet;
 }
 bool Client::isPendingPacketsEmpty() const
 {
     std::scoped_lock const lck(this->g_mutex);
-    return this->g_pendingTransmitPackets.empty();
+    return this->g_pendingForcedPackets.empty() &&
+           std::ranges::all_of(this->g_pendingTransmitPackets, [](auto const& queue) { return queue.empty(); });
 }
 void Client::allowMorePendingPackets(bool allow)
 {
     std::scoped_lock const lck(this->g_mutex);
     this->g_allowMorePackets = allow;
 }
+ClientQueueMetrics Client::getQueueMetrics() const
+{
+    ClientQueueMetrics metrics{};
+    {
+        std::scoped_lock const lck(this->g_mutex);
+        for (std::size_t i = 0; i < ProtocolPacket::PriorityCount; ++i)
+        {
+            metrics._pendingPackets[i] = this->g_pendingTransmitPackets[i].size();
+        }
+        metrics._pendingForcedPackets = this->g_pendingForcedPackets.size();
+        metrics._pendingBytes = this->g_pendingBytes;
+    }
+
+    auto const& limiter = this->_context._bandwidthLimiter;
+    metrics._sentPackets = limiter.getSentPackets();
+    metrics._sentBytes = limiter.getSentBytes();
+    metrics._throttledCount = limiter.getThrottledCount();
+    metrics._bandwidthRate = limiter.getRate();
+    return metrics;
+}
 
 void Client::disconnect(bool pushDisconnectPacket)
 {
@@ -411,10 +453,20 @@ std::unordered_set<PacketCache::Label, PacketCache::Label::Hash> const& Client::
 {
     return this->g_acknowledgedPackets;
 }
+void Client::acknowledgeFragmentReception(ReceivedPacketPtr const& packet)
+{
+    std::scoped_lock const lck(this->g_mutex);
+    this->g_acknowledgedFragments.emplace(packet->retrieveCounter().value(), packet->retrieveRealm().value());
+}
+std::unordered_set<PacketCache::Label, PacketCache::Label::Hash> const& Client::getAcknowledgedFragmentList() const
+{
+    return this->g_acknowledgedFragments;
+}
 void Client::clearAcknowledgedList()
 {
     std::scoped_lock const lck(this->g_mutex);
     this->g_acknowledgedPackets.clear();
+    this->g_acknowledgedFragments.clear();
 }
 
 void Client::clearLostPacketCount()
@@ -426,6 +478,7 @@ uint32_t Client::advanceLostPacketCount()
 {
     std::scoped_lock const lck(this->g_mutex);
     ++this->g_lostPacketCount;
+    this->_context._bandwidthLimiter.reportLoss();
     if (this->g_lostPacketCount != 0 && this->g_lostPacketCount % this->g_lostPacketThreshold == 0)
     {
         this->_onThresholdLostPacket.call(*this);
@@ -586,9 +639,9 @@ void OneWayLatencyPlanner::unpack(ProtocolPacket* packet, Client& client)
                                   ? FGE_NET_DEFAULT_LATENCY
                                   : ((this->g_roundTripTime.value() - latencyCorrector) / 2);
 
-        //Compute time offset
+        //Compute time offset, the packet have been sent "latency" ms ago by the other side
         FullTimestampOffset const clockOffset = static_cast<FullTimestampOffset>(Client::getFullTimestamp_ms()) -
-                                                static_cast<FullTimestampOffset>(fullTimestamp) +
+                                                static_cast<FullTimestampOffset>(fullTimestamp) -
                                                 this->g_latency.value();
         if (this->g_clockOffsetCount == this->g_clockOffsets.max_size())
         {
@@ -607,12 +660,12 @@ void OneWayLatencyPlanner::unpack(ProtocolPacket* packet, Client& client)
         }
 
         //Compute new offset
-        FullTimestamp result = 0;
+        FullTimestampOffset result = 0;
         for (std::size_t i = 0; i < this->g_clockOffsetCount; ++i)
         {
             result += this->g_clockOffsets[i];
         }
-        this->g_meanClockOffset = result / this->g_clockOffsetCount;
+        this->g_meanClockOffset = result / static_cast<FullTimestampOffset>(this->g_clockOffsetCount);
     }
 }
 
@@ -620,6 +673,14 @@ std::optional<FullTimestampOffset> OneWayLatencyPlanner::getClockOffset() const
 {
     return this->g_meanClockOffset;
 }
+std::optional<FullTimestamp> OneWayLatencyPlanner::getOtherSideTimestamp_ms(FullTimestamp localTimestamp) const
+{
+    if (!this->g_meanClockOffset)
+    {
+        return std::nullopt;
+    }
+    return static_cast<FullTimestamp>(static_cast<FullTimestampOffset>(localTimestamp) - *this->g_meanClockOffset);
+}
 std::optional<Latency_ms> OneWayLatencyPlanner::getLatency() const
 {
     return this->g_latency;
@@ -0,0 +1,298 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/network/C_compressionPolicy.hpp"
+
+namespace fge::net
+{
+
+namespace
+{
+
+[[nodiscard]] inline std::size_t ToIndex(CompressionPolicy::Codecs codec)
+{
+    return static_cast<std::size_t>(codec);
+}
+
+} // namespace
+
+//CompressionStats
+
+void CompressionStats::add(std::size_t rawSize, std::size_t compressedSize, std::chrono::nanoseconds cpuTime)
+{
+    this->g_packetCount.fetch_add(1, std::memory_order_relaxed);
+    this->g_rawBytes.fetch_add(rawSize, std::memory_order_relaxed);
+    this->g_compressedBytes.fetch_add(compressedSize, std::memory_order_relaxed);
+    this->g_cpuTime_ns.fetch_add(static_cast<uint64_t>(cpuTime.count()), std::memory_order_relaxed);
+}
+void CompressionStats::reset()
+{
+    this->g_packetCount = 0;
+    this->g_rawBytes = 0;
+    this->g_compressedBytes = 0;
+    this->g_cpuTime_ns = 0;
+}
+
+uint64_t CompressionStats::getPacketCount() const
+{
+    return this->g_packetCount.load(std::memory_order_relaxed);
+}
+uint64_t CompressionStats::getRawBytes() const
+{
+    return this->g_rawBytes.load(std::memory_order_relaxed);
+}
+uint64_t CompressionStats::getCompressedBytes() const
+{
+    return this->g_compressedBytes.load(std::memory_order_relaxed);
+}
+std::chrono::nanoseconds CompressionStats::getCpuTime() const
+{
+    return std::chrono::nanoseconds{this->g_cpuTime_ns.load(std::memory_order_relaxed)};
+}
+
+float CompressionStats::getRatio() const
+{
+    auto const rawBytes = this->getRawBytes();
+    if (rawBytes == 0)
+    {
+        return 1.0f;
+    }
+    return static_cast<float>(this->getCompressedBytes()) / static_cast<float>(rawBytes);
+}
+std::chrono::nanoseconds CompressionStats::getMeanCpuTime() const
+{
+    auto const packetCount = this->getPacketCount();
+    if (packetCount == 0)
+    {
+        return std::chrono::nanoseconds::zero();
+    }
+    return this->getCpuTime() / packetCount;
+}
+
+//CompressionPolicy
+
+void CompressionPolicy::setConfig(CompressionPolicyConfig const& config)
+{
+    std::scoped_lock const lock(this->g_mutex);
+    this->g_config = config;
+}
+CompressionPolicyConfig CompressionPolicy::getConfig() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_config;
+}
+
+CompressionPolicy::Codecs CompressionPolicy::choose(std::size_t payloadSize)
+{
+    std::scoped_lock const lock(this->g_mutex);
+
+    if (!this->g_config._enabled)
+    {
+        this->g_skipCounters[static_cast<std::size_t>(SkipReasons::DISABLED)].fetch_add(1, std::memory_order_relaxed);
+        return Codecs::NONE;
+    }
+    if (payloadSize < this->g_config._minPayloadSize)
+    {
+        this->g_skipCounters[static_cast<std::size_t>(SkipReasons::TOO_SMALL)].fetch_add(1, std::memory_order_relaxed);
+        return Codecs::NONE;
+    }
+
+    bool const highCompressionEligible = payloadSize >= this->g_config._highCompressionMinPayloadSize;
+
+    //Codecs without estimate are tried first
+    if (!this->g_estimates[ToIndex(Codecs::LZ4)]._valid)
+    {
+        return Codecs::LZ4;
+    }
+    if (highCompressionEligible && !this->g_estimates[ToIndex(Codecs::LZ4HC)]._valid)
+    {
+        return Codecs::LZ4HC;
+    }
+
+    //Choose the acceptable codec that save the most bytes
+    auto chosen = Codecs::NONE;
+    float bestRatio = 1.0f;
+    if (this->isAcceptable(Codecs::LZ4, payloadSize))
+    {
+        chosen = Codecs::LZ4;
+        bestRatio = this->g_estimates[ToIndex(Codecs::LZ4)]._ratio;
+    }
+    if (highCompressionEligible && this->isAcceptable(Codecs::LZ4HC, payloadSize) &&
+        this->g_estimates[ToIndex(Codecs::LZ4HC)]._ratio < bestRatio)
+    {
+        chosen = Codecs::LZ4HC;
+    }
+
+    //Periodically probe the rejected codecs in order to refresh their estimate
+    if (chosen != Codecs::LZ4 && this->shouldProbe(Codecs::LZ4))
+    {
+        this->g_estimates[ToIndex(Codecs::LZ4)]._valid = false;
+        return Codecs::LZ4;
+    }
+    if (highCompressionEligible && chosen != Codecs::LZ4HC && this->shouldProbe(Codecs::LZ4HC))
+    {
+        this->g_estimates[ToIndex(Codecs::LZ4HC)]._valid = false;
+        return Codecs::LZ4HC;
+    }
+
+    if (chosen == Codecs::NONE)
+    {
+        this->g_skipCounters[static_cast<std::size_t>(SkipReasons::NOT_PROFITABLE)].fetch_add(
+                1, std::memory_order_relaxed);
+    }
+    return chosen;
+}
+void CompressionPolicy::report(Codecs codec,
+                               std::size_t rawSize,
+                               std::size_t compressedSize,
+                               std::chrono::nanoseconds cpuTime)
+{
+    if (codec == Codecs::NONE || rawSize == 0)
+    {
+        return;
+    }
+
+    auto const ratio = static_cast<float>(compressedSize) / static_cast<float>(rawSize);
+    auto const cpuTimePerByte = static_cast<float>(cpuTime.count()) / static_cast<float>(rawSize);
+
+    std::scoped_lock const lock(this->g_mutex);
+    auto& estimate = this->g_estimates[ToIndex(codec)];
+    if (!estimate._valid)
+    {
+        estimate._ratio = ratio;
+        estimate._cpuTimePerByte_ns = cpuTimePerByte;
+        estimate._valid = true;
+        return;
+    }
+
+    estimate._ratio += (ratio - estimate._ratio) * FGE_NET_COMPRESSION_ESTIMATE_SMOOTHING;
+    estimate._cpuTimePerByte_ns +=
+            (cpuTimePerByte - estimate._cpuTimePerByte_ns) * FGE_NET_COMPRESSION_ESTIMATE_SMOOTHING;
+}
+
+bool CompressionPolicy::compress(ProtocolPacket& packet, CompressorLZ4& lz4, CompressorLZ4HC& lz4hc)
+{
+    if (!packet.haveCorrectHeaderSize())
+    {
+        return false;
+    }
+    if (packet.checkFlags(FGE_NET_HEADER_COMPRESSED_FLAG))
+    {
+        return true; //Already compressed
+    }
+
+    auto const payloadSize = packet.getDataSize() - ProtocolPacket::HeaderSize;
+    if (payloadSize == 0)
+    {
+        return true;
+    }
+
+    auto const codec = this->choose(payloadSize);
+    if (codec == Codecs::NONE)
+    {
+        this->g_stats[ToIndex(Codecs::NONE)].add(payloadSize, payloadSize, std::chrono::nanoseconds::zero());
+        return true;
+    }
+
+    Compressor& compressor = codec == Codecs::LZ4HC ? static_cast<Compressor&>(lz4hc) : lz4;
+
+    auto const compressionStart = std::chrono::steady_clock::now();
+    if (!packet.compress(compressor, codec))
+    {
+        return false;
+    }
+    auto const cpuTime = std::chrono::steady_clock::now() - compressionStart;
+
+    auto const compressedSize = compressor.getBuffer().size() + sizeof(Codecs);
+    this->report(codec, payloadSize, compressedSize, cpuTime);
+
+    if (!packet.checkFlags(FGE_NET_HEADER_COMPRESSED_FLAG))
+    { //The packet was left uncompressed as it would have expanded
+        this->g_skipCounters[static_cast<std::size_t>(SkipReasons::EXPANDED)].fetch_add(1, std::memory_order_relaxed);
+        this->g_stats[ToIndex(Codecs::NONE)].add(payloadSize, payloadSize, cpuTime);
+        return true;
+    }
+
+    this->g_stats[ToIndex(codec)].add(payloadSize, compressedSize, cpuTime);
+    return true;
+}
+
+CompressionStats const& CompressionPolicy::getStats(Codecs codec) const
+{
+    return this->g_stats[ToIndex(codec)];
+}
+uint64_t CompressionPolicy::getSkipCount(SkipReasons reason) const
+{
+    return this->g_skipCounters[static_cast<std::size_t>(reason)].load(std::memory_order_relaxed);
+}
+CompressionPolicy::Estimate CompressionPolicy::getEstimate(Codecs codec) const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_estimates[ToIndex(codec)];
+}
+float CompressionPolicy::getOverallRatio() const
+{
+    uint64_t rawBytes = 0;
+    uint64_t compressedBytes = 0;
+    for (auto const& stats: this->g_stats)
+    {
+        rawBytes += stats.getRawBytes();
+        compressedBytes += stats.getCompressedBytes();
+    }
+    if (rawBytes == 0)
+    {
+        return 1.0f;
+    }
+    return static_cast<float>(compressedBytes) / static_cast<float>(rawBytes);
+}
+
+void CompressionPolicy::resetCounters()
+{
+    for (auto& stats: this->g_stats)
+    {
+        stats.reset();
+    }
+    for (auto& counter: this->g_skipCounters)
+    {
+        counter = 0;
+    }
+}
+
+bool CompressionPolicy::isAcceptable(Codecs codec, std::size_t payloadSize) const
+{
+    auto const& estimate = this->g_estimates[ToIndex(codec)];
+    auto const gain = 1.0f - estimate._ratio;
+    if (gain < this->g_config._minGain)
+    {
+        return false;
+    }
+
+    auto const savedBytes = gain * static_cast<float>(payloadSize);
+    auto const cpuTime_ns = estimate._cpuTimePerByte_ns * static_cast<float>(payloadSize);
+    return cpuTime_ns <= savedBytes * this->g_config._maxCpuTimePerSavedByte_ns;
+}
+bool CompressionPolicy::shouldProbe(Codecs codec)
+{
+    auto& counter = this->g_probeCounters[ToIndex(codec)];
+    if (++counter >= this->g_config._probeInterval)
+    {
+        counter = 0;
+        return true;
+    }
+    return false;
+}
+
+} // namespace fge::net
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastEngine/network/C_cryptWorkerPool.hpp"
+#include "private/fge_crypt.hpp"
+#include "private/fge_debug.hpp"
+#include <algorithm>
+#include <iterator>
+
+using namespace fge::priv;
+
+namespace fge::net
+{
+
+CryptWorkerPool::~CryptWorkerPool()
+{
+    this->stop();
+}
+
+bool CryptWorkerPool::start(std::size_t threadCount, DecryptedCallback onDecrypted, EncryptedCallback onEncrypted)
+{
+    if (this->g_running || threadCount == 0)
+    {
+        return false;
+    }
+
+    this->g_onDecrypted = std::move(onDecrypted);
+    this->g_onEncrypted = std::move(onEncrypted);
+    this->g_running = true;
+
+    this->g_workers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        this->g_workers.push_back(std::make_unique<Worker>());
+    }
+    for (auto& worker: this->g_workers)
+    {
+        worker->_thread = std::thread(&CryptWorkerPool::threadWorker, this, std::ref(*worker));
+    }
+    return true;
+}
+void CryptWorkerPool::stop()
+{
+    if (!this->g_running)
+    {
+        return;
+    }
+
+    this->g_running = false;
+    for (auto& worker: this->g_workers)
+    {
+        {
+            std::scoped_lock const lock(worker->_mutex);
+            worker->_jobs.clear();
+        }
+        worker->_notifier.notify_all();
+        worker->_thread.join();
+    }
+    this->g_workers.clear();
+
+    std::scoped_lock const lock(this->g_mutexEncrypted);
+    this->g_encryptedPackets.clear();
+}
+
+bool CryptWorkerPool::isRunning() const
+{
+    return this->g_running;
+}
+std::size_t CryptWorkerPool::getThreadCount() const
+{
+    return this->g_workers.size();
+}
+
+void CryptWorkerPool::pushEncrypt(ClientSharedPtr const& client, Identity const& identity, TransmitPacketPtr&& packet)
+{
+    this->pushJob({Job::Types::ENCRYPT, client, identity, std::move(packet)});
+}
+void CryptWorkerPool::pushDecrypt(ClientSharedPtr const& client, ReceivedPacketPtr&& packet)
+{
+    auto const identity = packet->getIdentity();
+    this->pushJob({Job::Types::DECRYPT, client, identity, std::move(packet)});
+}
+
+std::size_t CryptWorkerPool::popEncrypted(std::vector<EncryptedPacket>& packets)
+{
+    std::scoped_lock const lock(this->g_mutexEncrypted);
+    auto const count = this->g_encryptedPackets.size();
+    if (packets.empty())
+    {
+        packets.swap(this->g_encryptedPackets);
+    }
+    else
+    {
+        std::move(this->g_encryptedPackets.begin(), this->g_encryptedPackets.end(), std::back_inserter(packets));
+        this->g_encryptedPackets.clear();
+    }
+    return count;
+}
+
+void CryptWorkerPool::pushJob(Job&& job)
+{
+    if (!this->g_running)
+    {
+        return;
+    }
+
+    //Sharding by identity, every job of a client is handled by the same worker
+    auto& worker = *this->g_workers[IdentityHash{}(job._identity) % this->g_workers.size()];
+    {
+        std::scoped_lock const lock(worker._mutex);
+        worker._jobs.push_back(std::move(job));
+    }
+    worker._notifier.notify_one();
+}
+
+void CryptWorkerPool::threadWorker(Worker& worker)
+{
+    std::deque<Job> jobs;
+    std::vector<EncryptedPacket> encryptedPackets;
+
+    while (this->g_running)
+    {
+        {
+            std::unique_lock lock(worker._mutex);
+            worker._notifier.wait(lock, [&]() { return !worker._jobs.empty() || !this->g_running; });
+            jobs.swap(worker._jobs);
+        }
+
+        for (auto& job: jobs)
+        {
+            if (job._type == Job::Types::ENCRYPT)
+            {
+                if (!CryptEncrypt(*job._client, *job._packet))
+                {
+                    FGE_DEBUG_PRINT("Error while encrypting a packet");
+                    continue;
+                }
+                encryptedPackets.push_back({std::move(job._packet), job._identity});
+            }
+            else
+            {
+                if (!CryptDecrypt(*job._client, *job._packet))
+                {
+                    continue;
+                }
+                this->g_onDecrypted(job._client, std::move(job._packet));
+            }
+        }
+        jobs.clear();
+
+        //Give back the encrypted packets as a batch
+        if (!encryptedPackets.empty())
+        {
+            {
+                std::scoped_lock const lock(this->g_mutexEncrypted);
+                std::move(encryptedPackets.begin(), encryptedPackets.end(),
+                          std::back_inserter(this->g_encryptedPackets));
+            }
+            encryptedPackets.clear();
+            this->g_onEncrypted();
+        }
+    }
+}
+
+} // namespace fge::net
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/network/C_linkConditioner.hpp"
+#include <algorithm>
+
+namespace fge::net
+{
+
+LinkConditioner::LinkConditioner() :
+        g_random(fge::GetThreadRandom().rand<uint64_t>())
+{}
+
+void LinkConditioner::setConfig(LinkConditionerConfig const& config)
+{
+    std::scoped_lock const lock(this->g_mutex);
+    this->g_config = config;
+    this->g_config._lossRate = std::clamp(this->g_config._lossRate, 0.0f, 1.0f);
+    this->g_config._duplicateRate = std::clamp(this->g_config._duplicateRate, 0.0f, 1.0f);
+    this->g_config._reorderRate = std::clamp(this->g_config._reorderRate, 0.0f, 1.0f);
+}
+LinkConditionerConfig LinkConditioner::getConfig() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_config;
+}
+bool LinkConditioner::isEnabled() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_config._enabled;
+}
+
+void LinkConditioner::setSeed(uint64_t seed)
+{
+    std::scoped_lock const lock(this->g_mutex);
+    this->g_random.setSeed(seed);
+}
+
+bool LinkConditioner::push(Packet& pck, Identity const& id, TimePoint const& timePoint)
+{
+    std::scoped_lock const lock(this->g_mutex);
+
+    if (!this->g_config._enabled)
+    {
+        return false;
+    }
+
+    ++this->g_stats._receivedCount;
+
+    if (this->chance(this->g_config._lossRate))
+    {
+        ++this->g_stats._lostCount;
+        pck.clear();
+        return true;
+    }
+
+    if (this->chance(this->g_config._duplicateRate))
+    {
+        ++this->g_stats._duplicatedCount;
+        this->schedule(Packet{pck}, id, timePoint);
+    }
+    this->schedule(std::move(pck), id, timePoint);
+    pck.clear();
+    return true;
+}
+bool LinkConditioner::pop(Packet& pck, Identity& id, TimePoint const& timePoint)
+{
+    std::scoped_lock const lock(this->g_mutex);
+
+    if (this->g_datagrams.empty() ||
+        (this->g_config._enabled && this->g_datagrams.front()._deliveryTime > timePoint))
+    {
+        return false;
+    }
+
+    std::pop_heap(this->g_datagrams.begin(), this->g_datagrams.end(), DatagramCompare{});
+    auto& datagram = this->g_datagrams.back();
+    pck = std::move(datagram._packet);
+    id = datagram._id;
+    this->g_datagrams.pop_back();
+
+    ++this->g_stats._deliveredCount;
+    return true;
+}
+
+uint32_t LinkConditioner::getWaitTime_ms(uint32_t maxWait_ms, TimePoint const& timePoint) const
+{
+    std::scoped_lock const lock(this->g_mutex);
+
+    if (this->g_datagrams.empty())
+    {
+        return maxWait_ms;
+    }
+    if (!this->g_config._enabled || this->g_datagrams.front()._deliveryTime <= timePoint)
+    {
+        return 0;
+    }
+
+    auto const waitTime =
+            std::chrono::ceil<std::chrono::milliseconds>(this->g_datagrams.front()._deliveryTime - timePoint).count();
+    return static_cast<uint32_t>(std::min<int64_t>(waitTime, maxWait_ms));
+}
+std::size_t LinkConditioner::getPendingCount() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_datagrams.size();
+}
+
+LinkConditionerStats LinkConditioner::getStats() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return this->g_stats;
+}
+void LinkConditioner::resetStats()
+{
+    std::scoped_lock const lock(this->g_mutex);
+    this->g_stats = {};
+}
+
+void LinkConditioner::clear()
+{
+    std::scoped_lock const lock(this->g_mutex);
+    this->g_datagrams.clear();
+    this->g_linkFreeTime = {};
+}
+
+bool LinkConditioner::chance(float probability)
+{
+    return probability > 0.0f && this->g_random.range(0.0f, 1.0f) < probability;
+}
+void LinkConditioner::schedule(Packet&& pck, Identity const& id, TimePoint const& timePoint)
+{
+    auto deliveryTime = timePoint;
+
+    //The datagram wait for the previous ones to go through the link
+    if (this->g_config._bandwidth > 0)
+    {
+        auto const bandwidth = static_cast<double>(this->g_config._bandwidth);
+        auto const start = std::max(timePoint, this->g_linkFreeTime);
+        auto const backlog = std::chrono::duration<double>(start - timePoint).count() * bandwidth;
+        if (backlog + static_cast<double>(pck.getDataSize()) > static_cast<double>(this->g_config._queueLimit))
+        {
+            ++this->g_stats._overflowCount;
+            return;
+        }
+
+        this->g_linkFreeTime = start + std::chrono::duration_cast<TimePoint::duration>(std::chrono::duration<double>(
+                                               static_cast<double>(pck.getDataSize()) / bandwidth));
+        deliveryTime = this->g_linkFreeTime;
+    }
+
+    auto delay = this->g_config._latency;
+    if (this->g_config._jitter.count() > 0)
+    {
+        auto const jitter = this->g_config._jitter.count();
+        delay += std::chrono::milliseconds{this->g_random.range<int64_t>(-jitter, jitter)};
+    }
+    if (this->chance(this->g_config._reorderRate))
+    {
+        ++this->g_stats._reorderedCount;
+        delay += FGE_NET_LINK_CONDITIONER_REORDER_DELAY + this->g_config._jitter;
+    }
+    deliveryTime += std::max(delay, std::chrono::milliseconds{0});
+
+    this->g_datagrams.push_back({deliveryTime, this->g_order++, std::move(pck), id});
+    std::push_heap(this->g_datagrams.begin(), this->g_datagrams.end(), DatagramCompare{});
+}
+
+} // namespace fge::net
@@ -157,6 +157,17 @@ std::future<uint16_t> ClientSideNetUdp::retrieveMTU()
 
     return future;
 }
+void ClientSideNetUdp::setCompressionDictionary(CompressorLZ4DictionaryPtr dictionary)
+{
+    std::scoped_lock const lock(this->g_mutexCommands);
+    this->g_compressionDictionary = std::move(dictionary);
+}
+CompressorLZ4DictionaryPtr ClientSideNetUdp::getCompressionDictionary() const
+{
+    std::scoped_lock const lock(this->g_mutexCommands);
+    return this->g_compressionDictionary;
+}
+
 std::future<bool> ClientSideNetUdp::connect(std::string_view versioningString)
 {
     if (!this->g_running)
@@ -169,6 +180,7 @@ std::future<bool> ClientSideNetUdp::connect(std::string_view versioningString)
     command->setVersioningString(versioningString);
 
     std::scoped_lock const lock(this->g_mutexCommands);
+    command->setCompressionDictionary(this->g_compressionDictionary);
     this->_client._context._commands.push_back(std::move(command));
 
     return future;
@@ -199,6 +211,15 @@ Identity const& ClientSideNetUdp::getClientIdentity() const
     return this->g_clientIdentity;
 }
 
+LinkConditioner& ClientSideNetUdp::getLinkConditioner()
+{
+    return this->g_linkConditioner;
+}
+LinkConditioner const& ClientSideNetUdp::getLinkConditioner() const
+{
+    return this->g_linkConditioner;
+}
+
 FluxProcessResults ClientSideNetUdp::process(ReceivedPacketPtr& packet, EnumFlags<ProcessOptions> options)
 {
     packet.reset();
@@ -476,6 +497,13 @@ TransmitPacketPtr ClientSideNetUdp::prepareAndRetrieveReturnPacket()
     {
         returnPacket->packet() << acknowledgedPacket._counter << acknowledgedPacket._realm;
     }
+    auto const& acknowledgedFragments = this->_client.getAcknowledgedFragmentList();
+    SizeType const fragmentSize = acknowledgedFragments.size();
+    returnPacket->packet() << fragmentSize;
+    for (auto const& acknowledgedFragment: acknowledgedFragments)
+    {
+        returnPacket->packet() << acknowledgedFragment._counter << acknowledgedFragment._realm;
+    }
     this->_client.clearAcknowledgedList();
 
     //Prepare the new returnPacket
@@ -511,19 +539,27 @@ std::size_t ClientSideNetUdp::waitForPackets(std::chrono::milliseconds time_ms)
 void ClientSideNetUdp::threadReception()
 {
     Packet pckReceive;
-    CompressorLZ4 compressor;
 
     while (this->g_running)
     {
-        if (this->g_socket.select(true, FGE_SERVER_PACKET_RECEPTION_TIMEOUT_MS) == Socket::Errors::ERR_NOERROR)
+        //The link conditioner can hold datagrams, the wait is shortened to the next delivery
+        auto const receptionTimeout = this->g_linkConditioner.getWaitTime_ms(FGE_SERVER_PACKET_RECEPTION_TIMEOUT_MS);
+        bool received = false;
+        if (this->g_socket.select(true, receptionTimeout) == Socket::Errors::ERR_NOERROR &&
+            this->g_socket.receive(pckReceive) == Socket::Errors::ERR_NOERROR)
         {
-            if (this->g_socket.receive(pckReceive) != Socket::Errors::ERR_NOERROR)
-            {
-                continue;
-            }
+            received = !this->g_linkConditioner.push(pckReceive, this->g_clientIdentity);
+        }
+        if (!received)
+        {
+            Identity id;
+            received = this->g_linkConditioner.pop(pckReceive, id);
+        }
 
+        if (received)
+        {
 #ifdef FGE_ENABLE_CLIENT_NETWORK_RANDOM_LOST
-            if (fge::_random.range(0, 5000) <= 10)
+            if (fge::GetThreadRandom().range(0, 5000) <= 10)
             {
                 continue;
             }
@@ -554,6 +590,8 @@ void ClientSideNetUdp::threadReception()
             //Check if the packet is a fragment
             if (packet->isFragmented())
             {
+                //Fragments are acknowledged individually, even duplicates as the previous acknowledgment may be lost
+                this->_client.acknowledgeFragmentReception(packet);
                 auto const result = this->_client._context._defragmentation.process(std::move(packet));
                 if (result._result == PacketDefragmentation::Results::RETRIEVABLE)
                 {
@@ -566,7 +604,7 @@ void ClientSideNetUdp::threadReception()
             }
 
             //Decompress the packet if needed
-            if (!packet->decompress(compressor))
+            if (!packet->decompress(this->_client._context._decompressor))
             {
                 FGE_DEBUG_PRINT("decompress failed");
                 continue;
@@ -638,7 +676,6 @@ void ClientSideNetUdp::threadTransmission()
 {
     auto lastTimePoint = std::chrono::steady_clock::now();
     std::chrono::milliseconds commandsTime{0};
-    CompressorLZ4 compressor;
 
     std::unique_lock lckServer(this->_g_mutexFlux);
 
@@ -681,7 +718,8 @@ void ClientSideNetUdp::threadTransmission()
             continue;
         }
 
-        if (this->_client.getLastPacketLatency() >= this->_client.getCTOSLatency_ms())
+        if (this->_client.getLastPacketLatency() >= this->_client.getCTOSLatency_ms() &&
+            this->_client._context._bandwidthLimiter.tryAcquire())
         { //Ready to send !
             auto transmissionPacket = this->_client.popPacket();
 
@@ -689,7 +727,9 @@ void ClientSideNetUdp::threadTransmission()
             if (!transmissionPacket->isFragmented() && this->_client.getStatus().isInEncryptedState())
             {
                 transmissionPacket->applyOptions(this->_client);
-                if (!transmissionPacket->compress(compressor))
+                auto& context = this->_client._context;
+                if (!context._compressionPolicy.compress(*transmissionPacket, context._compressor,
+                                                         context._compressorHC))
                 {
                     continue;
                 }
@@ -748,6 +788,7 @@ void ClientSideNetUdp::threadTransmission()
 
             //Sending the packet
             this->g_socket.send(transmissionPacket->packet());
+            this->_client._context._bandwidthLimiter.consume(transmissionPacket->getDataSize());
             this->_client.resetLastPacketTimePoint();
         }
     }
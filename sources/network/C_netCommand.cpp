@@ -297,6 +297,15 @@ std::string const& NetConnectCommand::getVersioningString() const
     return this->g_versioningString;
 }
 
+void NetConnectCommand::setCompressionDictionary(CompressorLZ4DictionaryPtr dictionary)
+{
+    this->g_compressionDictionary = std::move(dictionary);
+}
+CompressorLZ4DictionaryPtr const& NetConnectCommand::getCompressionDictionary() const
+{
+    return this->g_compressionDictionary;
+}
+
 void NetConnectCommand::internalUpdate(TransmitPacketPtr& buffPacket,
                                        [[maybe_unused]] IpAddress::Types addressType,
                                        Client& client,
@@ -312,7 +321,9 @@ void NetConnectCommand::internalUpdate(TransmitPacketPtr& buffPacket,
 
         buffPacket = CreatePacket(NET_INTERNAL_ID_FGE_HANDSHAKE);
         buffPacket->doNotDiscard().doNotReorder().doNotFragment()
-                << FGE_NET_HANDSHAKE_STRING << this->g_versioningString;
+                << FGE_NET_HANDSHAKE_STRING << this->g_versioningString
+                << (this->g_compressionDictionary ? this->g_compressionDictionary->getId()
+                                                  : CompressorLZ4Dictionary::Id{FGE_COMPRESSOR_LZ4_DICTIONARY_NONE});
         this->resetTimeout();
         this->g_state = States::WAITING_FGE_HANDSHAKE;
         break;
@@ -463,7 +474,10 @@ void NetConnectCommand::onReceive(std::unique_ptr<ProtocolPacket>& packet,
         FGE_DEBUG_PRINT("receiving handshake response");
 
         std::string handshake;
-        if (rules::RValid<std::string>({packetOwned->packet(), &handshake}).end() || !packetOwned->endReached())
+        CompressorLZ4Dictionary::Id dictionaryId{FGE_COMPRESSOR_LZ4_DICTIONARY_NONE};
+        if (rules::RValid<std::string>({packetOwned->packet(), &handshake}).end() ||
+            rules::RValid<CompressorLZ4Dictionary::Id>({packetOwned->packet(), &dictionaryId}).end() ||
+            !packetOwned->endReached())
         {
             FGE_DEBUG_PRINT("handshake failed");
             client.getStatus().setNetworkStatus(ClientStatus::NetworkStatus::DISCONNECTED);
@@ -481,6 +495,17 @@ void NetConnectCommand::onReceive(std::unique_ptr<ProtocolPacket>& packet,
             return;
         }
 
+        //The server respond with the accepted dictionary id
+        CompressorLZ4DictionaryPtr dictionary;
+        if (dictionaryId != FGE_COMPRESSOR_LZ4_DICTIONARY_NONE && this->g_compressionDictionary &&
+            this->g_compressionDictionary->getId() == dictionaryId)
+        {
+            dictionary = this->g_compressionDictionary;
+        }
+        client._context._compressor.setDictionary(dictionary);
+        client._context._compressorHC.setDictionary(dictionary);
+        client._context._decompressor.setDictionary(dictionary);
+
         FGE_DEBUG_PRINT("RX ACKNOWLEDGED");
         client.getStatus().setNetworkStatus(ClientStatus::NetworkStatus::ACKNOWLEDGED);
         client.getStatus().setTimeout(FGE_NET_STATUS_DEFAULT_TIMEOUT);
@@ -50,6 +50,26 @@ std::string const& ServerSideNetUdp::getVersioningString() const
     return this->g_versioningString;
 }
 
+void ServerSideNetUdp::setCompressionDictionary(CompressorLZ4DictionaryPtr dictionary)
+{
+    std::scoped_lock const lock{this->g_mutexServer};
+    this->g_compressionDictionary = std::move(dictionary);
+}
+CompressorLZ4DictionaryPtr ServerSideNetUdp::getCompressionDictionary() const
+{
+    std::scoped_lock const lock{this->g_mutexServer};
+    return this->g_compressionDictionary;
+}
+
+void ServerSideNetUdp::setCryptThreadCount(std::size_t count)
+{
+    this->g_cryptThreadCount = count;
+}
+std::size_t ServerSideNetUdp::getCryptThreadCount() const
+{
+    return this->g_cryptThreadCount;
+}
+
 bool ServerSideNetUdp::start(Port bindPort, IpAddress const& bindIp, IpAddress::Types addressType)
 {
     if (this->g_running)
@@ -68,6 +88,7 @@ bool ServerSideNetUdp::start(Port bindPort, IpAddress const& bindIp, IpAddress::
 
         this->g_running = true;
 
+        this->startCryptPool();
         this->g_threadReception = std::make_unique<std::thread>(&ServerSideNetUdp::threadReception, this);
         this->g_threadTransmission = std::make_unique<std::thread>(&ServerSideNetUdp::threadTransmission, this);
 
@@ -92,6 +113,7 @@ bool ServerSideNetUdp::start(IpAddress::Types addressType)
 
         this->g_running = true;
 
+        this->startCryptPool();
         this->g_threadReception = std::make_unique<std::thread>(&ServerSideNetUdp::threadReception, this);
         this->g_threadTransmission = std::make_unique<std::thread>(&ServerSideNetUdp::threadTransmission, this);
 
@@ -111,6 +133,8 @@ void ServerSideNetUdp::stop()
         this->g_threadReception = nullptr;
         this->g_threadTransmission = nullptr;
 
+        this->g_cryptPool.stop();
+
         this->g_socket.close();
 
         //Clear the flux
@@ -238,87 +262,145 @@ void* ServerSideNetUdp::getCryptContext() const
     return this->g_crypt_ctx;
 }
 
+LinkConditioner& ServerSideNetUdp::getLinkConditioner()
+{
+    return this->g_linkConditioner;
+}
+LinkConditioner const& ServerSideNetUdp::getLinkConditioner() const
+{
+    return this->g_linkConditioner;
+}
+
+void ServerSideNetUdp::startCryptPool()
+{
+    if (this->g_cryptThreadCount == 0)
+    {
+        return;
+    }
+
+    this->g_cryptPool.start(
+            this->g_cryptThreadCount,
+            [this](ClientSharedPtr const& client, ReceivedPacketPtr&& packet) {
+        if (!prepareReceivedPacket(*packet, client->_context._decompressor))
+        {
+            return;
+        }
+
+        std::scoped_lock const lock(this->g_mutexServer);
+        this->pushReceivedPacket(std::move(packet));
+    },
+            [this]() { this->notifyTransmission(); });
+}
+bool ServerSideNetUdp::prepareReceivedPacket(ProtocolPacket& packet, Compressor& decompressor)
+{
+    //Here we consider that the packet is not encrypted
+    if (!packet.haveCorrectHeader())
+    {
+        return false;
+    }
+    //Skip the header for reading
+    packet.skip(ProtocolPacket::HeaderSize);
+
+    //Decompress the packet if needed
+    return packet.decompress(decompressor);
+}
+void ServerSideNetUdp::pushReceivedPacket(ReceivedPacketPtr&& packet)
+{
+    //Realm and countId is verified by the flux
+
+    if (this->g_fluxes.empty())
+    {
+        this->g_defaultFlux.pushPacket(std::move(packet));
+        return;
+    }
+
+    //Try to push packet in a flux
+    for (std::size_t i = 0; i < this->g_fluxes.size(); ++i)
+    {
+        auto const pushingIndex = packet->bumpFluxIndex(this->g_fluxes.size());
+        if (this->g_fluxes[pushingIndex]->pushPacket(std::move(packet)))
+        { //Packet is correctly pushed
+            break;
+        }
+    }
+    //If every flux is busy, the new packet is dismissed
+}
+
 void ServerSideNetUdp::threadReception()
 {
     Identity idReceive;
     Packet pckReceive;
-    std::size_t pushingIndex = 0;
     auto gcClientsMap = std::chrono::steady_clock::now();
 
-    CompressorLZ4 compressor;
+    CompressorLZ4 unknownClientCompressor;
 
     while (this->g_running)
     {
-        if (this->g_socket.select(true, FGE_SERVER_PACKET_RECEPTION_TIMEOUT_MS) == Socket::Errors::ERR_NOERROR)
+        bool received = false;
+
+        //The link conditioner can hold datagrams, the wait is shortened to the next delivery
+        auto const receptionTimeout = this->g_linkConditioner.getWaitTime_ms(FGE_SERVER_PACKET_RECEPTION_TIMEOUT_MS);
+        if (this->g_socket.select(true, receptionTimeout) == Socket::Errors::ERR_NOERROR &&
+            this->g_socket.receiveFrom(pckReceive, idReceive._ip, idReceive._port) == Socket::Errors::ERR_NOERROR)
+        {
+            received = !this->g_linkConditioner.push(pckReceive, idReceive);
+        }
+        if (!received)
+        {
+            received = this->g_linkConditioner.pop(pckReceive, idReceive);
+        }
+
+        if (received)
         {
-            if (this->g_socket.receiveFrom(pckReceive, idReceive._ip, idReceive._port) == Socket::Errors::ERR_NOERROR)
-            {
 #ifdef FGE_ENABLE_SERVER_NETWORK_RANDOM_LOST
-                if (fge::_random.range(0, 1000) <= 10)
-                {
-                    continue;
-                }
+            if (fge::GetThreadRandom().range(0, 1000) <= 10)
+            {
+                continue;
+            }
 #endif
 
-                auto packet = std::make_unique<ProtocolPacket>(std::move(pckReceive), idReceive);
-                packet->setTimestamp(Client::getTimestamp_ms());
+            auto packet = std::make_unique<ProtocolPacket>(std::move(pckReceive), idReceive);
+            packet->setTimestamp(Client::getTimestamp_ms());
 
-                std::scoped_lock const lck(this->g_mutexServer);
+            std::scoped_lock const lck(this->g_mutexServer);
 
-                auto itClient = this->g_clientsMap.find(idReceive);
-                if (itClient != this->g_clientsMap.end())
+            CompressorLZ4* compressor = &unknownClientCompressor;
+            ClientSharedPtr client;
+
+            auto itClient = this->g_clientsMap.find(idReceive);
+            if (itClient != this->g_clientsMap.end())
+            {
+                client = itClient->second.lock();
+                if (!client)
+                { //bad client
+                    this->g_clientsMap.erase(itClient);
+                }
+                else
                 {
-                    auto client = itClient->second.lock();
-                    if (!client)
-                    { //bad client
-                        this->g_clientsMap.erase(itClient);
-                    }
-                    else
+                    //Check if the packet is encrypted
+                    if (client->getStatus().isInEncryptedState())
                     {
-                        //Check if the packet is encrypted
-                        if (client->getStatus().isInEncryptedState())
+                        if (this->g_cryptPool.isRunning())
+                        { //The packet will be pushed by the crypt pool
+                            this->g_cryptPool.pushDecrypt(client, std::move(packet));
+                            continue;
+                        }
+
+                        if (!CryptDecrypt(*client, *packet))
                         {
-                            if (!CryptDecrypt(*client, *packet))
-                            {
-                                continue;
-                            }
+                            continue;
                         }
                     }
+                    compressor = &client->_context._decompressor;
                 }
+            }
 
-                //Here we consider that the packet is not encrypted
-                if (!packet->haveCorrectHeader())
-                {
-                    continue;
-                }
-                //Skip the header for reading
-                packet->skip(ProtocolPacket::HeaderSize);
-
-                //Decompress the packet if needed
-                if (!packet->decompress(compressor))
-                {
-                    continue;
-                }
-
-                //Realm and countId is verified by the flux
-
-                if (this->g_fluxes.empty())
-                {
-                    this->g_defaultFlux.pushPacket(std::move(packet));
-                    continue;
-                }
-
-                //Try to push packet in a flux
-                for (std::size_t i = 0; i < this->g_fluxes.size(); ++i)
-                {
-                    pushingIndex = packet->bumpFluxIndex(this->g_fluxes.size());
-                    if (this->g_fluxes[pushingIndex]->pushPacket(std::move(packet)))
-                    { //Packet is correctly pushed
-                        break;
-                    }
-                }
-                //If every flux is busy, the new packet is dismissed
+            if (!prepareReceivedPacket(*packet, *compressor))
+            {
+                continue;
             }
+
+            this->pushReceivedPacket(std::move(packet));
         }
 
         //"Garbage collection" of the clients map
@@ -343,8 +425,8 @@ void ServerSideNetUdp::threadReception()
 void ServerSideNetUdp::threadTransmission()
 {
     std::unique_lock lckServer(this->g_mutexServer);
-    CompressorLZ4 compressor;
     std::chrono::steady_clock::time_point timePoint;
+    std::vector<CryptWorkerPool::EncryptedPacket> encryptedPackets;
 
     while (this->g_running)
     {
@@ -383,23 +465,27 @@ void ServerSideNetUdp::threadTransmission()
                     continue;
                 }
 
+                if (!client->_context._bandwidthLimiter.tryAcquire(timePoint))
+                { //Not enough bandwidth for this client, the pending packets wait for the next pass
+                    continue;
+                }
+
                 auto transmissionPacket = client->popPacket();
 
-                if (!transmissionPacket->isMarkedAsCached())
+                bool const cacheable = !transmissionPacket->isMarkedAsCached();
+                if (cacheable)
                 {
                     //Compression and applying options
                     transmissionPacket->applyOptions(*client);
-                    if (!transmissionPacket->isFragmented())
+                    if (!transmissionPacket->isFragmented() && client->getStatus().isInEncryptedState())
                     {
-                        if (client->getStatus().isInEncryptedState())
+                        auto& context = client->_context;
+                        if (!context._compressionPolicy.compress(*transmissionPacket, context._compressor,
+                                                                 context._compressorHC))
                         {
-                            if (!transmissionPacket->compress(compressor))
-                            {
-                                FGE_DEBUG_PRINT("Error while compressing a packet");
-                                continue;
-                            }
+                            FGE_DEBUG_PRINT("Error while compressing a packet");
+                            continue;
                         }
-                        client->_context._cache.push(transmissionPacket);
                     }
                 }
 
@@ -415,31 +501,36 @@ void ServerSideNetUdp::threadTransmission()
                         goto mtu_check_skip;
                     }
 
-                    auto fragments = transmissionPacket->fragment(mtu);
-#ifdef FGE_ENABLE_PACKET_DEBUG_VERBOSE
-                    auto const fragmentCount = fragments.size();
-                    if (fragmentCount > 1)
+                    if (transmissionPacket->getDataSize() >= mtu)
                     {
-                        auto const originalSize = transmissionPacket->getDataSize();
-                        FGE_DEBUG_PRINT("Fragmenting packet of size {} into {} fragments", originalSize, fragmentCount);
-                    }
+                        //Fragments are views into the shared original packet
+                        std::shared_ptr<ProtocolPacket const> const originalPacket = std::move(transmissionPacket);
+                        auto const fragments = CreateFragmentViews(originalPacket, mtu);
+#ifdef FGE_ENABLE_PACKET_DEBUG_VERBOSE
+                        FGE_DEBUG_PRINT("Fragmenting packet of size {} into {} fragments",
+                                        originalPacket->getDataSize(), fragments.size());
 #endif
-                    for (std::size_t iFragment = 0; iFragment < fragments.size(); ++iFragment)
-                    {
-                        if (iFragment == 0)
-                        {
-                            transmissionPacket = std::move(fragments[iFragment]);
+                        if (cacheable)
+                        { //Every fragment is cached individually
+                            client->_context._cache.push(fragments);
                         }
-                        else
+
+                        for (std::size_t iFragment = fragments.size() - 1; iFragment > 0; --iFragment)
                         {
-                            fragments[iFragment]
-                                    ->markAsCached(); //TODO: maybe allow fragments to be cached individually?
-                            client->pushForcedFrontPacket(std::move(fragments[iFragment]));
+                            auto fragmentPacket = fragments[iFragment].materialize();
+                            fragmentPacket->markAsCached();
+                            client->pushForcedFrontPacket(std::move(fragmentPacket));
                         }
+                        transmissionPacket = fragments.front().materialize();
                     }
                 }
             mtu_check_skip:
 
+                if (cacheable && !transmissionPacket->isFragmented())
+                {
+                    client->_context._cache.push(transmissionPacket);
+                }
+
                 if (!transmissionPacket->packet() || !transmissionPacket->haveCorrectHeaderSize())
                 { //Last verification of the packet
                     FGE_DEBUG_PRINT("Invalid packet before sending");
@@ -449,6 +540,14 @@ void ServerSideNetUdp::threadTransmission()
                 //Check if the packet must be encrypted
                 if (transmissionPacket->isMarkedForEncryption())
                 {
+                    if (this->g_cryptPool.isRunning())
+                    { //The packet will be sent when encrypted by the crypt pool
+                        client->_context._bandwidthLimiter.consume(transmissionPacket->getDataSize());
+                        this->g_cryptPool.pushEncrypt(client, itClient->first, std::move(transmissionPacket));
+                        client->resetLastPacketTimePoint();
+                        continue;
+                    }
+
                     if (!CryptEncrypt(*client, *transmissionPacket))
                     {
                         FGE_DEBUG_PRINT("Error while encrypting a packet");
@@ -458,10 +557,22 @@ void ServerSideNetUdp::threadTransmission()
 
                 //Sending the packet
                 this->g_socket.sendTo(transmissionPacket->packet(), itClient->first._ip, itClient->first._port);
+                client->_context._bandwidthLimiter.consume(transmissionPacket->getDataSize());
                 client->resetLastPacketTimePoint();
             }
         }
 
+        //Sending packets encrypted by the crypt pool as a batch
+        if (this->g_cryptPool.popEncrypted(encryptedPackets) > 0)
+        {
+            for (auto const& encryptedPacket: encryptedPackets)
+            {
+                this->g_socket.sendTo(encryptedPacket._packet->packet(), encryptedPacket._identity._ip,
+                                      encryptedPacket._identity._port);
+            }
+            encryptedPackets.clear();
+        }
+
         //Checking isolated transmission queue TODO: maybe remove all that
         while (!this->g_transmissionQueue.empty())
         {
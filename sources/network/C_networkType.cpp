@@ -191,6 +191,7 @@ bool NetworkTypeBase::clientsCheckup(ClientList const& clients, bool force)
     {
         this->setModificationFlag();
         this->forceUncheck();
+        ++this->_g_modificationRevision;
     }
     return checkResult;
 }
@@ -215,6 +216,10 @@ bool NetworkTypeBase::isForced() const
 {
     return this->_g_force;
 }
+uint32_t NetworkTypeBase::getModificationRevision() const
+{
+    return this->_g_modificationRevision;
+}
 
 void NetworkTypeBase::clearExplicitUpdateFlag()
 {
@@ -332,7 +337,7 @@ void const* NetworkTypeSmoothVec2Float::getSource() const
 
 bool NetworkTypeSmoothVec2Float::applyData(Packet const& pck)
 {
-    if (pck >> this->g_typeCopy)
+    if (this->unpackValue(pck))
     {
         fge::Vector2f const source = this->g_typeSource._getter();
         float const error = std::abs(this->g_typeCopy.x - source.x) + std::abs(this->g_typeCopy.y - source.y);
@@ -354,12 +359,12 @@ void NetworkTypeSmoothVec2Float::packData(Packet& pck, Identity const& id)
 {
     if (this->clearModificationFlag(id))
     {
-        pck << this->g_typeSource._getter();
+        this->packValue(pck);
     }
 }
 void NetworkTypeSmoothVec2Float::packData(Packet& pck)
 {
-    pck << this->g_typeSource._getter();
+    this->packValue(pck);
 }
 
 bool NetworkTypeSmoothVec2Float::check() const
@@ -389,6 +394,40 @@ float NetworkTypeSmoothVec2Float::getErrorRange() const
     return this->g_errorRange;
 }
 
+void NetworkTypeSmoothVec2Float::setQuantization(std::optional<QuantizeRange> const& range)
+{
+    this->g_quantization = range;
+}
+std::optional<QuantizeRange> const& NetworkTypeSmoothVec2Float::getQuantization() const
+{
+    return this->g_quantization;
+}
+
+void NetworkTypeSmoothVec2Float::packValue(Packet& pck) const
+{
+    if (this->g_quantization)
+    {
+        fge::Vector2f const value = this->g_typeSource._getter();
+        fge::net::PackQuantized<2>(pck, *this->g_quantization, {value.x, value.y});
+        return;
+    }
+    pck << this->g_typeSource._getter();
+}
+bool NetworkTypeSmoothVec2Float::unpackValue(Packet const& pck)
+{
+    if (this->g_quantization)
+    {
+        std::array<float, 2> values{};
+        if (fge::net::UnpackQuantized(pck, *this->g_quantization, values))
+        {
+            this->g_typeCopy = {values[0], values[1]};
+            return true;
+        }
+        return false;
+    }
+    return static_cast<bool>(pck >> this->g_typeCopy);
+}
+
 ///NetworkTypeSmoothFloat
 
 NetworkTypeSmoothFloat::NetworkTypeSmoothFloat(fge::DataAccessor<float> source, float errorRange) :
@@ -404,7 +443,7 @@ void const* NetworkTypeSmoothFloat::getSource() const
 
 bool NetworkTypeSmoothFloat::applyData(Packet const& pck)
 {
-    if (pck >> this->g_typeCopy)
+    if (this->unpackValue(pck))
     {
         float error = std::abs(this->g_typeCopy - this->g_typeSource._getter());
         if (error >= this->g_errorRange)
@@ -425,12 +464,12 @@ void NetworkTypeSmoothFloat::packData(Packet& pck, Identity const& id)
 {
     if (this->clearModificationFlag(id))
     {
-        pck << this->g_typeSource._getter();
+        this->packValue(pck);
     }
 }
 void NetworkTypeSmoothFloat::packData(Packet& pck)
 {
-    pck << this->g_typeSource._getter();
+    this->packValue(pck);
 }
 
 bool NetworkTypeSmoothFloat::check() const
@@ -460,11 +499,44 @@ float NetworkTypeSmoothFloat::getErrorRange() const
     return this->g_errorRange;
 }
 
+void NetworkTypeSmoothFloat::setQuantization(std::optional<QuantizeRange> const& range)
+{
+    this->g_quantization = range;
+}
+std::optional<QuantizeRange> const& NetworkTypeSmoothFloat::getQuantization() const
+{
+    return this->g_quantization;
+}
+
+void NetworkTypeSmoothFloat::packValue(Packet& pck) const
+{
+    if (this->g_quantization)
+    {
+        fge::net::PackQuantized<1>(pck, *this->g_quantization, {this->g_typeSource._getter()});
+        return;
+    }
+    pck << this->g_typeSource._getter();
+}
+bool NetworkTypeSmoothFloat::unpackValue(Packet const& pck)
+{
+    if (this->g_quantization)
+    {
+        std::array<float, 1> values{};
+        if (fge::net::UnpackQuantized(pck, *this->g_quantization, values))
+        {
+            this->g_typeCopy = values[0];
+            return true;
+        }
+        return false;
+    }
+    return static_cast<bool>(pck >> this->g_typeCopy);
+}
+
 ///NetworkTypeTag
 
-NetworkTypeTag::NetworkTypeTag(fge::TagList* source, std::string tag) :
+NetworkTypeTag::NetworkTypeTag(fge::TagList* source, std::string_view tag) :
         g_typeSource(source),
-        g_tag(std::move(tag))
+        g_tag(fge::InternString(tag))
 {}
 
 void const* NetworkTypeTag::getSource() const
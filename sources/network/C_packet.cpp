@@ -48,10 +48,14 @@ Packet::Packet(Packet&& pck) noexcept :
         _g_transmitPos(pck._g_transmitPos),
         _g_transmitCacheValid(pck._g_transmitCacheValid),
         g_data(std::move(pck.g_data)),
+        g_view(pck.g_view),
+        g_isView(pck.g_isView),
         g_readPos(pck.g_readPos),
         g_valid(pck.g_valid)
 {
     pck._g_transmitCacheValid = false;
+    pck.g_view = {};
+    pck.g_isView = false;
     pck.g_valid = true;
     pck.g_readPos = 0;
     pck._g_transmitPos = 0;
@@ -71,10 +75,14 @@ Packet& Packet::operator=(Packet&& pck) noexcept
         this->_g_transmitPos = pck._g_transmitPos;
         this->_g_transmitCacheValid = pck._g_transmitCacheValid;
         this->g_data = std::move(pck.g_data);
+        this->g_view = pck.g_view;
+        this->g_isView = pck.g_isView;
         this->g_readPos = pck.g_readPos;
         this->g_valid = pck.g_valid;
 
         pck._g_transmitCacheValid = false;
+        pck.g_view = {};
+        pck.g_isView = false;
         pck.g_valid = true;
         pck.g_readPos = 0;
         pck._g_transmitPos = 0;
@@ -82,6 +90,27 @@ Packet& Packet::operator=(Packet&& pck) noexcept
     return *this;
 }
 
+Packet Packet::View(std::span<uint8_t const> data)
+{
+    Packet packet{0};
+    packet.g_view = data;
+    packet.g_isView = true;
+    return packet;
+}
+bool Packet::isView() const
+{
+    return this->g_isView;
+}
+void Packet::detachView()
+{
+    if (this->g_isView)
+    {
+        this->g_data.assign(this->g_view.begin(), this->g_view.end());
+        this->g_view = {};
+        this->g_isView = false;
+    }
+}
+
 void Packet::clear()
 {
     this->_g_transmitPos = 0;
@@ -89,6 +118,8 @@ void Packet::clear()
     this->_g_transmitCacheValid = false;
 
     this->g_data.clear();
+    this->g_view = {};
+    this->g_isView = false;
     this->g_readPos = 0;
     this->g_valid = true;
 }
@@ -100,11 +131,13 @@ void Packet::flush()
 }
 void Packet::reserve(std::size_t reserveSize)
 {
+    this->detachView();
     this->g_data.reserve(reserveSize);
 }
 
 Packet& Packet::append(std::size_t size)
 {
+    this->detachView();
     if (size > 0)
     {
         std::size_t startPos = this->g_data.size();
@@ -116,6 +149,7 @@ Packet& Packet::append(std::size_t size)
 }
 Packet& Packet::append(void const* data, std::size_t size)
 {
+    this->detachView();
     if (data && (size > 0))
     {
         std::size_t startPos = this->g_data.size();
@@ -132,6 +166,7 @@ Packet& Packet::append(void const* data, std::size_t size)
 }
 Packet& Packet::pack(void const* data, std::size_t size)
 {
+    this->detachView();
     if (data && (size > 0))
     {
         std::size_t startPos = this->g_data.size();
@@ -160,6 +195,7 @@ Packet& Packet::pack(void const* data, std::size_t size)
 
 bool Packet::write(std::size_t pos, void const* data, std::size_t size)
 {
+    this->detachView();
     if (data && (size > 0) && (pos < this->g_data.size()))
     {
         //Copy memory
@@ -174,6 +210,7 @@ bool Packet::write(std::size_t pos, void const* data, std::size_t size)
 }
 bool Packet::pack(std::size_t pos, void const* data, std::size_t size)
 {
+    this->detachView();
     if (data && (size > 0) && (pos < this->g_data.size()))
     {
         if constexpr (std::endian::native == std::endian::big)
@@ -200,12 +237,13 @@ bool Packet::pack(std::size_t pos, void const* data, std::size_t size)
 
 Packet const& Packet::read(void* buff, std::size_t size) const
 {
-    if (buff && (size > 0) && (this->g_readPos + size <= this->g_data.size()))
+    auto const view = this->getReadSpan();
+    if (buff && (size > 0) && (this->g_readPos + size <= view.size()))
     {
         //Copy to buff
         for (std::size_t i = 0; i < size; ++i)
         {
-            static_cast<uint8_t*>(buff)[i] = this->g_data[this->g_readPos + i];
+            static_cast<uint8_t*>(buff)[i] = view[this->g_readPos + i];
         }
         this->g_readPos += size;
         this->g_valid = true;
@@ -216,14 +254,15 @@ Packet const& Packet::read(void* buff, std::size_t size) const
 }
 Packet const& Packet::unpack(void* buff, std::size_t size) const
 {
-    if (buff && (size > 0) && (this->g_readPos + size <= this->g_data.size()))
+    auto const view = this->getReadSpan();
+    if (buff && (size > 0) && (this->g_readPos + size <= view.size()))
     {
         if constexpr (std::endian::native == std::endian::big)
         {
             //Copy to buff
             for (std::size_t i = 0; i < size; ++i)
             {
-                static_cast<uint8_t*>(buff)[i] = this->g_data[this->g_readPos + i];
+                static_cast<uint8_t*>(buff)[i] = view[this->g_readPos + i];
             }
         }
         else
@@ -231,7 +270,7 @@ Packet const& Packet::unpack(void* buff, std::size_t size) const
             //Copy to buff
             for (std::size_t i = 0; i < size; ++i)
             {
-                static_cast<uint8_t*>(buff)[size - 1 - i] = this->g_data[this->g_readPos + i];
+                static_cast<uint8_t*>(buff)[size - 1 - i] = view[this->g_readPos + i];
             }
         }
         this->g_readPos += size;
@@ -244,12 +283,13 @@ Packet const& Packet::unpack(void* buff, std::size_t size) const
 
 bool Packet::read(std::size_t pos, void* buff, std::size_t size) const
 {
-    if (buff && (size > 0) && (pos + size <= this->g_data.size()))
+    auto const view = this->getReadSpan();
+    if (buff && (size > 0) && (pos + size <= view.size()))
     {
         //Copy to buff
         for (std::size_t i = 0; i < size; ++i)
         {
-            static_cast<uint8_t*>(buff)[i] = this->g_data[pos + i];
+            static_cast<uint8_t*>(buff)[i] = view[pos + i];
         }
         return true;
     }
@@ -257,14 +297,15 @@ bool Packet::read(std::size_t pos, void* buff, std::size_t size) const
 }
 bool Packet::unpack(std::size_t pos, void* buff, std::size_t size) const
 {
-    if (buff && (size > 0) && (pos + size <= this->g_data.size()))
+    auto const view = this->getReadSpan();
+    if (buff && (size > 0) && (pos + size <= view.size()))
     {
         if constexpr (std::endian::native == std::endian::big)
         {
             //Copy to buff
             for (std::size_t i = 0; i < size; ++i)
             {
-                static_cast<uint8_t*>(buff)[i] = this->g_data[pos + i];
+                static_cast<uint8_t*>(buff)[i] = view[pos + i];
             }
         }
         else
@@ -272,7 +313,7 @@ bool Packet::unpack(std::size_t pos, void* buff, std::size_t size) const
             //Copy to buff
             for (std::size_t i = 0; i < size; ++i)
             {
-                static_cast<uint8_t*>(buff)[size - 1 - i] = this->g_data[pos + i];
+                static_cast<uint8_t*>(buff)[size - 1 - i] = view[pos + i];
             }
         }
         return true;
@@ -282,6 +323,7 @@ bool Packet::unpack(std::size_t pos, void* buff, std::size_t size) const
 
 Packet& Packet::shrink(std::size_t size)
 {
+    this->detachView();
     if (size > 0)
     {
         if (size >= this->g_data.size())
@@ -300,6 +342,7 @@ Packet& Packet::shrink(std::size_t size)
 }
 bool Packet::erase(std::size_t pos, std::size_t size)
 {
+    this->detachView();
     if ((size > 0) && (pos + size <= this->g_data.size()))
     {
         this->g_data.erase(this->g_data.begin() + pos, this->g_data.begin() + pos + size);
@@ -309,7 +352,8 @@ bool Packet::erase(std::size_t pos, std::size_t size)
 }
 Packet const& Packet::skip(std::size_t size) const
 {
-    if ((size > 0) && (this->g_readPos + size <= this->g_data.size()))
+    auto const view = this->getReadSpan();
+    if ((size > 0) && (this->g_readPos + size <= view.size()))
     {
         this->g_readPos += size;
         this->g_valid = true;
@@ -321,7 +365,8 @@ Packet const& Packet::skip(std::size_t size) const
 
 void Packet::setReadPos(std::size_t pos) const
 {
-    this->g_readPos = (pos > this->g_data.size()) ? this->g_data.size() : pos;
+    auto const view = this->getReadSpan();
+    this->g_readPos = (pos > view.size()) ? view.size() : pos;
 }
 std::size_t Packet::getReadPos() const
 {
@@ -329,29 +374,32 @@ std::size_t Packet::getReadPos() const
 }
 bool Packet::isExtractable(std::size_t size) const
 {
-    return (this->g_readPos + size) <= this->g_data.size();
+    return (this->g_readPos + size) <= this->getReadSpan().size();
 }
 
 uint8_t const* Packet::getData(std::size_t pos) const
 {
-    return (pos < this->g_data.size()) ? &this->g_data[pos] : nullptr;
+    auto const view = this->getReadSpan();
+    return (pos < view.size()) ? &view[pos] : nullptr;
 }
 uint8_t* Packet::getData(std::size_t pos)
 {
+    this->detachView();
     return (pos < this->g_data.size()) ? &this->g_data[pos] : nullptr;
 }
 uint8_t const* Packet::getData() const
 {
-    return this->g_data.data();
+    return this->getReadSpan().data();
 }
 uint8_t* Packet::getData()
 {
+    this->detachView();
     return this->g_data.data();
 }
 
 std::size_t Packet::getDataSize() const
 {
-    return this->g_data.size();
+    return this->getReadSpan().size();
 }
 uint32_t Packet::getLength() const
 {
@@ -378,7 +426,7 @@ Packet::operator bool() const
 }
 bool Packet::endReached() const
 {
-    return this->g_readPos >= this->g_data.size();
+    return this->g_readPos >= this->getReadSpan().size();
 }
 
 std::vector<uint8_t> const& Packet::getTransmitCache() const
@@ -457,12 +505,13 @@ Packet& Packet::operator<<(std::wstring const& data)
 
 Packet const& Packet::operator>>(char* data) const
 {
+    auto const view = this->getReadSpan();
     SizeType length = 0;
     this->unpack(&length, sizeof(length));
 
     if (length > 0)
     {
-        if ((this->g_readPos + length - 1) < this->g_data.size())
+        if ((this->g_readPos + length - 1) < view.size())
         {
             this->read(data, sizeof(char) * length);
             data[length] = '\0';
@@ -480,15 +529,16 @@ Packet const& Packet::operator>>(char* data) const
 }
 Packet const& Packet::operator>>(std::string& data) const
 {
+    auto const view = this->getReadSpan();
     SizeType length = 0;
     this->unpack(&length, sizeof(length));
 
     if (length > 0)
     {
-        if ((this->g_readPos + length - 1) < this->g_data.size())
+        if ((this->g_readPos + length - 1) < view.size())
         {
             data.clear();
-            data.assign(reinterpret_cast<char const*>(&this->g_data[this->g_readPos]), length);
+            data.assign(reinterpret_cast<char const*>(&view[this->g_readPos]), length);
 
             this->g_readPos += length;
         }
@@ -505,15 +555,16 @@ Packet const& Packet::operator>>(std::string& data) const
 }
 Packet const& Packet::operator>>(tiny_utf8::string& data) const
 {
+    auto const view = this->getReadSpan();
     SizeType length = 0;
     this->unpack(&length, sizeof(length));
 
     if (length > 0)
     {
-        if ((this->g_readPos + length - 1) < this->g_data.size())
+        if ((this->g_readPos + length - 1) < view.size())
         {
             data.clear();
-            data.assign(reinterpret_cast<char const*>(&this->g_data[this->g_readPos]), length);
+            data.assign(reinterpret_cast<char const*>(&view[this->g_readPos]), length);
 
             this->g_readPos += length;
         }
@@ -530,12 +581,13 @@ Packet const& Packet::operator>>(tiny_utf8::string& data) const
 }
 Packet const& Packet::operator>>(wchar_t* data) const
 {
+    auto const view = this->getReadSpan();
     SizeType length = 0;
     this->unpack(&length, sizeof(length));
 
     if (length > 0)
     {
-        if ((this->g_readPos + (length - 1) * sizeof(uint32_t)) < this->g_data.size())
+        if ((this->g_readPos + (length - 1) * sizeof(uint32_t)) < view.size())
         {
             for (SizeType i = 0; i < length; ++i)
             {
@@ -558,12 +610,13 @@ Packet const& Packet::operator>>(wchar_t* data) const
 }
 Packet const& Packet::operator>>(std::wstring& data) const
 {
+    auto const view = this->getReadSpan();
     SizeType length = 0;
     this->unpack(&length, sizeof(length));
 
     if (length > 0)
     {
-        if ((this->g_readPos + (length - 1) * sizeof(uint32_t)) < this->g_data.size())
+        if ((this->g_readPos + (length - 1) * sizeof(uint32_t)) < view.size())
         {
             data.resize(length);
             for (SizeType i = 0; i < length; ++i)
@@ -587,9 +640,10 @@ Packet const& Packet::operator>>(std::wstring& data) const
 
 bool Packet::onSend(std::size_t offset)
 {
+    auto const view = this->getReadSpan();
     this->_g_transmitCacheValid = true;
-    this->_g_transmitCache.resize(this->g_data.size() + offset);
-    std::memcpy(this->_g_transmitCache.data() + offset, this->g_data.data(), this->g_data.size());
+    this->_g_transmitCache.resize(view.size() + offset);
+    std::memcpy(this->_g_transmitCache.data() + offset, view.data(), view.size());
     return true;
 }
 void Packet::onReceive(std::span<uint8_t const> const& data)
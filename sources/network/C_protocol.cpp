@@ -25,11 +25,61 @@
 namespace fge::net
 {
 
+namespace
+{
+
+struct FragmentLayout
+{
+    std::size_t _packetSize;
+    std::size_t _maxFragmentSize;
+    std::size_t _count;
+
+    [[nodiscard]] std::size_t getFragmentSize(std::size_t index) const
+    {
+        return index == this->_count - 1 ? this->_packetSize - index * this->_maxFragmentSize
+                                         : this->_maxFragmentSize;
+    }
+};
+
+[[nodiscard]] FragmentLayout ComputeFragmentLayout(std::size_t packetSize, uint16_t mtu)
+{
+    std::size_t const maxFragmentSize = mtu - ProtocolPacket::HeaderSize - sizeof(InternalFragmentedPacketData);
+    return {packetSize, maxFragmentSize,
+            packetSize / maxFragmentSize + (packetSize % maxFragmentSize > 0 ? 1 : 0)};
+}
+
+[[nodiscard]] TransmitPacketPtr MaterializeFragment(ProtocolPacket const& source,
+                                                    std::size_t offset,
+                                                    std::size_t size,
+                                                    ProtocolPacket::RealmType realm,
+                                                    std::size_t index,
+                                                    std::size_t total)
+{
+    InternalFragmentedPacketData fragmentData{};
+    fragmentData._fragmentTotal = static_cast<decltype(fragmentData._fragmentTotal)>(total);
+
+    auto fragmentedPacket = std::make_unique<ProtocolPacket>(NET_INTERNAL_ID_FRAGMENTED_PACKET, realm,
+                                                             static_cast<ProtocolPacket::CounterType>(index));
+    fragmentedPacket->reserve(ProtocolPacket::HeaderSize + sizeof(fragmentData) + size);
+
+    fragmentedPacket->pack(&fragmentData, sizeof(fragmentData));
+    fragmentedPacket->append(source.getData() + offset, size);
+
+    fragmentedPacket->doNotFragment().doNotReorder();
+    if (source.isMarkedForEncryption())
+    {
+        fragmentedPacket->markForEncryption();
+    }
+    return fragmentedPacket;
+}
+
+} // namespace
+
 //ProtocolPacket
 
-bool ProtocolPacket::compress(Compressor& compressor)
+bool ProtocolPacket::compress(Compressor& compressor, CompressionCodecs codec)
 {
-    if (!this->haveCorrectHeaderSize())
+    if (!this->haveCorrectHeaderSize() || codec == CompressionCodecs::NONE)
     {
         return false;
     }
@@ -50,7 +100,13 @@ bool ProtocolPacket::compress(Compressor& compressor)
         return false; //Compression failed
     }
 
+    if (compressor.getBuffer().size() + sizeof(CompressionCodecs) >= payloadSize)
+    {
+        return true; //Not worth it
+    }
+
     this->shrink(payloadSize);
+    this->append(&codec, sizeof(CompressionCodecs));
     this->append(compressor.getBuffer().data(), compressor.getBuffer().size());
 
     this->addFlags(FGE_NET_HEADER_COMPRESSED_FLAG);
@@ -70,12 +126,19 @@ bool ProtocolPacket::decompress(Compressor& compressor)
     }
 
     auto const payloadSize = this->getDataSize() - HeaderSize;
-    if (payloadSize == 0)
+    if (payloadSize <= sizeof(CompressionCodecs))
     {
         return false; //Abnormal size
     }
 
-    if (compressor.uncompress({this->getData() + HeaderSize, payloadSize}))
+    auto const codec = this->retrieveCompressionCodec();
+    if (codec != CompressionCodecs::LZ4 && codec != CompressionCodecs::LZ4HC)
+    {
+        return false; //Unknown codec
+    }
+
+    if (compressor.uncompress({this->getData() + HeaderSize + sizeof(CompressionCodecs),
+                               payloadSize - sizeof(CompressionCodecs)}))
     {
         return false; //Decompression failed
     }
@@ -87,6 +150,18 @@ bool ProtocolPacket::decompress(Compressor& compressor)
 
     return true;
 }
+std::optional<ProtocolPacket::CompressionCodecs> ProtocolPacket::retrieveCompressionCodec() const
+{
+    if (!this->checkFlags(FGE_NET_HEADER_COMPRESSED_FLAG))
+    {
+        return CompressionCodecs::NONE;
+    }
+    if (this->getDataSize() <= HeaderSize)
+    {
+        return std::nullopt;
+    }
+    return static_cast<CompressionCodecs>(this->getData()[HeaderSize]);
+}
 
 void ProtocolPacket::applyOptions(Client const& client)
 {
@@ -140,31 +215,46 @@ std::vector<std::unique_ptr<ProtocolPacket>> ProtocolPacket::fragment(uint16_t m
     }
 
     //We have to fragment the packet
-    auto const packetSize = this->getDataSize();
-    auto const maxFragmentSize = mtu - HeaderSize - sizeof(InternalFragmentedPacketData);
-    auto const fragmentCount = packetSize / maxFragmentSize + (packetSize % maxFragmentSize > 0 ? 1 : 0);
-
+    auto const layout = ComputeFragmentLayout(this->getDataSize(), mtu);
     auto const fragmentRealm = this->retrieveCounter().value();
 
-    InternalFragmentedPacketData fragmentData{};
-    fragmentData._fragmentTotal = fragmentCount;
-
-    std::vector<std::unique_ptr<ProtocolPacket>> fragments(fragmentCount);
-    for (std::size_t i = 0; i < fragmentCount; ++i)
+    std::vector<std::unique_ptr<ProtocolPacket>> fragments(layout._count);
+    for (std::size_t i = 0; i < layout._count; ++i)
     {
-        auto fragmentedPacket = std::make_unique<ProtocolPacket>(NET_INTERNAL_ID_FRAGMENTED_PACKET, fragmentRealm, i);
+        fragments[i] = MaterializeFragment(*this, i * layout._maxFragmentSize, layout.getFragmentSize(i),
+                                           fragmentRealm, i, layout._count);
+    }
+    return fragments;
+}
 
-        fragmentedPacket->pack(&fragmentData, sizeof(fragmentData));
-        fragmentedPacket->append(this->getData() + i * maxFragmentSize,
-                                 i == fragmentCount - 1 ? packetSize - i * maxFragmentSize : maxFragmentSize);
+//FragmentView
 
-        fragmentedPacket->doNotFragment().doNotReorder();
-        if (this->isMarkedForEncryption())
-        {
-            fragmentedPacket->markForEncryption();
-        }
+TransmitPacketPtr FragmentView::materialize() const
+{
+    return MaterializeFragment(*this->_source, this->_offset, this->_size, this->_realm, this->_index, this->_total);
+}
 
-        fragments[i] = std::move(fragmentedPacket);
+std::vector<FragmentView> CreateFragmentViews(std::shared_ptr<ProtocolPacket const> const& packet, uint16_t mtu)
+{
+    std::vector<FragmentView> fragments;
+    if (packet->getDataSize() < mtu)
+    {
+        return fragments;
+    }
+
+    auto const layout = ComputeFragmentLayout(packet->getDataSize(), mtu);
+    auto const fragmentRealm = packet->retrieveCounter().value();
+
+    fragments.resize(layout._count);
+    for (std::size_t i = 0; i < layout._count; ++i)
+    {
+        auto& fragment = fragments[i];
+        fragment._source = packet;
+        fragment._offset = i * layout._maxFragmentSize;
+        fragment._size = layout.getFragmentSize(i);
+        fragment._realm = fragmentRealm;
+        fragment._index = static_cast<ProtocolPacket::CounterType>(i);
+        fragment._total = static_cast<decltype(FragmentView::_total)>(layout._count);
     }
     return fragments;
 }
@@ -202,8 +292,7 @@ PacketDefragmentation::Result PacketDefragmentation::process(ReceivedPacketPtr&&
         auto& fragment = data._fragments[counter];
         if (fragment != nullptr)
         {
-            //Already received, some duplicate, discarded
-            this->g_data.erase(itData);
+            //Already received, a retransmitted duplicate, only this fragment is discarded
             return {Results::DISCARDED, id};
         }
 
@@ -223,8 +312,17 @@ PacketDefragmentation::Result PacketDefragmentation::process(ReceivedPacketPtr&&
     InternalFragmentedPacketData fragmentedData{};
     packet->packet().unpack(ProtocolPacket::HeaderSize, &fragmentedData, sizeof(fragmentedData));
 
+    if (counter >= fragmentedData._fragmentTotal)
+    {
+        return {Results::DISCARDED, id};
+    }
+
+    if (this->g_data.size() >= FGE_NET_DEFRAGMENTATION_CACHE_MAX)
+    { //Remove the oldest data, a late duplicate fragment can create data that will never be completed
+        this->g_data.erase(this->g_data.begin());
+    }
+
     this->g_data.emplace_back(id, fragmentedData._fragmentTotal)._fragments[counter] = std::move(packet);
-    ///TODO: remove the oldest data if the cache is full
     return {Results::WAITING, id};
 }
 ReceivedPacketPtr PacketDefragmentation::retrieve(ProtocolPacket::RealmType id, Identity const& client)
@@ -604,7 +702,35 @@ void PacketCache::push(TransmitPacketPtr const& packet)
     }
 }
 
+void PacketCache::push(std::span<FragmentView const> fragments)
+{
+    std::scoped_lock const lock(this->g_mutex);
+    if (!this->g_enable)
+    {
+        return;
+    }
+
+    for (auto const& fragment: fragments)
+    {
+        this->g_cache.emplace_back(fragment);
+    }
+    if (this->g_cache.size() >= FGE_NET_PACKET_CACHE_MAX)
+    {
+        FGE_DEBUG_PRINT("PacketCache: Cache reached maximum size");
+        this->g_alarm = true;
+    }
+}
+
 void PacketCache::acknowledgeReception(std::span<Label> labels)
+{
+    this->acknowledge(labels, false);
+}
+void PacketCache::acknowledgeFragmentReception(std::span<Label> labels)
+{
+    this->acknowledge(labels, true);
+}
+
+void PacketCache::acknowledge(std::span<Label> labels, bool fragments)
 {
     std::scoped_lock const lock(this->g_mutex);
 
@@ -618,7 +744,7 @@ void PacketCache::acknowledgeReception(std::span<Label> labels)
     {
         for (auto it = this->g_cache.begin(); it != this->g_cache.end(); ++it)
         {
-            if (it->_label == label)
+            if (it->_isFragment == fragments && it->_label == label)
             {
                 this->g_cache.erase(it);
                 break;
@@ -660,9 +786,10 @@ bool PacketCache::process(std::chrono::steady_clock::time_point const& timePoint
             if (it->_tryCount++ == 3)
             { //We loose this packet
 #ifdef FGE_DEF_DEBUG
-                auto const counter = it->_packet->retrieveCounter().value();
-                auto const reorderedCounter = it->_packet->retrieveReorderedCounter().value();
-                FGE_DEBUG_PRINT("PacketCache: Packet [{}/{}] lost after all tries", counter, reorderedCounter);
+                auto const counter = it->_label._counter;
+                auto const realm = it->_label._realm;
+                FGE_DEBUG_PRINT("PacketCache: {} [{}/{}] lost after all tries",
+                                it->_isFragment ? "Fragment" : "Packet", counter, realm);
 #endif
                 it = this->g_cache.erase(it);
                 client.advanceLostPacketCount();
@@ -672,13 +799,14 @@ bool PacketCache::process(std::chrono::steady_clock::time_point const& timePoint
             it->_time = timePoint;
 
 #ifdef FGE_DEF_DEBUG
-            auto const counter = it->_packet->retrieveCounter().value();
-            auto const reorderedCounter = it->_packet->retrieveReorderedCounter().value();
-            FGE_DEBUG_PRINT("re-transmit packet [{}/{}] try {}, as client didn't acknowledge it", counter,
-                            reorderedCounter, it->_tryCount);
+            auto const counter = it->_label._counter;
+            auto const realm = it->_label._realm;
+            FGE_DEBUG_PRINT("re-transmit {} [{}/{}] try {}, as client didn't acknowledge it",
+                            it->_isFragment ? "fragment" : "packet", counter, realm, it->_tryCount);
 #endif
 
-            client.pushForcedFrontPacket(std::make_unique<ProtocolPacket>(*it->_packet));
+            //Only this packet/fragment is retransmitted
+            client.pushForcedFrontPacket(it->copyPacket());
 
             needSetAlarm = true;
         }
@@ -703,13 +831,29 @@ PacketCache::Data::Data(TransmitPacketPtr&& packet) :
         _time(std::chrono::steady_clock::now())
 {}
 
+PacketCache::Data::Data(FragmentView const& fragment) :
+        _fragment(fragment),
+        _isFragment(true),
+        _label(fragment._index, fragment._realm),
+        _time(std::chrono::steady_clock::now())
+{}
+
 PacketCache::Data& PacketCache::Data::operator=(TransmitPacketPtr&& packet)
 {
     this->_packet = std::move(packet);
+    this->_fragment = {};
+    this->_isFragment = false;
     this->_label._counter = this->_packet->retrieveCounter().value();
     this->_label._realm = this->_packet->retrieveRealm().value();
     this->_time = std::chrono::steady_clock::now();
     return *this;
 }
 
+TransmitPacketPtr PacketCache::Data::copyPacket() const
+{
+    auto packet = this->_isFragment ? this->_fragment.materialize() : std::make_unique<ProtocolPacket>(*this->_packet);
+    packet->markAsCached();
+    return packet;
+}
+
 } // namespace fge::net
@@ -147,6 +147,24 @@ std::optional<Error> ReturnPacketHandler::handleReturnPacket(ClientSharedPtr con
 
     clientContext._cache.acknowledgeReception(acknowledgedPackets);
 
+    //Extract acknowledged fragments
+    packet->packet() >> acknowledgedPacketsSize;
+    acknowledgedPackets.resize(acknowledgedPacketsSize);
+    for (SizeType i = 0; i < acknowledgedPacketsSize; ++i)
+    {
+        PacketCache::Label label;
+        packet->packet() >> label._counter >> label._realm;
+        if (!packet->isValid())
+        {
+            FGE_DEBUG_PRINT("received bad fragment label");
+            return Error(Error::Types::ERR_DATA, packet->getReadPos(), "received bad acknowledged fragment label data",
+                         func);
+        }
+        acknowledgedPackets[i] = label;
+    }
+
+    clientContext._cache.acknowledgeFragmentReception(acknowledgedPackets);
+
     this->_onClientReturnPacket.call(refClient, packet->getIdentity(), packet);
 
     packet.reset();
@@ -523,9 +541,12 @@ FluxProcessResults ServerNetFluxUdp::processUnknownClient(ClientSharedPtr& refCl
         using namespace fge::net::rules;
         std::string handshakeString;
         std::string versioningString;
+        CompressorLZ4Dictionary::Id dictionaryId{FGE_COMPRESSOR_LZ4_DICTIONARY_NONE};
         auto const err = RStringMustEqual(sizeof(FGE_NET_HANDSHAKE_STRING) - 1, packet->packet(), &handshakeString)
                                  .and_then([&](auto& chain) {
             return RStringRange(0, FGE_NET_MAX_VERSIONING_STRING_SIZE, chain, &versioningString);
+        }).and_then([&](auto& chain) {
+            return RValid<CompressorLZ4Dictionary::Id>({chain.packet(), &dictionaryId});
         }).final();
         if (err || handshakeString != FGE_NET_HANDSHAKE_STRING ||
             versioningString != this->g_server->getVersioningString())
@@ -540,6 +561,16 @@ FluxProcessResults ServerNetFluxUdp::processUnknownClient(ClientSharedPtr& refCl
         refClient->getStatus().setNetworkStatus(ClientStatus::NetworkStatus::ACKNOWLEDGED);
         refClient->getStatus().setTimeout(FGE_NET_STATUS_DEFAULT_TIMEOUT);
 
+        //Negotiate the compression dictionary, both sides must have the same one
+        auto dictionary = this->g_server->getCompressionDictionary();
+        if (!dictionary || dictionary->getId() != dictionaryId)
+        {
+            dictionary.reset();
+        }
+        refClient->_context._compressor.setDictionary(dictionary);
+        refClient->_context._compressorHC.setDictionary(dictionary);
+        refClient->_context._decompressor.setDictionary(dictionary);
+
         //Create crypt context
         if (!CryptServerCreate(this->g_server->getCryptContext(), refClient->getCryptInfo()))
         {
@@ -557,7 +588,7 @@ FluxProcessResults ServerNetFluxUdp::processUnknownClient(ClientSharedPtr& refCl
         //Respond to the handshake
         auto responsePacket = CreatePacket(NET_INTERNAL_ID_FGE_HANDSHAKE);
         responsePacket->doNotReorder().doNotFragment().doNotDiscard();
-        responsePacket->packet() << FGE_NET_HANDSHAKE_STRING;
+        responsePacket->packet() << FGE_NET_HANDSHAKE_STRING << refClient->_context._compressor.getDictionaryId();
         refClient->pushPacket(std::move(responsePacket));
         this->g_server->notifyTransmission();
 
@@ -109,13 +109,13 @@ fge::ObjectDataShared ChildObjectsAccessor::addNewObject(fge::ObjectPtr&& newObj
     {
         it = this->g_data.insert(
                 this->g_data.end(),
-                {newObject.get(), std::make_shared<fge::ObjectData>(linkedScene, std::move(newObject), ownerSid)});
+                {newObject.get(), fge::MakeObjectData(linkedScene, std::move(newObject), ownerSid)});
     }
     else
     {
         it = this->g_data.insert(
                 this->g_data.begin() + static_cast<std::vector<DataContext>::difference_type>(insertionIndex),
-                {newObject.get(), std::make_shared<fge::ObjectData>(linkedScene, std::move(newObject), ownerSid)});
+                {newObject.get(), fge::MakeObjectData(linkedScene, std::move(newObject), ownerSid)});
     }
 
     it->_objData->setParent(owner);
@@ -177,8 +177,7 @@ fge::ObjectDataShared ChildObjectsAccessor::addNewDetachedObject(fge::ObjectPtr&
         return nullptr;
     }
 
-    auto detachedData =
-            std::make_shared<fge::ObjectData>(linkedScene, std::move(newObject), FGE_SCENE_BAD_SID, newPlan);
+    auto detachedData = fge::MakeObjectData(linkedScene, std::move(newObject), FGE_SCENE_BAD_SID, newPlan);
 
     detachedData->setParent(owner);
     detachedData->g_contextFlags.set(OBJ_CONTEXT_DETACHED);
@@ -0,0 +1,466 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/object/C_objAnimBatches.hpp"
+#include "FastEngine/manager/texture_manager.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace fge
+{
+
+ObjAnimationBatches::ObjAnimationBatches() :
+        g_tickDuration(std::chrono::milliseconds{FGE_OBJANIM_DEFAULT_TICKDURATION_MS})
+{
+    this->refreshFrameTable();
+}
+ObjAnimationBatches::ObjAnimationBatches(fge::Animation const& animation) :
+        g_animation(animation),
+        g_tickDuration(std::chrono::milliseconds{FGE_OBJANIM_DEFAULT_TICKDURATION_MS})
+{
+    this->refreshFrameTable();
+}
+
+void ObjAnimationBatches::setAnimation(fge::Animation const& animation)
+{
+    this->g_animation = animation;
+    this->refreshFrameTable();
+
+    for (std::size_t i = 0; i < this->g_groupIndices.size(); ++i)
+    {
+        if (this->g_groupIndices[i] >= this->g_groupTable.size())
+        {
+            this->g_groupIndices[i] = 0;
+        }
+        this->applyFrame(i);
+    }
+}
+fge::Animation const& ObjAnimationBatches::getAnimation() const
+{
+    return this->g_animation;
+}
+
+void ObjAnimationBatches::setTickDuration(std::chrono::milliseconds const& tms)
+{
+    this->g_tickDuration = tms;
+    for (std::size_t i = 0; i < this->g_frameDurations.size(); ++i)
+    {
+        this->applyFrame(i);
+    }
+}
+std::chrono::microseconds const& ObjAnimationBatches::getTickDuration() const
+{
+    return this->g_tickDuration;
+}
+
+fge::Transformable& ObjAnimationBatches::addInstance(Index groupIndex, Index frameIndex)
+{
+    auto& transformable = this->fge::ObjSpriteBatches::addSprite({}, 0);
+
+    //New instances take the play mode of the animation
+    uint8_t flags = INSTANCE_FLAG_NONE;
+    flags |= this->g_animation.isLoop() ? INSTANCE_FLAG_LOOP : INSTANCE_FLAG_NONE;
+    flags |= this->g_animation.isReverse() ? INSTANCE_FLAG_REVERSE : INSTANCE_FLAG_NONE;
+    flags |= this->g_animation.isHorizontalFlipped() ? INSTANCE_FLAG_FLIP_HORIZONTAL : INSTANCE_FLAG_NONE;
+
+    this->g_elapsedTimes.push_back(0);
+    this->g_frameDurations.push_back(0);
+    this->g_running.push_back(1);
+    this->g_groupIndices.push_back(groupIndex < this->g_groupTable.size() ? groupIndex : 0);
+    this->g_frameIndices.push_back(frameIndex);
+    this->g_flags.push_back(flags);
+
+    this->applyFrame(this->g_elapsedTimes.size() - 1);
+    return transformable;
+}
+void ObjAnimationBatches::resizeInstances(std::size_t size)
+{
+    std::size_t const oldSize = this->g_elapsedTimes.size();
+
+    this->fge::ObjSpriteBatches::resize(size);
+
+    uint8_t flags = INSTANCE_FLAG_NONE;
+    flags |= this->g_animation.isLoop() ? INSTANCE_FLAG_LOOP : INSTANCE_FLAG_NONE;
+    flags |= this->g_animation.isReverse() ? INSTANCE_FLAG_REVERSE : INSTANCE_FLAG_NONE;
+    flags |= this->g_animation.isHorizontalFlipped() ? INSTANCE_FLAG_FLIP_HORIZONTAL : INSTANCE_FLAG_NONE;
+
+    this->g_elapsedTimes.resize(size, 0);
+    this->g_frameDurations.resize(size, 0);
+    this->g_running.resize(size, 1);
+    this->g_groupIndices.resize(size, 0);
+    this->g_frameIndices.resize(size, 0);
+    this->g_flags.resize(size, flags);
+
+    for (std::size_t i = oldSize; i < size; ++i)
+    {
+        this->applyFrame(i);
+    }
+}
+void ObjAnimationBatches::clearInstances()
+{
+    this->fge::ObjSpriteBatches::clear();
+
+    this->g_elapsedTimes.clear();
+    this->g_frameDurations.clear();
+    this->g_running.clear();
+    this->g_groupIndices.clear();
+    this->g_frameIndices.clear();
+    this->g_flags.clear();
+}
+std::size_t ObjAnimationBatches::getInstanceCount() const
+{
+    return this->g_elapsedTimes.size();
+}
+
+bool ObjAnimationBatches::setInstanceGroup(std::size_t index, Index groupIndex)
+{
+    if (index >= this->g_groupIndices.size() || groupIndex >= this->g_groupTable.size())
+    {
+        return false;
+    }
+
+    if (this->g_groupIndices[index] != groupIndex)
+    {
+        this->g_groupIndices[index] = groupIndex;
+        //Like Animation::setGroup, the frame index is kept if it is valid in the new group
+        if (this->g_frameIndices[index] >= this->g_groupTable[groupIndex]._frameCount)
+        {
+            this->g_frameIndices[index] = 0;
+        }
+        this->applyFrame(index);
+    }
+    return true;
+}
+bool ObjAnimationBatches::setInstanceGroup(std::size_t index, std::string_view group)
+{
+    auto const& groups = this->g_animation.retrieve()->_groups;
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        if (groups[i]._groupName == group)
+        {
+            return this->setInstanceGroup(index, static_cast<Index>(i));
+        }
+    }
+    return false;
+}
+void ObjAnimationBatches::setInstanceFrame(std::size_t index, Index frameIndex)
+{
+    if (index < this->g_frameIndices.size())
+    {
+        this->g_frameIndices[index] = frameIndex;
+        this->g_elapsedTimes[index] = 0;
+        this->applyFrame(index);
+    }
+}
+std::optional<ObjAnimationBatches::Index> ObjAnimationBatches::getInstanceGroup(std::size_t index) const
+{
+    if (index < this->g_groupIndices.size())
+    {
+        return this->g_groupIndices[index];
+    }
+    return std::nullopt;
+}
+std::optional<ObjAnimationBatches::Index> ObjAnimationBatches::getInstanceFrame(std::size_t index) const
+{
+    if (index < this->g_frameIndices.size())
+    {
+        return this->g_frameIndices[index];
+    }
+    return std::nullopt;
+}
+
+void ObjAnimationBatches::setInstancePause(std::size_t index, bool flag)
+{
+    if (index < this->g_running.size())
+    {
+        this->g_running[index] = flag ? 0 : 1;
+    }
+}
+void ObjAnimationBatches::setInstanceLoop(std::size_t index, bool flag)
+{
+    if (index < this->g_flags.size())
+    {
+        this->g_flags[index] = flag ? this->g_flags[index] | INSTANCE_FLAG_LOOP
+                                    : this->g_flags[index] & ~INSTANCE_FLAG_LOOP;
+    }
+}
+void ObjAnimationBatches::setInstanceReverse(std::size_t index, bool flag)
+{
+    if (index < this->g_flags.size())
+    {
+        this->g_flags[index] = flag ? this->g_flags[index] | INSTANCE_FLAG_REVERSE
+                                    : this->g_flags[index] & ~INSTANCE_FLAG_REVERSE;
+    }
+}
+void ObjAnimationBatches::setInstanceHorizontalFlip(std::size_t index, bool flag)
+{
+    if (index < this->g_flags.size())
+    {
+        this->g_flags[index] = flag ? this->g_flags[index] | INSTANCE_FLAG_FLIP_HORIZONTAL
+                                    : this->g_flags[index] & ~INSTANCE_FLAG_FLIP_HORIZONTAL;
+        this->applyFrame(index);
+    }
+}
+bool ObjAnimationBatches::isInstancePaused(std::size_t index) const
+{
+    return index < this->g_running.size() && this->g_running[index] == 0;
+}
+bool ObjAnimationBatches::isInstanceLoop(std::size_t index) const
+{
+    return index < this->g_flags.size() && (this->g_flags[index] & INSTANCE_FLAG_LOOP) != 0;
+}
+bool ObjAnimationBatches::isInstanceReverse(std::size_t index) const
+{
+    return index < this->g_flags.size() && (this->g_flags[index] & INSTANCE_FLAG_REVERSE) != 0;
+}
+bool ObjAnimationBatches::isInstanceHorizontalFlipped(std::size_t index) const
+{
+    return index < this->g_flags.size() && (this->g_flags[index] & INSTANCE_FLAG_FLIP_HORIZONTAL) != 0;
+}
+
+FGE_OBJ_UPDATE_BODY(ObjAnimationBatches)
+{
+    std::size_t const count = this->g_elapsedTimes.size();
+    auto const delta = static_cast<uint32_t>(
+            std::clamp<fge::DeltaTime::rep>(deltaTime.count(), 0, std::numeric_limits<uint32_t>::max()));
+
+    uint32_t* elapsedTimes = this->g_elapsedTimes.data();
+    uint32_t const* frameDurations = this->g_frameDurations.data();
+    uint32_t const* running = this->g_running.data();
+
+    //Branchless pass over the timers, paused instances add 0
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        elapsedTimes[i] += delta * running[i];
+    }
+
+    //Only the instances at the end of their frame are touched
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (elapsedTimes[i] >= frameDurations[i])
+        {
+            this->advanceInstance(i);
+        }
+    }
+}
+
+void ObjAnimationBatches::save(nlohmann::json& jsonObject)
+{
+    fge::ObjSpriteBatches::save(jsonObject);
+
+    jsonObject["animation"] = this->g_animation;
+    jsonObject["tickDuration"] = static_cast<uint16_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(this->g_tickDuration).count());
+}
+void ObjAnimationBatches::load(nlohmann::json& jsonObject, std::filesystem::path const& filePath)
+{
+    fge::ObjSpriteBatches::load(jsonObject, filePath);
+
+    auto const animation = jsonObject.value<fge::Animation>("animation", fge::Animation{FGE_ANIM_BAD});
+    this->g_tickDuration =
+            std::chrono::milliseconds(jsonObject.value<uint16_t>("tickDuration", FGE_OBJANIM_DEFAULT_TICKDURATION_MS));
+
+    this->setAnimation(animation);
+}
+void ObjAnimationBatches::pack(fge::net::Packet& pck)
+{
+    fge::ObjSpriteBatches::pack(pck);
+
+    pck << this->g_animation;
+    pck << static_cast<uint16_t>(std::chrono::duration_cast<std::chrono::milliseconds>(this->g_tickDuration).count());
+}
+void ObjAnimationBatches::unpack(fge::net::Packet const& pck)
+{
+    fge::ObjSpriteBatches::unpack(pck);
+
+    fge::Animation animation;
+    pck >> animation;
+
+    uint16_t tmpTick = FGE_OBJANIM_DEFAULT_TICKDURATION_MS;
+    pck >> tmpTick;
+    this->g_tickDuration = std::chrono::milliseconds(tmpTick);
+
+    this->setAnimation(animation);
+}
+
+char const* ObjAnimationBatches::getClassName() const
+{
+    return FGE_OBJANIMBATCHES_CLASSNAME;
+}
+char const* ObjAnimationBatches::getReadableClassName() const
+{
+    return "animation batches";
+}
+
+void ObjAnimationBatches::refreshFrameTable()
+{
+    this->g_frameTable.clear();
+    this->g_groupTable.clear();
+    this->fge::ObjSpriteBatches::clearTexture();
+
+    auto const* data = this->g_animation.retrieve();
+    auto const& badTexture = fge::texture::gManager.getBadElement()->_ptr;
+
+    for (auto const& group: data->_groups)
+    {
+        auto& groupData = this->g_groupTable.emplace_back();
+        groupData._firstFrame = static_cast<uint32_t>(this->g_frameTable.size());
+        groupData._frameCount = static_cast<Index>(group._frames.size());
+
+        for (auto const& frame: group._frames)
+        {
+            auto& frameData = this->g_frameTable.emplace_back();
+            frameData._ticks = frame._ticks;
+
+            std::shared_ptr<fge::TextureType> const* texture = &badTexture;
+            if (data->_type == fge::anim::AnimationType::ANIM_TYPE_TILESET)
+            {
+                if (frame._texturePosition != FGE_NUMERIC_LIMITS_VECTOR_MAX(fge::Vector2u))
+                {
+                    auto const gridSize = static_cast<fge::Vector2i>(data->_tilesetGridSize);
+                    auto const gridPosition = static_cast<fge::Vector2i>(frame._texturePosition);
+                    frameData._textureRect = {{gridPosition.x * gridSize.x, gridPosition.y * gridSize.y}, gridSize};
+                    texture = &data->_tilesetTexture;
+                }
+            }
+            else if (frame._texture)
+            { //Frames of a separate files animation share an atlas texture
+                frameData._textureRect = frame._textureRect;
+                texture = &frame._texture;
+            }
+
+            if (texture == &badTexture)
+            {
+                frameData._textureRect = {{0, 0}, static_cast<fge::Vector2i>(badTexture->getSize())};
+            }
+            frameData._textureIndex = this->getTextureIndex(*texture);
+        }
+    }
+}
+uint32_t ObjAnimationBatches::getTextureIndex(std::shared_ptr<fge::TextureType> const& texture)
+{
+    for (std::size_t i = 0; i < this->getTextureCount(); ++i)
+    {
+        if (this->getTexture(i).getSharedData() == texture)
+        {
+            return static_cast<uint32_t>(i);
+        }
+    }
+
+    auto const& badTexture = fge::texture::gManager.getBadElement()->_ptr;
+    //One slot is kept for the bad texture, extra textures fallback to it
+    if (texture != badTexture && this->getTextureCount() + 1 >= FGE_OBJSPRITEBATCHES_MAXIMUM_TEXTURES)
+    {
+        return this->getTextureIndex(badTexture);
+    }
+
+    this->fge::ObjSpriteBatches::addTexture(texture);
+    return static_cast<uint32_t>(this->getTextureCount() - 1);
+}
+void ObjAnimationBatches::advanceInstance(std::size_t index)
+{
+    this->g_elapsedTimes[index] = 0;
+
+    auto const groupIndex = this->g_groupIndices[index];
+    if (groupIndex >= this->g_groupTable.size())
+    {
+        return;
+    }
+    auto const frameCount = this->g_groupTable[groupIndex]._frameCount;
+    auto const flags = this->g_flags[index];
+    auto& frameIndex = this->g_frameIndices[index];
+    auto const oldFrameIndex = frameIndex;
+
+    //Same behavior as Animation::nextFrame
+    if ((flags & INSTANCE_FLAG_REVERSE) != 0)
+    {
+        if (frameIndex == 0)
+        {
+            if ((flags & INSTANCE_FLAG_LOOP) != 0 && frameCount != 0)
+            {
+                frameIndex = frameCount - 1;
+            }
+        }
+        else
+        {
+            --frameIndex;
+        }
+    }
+    else
+    {
+        if (frameIndex + 1 >= frameCount)
+        {
+            if ((flags & INSTANCE_FLAG_LOOP) != 0)
+            {
+                frameIndex = 0;
+            }
+        }
+        else
+        {
+            ++frameIndex;
+        }
+    }
+
+    if (frameIndex != oldFrameIndex)
+    {
+        this->applyFrame(index);
+    }
+}
+void ObjAnimationBatches::applyFrame(std::size_t index)
+{
+    auto const* frame = this->getFrameData(this->g_groupIndices[index], this->g_frameIndices[index]);
+    if (frame == nullptr)
+    { //Like ObjAnimation, an invalid frame restart the animation
+        this->g_frameIndices[index] = 0;
+        frame = this->getFrameData(this->g_groupIndices[index], 0);
+        if (frame == nullptr)
+        {
+            this->g_frameDurations[index] = std::numeric_limits<uint32_t>::max();
+            return;
+        }
+    }
+
+    this->g_frameDurations[index] = static_cast<uint32_t>(
+            std::min<int64_t>(this->g_tickDuration.count() * frame->_ticks, std::numeric_limits<uint32_t>::max()));
+
+    auto rect = frame->_textureRect;
+    if ((this->g_flags[index] & INSTANCE_FLAG_FLIP_HORIZONTAL) != 0)
+    {
+        rect._x += rect._width;
+        rect._width = -rect._width;
+    }
+
+    if (this->getSpriteTexture(index) != frame->_textureIndex)
+    {
+        this->fge::ObjSpriteBatches::setSpriteTexture(index, frame->_textureIndex);
+    }
+    this->fge::ObjSpriteBatches::setTextureRect(index, rect);
+}
+ObjAnimationBatches::FrameData const* ObjAnimationBatches::getFrameData(Index groupIndex, Index frameIndex) const
+{
+    if (groupIndex < this->g_groupTable.size())
+    {
+        auto const& group = this->g_groupTable[groupIndex];
+        if (frameIndex < group._frameCount)
+        {
+            return &this->g_frameTable[group._firstFrame + frameIndex];
+        }
+    }
+    return nullptr;
+}
+
+} // namespace fge
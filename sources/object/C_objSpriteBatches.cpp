@@ -103,6 +103,7 @@ void ObjSpriteBatches::resize(std::size_t size)
 
     this->g_instancesData.resize(size);
     this->g_instancesVertices.resize(size * FGE_OBJSPRITEBATCHES_VERTEX_COUNT);
+    this->g_needBuffersUpdate = true;
 
     if (size > oldSize)
     {
@@ -147,6 +148,14 @@ void ObjSpriteBatches::setSpriteTexture(std::size_t spriteIndex, uint32_t textur
         this->updateTexCoords(spriteIndex);
     }
 }
+std::optional<uint32_t> ObjSpriteBatches::getSpriteTexture(std::size_t spriteIndex) const
+{
+    if (spriteIndex < this->g_instancesData.size())
+    {
+        return this->g_instancesData[spriteIndex]._textureIndex;
+    }
+    return std::nullopt;
+}
 
 std::size_t ObjSpriteBatches::getSpriteCount() const
 {
@@ -297,8 +306,9 @@ std::optional<fge::RectFloat> ObjSpriteBatches::getLocalBounds(std::size_t index
 {
     if (index < this->g_instancesData.size())
     {
-        auto const width = static_cast<float>(this->g_instancesData[index]._textureRect._width);
-        auto const height = static_cast<float>(this->g_instancesData[index]._textureRect._height);
+        //A negative size flip the texture, not the sprite
+        auto const width = static_cast<float>(std::abs(this->g_instancesData[index]._textureRect._width));
+        auto const height = static_cast<float>(std::abs(this->g_instancesData[index]._textureRect._height));
 
         return fge::RectFloat{{0.f, 0.f}, {width, height}};
     }
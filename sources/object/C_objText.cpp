@@ -19,10 +19,26 @@
 #include "FastEngine/graphic/C_ftFont.hpp"
 #include "FastEngine/manager/font_manager.hpp"
 #include "FastEngine/manager/shader_manager.hpp"
+#include <algorithm>
 
 namespace fge
 {
 
+namespace
+{
+
+struct SdfConstantData
+{
+    glm::vec4 _outlineColor;
+    glm::vec4 _shadowColor;
+    glm::vec2 _shadowOffset; //!< In texture coordinates
+    float _outlineWidth;     //!< In distance units, the glyph edge is at 128/255
+};
+
+constexpr uint8_t gPackShadowFlag = 1 << 7; //!< Packed with the style when the shadow is visible
+
+} //end namespace
+
 Character::Character() :
         g_vertices(fge::vulkan::GetActiveContext()),
         g_outlineVertices(fge::vulkan::GetActiveContext())
@@ -76,13 +92,12 @@ void Character::addGlyphQuad(bool outlineVertices,
                              fge::Vector2f const& size,
                              fge::Glyph const& glyph,
                              fge::Vector2i const& textureSize,
-                             float italicShear)
+                             float italicShear,
+                             float padding)
 {
     fge::vulkan::VertexBuffer* vertices = outlineVertices ? &this->g_outlineVertices : &this->g_vertices;
     fge::Color const color = outlineVertices ? this->g_outlineColor : this->g_fillColor;
 
-    float const padding = 1.0f;
-
     float const left = glyph._bounds._x - padding;
     float const top = glyph._bounds._y - padding;
     float const right = glyph._bounds._x + glyph._bounds._width + padding;
@@ -277,6 +292,15 @@ void ObjText::setOutlineThickness(float thickness)
     }
 }
 
+void ObjText::setShadowColor(fge::Color const& color)
+{
+    this->g_shadowColor = color;
+}
+void ObjText::setShadowOffset(fge::Vector2f const& offset)
+{
+    this->g_shadowOffset = offset;
+}
+
 tiny_utf8::string const& ObjText::getString() const
 {
     return this->g_string;
@@ -325,6 +349,15 @@ float ObjText::getOutlineThickness() const
     return this->g_outlineThickness;
 }
 
+fge::Color const& ObjText::getShadowColor() const
+{
+    return this->g_shadowColor;
+}
+fge::Vector2f const& ObjText::getShadowOffset() const
+{
+    return this->g_shadowOffset;
+}
+
 fge::Vector2f ObjText::findCharacterPos(std::size_t index) const
 {
     this->ensureGeometryUpdate();
@@ -368,13 +401,44 @@ FGE_OBJ_DRAW_BODY(ObjText)
         }
         auto const viewTransform = target.getView().getProjection() * target.getView().getTransform();
 
+        auto const* font = this->g_font.retrieve();
+        auto const& fontTexture = font->getTexture(this->g_characterSize);
+        bool const isSdf = font->getRenderMode() == fge::FreeTypeFont::RenderModes::SDF;
+
         auto characterStates = states.copy();
-        characterStates._resTextures.set(&this->g_font.retrieve()->getTexture(this->g_characterSize), 1);
+        characterStates._resTextures.set(&fontTexture, 1);
+
+        // Distance field glyphs draw their outline and shadow in a single pass
+        SdfConstantData sdfConstantData{};
+        fge::RenderResourcePushConstants::PushConstantData const sdfPushConstant{
+                VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(SdfConstantData), &sdfConstantData};
+        if (isSdf)
+        {
+            // Converting pixels of the character size to pixels of the SDF page
+            float const scale = font->getGlyphScale(this->g_characterSize);
+            float const spread = static_cast<float>(FGE_FONT_SDF_SPREAD);
+            float const maxDistance = 128.0f / 255.0f;
+
+            sdfConstantData._outlineColor = this->g_outlineColor;
+            sdfConstantData._shadowColor = this->g_shadowColor;
+            auto const textureSize = fontTexture.getSize();
+            sdfConstantData._shadowOffset = {
+                    std::clamp(this->g_shadowOffset.x / scale, -spread, spread) / static_cast<float>(textureSize.x),
+                    std::clamp(this->g_shadowOffset.y / scale, -spread, spread) / static_cast<float>(textureSize.y)};
+            // Kept strictly below the spread, the empty texels around the glyphs must stay transparent
+            sdfConstantData._outlineWidth = std::min(std::abs(this->g_outlineThickness) / scale / spread * maxDistance,
+                                                     (spread - 1.0f) / spread * maxDistance);
+
+            characterStates._shaderVertex = fge::shader::gManager.getElement(FGE_SHADER_DEFAULT_VERTEX)->_ptr.get();
+            characterStates._shaderFragment =
+                    fge::shader::gManager.getElement(FGE_SHADER_DEFAULT_SDF_FRAGMENT)->_ptr.get();
+            characterStates._resPushConstants.set(&sdfPushConstant, 1);
+        }
 
         bool transformDataUpdated = false;
         uint32_t firstGlobalTransformIndex = target.getContext().getGlobalTransform()._transformsCount;
 
-        if (this->g_outlineThickness != 0.0f)
+        if (this->g_outlineThickness != 0.0f && !isSdf)
         {
             transformDataUpdated = true;
 
@@ -439,6 +503,8 @@ void ObjText::save(nlohmann::json& jsonObject)
     jsonObject["fillColor"] = static_cast<uint32_t>(this->g_fillColor.toInteger());
     jsonObject["outlineColor"] = static_cast<uint32_t>(this->g_outlineColor.toInteger());
     jsonObject["outlineThickness"] = this->g_outlineThickness;
+    jsonObject["shadowColor"] = static_cast<uint32_t>(this->g_shadowColor.toInteger());
+    jsonObject["shadowOffset"] = this->g_shadowOffset;
 }
 void ObjText::load(nlohmann::json& jsonObject, std::filesystem::path const& filePath)
 {
@@ -453,6 +519,8 @@ void ObjText::load(nlohmann::json& jsonObject, std::filesystem::path const& file
     this->g_fillColor = fge::Color{jsonObject.value<uint32_t>("fillColor", fge::Color::White.toInteger())};
     this->g_outlineColor = fge::Color{jsonObject.value<uint32_t>("outlineColor", fge::Color::Black.toInteger())};
     this->g_outlineThickness = jsonObject.value<float>("outlineThickness", 0.0f);
+    this->g_shadowColor = fge::Color{jsonObject.value<uint32_t>("shadowColor", fge::Color::Transparent.toInteger())};
+    this->g_shadowOffset = jsonObject.value<fge::Vector2f>("shadowOffset", {0.0f, 0.0f});
 
     this->g_geometryNeedUpdate = true;
 }
@@ -465,9 +533,14 @@ void ObjText::pack(fge::net::Packet& pck)
     pck << this->g_font;
     pck << this->g_characterSize;
     pck << this->g_letterSpacingFactor << this->g_lineSpacingFactor;
-    pck << this->g_style;
+    bool const hasShadow = this->g_shadowColor._a != 0;
+    pck << static_cast<uint8_t>(this->g_style | (hasShadow ? gPackShadowFlag : 0));
     pck << this->g_fillColor << this->g_outlineColor;
     pck << this->g_outlineThickness;
+    if (hasShadow)
+    {
+        pck << this->g_shadowColor << this->g_shadowOffset;
+    }
 }
 void ObjText::unpack(fge::net::Packet const& pck)
 {
@@ -477,9 +550,20 @@ void ObjText::unpack(fge::net::Packet const& pck)
     pck >> this->g_font;
     pck >> this->g_characterSize;
     pck >> this->g_letterSpacingFactor >> this->g_lineSpacingFactor;
-    pck >> this->g_style;
+    uint8_t style = Regular;
+    pck >> style;
+    this->g_style = static_cast<uint8_t>(style & ~gPackShadowFlag);
     pck >> this->g_fillColor >> this->g_outlineColor;
     pck >> this->g_outlineThickness;
+    if ((style & gPackShadowFlag) != 0)
+    {
+        pck >> this->g_shadowColor >> this->g_shadowOffset;
+    }
+    else
+    {
+        this->g_shadowColor = fge::Color::Transparent;
+        this->g_shadowOffset = {0.0f, 0.0f};
+    }
 
     this->g_geometryNeedUpdate = true;
 }
@@ -513,14 +597,15 @@ void ObjText::ensureGeometryUpdate() const
     auto const* font = this->g_font.retrieve();
     auto const& fontTexture = font->getTexture(this->g_characterSize);
 
-    // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!this->g_geometryNeedUpdate && fontTexture.getModificationCount() == this->g_fontTextureModificationCount)
+    // Do nothing, if geometry has not changed and the font texture coordinates are still valid
+    auto const fontPageRevision = font->getPageRevision(this->g_characterSize);
+    if (!this->g_geometryNeedUpdate && fontPageRevision == this->g_fontPageRevision)
     {
         return;
     }
 
-    // Save the current fonts texture id
-    this->g_fontTextureModificationCount = fontTexture.getModificationCount();
+    // Save the current font page revision
+    this->g_fontPageRevision = fontPageRevision;
 
     // Mark geometry as updated
     this->g_geometryNeedUpdate = false;
@@ -538,6 +623,13 @@ void ObjText::ensureGeometryUpdate() const
     this->g_characters.resize(this->g_string.length());
     std::size_t usedCharacters = 0;
 
+    // Distance field glyphs have their outline drawn by the shader and a margin of the SDF spread
+    bool const isSdf = font->getRenderMode() == fge::FreeTypeFont::RenderModes::SDF;
+    bool const outlineGeometry = this->g_outlineThickness != 0.0f && !isSdf;
+    float const glyphPadding = isSdf ? 0.0f : 1.0f;
+    float const glyphMargin =
+            isSdf ? static_cast<float>(FGE_FONT_SDF_SPREAD) * font->getGlyphScale(this->g_characterSize) : 0.0f;
+
     // Compute values related to the text style
     bool const isBold = static_cast<bool>(this->g_style & Bold);
     bool const isUnderlined = static_cast<bool>(this->g_style & Underlined);
@@ -593,7 +685,7 @@ void ObjText::ensureGeometryUpdate() const
         {
             character.addLine(false, size.x, size.y, underlineOffset, underlineThickness);
 
-            if (this->g_outlineThickness != 0.0f)
+            if (outlineGeometry)
             {
                 character.addLine(true, size.x, size.y, underlineOffset, underlineThickness, this->g_outlineThickness);
             }
@@ -604,7 +696,7 @@ void ObjText::ensureGeometryUpdate() const
         {
             character.addLine(false, size.x, size.y, strikeThroughOffset, underlineThickness);
 
-            if (this->g_outlineThickness != 0)
+            if (outlineGeometry)
             {
                 character.addLine(true, size.x, size.y, strikeThroughOffset, underlineThickness,
                                   this->g_outlineThickness);
@@ -642,7 +734,7 @@ void ObjText::ensureGeometryUpdate() const
                 {
                     character.addLine(false, size.x, size.y, underlineOffset, underlineThickness);
 
-                    if (this->g_outlineThickness != 0.0f)
+                    if (outlineGeometry)
                     {
                         character.addLine(true, size.x, size.y, underlineOffset, underlineThickness,
                                           this->g_outlineThickness);
@@ -654,7 +746,7 @@ void ObjText::ensureGeometryUpdate() const
                 {
                     character.addLine(false, size.x, size.y, strikeThroughOffset, underlineThickness);
 
-                    if (this->g_outlineThickness != 0.0f)
+                    if (outlineGeometry)
                     {
                         character.addLine(true, size.x, size.y, strikeThroughOffset, underlineThickness,
                                           this->g_outlineThickness);
@@ -673,7 +765,7 @@ void ObjText::ensureGeometryUpdate() const
         }
 
         // Apply the outline
-        if (this->g_outlineThickness != 0.0f)
+        if (outlineGeometry)
         {
             fge::Glyph const& glyph = font->getGlyph(curChar, this->g_characterSize, isBold, this->g_outlineThickness);
 
@@ -685,7 +777,7 @@ void ObjText::ensureGeometryUpdate() const
         fge::Glyph const& glyph = font->getGlyph(curChar, this->g_characterSize, isBold);
 
         // Add the glyph to the vertices
-        character.addGlyphQuad(false, size, glyph, fontTexture.getSize(), italicShear);
+        character.addGlyphQuad(false, size, glyph, fontTexture.getSize(), italicShear, glyphPadding);
         character.setPosition(position);
 
         float characterLength = glyph._advance + letterSpacing;
@@ -694,7 +786,7 @@ void ObjText::ensureGeometryUpdate() const
         {
             character.addLine(false, characterLength, size.y, underlineOffset, underlineThickness);
 
-            if (this->g_outlineThickness != 0.0f)
+            if (outlineGeometry)
             {
                 character.addLine(true, characterLength, size.y, underlineOffset, underlineThickness,
                                   this->g_outlineThickness);
@@ -706,7 +798,7 @@ void ObjText::ensureGeometryUpdate() const
         {
             character.addLine(false, characterLength, size.y, strikeThroughOffset, underlineThickness);
 
-            if (this->g_outlineThickness != 0.0f)
+            if (outlineGeometry)
             {
                 character.addLine(true, characterLength, size.y, strikeThroughOffset, underlineThickness,
                                   this->g_outlineThickness);
@@ -714,10 +806,10 @@ void ObjText::ensureGeometryUpdate() const
         }
 
         // Update the current bounds
-        float left = glyph._bounds._x;
-        float top = glyph._bounds._y;
-        float right = glyph._bounds._x + glyph._bounds._width;
-        float bottom = glyph._bounds._y + glyph._bounds._height;
+        float left = glyph._bounds._x + glyphMargin;
+        float top = glyph._bounds._y + glyphMargin;
+        float right = glyph._bounds._x + glyph._bounds._width - glyphMargin;
+        float bottom = glyph._bounds._y + glyph._bounds._height - glyphMargin;
 
         minX = std::min(minX, size.x + position.x + left - italicShear * bottom);
         maxX = std::max(maxX, size.x + position.x + right - italicShear * top);
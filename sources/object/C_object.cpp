@@ -27,18 +27,21 @@ namespace fge
 Object::Object() :
         fge::Anchor(this),
         fge::OwnView(),
+        _tags(this),
         _children(this)
 {}
 Object::Object(Object const& r) :
         fge::Transformable(r),
         fge::Anchor(this, r),
         fge::OwnView(r),
+        _tags(this),
         _children(this)
 {}
 Object::Object(Object&& r) noexcept :
         fge::Transformable(std::move(r)),
         fge::Anchor(this, r),
         fge::OwnView(r),
+        _tags(this),
         _children(this)
 {}
 
@@ -96,7 +99,7 @@ void Object::save(nlohmann::json& jsonObject)
     jsonObject["tags"] = nlohmann::json::array();
     for (auto const& tag: this->_tags)
     {
-        jsonObject["tags"] += tag;
+        jsonObject["tags"] += tag.getString();
     }
 }
 void Object::load(nlohmann::json& jsonObject, [[maybe_unused]] std::filesystem::path const& filePath)
@@ -416,6 +416,30 @@ void CommandBuffer::copyBufferToImage(VkBuffer buffer,
     this->g_renderPassScope = RenderPassScopes::OUTSIDE;
     ++this->g_recordedCommands;
 }
+void CommandBuffer::copyBufferToImage(VkBuffer buffer,
+                                      VkImage image,
+                                      VkBufferImageCopy const* regions,
+                                      uint32_t regionCount)
+{
+    if (this->g_commandBuffer == VK_NULL_HANDLE)
+    {
+        throw fge::Exception("CommandBuffer not created !");
+    }
+    if (this->g_isEnded)
+    {
+        throw fge::Exception("CommandBuffer already ended !");
+    }
+    if (this->g_renderPassScope == RenderPassScopes::INSIDE)
+    {
+        throw fge::Exception("Command executed inside a render pass !");
+    }
+
+    vkCmdCopyBufferToImage(this->g_commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, regionCount,
+                           regions);
+
+    this->g_renderPassScope = RenderPassScopes::OUTSIDE;
+    ++this->g_recordedCommands;
+}
 void CommandBuffer::copyImageToBuffer(VkImage image, VkBuffer buffer, uint32_t width, uint32_t height)
 {
     if (this->g_commandBuffer == VK_NULL_HANDLE)
@@ -92,6 +92,7 @@ void LogicalDevice::create(PhysicalDevice& physicalDevice, VkSurfaceKHR surface)
     this->g_enabledFeatures.samplerAnisotropy = VK_TRUE;
     this->g_enabledFeatures.geometryShader = availableFeatures.geometryShader;
     this->g_enabledFeatures.multiDrawIndirect = availableFeatures.multiDrawIndirect;
+    this->g_enabledFeatures.textureCompressionBC = availableFeatures.textureCompressionBC;
 
     VkDeviceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
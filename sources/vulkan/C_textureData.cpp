@@ -0,0 +1,467 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FastEngine/vulkan/C_textureData.hpp"
+#include "FastEngine/graphic/pixelKernels.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+namespace fge::vulkan
+{
+
+namespace
+{
+
+//Avoid overflows of the level sizes with corrupted files, larger than any device limit
+constexpr uint32_t gMaxDimension = 1 << 16;
+
+constexpr uint8_t gKtx2Identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+constexpr std::size_t gKtx2LevelIndexOffset = 80;
+constexpr std::size_t gKtx2LevelIndexEntrySize = 24;
+
+constexpr uint32_t gDdsMagic = 0x20534444; //"DDS "
+constexpr std::size_t gDdsHeaderSize = 124;
+constexpr std::size_t gDdsDataOffset = 4 + gDdsHeaderSize;
+constexpr std::size_t gDdsDx10DataOffset = gDdsDataOffset + 20;
+constexpr uint32_t gDdsPixelFormatFourCC = 0x4;
+constexpr uint32_t gDdsPixelFormatRGB = 0x40;
+constexpr uint32_t gDdsCaps2CubeMap = 0x200;
+constexpr uint32_t gDdsCaps2Volume = 0x200000;
+constexpr uint32_t gDdsDx10Texture2D = 3;
+constexpr uint32_t gDdsDx10MiscTextureCube = 0x4;
+
+constexpr uint32_t MakeFourCC(char a, char b, char c, char d)
+{
+    return static_cast<uint32_t>(static_cast<uint8_t>(a)) | (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+}
+
+//KTX2 and DDS are little endian files
+template<class T>
+T ReadLE(uint8_t const* data)
+{
+    T value{0};
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= static_cast<T>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+VkFormat NormalizeFormat(VkFormat format)
+{
+    //sRGB formats are loaded as UNORM, the engine doesn't do any color space conversion
+    switch (format)
+    {
+    case VK_FORMAT_R8G8B8A8_UNORM:
+    case VK_FORMAT_R8G8B8A8_SRGB:
+        return VK_FORMAT_R8G8B8A8_UNORM;
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+    case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+    case VK_FORMAT_BC3_UNORM_BLOCK:
+    case VK_FORMAT_BC3_SRGB_BLOCK:
+        return VK_FORMAT_BC3_UNORM_BLOCK;
+    case VK_FORMAT_BC7_UNORM_BLOCK:
+    case VK_FORMAT_BC7_SRGB_BLOCK:
+        return VK_FORMAT_BC7_UNORM_BLOCK;
+    default:
+        return VK_FORMAT_UNDEFINED;
+    }
+}
+
+VkFormat DxgiToFormat(uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+    case 28: //DXGI_FORMAT_R8G8B8A8_UNORM
+    case 29: //DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+        return VK_FORMAT_R8G8B8A8_UNORM;
+    case 71: //DXGI_FORMAT_BC1_UNORM
+    case 72: //DXGI_FORMAT_BC1_UNORM_SRGB
+        return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+    case 77: //DXGI_FORMAT_BC3_UNORM
+    case 78: //DXGI_FORMAT_BC3_UNORM_SRGB
+        return VK_FORMAT_BC3_UNORM_BLOCK;
+    case 98: //DXGI_FORMAT_BC7_UNORM
+    case 99: //DXGI_FORMAT_BC7_UNORM_SRGB
+        return VK_FORMAT_BC7_UNORM_BLOCK;
+    default:
+        return VK_FORMAT_UNDEFINED;
+    }
+}
+
+fge::Vector2i ComputeLevelSize(fge::Vector2i const& size, uint32_t level)
+{
+    return {std::max(size.x >> level, 1), std::max(size.y >> level, 1)};
+}
+
+} // namespace
+
+void TextureData::clear()
+{
+    this->g_format = VK_FORMAT_UNDEFINED;
+    this->g_levels.clear();
+    this->g_data.clear();
+}
+
+bool TextureData::create(SDL_Surface const* surface, uint32_t levels)
+{
+    this->clear();
+
+    if (surface == nullptr || surface->w <= 0 || surface->h <= 0 || surface->format->BytesPerPixel != 4)
+    {
+        return false;
+    }
+
+    fge::Vector2i const size{surface->w, surface->h};
+    uint32_t const maxLevels = ComputeMipLevels(size);
+    levels = levels == FGE_TEXTURE_DATA_MIPMAPS_LEVELS_AUTO ? maxLevels : std::min(levels, maxLevels);
+
+    std::size_t totalByteSize = 0;
+    this->g_levels.resize(levels);
+    for (uint32_t i = 0; i < levels; ++i)
+    {
+        auto& level = this->g_levels[i];
+        level._size = ComputeLevelSize(size, i);
+        level._offset = totalByteSize;
+        level._byteSize = ComputeLevelByteSize(VK_FORMAT_R8G8B8A8_UNORM, level._size);
+        totalByteSize += level._byteSize;
+    }
+    this->g_data.resize(totalByteSize);
+    this->g_format = VK_FORMAT_R8G8B8A8_UNORM;
+
+    //The first level is the surface without its pitch
+    auto const rowByteSize = static_cast<std::size_t>(size.x) * 4;
+    for (int y = 0; y < size.y; ++y)
+    {
+        std::memcpy(this->g_data.data() + static_cast<std::size_t>(y) * rowByteSize,
+                    static_cast<uint8_t const*>(surface->pixels) + static_cast<std::ptrdiff_t>(y) * surface->pitch,
+                    rowByteSize);
+    }
+
+    for (uint32_t i = 1; i < levels; ++i)
+    {
+        auto const& source = this->g_levels[i - 1];
+        auto const& destination = this->g_levels[i];
+        auto const* sourcePixels = reinterpret_cast<uint32_t const*>(this->g_data.data() + source._offset);
+        auto* destinationPixels = reinterpret_cast<uint32_t*>(this->g_data.data() + destination._offset);
+
+        for (int y = 0; y < destination._size.y; ++y)
+        {
+            auto const* rowA = sourcePixels + static_cast<std::size_t>(2 * y) * source._size.x;
+            auto const* rowB = sourcePixels + static_cast<std::size_t>(std::min(2 * y + 1, source._size.y - 1)) *
+                                                      source._size.x;
+            fge::pixel::DownsampleRows(rowA, rowB, static_cast<std::size_t>(source._size.x),
+                                       destinationPixels + static_cast<std::size_t>(y) * destination._size.x);
+        }
+    }
+    return true;
+}
+
+bool TextureData::loadFromFile(std::filesystem::path const& filePath)
+{
+    this->clear();
+
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+
+    auto const fileSize = file.tellg();
+    if (fileSize <= 0)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(fileSize));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), fileSize))
+    {
+        return false;
+    }
+
+    return this->loadFromMemory(buffer.data(), buffer.size());
+}
+bool TextureData::loadFromMemory(void const* data, std::size_t size)
+{
+    this->clear();
+
+    auto const* bytes = static_cast<uint8_t const*>(data);
+    if (bytes == nullptr)
+    {
+        return false;
+    }
+
+    bool result = false;
+    if (size >= sizeof(gKtx2Identifier) && std::memcmp(bytes, gKtx2Identifier, sizeof(gKtx2Identifier)) == 0)
+    {
+        result = this->loadKTX2(bytes, size);
+    }
+    else if (size >= 4 && ReadLE<uint32_t>(bytes) == gDdsMagic)
+    {
+        result = this->loadDDS(bytes, size);
+    }
+
+    if (!result)
+    {
+        this->clear();
+    }
+    return result;
+}
+
+bool TextureData::isValid() const
+{
+    return !this->g_levels.empty();
+}
+VkFormat TextureData::getFormat() const
+{
+    return this->g_format;
+}
+bool TextureData::isCompressed() const
+{
+    return IsCompressedFormat(this->g_format);
+}
+fge::Vector2i TextureData::getSize() const
+{
+    return this->g_levels.empty() ? fge::Vector2i{0, 0} : this->g_levels.front()._size;
+}
+
+uint32_t TextureData::getLevelCount() const
+{
+    return static_cast<uint32_t>(this->g_levels.size());
+}
+TextureData::Level const& TextureData::getLevel(uint32_t level) const
+{
+    return this->g_levels[level];
+}
+uint8_t const* TextureData::getLevelData(uint32_t level) const
+{
+    return this->g_data.data() + this->g_levels[level]._offset;
+}
+std::vector<uint8_t> const& TextureData::getData() const
+{
+    return this->g_data;
+}
+
+bool TextureData::IsSupportedFormat(VkFormat format)
+{
+    return format != VK_FORMAT_UNDEFINED && NormalizeFormat(format) == format;
+}
+bool TextureData::IsCompressedFormat(VkFormat format)
+{
+    switch (NormalizeFormat(format))
+    {
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+    case VK_FORMAT_BC3_UNORM_BLOCK:
+    case VK_FORMAT_BC7_UNORM_BLOCK:
+        return true;
+    default:
+        return false;
+    }
+}
+std::size_t TextureData::ComputeLevelByteSize(VkFormat format, fge::Vector2i const& size)
+{
+    auto const width = static_cast<std::size_t>(std::max(size.x, 0));
+    auto const height = static_cast<std::size_t>(std::max(size.y, 0));
+    auto const blockCount = ((width + 3) / 4) * ((height + 3) / 4);
+
+    switch (NormalizeFormat(format))
+    {
+    case VK_FORMAT_R8G8B8A8_UNORM:
+        return width * height * 4;
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+        return blockCount * 8;
+    case VK_FORMAT_BC3_UNORM_BLOCK:
+    case VK_FORMAT_BC7_UNORM_BLOCK:
+        return blockCount * 16;
+    default:
+        return 0;
+    }
+}
+uint32_t TextureData::ComputeMipLevels(fge::Vector2i const& size)
+{
+    auto const largest = static_cast<uint32_t>(std::max({size.x, size.y, 1}));
+    return static_cast<uint32_t>(std::bit_width(largest));
+}
+
+bool TextureData::loadKTX2(uint8_t const* data, std::size_t size)
+{
+    if (size < gKtx2LevelIndexOffset)
+    {
+        return false;
+    }
+
+    auto const format = NormalizeFormat(static_cast<VkFormat>(ReadLE<uint32_t>(data + 12)));
+    auto const width = ReadLE<uint32_t>(data + 20);
+    auto const height = ReadLE<uint32_t>(data + 24);
+    auto const depth = ReadLE<uint32_t>(data + 28);
+    auto const layerCount = ReadLE<uint32_t>(data + 32);
+    auto const faceCount = ReadLE<uint32_t>(data + 36);
+    auto const levelCount = std::max(ReadLE<uint32_t>(data + 40), 1u);
+    auto const supercompressionScheme = ReadLE<uint32_t>(data + 44);
+
+    //Only uncompressed (no supercompression) single 2D images are supported
+    if (format == VK_FORMAT_UNDEFINED || width == 0 || height == 0 || width > gMaxDimension ||
+        height > gMaxDimension || depth != 0 || layerCount > 1 || faceCount != 1 || supercompressionScheme != 0)
+    {
+        return false;
+    }
+    fge::Vector2i const imageSize{static_cast<int>(width), static_cast<int>(height)};
+    if (levelCount > ComputeMipLevels(imageSize) ||
+        size < gKtx2LevelIndexOffset + std::size_t{levelCount} * gKtx2LevelIndexEntrySize)
+    {
+        return false;
+    }
+
+    this->g_format = format;
+    this->g_levels.resize(levelCount);
+
+    std::size_t totalByteSize = 0;
+    for (uint32_t i = 0; i < levelCount; ++i)
+    {
+        auto const* entry = data + gKtx2LevelIndexOffset + i * gKtx2LevelIndexEntrySize;
+        auto const byteOffset = ReadLE<uint64_t>(entry);
+        auto const byteLength = ReadLE<uint64_t>(entry + 8);
+
+        auto& level = this->g_levels[i];
+        level._size = ComputeLevelSize(imageSize, i);
+        level._offset = totalByteSize;
+        level._byteSize = ComputeLevelByteSize(format, level._size);
+
+        if (byteLength != level._byteSize || byteOffset > size || byteLength > size - byteOffset)
+        {
+            return false;
+        }
+        totalByteSize += level._byteSize;
+    }
+
+    this->g_data.resize(totalByteSize);
+    for (uint32_t i = 0; i < levelCount; ++i)
+    {
+        auto const byteOffset = ReadLE<uint64_t>(data + gKtx2LevelIndexOffset + i * gKtx2LevelIndexEntrySize);
+        auto const& level = this->g_levels[i];
+        std::memcpy(this->g_data.data() + level._offset, data + byteOffset, level._byteSize);
+    }
+    return true;
+}
+bool TextureData::loadDDS(uint8_t const* data, std::size_t size)
+{
+    if (size < gDdsDataOffset || ReadLE<uint32_t>(data + 4) != gDdsHeaderSize)
+    {
+        return false;
+    }
+
+    auto const height = ReadLE<uint32_t>(data + 12);
+    auto const width = ReadLE<uint32_t>(data + 16);
+    auto const levelCount = std::max(ReadLE<uint32_t>(data + 28), 1u);
+    auto const pixelFormatFlags = ReadLE<uint32_t>(data + 80);
+    auto const fourCC = ReadLE<uint32_t>(data + 84);
+    auto const caps2 = ReadLE<uint32_t>(data + 112);
+
+    if ((caps2 & (gDdsCaps2CubeMap | gDdsCaps2Volume)) != 0)
+    {
+        return false;
+    }
+
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    std::size_t dataOffset = gDdsDataOffset;
+
+    if ((pixelFormatFlags & gDdsPixelFormatFourCC) != 0)
+    {
+        if (fourCC == MakeFourCC('D', 'X', 'T', '1'))
+        {
+            format = VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        }
+        else if (fourCC == MakeFourCC('D', 'X', 'T', '5'))
+        {
+            format = VK_FORMAT_BC3_UNORM_BLOCK;
+        }
+        else if (fourCC == MakeFourCC('D', 'X', '1', '0'))
+        {
+            if (size < gDdsDx10DataOffset)
+            {
+                return false;
+            }
+
+            auto const resourceDimension = ReadLE<uint32_t>(data + gDdsDataOffset + 4);
+            auto const miscFlag = ReadLE<uint32_t>(data + gDdsDataOffset + 8);
+            auto const arraySize = ReadLE<uint32_t>(data + gDdsDataOffset + 12);
+            if (resourceDimension != gDdsDx10Texture2D || (miscFlag & gDdsDx10MiscTextureCube) != 0 || arraySize > 1)
+            {
+                return false;
+            }
+
+            format = DxgiToFormat(ReadLE<uint32_t>(data + gDdsDataOffset));
+            dataOffset = gDdsDx10DataOffset;
+        }
+    }
+    else if ((pixelFormatFlags & gDdsPixelFormatRGB) != 0)
+    {
+        //Only the RGBA32 byte order is supported for uncompressed data
+        if (ReadLE<uint32_t>(data + 88) == 32 && ReadLE<uint32_t>(data + 92) == 0x000000FF &&
+            ReadLE<uint32_t>(data + 96) == 0x0000FF00 && ReadLE<uint32_t>(data + 100) == 0x00FF0000 &&
+            ReadLE<uint32_t>(data + 104) == 0xFF000000)
+        {
+            format = VK_FORMAT_R8G8B8A8_UNORM;
+        }
+    }
+
+    if (format == VK_FORMAT_UNDEFINED || width == 0 || height == 0 || width > gMaxDimension ||
+        height > gMaxDimension)
+    {
+        return false;
+    }
+    fge::Vector2i const imageSize{static_cast<int>(width), static_cast<int>(height)};
+    if (levelCount > ComputeMipLevels(imageSize))
+    {
+        return false;
+    }
+
+    //Levels are stored one after the other, from the largest to the smallest
+    this->g_format = format;
+    this->g_levels.resize(levelCount);
+
+    std::size_t totalByteSize = 0;
+    for (uint32_t i = 0; i < levelCount; ++i)
+    {
+        auto& level = this->g_levels[i];
+        level._size = ComputeLevelSize(imageSize, i);
+        level._offset = totalByteSize;
+        level._byteSize = ComputeLevelByteSize(format, level._size);
+        totalByteSize += level._byteSize;
+    }
+
+    if (size - dataOffset < totalByteSize)
+    {
+        return false;
+    }
+
+    this->g_data.assign(data + dataOffset, data + dataOffset + totalByteSize);
+    return true;
+}
+
+} // namespace fge::vulkan
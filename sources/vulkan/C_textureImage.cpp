@@ -17,6 +17,7 @@
 #include "FastEngine/vulkan/C_textureImage.hpp"
 #include "FastEngine/fge_except.hpp"
 #include "FastEngine/vulkan/C_context.hpp"
+#include "FastEngine/vulkan/C_textureData.hpp"
 #include <cstring>
 
 namespace fge::vulkan
@@ -29,6 +30,7 @@ TextureImage::TextureImage(Context const& context) :
 
         g_textureSize(0, 0),
         g_textureBytesPerPixel(0),
+        g_format(FGE_TEXTURE_IMAGE_FORMAT),
 
         g_filter(VK_FILTER_NEAREST),
         g_normalizedCoordinates(true),
@@ -43,6 +45,7 @@ TextureImage::TextureImage(TextureImage const& r) :
 
         g_textureSize(r.g_textureSize),
         g_textureBytesPerPixel(r.g_textureBytesPerPixel),
+        g_format(r.g_format),
 
         g_filter(r.g_filter),
         g_normalizedCoordinates(r.g_normalizedCoordinates),
@@ -61,6 +64,7 @@ TextureImage::TextureImage(TextureImage&& r) noexcept :
 
         g_textureSize(r.g_textureSize),
         g_textureBytesPerPixel(r.g_textureBytesPerPixel),
+        g_format(r.g_format),
 
         g_filter(r.g_filter),
         g_normalizedCoordinates(r.g_normalizedCoordinates),
@@ -77,6 +81,7 @@ TextureImage::TextureImage(TextureImage&& r) noexcept :
 
     r.g_textureSize = {0, 0};
     r.g_textureBytesPerPixel = 0;
+    r.g_format = FGE_TEXTURE_IMAGE_FORMAT;
 
     r.g_filter = VK_FILTER_NEAREST;
     r.g_normalizedCoordinates = false;
@@ -102,6 +107,7 @@ TextureImage& TextureImage::operator=(TextureImage&& r) noexcept
 
     this->g_textureSize = r.g_textureSize;
     this->g_textureBytesPerPixel = r.g_textureBytesPerPixel;
+    this->g_format = r.g_format;
 
     this->g_filter = r.g_filter;
     this->g_normalizedCoordinates = r.g_normalizedCoordinates;
@@ -118,6 +124,7 @@ TextureImage& TextureImage::operator=(TextureImage&& r) noexcept
 
     r.g_textureSize = {0, 0};
     r.g_textureBytesPerPixel = 0;
+    r.g_format = FGE_TEXTURE_IMAGE_FORMAT;
 
     r.g_filter = VK_FILTER_NEAREST;
     r.g_normalizedCoordinates = false;
@@ -143,6 +150,7 @@ bool TextureImage::create(glm::vec<2, int> const& size, uint32_t levels)
 
     this->g_textureSize = size;
     this->g_textureBytesPerPixel = FGE_TEXTURE_IMAGE_BYTESPERPIXEL;
+    this->g_format = FGE_TEXTURE_IMAGE_FORMAT;
 
     VkDeviceSize const imageSize = static_cast<VkDeviceSize>(size.x) * size.y * this->g_textureBytesPerPixel;
 
@@ -164,7 +172,7 @@ bool TextureImage::create(glm::vec<2, int> const& size, uint32_t levels)
     vmaUnmapMemory(context.getAllocator(), stagingBufferInfo._allocation);
 
     this->g_imageInfo =
-            *context.createImage(size.x, size.y, FGE_TEXTURE_IMAGE_FORMAT, VK_IMAGE_TILING_OPTIMAL, this->g_mipLevels,
+            *context.createImage(size.x, size.y, this->g_format, VK_IMAGE_TILING_OPTIMAL, this->g_mipLevels,
                                  VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
                                          VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
                                  0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
@@ -173,12 +181,12 @@ bool TextureImage::create(glm::vec<2, int> const& size, uint32_t levels)
             context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
                                   CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT, VK_IMAGE_LAYOUT_UNDEFINED,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format, VK_IMAGE_LAYOUT_UNDEFINED,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, this->g_mipLevels);
     commandBuffer.copyBufferToImage(stagingBufferInfo._buffer, this->g_imageInfo._image, static_cast<uint32_t>(size.x),
                                     static_cast<uint32_t>(size.y));
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -187,7 +195,7 @@ bool TextureImage::create(glm::vec<2, int> const& size, uint32_t levels)
     vmaDestroyBuffer(context.getAllocator(), stagingBufferInfo._buffer, stagingBufferInfo._allocation);
 
     this->g_textureImageView = context.getLogicalDevice().createImageView(this->g_imageInfo._image,
-                                                                          FGE_TEXTURE_IMAGE_FORMAT, this->g_mipLevels);
+                                                                          this->g_format, this->g_mipLevels);
 
     this->createTextureSampler(0.0f, 0.0f, static_cast<float>(this->g_mipLevels));
 
@@ -213,6 +221,7 @@ bool TextureImage::create(SDL_Surface* surface, uint32_t levels)
 
     this->g_textureSize = {surface->w, surface->h};
     this->g_textureBytesPerPixel = surface->format->BytesPerPixel;
+    this->g_format = FGE_TEXTURE_IMAGE_FORMAT;
 
     VkDeviceSize const imageSize = static_cast<VkDeviceSize>(surface->w) * surface->h * this->g_textureBytesPerPixel;
 
@@ -231,7 +240,7 @@ bool TextureImage::create(SDL_Surface* surface, uint32_t levels)
     memcpy(data, surface->pixels, static_cast<std::size_t>(imageSize));
     vmaUnmapMemory(context.getAllocator(), stagingBufferInfo._allocation);
 
-    this->g_imageInfo = *context.createImage(surface->w, surface->h, FGE_TEXTURE_IMAGE_FORMAT, VK_IMAGE_TILING_OPTIMAL,
+    this->g_imageInfo = *context.createImage(surface->w, surface->h, this->g_format, VK_IMAGE_TILING_OPTIMAL,
                                              this->g_mipLevels,
                                              VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
                                                      VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
@@ -241,12 +250,12 @@ bool TextureImage::create(SDL_Surface* surface, uint32_t levels)
             context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
                                   CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT, VK_IMAGE_LAYOUT_UNDEFINED,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format, VK_IMAGE_LAYOUT_UNDEFINED,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, this->g_mipLevels);
     commandBuffer.copyBufferToImage(stagingBufferInfo._buffer, this->g_imageInfo._image,
                                     static_cast<uint32_t>(surface->w), static_cast<uint32_t>(surface->h));
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -255,7 +264,7 @@ bool TextureImage::create(SDL_Surface* surface, uint32_t levels)
     vmaDestroyBuffer(context.getAllocator(), stagingBufferInfo._buffer, stagingBufferInfo._allocation);
 
     this->g_textureImageView = context.getLogicalDevice().createImageView(this->g_imageInfo._image,
-                                                                          FGE_TEXTURE_IMAGE_FORMAT, this->g_mipLevels);
+                                                                          this->g_format, this->g_mipLevels);
 
     this->createTextureSampler(0.0f, 0.0f, static_cast<float>(this->g_mipLevels));
 
@@ -281,7 +290,8 @@ bool TextureImage::create(TextureImage const& texture, uint32_t levels)
     auto& context = this->getContext();
 
     this->g_textureSize = texture.g_textureSize;
-    this->g_textureBytesPerPixel = FGE_TEXTURE_IMAGE_BYTESPERPIXEL;
+    this->g_textureBytesPerPixel = texture.g_textureBytesPerPixel;
+    this->g_format = texture.g_format;
 
     if (levels == FGE_TEXTURE_IMAGE_MIPMAPS_LEVELS_AUTO)
     {
@@ -296,19 +306,24 @@ bool TextureImage::create(TextureImage const& texture, uint32_t levels)
     }
     this->g_mipLevels = levels;
 
-    this->g_imageInfo = *context.createImage(this->g_textureSize.x, this->g_textureSize.y, FGE_TEXTURE_IMAGE_FORMAT,
-                                             VK_IMAGE_TILING_OPTIMAL, this->g_mipLevels,
-                                             VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
-                                                     VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
-                                             0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    VkImageUsageFlags usage =
+            VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    if (!this->isCompressed())
+    {
+        usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    }
+
+    this->g_imageInfo = *context.createImage(this->g_textureSize.x, this->g_textureSize.y, this->g_format,
+                                             VK_IMAGE_TILING_OPTIMAL, this->g_mipLevels, usage, 0,
+                                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
     auto commandBuffer =
             context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
                                   CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT, VK_IMAGE_LAYOUT_UNDEFINED,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format, VK_IMAGE_LAYOUT_UNDEFINED,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, this->g_mipLevels);
-    commandBuffer.transitionImageLayout(texture.g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(texture.g_imageInfo._image, texture.g_format,
                                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                         texture.g_mipLevels);
 
@@ -316,17 +331,114 @@ bool TextureImage::create(TextureImage const& texture, uint32_t levels)
                                    static_cast<uint32_t>(this->g_textureSize.x),
                                    static_cast<uint32_t>(this->g_textureSize.y));
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         this->g_mipLevels);
-    commandBuffer.transitionImageLayout(texture.g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(texture.g_imageInfo._image, texture.g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         texture.g_mipLevels);
 
     context.submitCommands(std::move(commandBuffer));
 
     this->g_textureImageView = context.getLogicalDevice().createImageView(this->g_imageInfo._image,
-                                                                          FGE_TEXTURE_IMAGE_FORMAT, this->g_mipLevels);
+                                                                          this->g_format, this->g_mipLevels);
+
+    this->createTextureSampler(0.0f, 0.0f, static_cast<float>(this->g_mipLevels));
+
+    this->g_textureDescriptorSet =
+            context.getTextureDescriptorPool().allocateDescriptorSet(context.getTextureLayout().getLayout()).value();
+
+    DescriptorSet::Descriptor const descriptor(*this, FGE_VULKAN_TEXTURE_BINDING);
+    this->g_textureDescriptorSet.updateDescriptorSet(&descriptor, 1);
+    return true;
+}
+bool TextureImage::create(TextureData const& data)
+{
+    this->destroy();
+
+    ++this->g_modificationCount;
+
+    if (!data.isValid())
+    {
+        return false;
+    }
+
+    auto& context = this->getContext();
+
+    //The format must be usable as a sampled image by the device
+    if (data.isCompressed() && context.getLogicalDevice().getEnabledFeatures().textureCompressionBC == VK_FALSE)
+    {
+        return false;
+    }
+    VkFormatProperties formatProperties{};
+    vkGetPhysicalDeviceFormatProperties(context.getPhysicalDevice().getDevice(), data.getFormat(), &formatProperties);
+    if ((formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) == 0)
+    {
+        return false;
+    }
+
+    this->g_textureSize = data.getSize();
+    this->g_format = data.getFormat();
+    this->g_textureBytesPerPixel = data.isCompressed() ? 0 : FGE_TEXTURE_IMAGE_BYTESPERPIXEL;
+    this->g_mipLevels = data.getLevelCount();
+
+    auto const& buffer = data.getData();
+    VkDeviceSize const bufferSize = buffer.size();
+
+    auto const stagingBufferInfo = *context.createBuffer(
+            bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    void* mappedData = nullptr;
+    vmaMapMemory(context.getAllocator(), stagingBufferInfo._allocation, &mappedData);
+    memcpy(mappedData, buffer.data(), buffer.size());
+    vmaUnmapMemory(context.getAllocator(), stagingBufferInfo._allocation);
+
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                              VK_IMAGE_USAGE_SAMPLED_BIT;
+    if (!data.isCompressed())
+    {
+        usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    }
+
+    this->g_imageInfo = *context.createImage(this->g_textureSize.x, this->g_textureSize.y, this->g_format,
+                                             VK_IMAGE_TILING_OPTIMAL, this->g_mipLevels, usage, 0,
+                                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    //Every level is copied from the same staging buffer
+    std::vector<VkBufferImageCopy> regions(this->g_mipLevels);
+    for (uint32_t i = 0; i < this->g_mipLevels; ++i)
+    {
+        auto const& level = data.getLevel(i);
+        auto& region = regions[i];
+        region.bufferOffset = level._offset;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = i;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = {0, 0, 0};
+        region.imageExtent = {static_cast<uint32_t>(level._size.x), static_cast<uint32_t>(level._size.y), 1};
+    }
+
+    auto commandBuffer =
+            context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
+                                  CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
+
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format, VK_IMAGE_LAYOUT_UNDEFINED,
+                                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, this->g_mipLevels);
+    commandBuffer.copyBufferToImage(stagingBufferInfo._buffer, this->g_imageInfo._image, regions.data(),
+                                    static_cast<uint32_t>(regions.size()));
+
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
+                                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                        this->g_mipLevels);
+
+    context.submitCommands(std::move(commandBuffer));
+
+    vmaDestroyBuffer(context.getAllocator(), stagingBufferInfo._buffer, stagingBufferInfo._allocation);
+
+    this->g_textureImageView =
+            context.getLogicalDevice().createImageView(this->g_imageInfo._image, this->g_format, this->g_mipLevels);
 
     this->createTextureSampler(0.0f, 0.0f, static_cast<float>(this->g_mipLevels));
 
@@ -355,6 +467,7 @@ void TextureImage::destroy()
 
         this->g_textureSize = {0, 0};
         this->g_textureBytesPerPixel = 0;
+        this->g_format = FGE_TEXTURE_IMAGE_FORMAT;
 
         this->g_filter = VK_FILTER_NEAREST;
 
@@ -369,7 +482,7 @@ bool TextureImage::isCreated() const
 
 SDL_Surface* TextureImage::copyToSurface() const
 {
-    if (!this->isCreated())
+    if (!this->isCreated() || this->isCompressed())
     {
         return nullptr;
     }
@@ -394,14 +507,14 @@ SDL_Surface* TextureImage::copyToSurface() const
             context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
                                   CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                         this->g_mipLevels);
 
     commandBuffer.copyImageToBuffer(this->g_imageInfo._image, dstBufferInfo._buffer, this->g_textureSize.x,
                                     this->g_textureSize.y);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -419,7 +532,7 @@ SDL_Surface* TextureImage::copyToSurface() const
 
 void TextureImage::update(SDL_Surface* surface, glm::vec<2, int> const& offset)
 {
-    if (surface == nullptr || !this->isCreated())
+    if (surface == nullptr || !this->isCreated() || this->isCompressed())
     {
         return;
     }
@@ -436,7 +549,7 @@ void TextureImage::update(SDL_Surface* surface, glm::vec<2, int> const& offset)
             context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
                                   CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -454,7 +567,7 @@ void TextureImage::update(SDL_Surface* surface, glm::vec<2, int> const& offset)
     commandBuffer.copyBufferToImage(stagingBufferInfo._buffer, this->g_imageInfo._image, surface->w, surface->h,
                                     offset.x, offset.y);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -464,7 +577,8 @@ void TextureImage::update(SDL_Surface* surface, glm::vec<2, int> const& offset)
 }
 void TextureImage::update(TextureImage const& textureImage, glm::vec<2, int> const& offset)
 {
-    if (!textureImage.isCreated() || !this->isCreated())
+    if (!textureImage.isCreated() || !this->isCreated() || this->isCompressed() ||
+        textureImage.g_format != this->g_format)
     {
         return;
     }
@@ -482,20 +596,20 @@ void TextureImage::update(TextureImage const& textureImage, glm::vec<2, int> con
             context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
                                   CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                         this->g_mipLevels);
-    commandBuffer.transitionImageLayout(textureImage.g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(textureImage.g_imageInfo._image, textureImage.g_format,
                                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                         this->g_mipLevels);
 
     commandBuffer.copyImageToImage(textureImage.g_imageInfo._image, this->g_imageInfo._image,
                                    textureImage.g_textureSize.x, textureImage.g_textureSize.y, offset.x, offset.y);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         this->g_mipLevels);
-    commandBuffer.transitionImageLayout(textureImage.g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(textureImage.g_imageInfo._image, textureImage.g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -510,7 +624,7 @@ void TextureImage::update(void* buffer,
     {
         return;
     }
-    if (!this->isCreated() || (size.x + offset.x > this->g_textureSize.x) ||
+    if (!this->isCreated() || this->isCompressed() || (size.x + offset.x > this->g_textureSize.x) ||
         (size.y + offset.y > this->g_textureSize.y))
     {
         return;
@@ -524,7 +638,7 @@ void TextureImage::update(void* buffer,
             context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
                                   CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -542,7 +656,7 @@ void TextureImage::update(void* buffer,
     commandBuffer.copyBufferToImage(stagingBufferInfo._buffer, this->g_imageInfo._image, size.x, size.y, offset.x,
                                     offset.y);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -553,6 +667,12 @@ void TextureImage::update(void* buffer,
 
 void TextureImage::generateMipmaps(uint32_t levels)
 { ///TODO: Redo the method without using copyToSurface()
+    if (this->isCompressed())
+    {
+        //Compressed formats can't be blitted, the mip chain must be provided by the TextureData
+        return;
+    }
+
     if (levels == FGE_TEXTURE_IMAGE_MIPMAPS_LEVELS_AUTO)
     {
         levels = computeMipLevels(this->g_textureSize);
@@ -578,7 +698,7 @@ void TextureImage::generateMipmaps(uint32_t levels)
             context.beginCommands(Context::SubmitTypes::DIRECT_WAIT_EXECUTION, CommandBuffer::RenderPassScopes::OUTSIDE,
                                   CommandBuffer::SUPPORTED_QUEUE_GRAPHICS);
 
-    commandBuffer.transitionImageLayout(this->g_imageInfo._image, FGE_TEXTURE_IMAGE_FORMAT,
+    commandBuffer.transitionImageLayout(this->g_imageInfo._image, this->g_format,
                                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                         this->g_mipLevels);
 
@@ -678,6 +798,14 @@ int TextureImage::getBytesPerPixel() const
 {
     return this->g_textureBytesPerPixel;
 }
+VkFormat TextureImage::getFormat() const
+{
+    return this->g_format;
+}
+bool TextureImage::isCompressed() const
+{
+    return TextureData::IsCompressedFormat(this->g_format);
+}
 
 VkImage TextureImage::getTextureImage() const
 {
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _FGE_TESTS_SURFACELESSCONTEXT_HPP_INCLUDED
+#define _FGE_TESTS_SURFACELESSCONTEXT_HPP_INCLUDED
+
+#include "doctest/doctest.h"
+#include "FastEngine/graphic/C_renderTexture.hpp"
+#include "FastEngine/manager/anim_manager.hpp"
+#include "FastEngine/manager/font_manager.hpp"
+#include "FastEngine/manager/texture_manager.hpp"
+#include "FastEngine/vulkan/C_context.hpp"
+#include "SDL.h"
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace fge::test
+{
+
+/**
+ * \brief A Vulkan context without window for the tests that need a device
+ *
+ * The resource managers are initialized with the context. When no device is available,
+ * isReady() return \b false and the test should be skipped.
+ */
+class SurfacelessContext
+{
+public:
+    explicit SurfacelessContext(std::string_view applicationName)
+    {
+        try
+        {
+            this->g_instance.emplace(fge::vulkan::Context::init(SDL_INIT_VIDEO, applicationName));
+            this->g_context.initVulkanSurfaceless(*this->g_instance);
+        }
+        catch (std::exception const& e)
+        {
+            MESSAGE(std::string{"no Vulkan device available: "} + e.what());
+            return;
+        }
+
+        fge::texture::gManager.initialize();
+        fge::font::gManager.initialize();
+        fge::anim::gManager.initialize();
+        this->g_renderTexture.emplace(fge::Vector2i{16, 16}, this->g_context);
+        this->g_ready = true;
+    }
+    ~SurfacelessContext()
+    {
+        if (this->g_ready)
+        {
+            this->g_context.waitIdle();
+            this->g_renderTexture.reset();
+            fge::anim::gManager.uninitialize();
+            fge::font::gManager.uninitialize();
+            fge::texture::gManager.uninitialize();
+        }
+        this->g_context.destroy();
+        this->g_instance.reset();
+        SDL_Quit();
+    }
+
+    SurfacelessContext(SurfacelessContext const& r) = delete;
+    SurfacelessContext& operator=(SurfacelessContext const& r) = delete;
+
+    [[nodiscard]] bool isReady() const { return this->g_ready; }
+    [[nodiscard]] fge::RenderTarget& getTarget() { return *this->g_renderTexture; }
+
+private:
+    std::optional<fge::vulkan::Instance> g_instance;
+    fge::vulkan::Context g_context;
+    std::optional<fge::RenderTexture> g_renderTexture;
+    bool g_ready{false};
+};
+
+} // namespace fge::test
+
+#endif // _FGE_TESTS_SURFACELESSCONTEXT_HPP_INCLUDED
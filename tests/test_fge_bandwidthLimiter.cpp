@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "doctest/doctest.h"
+#include "FastEngine/network/C_bandwidthLimiter.hpp"
+#include "FastEngine/network/C_client.hpp"
+
+using namespace std::chrono_literals;
+
+TEST_CASE("testing the bandwidth limiter")
+{
+    fge::net::BandwidthLimiter limiter;
+    auto const start = std::chrono::steady_clock::now();
+
+    SUBCASE("disabled by default")
+    {
+        REQUIRE_FALSE(limiter.isEnabled());
+        REQUIRE(limiter.tryAcquire(start));
+        limiter.consume(1'000'000);
+        REQUIRE(limiter.tryAcquire(start));
+    }
+
+    limiter.setConfig({._maxRate = 10000, ._minRate = 1000, ._burstSize = 1000, ._adaptive = true});
+    REQUIRE(limiter.isEnabled());
+    REQUIRE(limiter.getRate() == 10000);
+
+    SUBCASE("token bucket")
+    {
+        auto const now = start + 1s; //Fill the bucket to its burst size
+        REQUIRE(limiter.tryAcquire(now));
+        limiter.consume(1500); //The bucket can go in debt
+        REQUIRE_FALSE(limiter.tryAcquire(now));
+        REQUIRE(limiter.getThrottledCount() == 1);
+        REQUIRE_FALSE(limiter.tryAcquire(now + 40ms)); //400 bytes refilled, still in debt
+        REQUIRE(limiter.tryAcquire(now + 60ms));
+        REQUIRE(limiter.getSentBytes() == 1500);
+    }
+
+    SUBCASE("adaptive rate")
+    {
+        auto const now = start + 1s;
+        limiter.reportLoss(now);
+        REQUIRE(limiter.getRate() == 7500);
+        limiter.reportLoss(now + 10ms); //Same congestion, ignored
+        REQUIRE(limiter.getRate() == 7500);
+        limiter.reportLoss(now + 1s);
+        REQUIRE(limiter.getRate() < 7500);
+
+        //The rate goes back to the maximum rate without loss
+        (void) limiter.tryAcquire(now + 10s);
+        REQUIRE(limiter.getRate() == 10000);
+    }
+}
+
+TEST_CASE("testing the client transmission priorities")
+{
+    using fge::net::ProtocolPacket;
+    using Priorities = ProtocolPacket::Priorities;
+
+    auto control = fge::net::CreatePacket(fge::net::NET_INTERNAL_ID_MTU_ASK);
+    auto state = fge::net::CreatePacket(FGE_NET_CUSTOM_ID_START);
+    auto reliable = fge::net::CreatePacket(FGE_NET_CUSTOM_ID_START + 1);
+    reliable->doNotDiscard();
+    auto bulk = fge::net::CreatePacket(FGE_NET_CUSTOM_ID_START + 2);
+    bulk->setPriority(Priorities::BULK);
+
+    REQUIRE(control->getPriority() == Priorities::CONTROL);
+    REQUIRE(state->getPriority() == Priorities::STATE);
+    REQUIRE(reliable->getPriority() == Priorities::RELIABLE);
+    REQUIRE(bulk->getPriority() == Priorities::BULK);
+
+    fge::net::Client client;
+    client.pushPacket(std::move(bulk));
+    client.pushPacket(std::move(state));
+    client.pushPacket(std::move(reliable));
+    client.pushPacket(std::move(control));
+
+    auto const metrics = client.getQueueMetrics();
+    for (auto const count: metrics._pendingPackets)
+    {
+        REQUIRE(count == 1);
+    }
+
+    //Packets are popped by priority and counted in the transmission order
+    std::vector<ProtocolPacket::IdType> const expectedIds{fge::net::NET_INTERNAL_ID_MTU_ASK,
+                                                          FGE_NET_CUSTOM_ID_START + 1, FGE_NET_CUSTOM_ID_START,
+                                                          FGE_NET_CUSTOM_ID_START + 2};
+    ProtocolPacket::CounterType expectedCounter = 1;
+    for (auto const expectedId: expectedIds)
+    {
+        auto packet = client.popPacket();
+        REQUIRE(packet);
+        REQUIRE(packet->retrieveHeaderId().value() == expectedId);
+        REQUIRE(packet->retrieveCounter().value() == expectedCounter++);
+    }
+    REQUIRE(client.isPendingPacketsEmpty());
+    REQUIRE(client.getQueueMetrics()._pendingBytes == 0);
+}
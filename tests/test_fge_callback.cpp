@@ -16,6 +16,9 @@
 
 #include "doctest/doctest.h"
 #include "FastEngine/C_callback.hpp"
+#include <atomic>
+#include <memory>
+#include <thread>
 
 TEST_CASE("testing empty callback")
 {
@@ -232,4 +235,90 @@ TEST_CASE("testing adding callbacks in a call")
     REQUIRE(number == 2);
 }
 
+TEST_CASE("testing local callback handler")
+{
+    fge::LocalCallbackHandler<int> onEvent;
+
+    int number = 0;
+    auto funcAdd = [&](int value){
+        number += value;
+    };
+
+    fge::Subscriber subscriber;
+    auto* callback = onEvent.addLambda(funcAdd, &subscriber);
+    onEvent.addLambda(funcAdd);
+    onEvent.call(2);
+    REQUIRE(number == 4);
+
+    SUBCASE("removing itself while being called")
+    {
+        onEvent.addLambda([&](int){
+            onEvent.del(callback);
+            onEvent.delSub(nullptr);
+        });
+        onEvent.call(1);
+        REQUIRE(number == 6);
+        onEvent.call(1);
+        REQUIRE(number == 6);
+    }
+
+    SUBCASE("removed callbacks are destroyed when the call ends")
+    {
+        auto token = std::make_shared<int>(0);
+        fge::CallbackLambda<void, int>* self = nullptr;
+        self = onEvent.addLambda([&, token](int){
+            onEvent.del(self);
+        });
+        REQUIRE(token.use_count() == 2);
+
+        //Still running when removed, so it is kept alive until the call ends
+        onEvent.call(1);
+        REQUIRE(token.use_count() == 1);
+        REQUIRE(number == 6);
+    }
+
+    SUBCASE("hooking another handler")
+    {
+        fge::LocalCallbackHandler<int> onOtherEvent;
+        onOtherEvent.hook(onEvent);
+        onOtherEvent.call(10);
+        REQUIRE(number == 24);
+
+        onEvent.clear();
+        onOtherEvent.call(10);
+        REQUIRE(number == 24);
+    }
+}
+
+TEST_CASE("testing callback handler with multiple threads")
+{
+    fge::CallbackHandler<> onEvent;
+
+    std::atomic_uint32_t number = 0;
+    auto funcCount = [&](){
+        ++number;
+    };
+    onEvent.addLambda(funcCount);
+
+    std::atomic_bool running = true;
+    std::thread modifier([&](){
+        fge::Subscriber subscriber;
+        while (running)
+        {
+            onEvent.addLambda(funcCount, &subscriber);
+            onEvent.delSub(&subscriber);
+        }
+    });
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        onEvent.call();
+    }
+    running = false;
+    modifier.join();
+
+    //The callback without subscriber is always called
+    REQUIRE(number >= 10000);
+}
+
 ///TODO: add tests for CallbackObjectFunctor, and object that inherit from Subscriber
\ No newline at end of file
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/graphic/C_ftFont.hpp"
+#include "fge_surfacelessContext.hpp"
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#define FGE_TEST_FONT_PATH "resources/fonts/SourceSansPro-Regular.ttf"
+
+namespace
+{
+
+//A bitmap only font with a single 'A' glyph
+constexpr char gBitmapFont[] = "STARTFONT 2.1\n"
+                               "FONT -fge-test-medium-r-normal--8-80-75-75-c-80-iso10646-1\n"
+                               "SIZE 8 75 75\n"
+                               "FONTBOUNDINGBOX 8 8 0 0\n"
+                               "STARTPROPERTIES 4\n"
+                               "FONT_ASCENT 8\n"
+                               "FONT_DESCENT 0\n"
+                               "CHARSET_REGISTRY \"ISO10646\"\n"
+                               "CHARSET_ENCODING \"1\"\n"
+                               "ENDPROPERTIES\n"
+                               "CHARS 1\n"
+                               "STARTCHAR A\n"
+                               "ENCODING 65\n"
+                               "SWIDTH 1000 0\n"
+                               "DWIDTH 8 0\n"
+                               "BBX 8 8 0 0\n"
+                               "BITMAP\n"
+                               "FF\n81\n81\n81\n81\n81\n81\nFF\n"
+                               "ENDCHAR\n"
+                               "ENDFONT\n";
+
+template<class T>
+T ReadAt(std::vector<char> const& data, std::size_t offset)
+{
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+}
+template<class T>
+void WriteAt(std::vector<char>& data, std::size_t offset, T value)
+{
+    std::memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+} // namespace
+
+TEST_CASE("testing FreeTypeFont glyph cache")
+{
+    fge::test::SurfacelessContext context{"fgeFtFontTests"};
+    if (!context.isReady())
+    {
+        return;
+    }
+
+    fge::FreeTypeFont font;
+    REQUIRE(font.loadFromFile(FGE_TEST_FONT_PATH));
+
+    std::array<fge::CharacterSize, 1> const sizes{16};
+    REQUIRE(font.bakeGlyphs(U"abc", sizes) == 3);
+
+    auto const cachePath = std::filesystem::temp_directory_path() / "fgeFtFontTests.glyphcache";
+    REQUIRE(font.saveGlyphCache(cachePath));
+
+    fge::FreeTypeFont loadedFont;
+    REQUIRE(loadedFont.loadFromFile(FGE_TEST_FONT_PATH));
+
+    SUBCASE("save and load")
+    {
+        REQUIRE(loadedFont.loadGlyphCache(cachePath));
+        auto const& glyph = font.getGlyph('b', 16, false);
+        auto const& loadedGlyph = loadedFont.getGlyph('b', 16, false);
+        CHECK(loadedGlyph._textureRect == glyph._textureRect);
+        CHECK(loadedGlyph._advance == glyph._advance);
+    }
+
+    SUBCASE("a glyph outside of its page is refused")
+    {
+        std::vector<char> data;
+        {
+            std::ifstream file(cachePath, std::ios::binary);
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        //Header, family and style names, then the first page header, its skyline nodes and its glyphs
+        auto const pageOffset = 32 + ReadAt<uint32_t>(data, 24) + ReadAt<uint32_t>(data, 28);
+        auto const pageWidth = ReadAt<int32_t>(data, pageOffset + 4);
+        auto const nodeCount = ReadAt<uint32_t>(data, pageOffset + 16);
+        auto const textureRectOffset = pageOffset + 32 + nodeCount * 12 + 36;
+        REQUIRE(ReadAt<int32_t>(data, textureRectOffset + 8) > 0);
+        WriteAt<int32_t>(data, textureRectOffset, pageWidth);
+
+        {
+            std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+        CHECK_FALSE(loadedFont.loadGlyphCache(cachePath));
+    }
+
+    std::filesystem::remove(cachePath);
+}
+
+TEST_CASE("testing FreeTypeFont SDF render mode")
+{
+    fge::test::SurfacelessContext context{"fgeFtFontTests"};
+    if (!context.isReady())
+    {
+        return;
+    }
+
+    SUBCASE("glyph metrics are scaled to the character size")
+    {
+        fge::FreeTypeFont font;
+        REQUIRE(font.loadFromFile(FGE_TEST_FONT_PATH));
+        REQUIRE(font.setRenderMode(fge::FreeTypeFont::RenderModes::SDF));
+        REQUIRE(font.getRenderMode() == fge::FreeTypeFont::RenderModes::SDF);
+
+        constexpr fge::CharacterSize characterSize = FGE_FONT_SDF_BASE_SIZE / 2;
+        float const scale = font.getGlyphScale(characterSize);
+        CHECK(scale == doctest::Approx(0.5f));
+        CHECK(font.getGlyphScale(FGE_FONT_SDF_BASE_SIZE) == doctest::Approx(1.0f));
+
+        fge::Glyph const baseGlyph = font.getGlyph('b', FGE_FONT_SDF_BASE_SIZE, false);
+        fge::Glyph const glyph = font.getGlyph('b', characterSize, false);
+        REQUIRE(baseGlyph._bounds._width > 0.0f);
+
+        CHECK(glyph._advance == doctest::Approx(baseGlyph._advance * scale));
+        CHECK(glyph._bounds._x == doctest::Approx(baseGlyph._bounds._x * scale));
+        CHECK(glyph._bounds._y == doctest::Approx(baseGlyph._bounds._y * scale));
+        CHECK(glyph._bounds._width == doctest::Approx(baseGlyph._bounds._width * scale));
+        CHECK(glyph._bounds._height == doctest::Approx(baseGlyph._bounds._height * scale));
+
+        //Every character size share the same page
+        CHECK(glyph._textureRect == baseGlyph._textureRect);
+        CHECK(&font.getTexture(characterSize) == &font.getTexture(FGE_FONT_SDF_BASE_SIZE));
+
+        REQUIRE(font.setRenderMode(fge::FreeTypeFont::RenderModes::BITMAP));
+        CHECK(font.getGlyphScale(characterSize) == doctest::Approx(1.0f));
+    }
+
+    SUBCASE("a bitmap font can't be rendered as distance fields")
+    {
+        fge::FreeTypeFont font;
+        REQUIRE(font.loadFromMemory(gBitmapFont, sizeof(gBitmapFont) - 1));
+
+        CHECK_FALSE(font.setRenderMode(fge::FreeTypeFont::RenderModes::SDF));
+        CHECK(font.getRenderMode() == fge::FreeTypeFont::RenderModes::BITMAP);
+        CHECK(font.getGlyphScale(FGE_FONT_SDF_BASE_SIZE / 2) == doctest::Approx(1.0f));
+    }
+}
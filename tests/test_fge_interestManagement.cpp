@@ -0,0 +1,206 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+#include "FastEngine/network/C_clientList.hpp"
+
+namespace
+{
+
+class Unit : public fge::Object
+{
+public:
+    Unit()
+    {
+        this->_netSyncMode = fge::Object::NetSyncModes::FULL_SYNC;
+        this->_netList.pushTrivial<int>(&this->_health);
+    }
+    Unit(Unit const& r) :
+            Unit()
+    {
+        this->_health = r._health;
+    }
+
+    FGE_OBJ_DEFAULT_COPYMETHOD(Unit)
+
+    char const* getClassName() const override { return "TEST_UNIT"; }
+    char const* getReadableClassName() const override { return "unit"; }
+
+    int _health{100};
+};
+
+fge::ObjectSid GetSid(fge::Object const* object)
+{
+    return object->_myObjectData.lock()->getSid();
+}
+
+void SyncWatchedEvent(fge::Scene& server, fge::Scene& client, fge::net::Identity const& id)
+{
+    fge::net::Packet pck;
+    server.packWatchedEvent(pck, id);
+    REQUIRE_FALSE(client.unpackWatchedEvent(pck).has_value());
+}
+
+} // namespace
+
+TEST_CASE("testing Scene interest management")
+{
+    fge::reg::RegisterNewClass<Unit>();
+
+    fge::net::Identity const id{fge::net::IpAddress{127, 0, 0, 1}, 42000};
+    fge::net::ClientList clients;
+    clients.add(id, std::make_shared<fge::net::Client>());
+
+    fge::Scene server;
+    fge::Scene client;
+    server.watchEvent(true);
+    server.clientsCheckup(clients, true);
+
+    fge::SceneInterestConfig config;
+    config._cellSize = 100.0f;
+    config._enterDistance = 200.0f;
+    config._leaveDistance = 300.0f;
+    server.enableInterestManagement(config);
+    REQUIRE(server.setClientViewpoint(id, {0.0f, 0.0f}));
+
+    SUBCASE("relevance enter and leave with hysteresis")
+    {
+        auto* near = server.newObject<Unit>();
+        near->setPosition({150.0f, 0.0f});
+        auto* far = server.newObject<Unit>();
+        far->setPosition({1000.0f, 0.0f});
+        auto const nearSid = GetSid(near);
+        auto const farSid = GetSid(far);
+
+        server.updateInterest();
+        REQUIRE(server.isRelevantFor(nearSid, id));
+        REQUIRE_FALSE(server.isRelevantFor(farSid, id));
+
+        //Between the enter and the leave distance, the relevance does not change
+        near->setPosition({250.0f, 0.0f});
+        far->setPosition({0.0f, 250.0f});
+        server.updateInterest();
+        REQUIRE(server.isRelevantFor(nearSid, id));
+        REQUIRE_FALSE(server.isRelevantFor(farSid, id));
+
+        near->setPosition({350.0f, 0.0f});
+        far->setPosition({0.0f, -200.0f});
+        server.updateInterest();
+        REQUIRE_FALSE(server.isRelevantFor(nearSid, id));
+        REQUIRE(server.isRelevantFor(farSid, id));
+
+        near->setPosition({-250.0f, 0.0f});
+        server.updateInterest();
+        REQUIRE_FALSE(server.isRelevantFor(nearSid, id));
+
+        //Without a viewpoint, every Object is relevant
+        server.clearClientViewpoint(id);
+        REQUIRE(server.isRelevantFor(nearSid, id));
+    }
+
+    SUBCASE("created and deleted events of a managed client")
+    {
+        auto* near = server.newObject<Unit>();
+        near->setPosition({100.0f, 100.0f});
+        auto* far = server.newObject<Unit>();
+        far->setPosition({-1000.0f, 500.0f});
+        auto const nearSid = GetSid(near);
+        auto const farSid = GetSid(far);
+
+        //The creation of the far Object is never sent to the client, the near one is sent once
+        server.updateInterest();
+        SyncWatchedEvent(server, client, id);
+        REQUIRE(client.getObjectSize() == 1);
+        REQUIRE(client.getObject(nearSid) != nullptr);
+        REQUIRE(client.getObject(nearSid)->getObject()->getPosition() == fge::Vector2f{100.0f, 100.0f});
+        REQUIRE(client.getObject(farSid) == nullptr);
+
+        near->setPosition({400.0f, 0.0f});
+        far->setPosition({0.0f, 0.0f});
+        server.updateInterest();
+        SyncWatchedEvent(server, client, id);
+        REQUIRE(client.getObjectSize() == 1);
+        REQUIRE(client.getObject(nearSid) == nullptr);
+        REQUIRE(client.getObject(farSid) != nullptr);
+
+        //The deletion of a relevant Object is sent, the deletion of a non-relevant one is not
+        server.delObject(nearSid);
+        server.delObject(farSid);
+        SyncWatchedEvent(server, client, id);
+        REQUIRE(client.getObjectSize() == 0);
+
+        fge::net::Packet pck;
+        server.packWatchedEvent(pck, id);
+        fge::net::SizeType eventCount = 1;
+        pck >> eventCount;
+        REQUIRE(eventCount == 0);
+    }
+
+    SUBCASE("unsent Object keep their modification flag once the byte budget is reached")
+    {
+        config._byteBudget = 1;
+        server.enableInterestManagement(config);
+
+        std::vector<Unit*> units;
+        for (int i = 0; i < 3; ++i)
+        {
+            units.push_back(server.newObject<Unit>());
+            units.back()->setPosition({static_cast<float>(i) * 50.0f, 0.0f});
+        }
+        server.clientsCheckup(clients);
+
+        auto const isModified = [&](Unit const* unit) { return unit->_netList[0]->checkClient(id); };
+        auto const packModification = [&]() {
+            fge::net::Packet pck;
+            server.packModification(pck, id);
+            return pck;
+        };
+
+        for (auto* unit: units)
+        {
+            unit->_health = 50;
+        }
+        server.clientsCheckup(clients);
+        REQUIRE(std::all_of(units.begin(), units.end(), isModified));
+
+        //Only the closest Object fit in the budget
+        packModification();
+        REQUIRE_FALSE(isModified(units[0]));
+        REQUIRE(isModified(units[1]));
+        REQUIRE(isModified(units[2]));
+
+        packModification();
+        REQUIRE_FALSE(isModified(units[1]));
+        REQUIRE(isModified(units[2]));
+
+        packModification();
+        REQUIRE(std::none_of(units.begin(), units.end(), isModified));
+
+        //Without a budget, everything is sent at once
+        config._byteBudget = 0;
+        server.enableInterestManagement(config);
+        for (auto* unit: units)
+        {
+            unit->_health = 10;
+        }
+        server.clientsCheckup(clients);
+        packModification();
+        REQUIRE(std::none_of(units.begin(), units.end(), isModified));
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_vector.hpp"
+#include "FastEngine/network/C_interpolation.hpp"
+#include <cstdlib>
+
+TEST_CASE("testing the interpolation buffer")
+{
+    fge::net::InterpolationConfig config;
+    config._renderDelay = std::chrono::milliseconds{100};
+    config._maxExtrapolation = std::chrono::milliseconds{50};
+    config._capacity = 4;
+
+    fge::net::InterpolationBuffer<float> buffer(config);
+    float value = -1.0f;
+
+    REQUIRE(buffer.sample(1000, value) == fge::net::InterpolationStates::EMPTY);
+    REQUIRE(value == -1.0f);
+
+    //Out of order samples
+    buffer.push(1100, 10.0f);
+    buffer.push(1000, 0.0f);
+    REQUIRE(buffer.getSize() == 2);
+
+    SUBCASE("interpolation")
+    {
+        REQUIRE(buffer.sample(1050, value) == fge::net::InterpolationStates::INTERPOLATED);
+        REQUIRE(value == doctest::Approx(5.0f));
+        REQUIRE(buffer.sampleDelayed(1175, value) == fge::net::InterpolationStates::INTERPOLATED);
+        REQUIRE(value == doctest::Approx(7.5f));
+    }
+
+    SUBCASE("clamping and extrapolation")
+    {
+        REQUIRE(buffer.sample(900, value) == fge::net::InterpolationStates::CLAMPED);
+        REQUIRE(value == 0.0f);
+        REQUIRE(buffer.sample(1120, value) == fge::net::InterpolationStates::EXTRAPOLATED);
+        REQUIRE(value == doctest::Approx(12.0f));
+        REQUIRE(buffer.sample(1500, value) == fge::net::InterpolationStates::CLAMPED);
+        REQUIRE(value == doctest::Approx(15.0f));
+    }
+
+    SUBCASE("capacity and cleanup")
+    {
+        buffer.push(1100, 20.0f); //Replace the old value
+        REQUIRE(buffer.getSize() == 2);
+        REQUIRE(buffer.getLastSample()->_value == 20.0f);
+
+        buffer.push(1200, 30.0f);
+        buffer.push(1300, 40.0f);
+        buffer.push(1400, 50.0f);
+        REQUIRE(buffer.getSize() == 4);
+        REQUIRE(buffer.sample(1000, value) == fge::net::InterpolationStates::CLAMPED);
+        REQUIRE(value == 20.0f);
+
+        buffer.removeOlderThan(1250);
+        REQUIRE(buffer.getSize() == 3);
+        REQUIRE(buffer.sample(1250, value) == fge::net::InterpolationStates::INTERPOLATED);
+        REQUIRE(value == doctest::Approx(35.0f));
+    }
+
+    SUBCASE("vector interpolation")
+    {
+        fge::net::InterpolationBuffer<fge::Vector2f> positions(config);
+        positions.push(0, {0.0f, 10.0f});
+        positions.push(10, {10.0f, 0.0f});
+
+        fge::Vector2f position;
+        REQUIRE(positions.sample(5, position) == fge::net::InterpolationStates::INTERPOLATED);
+        REQUIRE(position.x == doctest::Approx(5.0f));
+        REQUIRE(position.y == doctest::Approx(5.0f));
+    }
+}
+
+TEST_CASE("testing the prediction buffer")
+{
+    fge::net::PredictionBuffer<int, int> prediction;
+    auto const simulate = [](int state, int input) { return state + input; };
+
+    //Local prediction
+    int state = 0;
+    fge::net::InputId ids[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        state = simulate(state, 1);
+        ids[i] = prediction.push(1, state);
+    }
+    REQUIRE(ids[0] == 1);
+    REQUIRE(ids[2] == 3);
+    REQUIRE(state == 3);
+
+    SUBCASE("right prediction")
+    {
+        REQUIRE_FALSE(prediction.reconcile(ids[0], 1, simulate).has_value());
+        REQUIRE(prediction.getPendingInputs().size() == 2);
+        //The same state is received again
+        REQUIRE_FALSE(prediction.reconcile(ids[0], 1, simulate).has_value());
+        //An older state is ignored
+        REQUIRE_FALSE(prediction.reconcile(0, 100, simulate).has_value());
+    }
+
+    SUBCASE("wrong prediction")
+    {
+        auto const corrected = prediction.reconcile(ids[1], 10, simulate);
+        REQUIRE(corrected.has_value());
+        REQUIRE(*corrected == 11);
+        REQUIRE(prediction.getPendingInputs().size() == 1);
+        REQUIRE(prediction.getPendingInputs().front()._predictedState == 11);
+
+        //The replayed prediction is now right
+        REQUIRE_FALSE(prediction.reconcile(ids[2], 11, simulate).has_value());
+        REQUIRE(prediction.getPendingInputs().empty());
+    }
+
+    SUBCASE("tolerance")
+    {
+        auto const compare = [](int a, int b) { return std::abs(a - b) <= 1; };
+        REQUIRE_FALSE(prediction.reconcile(ids[0], 2, simulate, compare).has_value());
+    }
+}
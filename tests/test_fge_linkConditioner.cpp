@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/network/C_linkConditioner.hpp"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+fge::net::Packet MakeDatagram(uint32_t value, std::size_t size = sizeof(uint32_t))
+{
+    fge::net::Packet pck;
+    pck << value;
+    if (size > sizeof(uint32_t))
+    {
+        pck.append(size - sizeof(uint32_t));
+    }
+    return pck;
+}
+
+} // namespace
+
+TEST_CASE("testing the link conditioner")
+{
+    fge::net::LinkConditioner conditioner;
+    conditioner.setSeed(42);
+    auto const start = std::chrono::steady_clock::now();
+
+    fge::net::Identity const source{fge::net::IpAddress::Loopback(fge::net::IpAddress::Types::Ipv4), 4242};
+    fge::net::Identity id;
+    fge::net::Packet pck;
+    uint32_t value = 0;
+
+    SUBCASE("disabled")
+    {
+        pck = MakeDatagram(1);
+        REQUIRE_FALSE(conditioner.push(pck, source, start));
+        REQUIRE(pck.getDataSize() == sizeof(uint32_t));
+        REQUIRE_FALSE(conditioner.pop(pck, id, start));
+        REQUIRE(conditioner.getWaitTime_ms(100, start) == 100);
+    }
+
+    SUBCASE("latency")
+    {
+        conditioner.setConfig({._enabled = true, ._latency = 50ms});
+
+        pck = MakeDatagram(1);
+        REQUIRE(conditioner.push(pck, source, start));
+        pck = MakeDatagram(2);
+        REQUIRE(conditioner.push(pck, source, start + 10ms));
+        REQUIRE(conditioner.getPendingCount() == 2);
+
+        REQUIRE_FALSE(conditioner.pop(pck, id, start + 49ms));
+        REQUIRE(conditioner.getWaitTime_ms(100, start + 20ms) == 30);
+
+        REQUIRE(conditioner.pop(pck, id, start + 50ms));
+        pck >> value;
+        REQUIRE(value == 1);
+        REQUIRE(id == source);
+        REQUIRE_FALSE(conditioner.pop(pck, id, start + 50ms));
+
+        REQUIRE(conditioner.pop(pck, id, start + 60ms));
+        pck >> value;
+        REQUIRE(value == 2);
+
+        REQUIRE(conditioner.getStats()._deliveredCount == 2);
+    }
+
+    SUBCASE("disabling deliver the held datagrams")
+    {
+        conditioner.setConfig({._enabled = true, ._latency = 1s});
+        pck = MakeDatagram(1);
+        REQUIRE(conditioner.push(pck, source, start));
+
+        conditioner.setConfig({});
+        REQUIRE(conditioner.getWaitTime_ms(100, start) == 0);
+        REQUIRE(conditioner.pop(pck, id, start));
+        REQUIRE(conditioner.getPendingCount() == 0);
+    }
+
+    SUBCASE("loss and duplication")
+    {
+        conditioner.setConfig({._enabled = true, ._lossRate = 1.0f});
+        for (uint32_t i = 0; i < 10; ++i)
+        {
+            pck = MakeDatagram(i);
+            REQUIRE(conditioner.push(pck, source, start));
+        }
+        REQUIRE(conditioner.getPendingCount() == 0);
+        REQUIRE(conditioner.getStats()._lostCount == 10);
+
+        conditioner.setConfig({._enabled = true, ._duplicateRate = 1.0f});
+        pck = MakeDatagram(7);
+        REQUIRE(conditioner.push(pck, source, start));
+        for (int i = 0; i < 2; ++i)
+        {
+            REQUIRE(conditioner.pop(pck, id, start));
+            pck >> value;
+            REQUIRE(value == 7);
+        }
+        REQUIRE_FALSE(conditioner.pop(pck, id, start));
+        REQUIRE(conditioner.getStats()._duplicatedCount == 1);
+    }
+
+    SUBCASE("reordering")
+    {
+        conditioner.setConfig({._enabled = true, ._reorderRate = 1.0f});
+        pck = MakeDatagram(1);
+        REQUIRE(conditioner.push(pck, source, start));
+
+        conditioner.setConfig({._enabled = true});
+        pck = MakeDatagram(2);
+        REQUIRE(conditioner.push(pck, source, start));
+
+        REQUIRE(conditioner.pop(pck, id, start));
+        pck >> value;
+        REQUIRE(value == 2);
+        REQUIRE_FALSE(conditioner.pop(pck, id, start));
+        REQUIRE(conditioner.pop(pck, id, start + FGE_NET_LINK_CONDITIONER_REORDER_DELAY));
+        pck >> value;
+        REQUIRE(value == 1);
+    }
+
+    SUBCASE("bandwidth")
+    {
+        //1000 bytes per second, a 100 bytes datagram take 100ms to go through the link
+        conditioner.setConfig({._enabled = true, ._bandwidth = 1000, ._queueLimit = 300});
+
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            pck = MakeDatagram(i, 100);
+            REQUIRE(conditioner.push(pck, source, start));
+        }
+        //The last datagram overflow the queue
+        REQUIRE(conditioner.getPendingCount() == 3);
+        REQUIRE(conditioner.getStats()._overflowCount == 1);
+
+        REQUIRE_FALSE(conditioner.pop(pck, id, start + 99ms));
+        REQUIRE(conditioner.pop(pck, id, start + 100ms));
+        REQUIRE_FALSE(conditioner.pop(pck, id, start + 199ms));
+        REQUIRE(conditioner.pop(pck, id, start + 200ms));
+        REQUIRE(conditioner.pop(pck, id, start + 300ms));
+        pck >> value;
+        REQUIRE(value == 2);
+    }
+}
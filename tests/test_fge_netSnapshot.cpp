@@ -0,0 +1,216 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+#include "FastEngine/network/C_clientList.hpp"
+#include <string>
+
+namespace
+{
+
+class Unit : public fge::Object
+{
+public:
+    Unit()
+    {
+        this->_netSyncMode = fge::Object::NetSyncModes::DELTA_SYNC;
+        this->_netList.pushTrivial<int>(&this->_health);
+        this->_netList.pushTrivial<int>(&this->_ammo);
+    }
+    Unit(Unit const& r) :
+            Unit()
+    {
+        this->_health = r._health;
+        this->_ammo = r._ammo;
+    }
+
+    FGE_OBJ_DEFAULT_COPYMETHOD(Unit)
+
+    char const* getClassName() const override { return "TEST_SNAPSHOT_UNIT"; }
+    char const* getReadableClassName() const override { return "unit"; }
+
+    int _health{100};
+    int _ammo{10};
+};
+
+fge::ObjectSid GetSid(fge::Object const* object)
+{
+    return object->_myObjectData.lock()->getSid();
+}
+
+struct Delta
+{
+    fge::net::Packet _packet;
+    fge::Scene::NetSnapshotId _snapshotId{0};
+    fge::Scene::NetSnapshotId _baselineId{0};
+};
+
+Delta CaptureDelta(fge::Scene& server, fge::net::Identity const& id)
+{
+    server.captureNetSnapshot();
+
+    Delta delta;
+    server.packNetSnapshotDelta(delta._packet, id);
+    delta._packet >> delta._snapshotId >> delta._baselineId;
+    delta._packet.setReadPos(0);
+    return delta;
+}
+
+void Deliver(fge::Scene& server, fge::Scene& client, fge::net::Identity const& id, Delta const& delta)
+{
+    REQUIRE_FALSE(client.unpackNetSnapshotDelta(delta._packet).has_value());
+    REQUIRE(server.acknowledgeNetSnapshot(id, client.getLastReceivedNetSnapshotId()));
+}
+
+Unit const* GetUnit(fge::Scene const& scene, fge::ObjectSid sid)
+{
+    auto const data = scene.getObject(sid);
+    return data ? data->getObject<Unit>() : nullptr;
+}
+
+} // namespace
+
+TEST_CASE("testing Scene network snapshots")
+{
+    fge::reg::RegisterNewClass<Unit>();
+
+    fge::net::Identity const id{fge::net::IpAddress{127, 0, 0, 1}, 42000};
+    fge::net::ClientList clients;
+    clients.add(id, std::make_shared<fge::net::Client>());
+
+    fge::Scene server;
+    fge::Scene client;
+    server.clientsCheckup(clients, true);
+
+    auto* unit = server.newObject<Unit>();
+    auto const sid = GetSid(unit);
+
+    SUBCASE("a lost acknowledgement falls back to the last acknowledged baseline")
+    {
+        auto const first = CaptureDelta(server, id);
+        REQUIRE(first._baselineId == 0);
+        Deliver(server, client, id, first);
+        REQUIRE(GetUnit(client, sid) != nullptr);
+
+        unit->_health = 50;
+        auto const lost = CaptureDelta(server, id);
+        REQUIRE(lost._baselineId == first._snapshotId);
+
+        unit->_ammo = 5;
+        auto const next = CaptureDelta(server, id);
+        REQUIRE(next._baselineId == first._snapshotId);
+        Deliver(server, client, id, next);
+
+        REQUIRE(GetUnit(client, sid)->_health == 50);
+        REQUIRE(GetUnit(client, sid)->_ammo == 5);
+        REQUIRE(server.getAcknowledgedNetSnapshot(id) == next._snapshotId);
+    }
+
+    SUBCASE("a baseline evicted from the ring sends a full snapshot")
+    {
+        unit->_health = 42;
+        Deliver(server, client, id, CaptureDelta(server, id));
+
+        for (std::size_t i = 0; i < FGE_SCENE_NET_SNAPSHOT_RING_SIZE; ++i)
+        {
+            server.captureNetSnapshot();
+        }
+
+        //The client lost its state, only a full snapshot can restore it
+        fge::Scene freshClient;
+        auto const delta = CaptureDelta(server, id);
+        REQUIRE(delta._baselineId == 0);
+        REQUIRE_FALSE(freshClient.unpackNetSnapshotDelta(delta._packet).has_value());
+        REQUIRE(GetUnit(freshClient, sid) != nullptr);
+        REQUIRE(GetUnit(freshClient, sid)->_health == 42);
+        REQUIRE(GetUnit(freshClient, sid)->_ammo == 10);
+    }
+
+    SUBCASE("an Object entering the interest is sent with its full state")
+    {
+        fge::SceneInterestConfig config;
+        config._cellSize = 100.0f;
+        config._enterDistance = 200.0f;
+        config._leaveDistance = 300.0f;
+        server.enableInterestManagement(config);
+        REQUIRE(server.setClientViewpoint(id, {0.0f, 0.0f}));
+
+        unit->setPosition({1000.0f, 0.0f});
+        server.updateInterest();
+        Deliver(server, client, id, CaptureDelta(server, id));
+        REQUIRE(GetUnit(client, sid) == nullptr);
+
+        //The value changes long before the Object become relevant
+        unit->_health = 20;
+        Deliver(server, client, id, CaptureDelta(server, id));
+        Deliver(server, client, id, CaptureDelta(server, id));
+        REQUIRE(GetUnit(client, sid) == nullptr);
+
+        unit->setPosition({100.0f, 0.0f});
+        server.updateInterest();
+        auto const delta = CaptureDelta(server, id);
+        REQUIRE(delta._baselineId != 0);
+        Deliver(server, client, id, delta);
+
+        REQUIRE(GetUnit(client, sid) != nullptr);
+        REQUIRE(GetUnit(client, sid)->_health == 20);
+        REQUIRE(GetUnit(client, sid)->_ammo == 10);
+    }
+
+    SUBCASE("unmodified values are reused and modified ones are captured")
+    {
+        Deliver(server, client, id, CaptureDelta(server, id));
+
+        //Nothing changed, nothing is sent
+        auto const unchanged = CaptureDelta(server, id);
+        Deliver(server, client, id, unchanged);
+        auto const& pck = unchanged._packet;
+        fge::Scene::NetSnapshotId snapshotId{0};
+        fge::Scene::NetSnapshotId baselineId{0};
+        uint64_t timestamp{0};
+        std::string name;
+        fge::net::SizeType sceneCount{1};
+        fge::net::SizeType objectCount{1};
+        pck.setReadPos(0);
+        pck >> snapshotId >> baselineId >> timestamp >> name >> sceneCount >> objectCount;
+        REQUIRE(pck.isValid());
+        REQUIRE(objectCount == 0);
+
+        //Modified with a clients checkup between the captures
+        unit->_health = 1;
+        server.clientsCheckup(clients);
+        Deliver(server, client, id, CaptureDelta(server, id));
+        REQUIRE(GetUnit(client, sid)->_health == 1);
+
+        //Modified without a clients checkup
+        unit->_ammo = 2;
+        Deliver(server, client, id, CaptureDelta(server, id));
+        REQUIRE(GetUnit(client, sid)->_ammo == 2);
+
+        //Modified back to the value of the last clients checkup
+        unit->_health = 3;
+        server.clientsCheckup(clients);
+        Deliver(server, client, id, CaptureDelta(server, id));
+        unit->_health = 1;
+        server.clientsCheckup(clients);
+        Deliver(server, client, id, CaptureDelta(server, id));
+        REQUIRE(GetUnit(client, sid)->_health == 1);
+        REQUIRE(GetUnit(client, sid)->_ammo == 2);
+    }
+}
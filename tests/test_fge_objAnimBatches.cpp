@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/object/C_objAnimBatches.hpp"
+#include "fge_surfacelessContext.hpp"
+
+namespace
+{
+
+void PushAnimation(std::string_view name, std::size_t frameCount, uint32_t ticks)
+{
+    auto block = std::make_shared<fge::anim::DataBlock>();
+    block->_ptr = std::make_shared<fge::anim::AnimationData>();
+    block->_ptr->_type = fge::anim::AnimationType::ANIM_TYPE_SEPARATE_FILES;
+
+    //Frames without texture fallback to the bad texture
+    auto& group = block->_ptr->_groups.emplace_back();
+    group._groupName = "walk";
+    for (std::size_t i = 0; i < frameCount; ++i)
+    {
+        group._frames.emplace_back()._ticks = ticks;
+    }
+    block->_valid = true;
+
+    fge::anim::gManager.push(name, std::move(block));
+}
+
+} // namespace
+
+TEST_CASE("testing ObjAnimationBatches")
+{
+    fge::test::SurfacelessContext context{"fgeObjAnimBatchesTests"};
+    if (!context.isReady())
+    {
+        return;
+    }
+
+    PushAnimation("batches", 3, 2);
+
+    fge::Event event;
+    fge::Scene scene;
+    auto& target = context.getTarget();
+
+    SUBCASE("per instance advance and pause")
+    {
+        fge::Animation animation{"batches"};
+        animation.setLoop(true);
+
+        fge::ObjAnimationBatches batches{animation};
+        batches.setTickDuration(std::chrono::milliseconds{10});
+        batches.addInstance(0, 0);
+        batches.addInstance(0, 1);
+        batches.addInstance(0, 0);
+        batches.setInstancePause(2, true);
+
+        REQUIRE(batches.getInstanceCount() == 3);
+        CHECK(batches.isInstancePaused(2));
+        CHECK_FALSE(batches.isInstancePaused(0));
+
+        //A frame last 2 ticks of 10ms
+        fge::DeltaTime deltaTime{std::chrono::milliseconds{15}};
+        batches.update(target, event, deltaTime, scene);
+        CHECK(batches.getInstanceFrame(0) == 0);
+        CHECK(batches.getInstanceFrame(1) == 1);
+
+        deltaTime = std::chrono::milliseconds{5};
+        batches.update(target, event, deltaTime, scene);
+        CHECK(batches.getInstanceFrame(0) == 1);
+        CHECK(batches.getInstanceFrame(1) == 2);
+        CHECK(batches.getInstanceFrame(2) == 0);
+
+        //The looping instance restart at the first frame
+        deltaTime = std::chrono::milliseconds{20};
+        batches.update(target, event, deltaTime, scene);
+        CHECK(batches.getInstanceFrame(0) == 2);
+        CHECK(batches.getInstanceFrame(1) == 0);
+        CHECK(batches.getInstanceFrame(2) == 0);
+
+        batches.setInstancePause(2, false);
+        batches.update(target, event, deltaTime, scene);
+        CHECK(batches.getInstanceFrame(2) == 1);
+
+        CHECK(batches.getInstanceFrame(3) == std::nullopt);
+    }
+
+    SUBCASE("save and load")
+    {
+        fge::Animation animation{"batches", 2};
+        animation.setLoop(true);
+        animation.setReverse(true);
+
+        fge::ObjAnimationBatches batches{animation};
+        batches.setTickDuration(std::chrono::milliseconds{42});
+
+        nlohmann::json json;
+        batches.save(json);
+
+        fge::ObjAnimationBatches loaded;
+        loaded.load(json, {});
+
+        auto const& loadedAnimation = loaded.getAnimation();
+        CHECK(loadedAnimation.getName() == "batches");
+        CHECK(loadedAnimation.getFrameIndex() == 2);
+        CHECK(loadedAnimation.isLoop());
+        CHECK(loadedAnimation.isReverse());
+        CHECK(loaded.getTickDuration() == std::chrono::milliseconds{42});
+
+        //New instances take the play mode of the loaded animation
+        loaded.addInstance();
+        CHECK(loaded.isInstanceLoop(0));
+        CHECK(loaded.isInstanceReverse(0));
+    }
+}
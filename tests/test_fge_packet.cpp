@@ -0,0 +1,302 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_compressorLZ4.hpp"
+#include "FastEngine/network/C_packet.hpp"
+#include "FastEngine/network/C_protocol.hpp"
+#include "FastEngine/network/C_quantized.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST_CASE("testing zig-zag encoding")
+{
+    REQUIRE(fge::net::ZigZagEncode<int32_t>(0) == 0);
+    REQUIRE(fge::net::ZigZagEncode<int32_t>(-1) == 1);
+    REQUIRE(fge::net::ZigZagEncode<int32_t>(1) == 2);
+    REQUIRE(fge::net::ZigZagEncode<int32_t>(-2) == 3);
+
+    REQUIRE(fge::net::ZigZagDecode<int32_t>(fge::net::ZigZagEncode<int32_t>(std::numeric_limits<int32_t>::min())) ==
+            std::numeric_limits<int32_t>::min());
+    REQUIRE(fge::net::ZigZagDecode<int64_t>(fge::net::ZigZagEncode<int64_t>(std::numeric_limits<int64_t>::max())) ==
+            std::numeric_limits<int64_t>::max());
+    REQUIRE(fge::net::ZigZagDecode<int8_t>(fge::net::ZigZagEncode<int8_t>(-128)) == -128);
+}
+
+TEST_CASE("testing packet varint")
+{
+    fge::net::Packet pck;
+
+    SUBCASE("small values take 1 byte")
+    {
+        pck << fge::net::VarInt<uint16_t>{127};
+        REQUIRE(pck.getDataSize() == 1);
+        pck << fge::net::VarInt<int32_t>{-64};
+        REQUIRE(pck.getDataSize() == 2);
+
+        fge::net::VarInt<uint16_t> a;
+        fge::net::VarInt<int32_t> b;
+        pck >> a >> b;
+        REQUIRE(pck.isValid());
+        REQUIRE(a._value == 127);
+        REQUIRE(b._value == -64);
+    }
+
+    SUBCASE("limits round trip")
+    {
+        pck.packVarint(std::numeric_limits<uint64_t>::max());
+        pck.packVarint(std::numeric_limits<int64_t>::min());
+        pck.packVarint(std::numeric_limits<uint16_t>::max());
+        REQUIRE(pck.getDataSize() == 10 + 10 + 3);
+
+        uint64_t a = 0;
+        int64_t b = 0;
+        uint16_t c = 0;
+        pck.unpackVarint(a).unpackVarint(b).unpackVarint(c);
+        REQUIRE(pck.isValid());
+        REQUIRE(a == std::numeric_limits<uint64_t>::max());
+        REQUIRE(b == std::numeric_limits<int64_t>::min());
+        REQUIRE(c == std::numeric_limits<uint16_t>::max());
+        REQUIRE(pck.endReached());
+    }
+
+    SUBCASE("overflow is rejected")
+    {
+        pck.packVarint(uint32_t{70000});
+
+        uint16_t value = 0;
+        pck.unpackVarint(value);
+        REQUIRE_FALSE(pck.isValid());
+    }
+
+    SUBCASE("truncated varint is rejected")
+    {
+        uint8_t const data = 0x80;
+        pck.append(&data, sizeof(data));
+
+        uint32_t value = 0;
+        pck.unpackVarint(value);
+        REQUIRE_FALSE(pck.isValid());
+    }
+}
+
+TEST_CASE("testing packet views")
+{
+    fge::net::Packet source;
+    source << uint32_t{42} << std::string{"view"} << uint16_t{7};
+
+    auto view = fge::net::Packet::View({source.getData(), source.getDataSize()});
+    REQUIRE(view.isView());
+    REQUIRE(std::as_const(view).getData() == source.getData());
+    REQUIRE(view.getDataSize() == source.getDataSize());
+
+    SUBCASE("reading does not copy")
+    {
+        uint32_t a = 0;
+        std::string b;
+        uint16_t c = 0;
+        view >> a >> b >> c;
+        REQUIRE(view.isValid());
+        REQUIRE(view.endReached());
+        REQUIRE(a == 42);
+        REQUIRE(b == "view");
+        REQUIRE(c == 7);
+        REQUIRE(view.isView());
+
+        view.setReadPos(0);
+        view >> a;
+        REQUIRE(a == 42);
+    }
+
+    SUBCASE("modifying copies the data")
+    {
+        auto const sourceSize = source.getDataSize();
+        view << uint8_t{1};
+        REQUIRE_FALSE(view.isView());
+        REQUIRE(std::as_const(view).getData() != source.getData());
+        REQUIRE(view.getDataSize() == sourceSize + 1);
+        REQUIRE(source.getDataSize() == sourceSize);
+
+        uint32_t a = 0;
+        view >> a;
+        REQUIRE(a == 42);
+    }
+
+    SUBCASE("moving keeps the view")
+    {
+        auto moved = std::move(view);
+        REQUIRE(moved.isView());
+        REQUIRE(std::as_const(moved).getData() == source.getData());
+        REQUIRE_FALSE(view.isView());
+        REQUIRE(view.getDataSize() == 0);
+    }
+}
+
+TEST_CASE("testing packet quantization")
+{
+    fge::net::Packet pck;
+
+    SUBCASE("quantize range")
+    {
+        constexpr fge::net::QuantizeRange range{-1.0f, 1.0f, 8};
+        REQUIRE(range.getMaxQuantizedValue() == 255);
+        REQUIRE(range.quantize(-2.0f) == 0);
+        REQUIRE(range.quantize(2.0f) == 255);
+        REQUIRE(std::abs(range.dequantize(range.quantize(0.5f)) - 0.5f) <= range.getPrecision());
+    }
+
+    SUBCASE("out of range bits are clamped")
+    {
+        constexpr fge::net::QuantizeRange noBits{0.0f, 1.0f, 0};
+        REQUIRE(noBits.getBits() == 1);
+        REQUIRE(noBits.dequantize(noBits.quantize(1.0f)) == 1.0f);
+
+        fge::net::QuantizeRange const tooManyBits{0.0f, 1.0f, 40};
+        REQUIRE(tooManyBits.getBits() == 32);
+        REQUIRE(tooManyBits.getPackedSize(3) == 12);
+
+        fge::net::PackQuantized<3>(pck, tooManyBits, {0.0f, 0.5f, 1.0f});
+        REQUIRE(pck.getDataSize() == 12);
+        std::array<float, 3> values{};
+        REQUIRE(fge::net::UnpackQuantized(pck, tooManyBits, values));
+        REQUIRE(values[2] == 1.0f);
+    }
+
+    SUBCASE("quantized values are bit packed")
+    {
+        using QuantizedPosition = fge::net::QuantizedVector2<float, 0.0f, 1024.0f, 12>;
+        pck << QuantizedPosition{{512.3f, 12.7f}};
+        REQUIRE(pck.getDataSize() == 3);
+
+        QuantizedPosition position;
+        pck >> position;
+        REQUIRE(pck.isValid());
+        REQUIRE(std::abs(position._value.x - 512.3f) <= QuantizedPosition::Range.getPrecision());
+        REQUIRE(std::abs(position._value.y - 12.7f) <= QuantizedPosition::Range.getPrecision());
+    }
+
+    SUBCASE("quantize policy")
+    {
+        using Policy = fge::net::NetworkTypeQuantizePolicy<-100.0f, 100.0f, 16>;
+        Policy::pack(pck, fge::Vector3f{-50.0f, 0.0f, 99.0f});
+        REQUIRE(pck.getDataSize() == 6);
+
+        fge::Vector3f value;
+        REQUIRE(Policy::unpack(pck, value));
+        REQUIRE(std::abs(value.x + 50.0f) <= Policy::Range.getPrecision());
+        REQUIRE(std::abs(value.y - 0.0f) <= Policy::Range.getPrecision());
+        REQUIRE(std::abs(value.z - 99.0f) <= Policy::Range.getPrecision());
+    }
+}
+
+TEST_CASE("testing fragment views")
+{
+    auto packet = std::make_shared<fge::net::ProtocolPacket>(fge::net::ProtocolPacket::IdType{FGE_NET_CUSTOM_ID_START},
+                                                             fge::net::ProtocolPacket::RealmType{2},
+                                                             fge::net::ProtocolPacket::CounterType{42});
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        packet->packet() << i;
+    }
+
+    auto const fragments = fge::net::CreateFragmentViews(packet, 500);
+    REQUIRE(fragments.size() == 9);
+    REQUIRE(fge::net::CreateFragmentViews(packet, 5000).empty());
+
+    for (auto const& fragment: fragments)
+    {
+        REQUIRE(fragment._source == packet);
+        REQUIRE(fragment._realm == 42);
+        REQUIRE(fragment._total == fragments.size());
+    }
+
+    SUBCASE("reassembly with a retransmitted fragment")
+    {
+        fge::net::PacketDefragmentation defragmentation;
+        fge::net::PacketDefragmentation::Result result{};
+
+        auto const receive = [&](fge::net::FragmentView const& fragment) {
+            auto received = fragment.materialize();
+            REQUIRE(received->isFragmented());
+            received->skip(fge::net::ProtocolPacket::HeaderSize);
+            return defragmentation.process(std::move(received));
+        };
+
+        for (std::size_t i = 0; i < fragments.size() - 1; ++i)
+        {
+            result = receive(fragments[i]);
+            REQUIRE(result._result == fge::net::PacketDefragmentation::Results::WAITING);
+        }
+        //A duplicate must not discard the fragments already received
+        result = receive(fragments[2]);
+        REQUIRE(result._result == fge::net::PacketDefragmentation::Results::DISCARDED);
+
+        result = receive(fragments.back());
+        REQUIRE(result._result == fge::net::PacketDefragmentation::Results::RETRIEVABLE);
+
+        auto const reassembled = defragmentation.retrieve(result._id, {});
+        REQUIRE(reassembled != nullptr);
+        REQUIRE(reassembled->getDataSize() == packet->getDataSize());
+        REQUIRE(std::equal(packet->getData(), packet->getData() + packet->getDataSize(), reassembled->getData()));
+    }
+}
+
+TEST_CASE("testing LZ4HC compressors sharing the thread context")
+{
+    std::vector<uint8_t> dictionaryData;
+    std::vector<uint8_t> raw;
+    for (uint32_t i = 0; i < 2048; ++i)
+    {
+        dictionaryData.push_back(static_cast<uint8_t>(i * 7));
+        raw.push_back(static_cast<uint8_t>((i * 7) ^ (i / 64)));
+    }
+    auto const dictionary = std::make_shared<fge::CompressorLZ4Dictionary const>(dictionaryData);
+
+    fge::CompressorLZ4HC withDictionary;
+    withDictionary.setDictionary(dictionary);
+    fge::CompressorLZ4HC withoutDictionary;
+    withoutDictionary.setCompressionLevel(3);
+
+    //Alternating compressors with a different dictionary and level must reload the shared context
+    auto const roundTrip = [&](fge::CompressorLZ4HC& compressor) {
+        REQUIRE_FALSE(compressor.compress(raw).has_value());
+        auto const compressed = compressor.getBuffer();
+
+        fge::CompressorLZ4 decompressor;
+        decompressor.setDictionary(compressor.getDictionary());
+        REQUIRE_FALSE(decompressor.uncompress(compressed).has_value());
+        REQUIRE(decompressor.getBuffer() == raw);
+    };
+    for (int i = 0; i < 2; ++i)
+    {
+        roundTrip(withDictionary);
+        roundTrip(withoutDictionary);
+    }
+
+    std::thread otherThread([&]() {
+        fge::CompressorLZ4HC compressor;
+        compressor.setDictionary(dictionary);
+        roundTrip(compressor);
+    });
+    otherThread.join();
+    roundTrip(withDictionary);
+}
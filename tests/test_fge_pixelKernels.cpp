@@ -0,0 +1,219 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/graphic/pixelKernels.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+uint32_t MakePixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+    uint8_t const bytes[4] = {r, g, b, a};
+    uint32_t pixel;
+    std::memcpy(&pixel, bytes, sizeof(pixel));
+    return pixel;
+}
+
+uint8_t GetChannel(uint32_t pixel, std::size_t channel)
+{
+    uint8_t bytes[4];
+    std::memcpy(bytes, &pixel, sizeof(pixel));
+    return bytes[channel];
+}
+
+std::vector<uint32_t> MakeRow(std::size_t count)
+{
+    std::vector<uint32_t> row(count);
+    uint32_t state = 0x12345678;
+    for (auto& pixel: row)
+    {
+        state = state * 1664525u + 1013904223u;
+        pixel = state;
+    }
+    return row;
+}
+
+} // namespace
+
+TEST_CASE("testing pixel row kernels")
+{
+    //Every size up to a few SIMD blocks, in order to test the remaining pixels handling
+    constexpr std::size_t MaxCount = 70;
+
+    SUBCASE("ReverseRow")
+    {
+        for (std::size_t count = 0; count < MaxCount; ++count)
+        {
+            CAPTURE(count);
+            auto const original = MakeRow(count);
+
+            auto row = original;
+            fge::pixel::ReverseRow(row.data(), row.size());
+            CHECK(std::equal(row.begin(), row.end(), original.rbegin()));
+        }
+    }
+    SUBCASE("SwapRows")
+    {
+        for (std::size_t count = 0; count < MaxCount; ++count)
+        {
+            CAPTURE(count);
+            auto const original = MakeRow(count);
+
+            auto rowA = original;
+            auto rowB = MakeRow(count + 1);
+            rowB.pop_back();
+            auto const originalB = rowB;
+            fge::pixel::SwapRows(rowA.data(), rowB.data(), count);
+            CHECK(rowA == originalB);
+            CHECK(rowB == original);
+        }
+    }
+    SUBCASE("FillRow")
+    {
+        for (std::size_t count = 0; count < MaxCount; ++count)
+        {
+            CAPTURE(count);
+            auto const original = MakeRow(count);
+
+            auto row = original;
+            fge::pixel::FillRow(row.data(), row.size(), 0xDEADBEEF);
+            CHECK(std::all_of(row.begin(), row.end(), [](uint32_t pixel) { return pixel == 0xDEADBEEF; }));
+        }
+    }
+    SUBCASE("ReplaceRow")
+    {
+        for (std::size_t count = 0; count < MaxCount; ++count)
+        {
+            CAPTURE(count);
+            auto const original = MakeRow(count);
+
+            auto row = original;
+            uint32_t const key = 0xFF00FF00;
+            for (std::size_t i = 0; i < row.size(); i += 3)
+            {
+                row[i] = key;
+            }
+            auto expected = row;
+            std::replace(expected.begin(), expected.end(), key, uint32_t{0x00FF00FF});
+
+            fge::pixel::ReplaceRow(row.data(), row.size(), key, 0x00FF00FF);
+            CHECK(row == expected);
+        }
+    }
+    SUBCASE("PremultiplyRow")
+    {
+        for (std::size_t count = 0; count < MaxCount; ++count)
+        {
+            CAPTURE(count);
+            auto const original = MakeRow(count);
+
+            auto row = original;
+            fge::pixel::PremultiplyRow(row.data(), row.size());
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                auto const alpha = static_cast<double>(GetChannel(original[i], 3));
+                for (std::size_t c = 0; c < 3; ++c)
+                {
+                    auto const expected = std::lround(GetChannel(original[i], c) * alpha / 255.0);
+                    REQUIRE(GetChannel(row[i], c) == expected);
+                }
+                REQUIRE(GetChannel(row[i], 3) == GetChannel(original[i], 3));
+            }
+        }
+    }
+    SUBCASE("UnpremultiplyRow")
+    {
+        for (std::size_t count = 0; count < MaxCount; ++count)
+        {
+            CAPTURE(count);
+            auto const original = MakeRow(count);
+
+            auto row = original;
+            fge::pixel::PremultiplyRow(row.data(), row.size());
+            auto const premultiplied = row;
+            fge::pixel::UnpremultiplyRow(row.data(), row.size());
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                auto const alpha = GetChannel(premultiplied[i], 3);
+                REQUIRE(GetChannel(row[i], 3) == alpha);
+                for (std::size_t c = 0; c < 3; ++c)
+                {
+                    long expected = 0;
+                    if (alpha != 0)
+                    {
+                        auto const channel = static_cast<double>(GetChannel(premultiplied[i], c));
+                        expected = std::min(255L, std::lround(channel * 255.0 / static_cast<double>(alpha)));
+                    }
+                    REQUIRE(std::abs(GetChannel(row[i], c) - expected) <= 1);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("testing pixel rows downsampling")
+{
+    for (std::size_t srcCount = 1; srcCount < 40; ++srcCount)
+    {
+        CAPTURE(srcCount);
+        auto const rowA = MakeRow(srcCount);
+        auto const rowB = MakeRow(srcCount + 1);
+
+        std::size_t const dstCount = std::max<std::size_t>(srcCount / 2, 1);
+        std::vector<uint32_t> dst(dstCount + 1, 0xCDCDCDCD);
+        fge::pixel::DownsampleRows(rowA.data(), rowB.data(), srcCount, dst.data());
+
+        for (std::size_t i = 0; i < dstCount; ++i)
+        {
+            std::size_t const x0 = 2 * i;
+            std::size_t const x1 = std::min(2 * i + 1, srcCount - 1);
+            for (std::size_t c = 0; c < 4; ++c)
+            {
+                unsigned int const sum = GetChannel(rowA[x0], c) + GetChannel(rowA[x1], c) +
+                                         GetChannel(rowB[x0], c) + GetChannel(rowB[x1], c);
+                REQUIRE(GetChannel(dst[i], c) == (sum + 2) / 4);
+            }
+        }
+        //Nothing is written after the destination row
+        CHECK(dst.back() == 0xCDCDCDCD);
+    }
+}
+
+TEST_CASE("testing premultiply edge values")
+{
+    std::vector<uint32_t> row = {MakePixel(255, 128, 0, 255), MakePixel(255, 128, 1, 0), MakePixel(200, 100, 50, 128),
+                                 MakePixel(255, 255, 255, 1)};
+    row.resize(9, MakePixel(10, 20, 30, 40));
+
+    fge::pixel::PremultiplyRow(row.data(), row.size());
+    CHECK(row[0] == MakePixel(255, 128, 0, 255));
+    CHECK(row[1] == MakePixel(0, 0, 0, 0));
+    CHECK(row[2] == MakePixel(100, 50, 25, 128));
+    CHECK(row[3] == MakePixel(1, 1, 1, 1));
+    CHECK(row[8] == MakePixel(2, 3, 5, 40));
+
+    fge::pixel::UnpremultiplyRow(row.data(), row.size());
+    CHECK(row[0] == MakePixel(255, 128, 0, 255));
+    CHECK(row[1] == MakePixel(0, 0, 0, 0));
+    CHECK(row[2] == MakePixel(199, 100, 50, 128));
+    CHECK(row[3] == MakePixel(255, 255, 255, 1));
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_propertyList.hpp"
+#include "FastEngine/C_vector.hpp"
+#include <string>
+
+namespace
+{
+
+struct LargeValue
+{
+    char _data[128]{};
+    std::string _name;
+};
+
+} // namespace
+
+TEST_CASE("testing Property inline storage")
+{
+    static_assert(fge::Property::IsStringStoredInline);
+    static_assert(fge::Property::IsClassStoredInline<fge::Vector2f>);
+    static_assert(!fge::Property::IsClassStoredInline<LargeValue>);
+
+    SUBCASE("string")
+    {
+        fge::Property property{"a string that is too long for the small string optimization"};
+        fge::Property copy{property};
+        REQUIRE(copy.get<std::string>() == property.get<std::string>());
+
+        fge::Property moved{std::move(copy)};
+        REQUIRE(moved.get<std::string>() == property.get<std::string>());
+        REQUIRE(copy.isType(fge::Property::Types::PTYPE_NULL));
+
+        moved.set(fge::Property{"other"});
+        REQUIRE(moved.get<std::string>().value() == "other");
+    }
+
+    SUBCASE("small class")
+    {
+        fge::Property property{fge::Vector2f{1.0f, 2.0f}};
+        fge::Property copy{property};
+        REQUIRE(copy.get<fge::Vector2f>().value() == fge::Vector2f{1.0f, 2.0f});
+
+        fge::Property moved{std::move(copy)};
+        REQUIRE(moved.get<fge::Vector2f>().value() == fge::Vector2f{1.0f, 2.0f});
+        REQUIRE(copy.isType(fge::Property::Types::PTYPE_NULL));
+
+        moved.set(fge::Vector2f{3.0f, 4.0f});
+        REQUIRE(moved.get<fge::Vector2f>().value() == fge::Vector2f{3.0f, 4.0f});
+    }
+
+    SUBCASE("large class")
+    {
+        fge::Property property{LargeValue{{}, "large"}};
+        fge::Property copy{property};
+        fge::Property moved{std::move(copy)};
+        REQUIRE(moved.getPtr<LargeValue>()->_name == "large");
+        REQUIRE(copy.isType(fge::Property::Types::PTYPE_NULL));
+    }
+
+    SUBCASE("array")
+    {
+        fge::Property property;
+        property.setArrayType();
+        property.pushData(fge::PintType{1});
+        property.pushData(std::string{"two"});
+
+        fge::Property copy{property};
+        REQUIRE(copy.getDataSize() == 2);
+        REQUIRE(copy.getData(1)->get<std::string>().value() == "two");
+    }
+}
+
+TEST_CASE("testing PropertyList open addressing")
+{
+    fge::PropertyList properties;
+
+    auto& first = properties["first"];
+    first = "stable";
+
+    //Forcing several rehashes
+    for (fge::PintType i = 0; i < 500; ++i)
+    {
+        properties.setProperty("value" + std::to_string(i), i);
+    }
+    REQUIRE(properties.count() == 501);
+    REQUIRE(&first == &properties["first"]);
+    REQUIRE(first.get<std::string>().value() == "stable");
+
+    //Removing every even values, the probe sequences of the remaining keys must stay valid
+    for (fge::PintType i = 0; i < 500; i += 2)
+    {
+        properties.delProperty("value" + std::to_string(i));
+    }
+    REQUIRE(properties.count() == 251);
+
+    auto const& constProperties = properties;
+    for (fge::PintType i = 0; i < 500; ++i)
+    {
+        auto const* value = constProperties.getProperty<fge::PintType>("value" + std::to_string(i));
+        if (i % 2 == 0)
+        {
+            REQUIRE(value == nullptr);
+        }
+        else
+        {
+            REQUIRE(value != nullptr);
+            REQUIRE(*value == i);
+        }
+    }
+
+    std::size_t iterated = 0;
+    for (auto const& property: constProperties)
+    {
+        REQUIRE(property.first.isValid());
+        ++iterated;
+    }
+    REQUIRE(iterated == 251);
+
+    //Removed entries are recycled
+    properties.setProperty("recycled", fge::PintType{42});
+    REQUIRE(properties.count() == 252);
+    REQUIRE(*properties.getProperty<fge::PintType>("recycled") == 42);
+
+    fge::PropertyList copy;
+    copy = properties;
+    REQUIRE(copy.count() == properties.count());
+    REQUIRE(copy.findProperty<std::string>("first"));
+
+    copy.delAllProperties();
+    REQUIRE(copy.count() == 0);
+    REQUIRE(copy.begin() == copy.end());
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_random.hpp"
+#include <vector>
+
+TEST_CASE("testing xoshiro256** engine")
+{
+    //Reference value of xoshiro256** with a splitmix64 expanded seed of 0
+    fge::Xoshiro256ss engine(0);
+    REQUIRE(engine() == 0x99EC5F36CB75F2B4);
+
+    SUBCASE("same seed give the same stream")
+    {
+        fge::Xoshiro256ss a(1234);
+        fge::Xoshiro256ss b(1234);
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(a() == b());
+        }
+    }
+
+    SUBCASE("bulk generation use jumped streams")
+    {
+        fge::Xoshiro256ss bulk(42);
+        fge::Xoshiro256ss reference(42);
+
+        std::vector<uint64_t> values(1001);
+        bulk.generate(values);
+
+        for (std::size_t lane = 0; lane < FGE_RANDOM_BULK_LANES; ++lane)
+        {
+            fge::Xoshiro256ss laneEngine = reference;
+            for (std::size_t i = 0; i <= lane; ++i)
+            {
+                laneEngine.jump();
+            }
+            for (std::size_t i = lane; i < values.size(); i += FGE_RANDOM_BULK_LANES)
+            {
+                REQUIRE(values[i] == laneEngine());
+            }
+        }
+
+        //The main stream is not affected
+        REQUIRE(bulk() == reference());
+    }
+}
+
+TEST_CASE("testing random fill")
+{
+    fge::LocalRandom random(7);
+
+    std::vector<float> values(10000);
+    random.fill<float>(values, -2.0f, 3.0f);
+    for (auto const value: values)
+    {
+        REQUIRE(value >= -2.0f);
+        REQUIRE(value <= 3.0f);
+    }
+
+    std::vector<int> dices(100);
+    random.fill<int>(dices, 1, 6);
+    for (auto const dice: dices)
+    {
+        REQUIRE(dice >= 1);
+        REQUIRE(dice <= 6);
+    }
+}
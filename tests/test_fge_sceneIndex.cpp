@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+
+using namespace fge::literals;
+
+namespace
+{
+
+class Creature : public fge::Object
+{
+public:
+    FGE_OBJ_DEFAULT_COPYMETHOD(Creature)
+
+    char const* getClassName() const override { return "TEST_CREATURE"; }
+    char const* getReadableClassName() const override { return "creature"; }
+};
+class Door : public fge::Object
+{
+public:
+    FGE_OBJ_DEFAULT_COPYMETHOD(Door)
+
+    char const* getClassName() const override { return "TEST_DOOR"; }
+    char const* getReadableClassName() const override { return "door"; }
+};
+
+} // namespace
+
+TEST_CASE("testing Scene class and tag indices")
+{
+    fge::reg::RegisterNewClass<Creature>();
+    fge::reg::RegisterNewClass<Door>();
+
+    fge::Scene scene;
+    fge::ObjectContainer result;
+
+    auto creatureA = scene.newObject<Creature>();
+    auto creatureB = scene.newObject<Creature>();
+    auto door = scene.newObject<Door>();
+
+    SUBCASE("class index")
+    {
+        REQUIRE(scene.getAllObj_ByClass("TEST_CREATURE", result) == 2);
+        REQUIRE(scene.getAllObj_ByClass("TEST_DOOR"_strid, result) == 1);
+        REQUIRE(scene.getAllObj_ByClass(fge::reg::GetClassId("TEST_DOOR"), result) == 1);
+        REQUIRE(result.size() == 4);
+        REQUIRE(scene.getFirstObj_ByClass("TEST_DOOR")->getObject() == door);
+
+        scene.delObject(creatureA->_myObjectData.lock()->getSid());
+        result.clear();
+        REQUIRE(scene.getAllObj_ByClass("TEST_CREATURE"_strid, result) == 1);
+        REQUIRE(result.front()->getObject() == creatureB);
+
+        auto const doorSid = door->_myObjectData.lock()->getSid();
+        REQUIRE(scene.setObject(doorSid, fge::ObjectPtr{new Creature()}));
+        REQUIRE(scene.getFirstObj_ByClass("TEST_DOOR") == nullptr);
+        REQUIRE(scene.getFirstObj_ByClass("TEST_CREATURE"_strid) != nullptr);
+        REQUIRE(scene.getObject(doorSid)->getObject()->getClassName() == std::string_view{"TEST_CREATURE"});
+
+        scene.delAllObject(false);
+        REQUIRE(scene.getFirstObj_ByClass("TEST_CREATURE") == nullptr);
+    }
+
+    SUBCASE("tag index")
+    {
+        creatureA->_tags.add("hostile");
+        door->_tags.add("hostile"_strid);
+        REQUIRE(scene.getAllObj_ByTag("hostile", result) == 2);
+
+        door->_tags.del("hostile");
+        result.clear();
+        REQUIRE(scene.getAllObj_ByTag("hostile"_strid, result) == 1);
+        REQUIRE(scene.getFirstObj_ByTag("hostile")->getObject() == creatureA);
+
+        auto tagged = fge::ObjectPtr{new Door()};
+        tagged->_tags.add("locked");
+        auto* taggedPtr = tagged.get();
+        scene.newObject(std::move(tagged));
+        REQUIRE(scene.getFirstObj_ByTag("locked"_strid)->getObject() == taggedPtr);
+
+        fge::Scene otherScene;
+        scene.transferObject(creatureA->_myObjectData.lock()->getSid(), otherScene);
+        REQUIRE(scene.getFirstObj_ByTag("hostile") == nullptr);
+        REQUIRE(otherScene.getFirstObj_ByTag("hostile")->getObject() == creatureA);
+
+        creatureA->_tags.clear();
+        REQUIRE(otherScene.getFirstObj_ByTag("hostile") == nullptr);
+    }
+
+    SUBCASE("tag list move")
+    {
+        creatureA->_tags.add("hostile");
+        door->_tags.add("locked");
+
+        door->_tags = std::move(creatureA->_tags);
+        REQUIRE(creatureA->_tags.getSize() == 0);
+        REQUIRE(scene.getAllObj_ByTag("hostile", result) == 1);
+        REQUIRE(result.front()->getObject() == door);
+        REQUIRE(scene.getFirstObj_ByTag("locked") == nullptr);
+
+        fge::TagList moved{std::move(door->_tags)};
+        REQUIRE(moved.check("hostile"));
+        REQUIRE(scene.getFirstObj_ByTag("hostile") == nullptr);
+    }
+}
+
+TEST_CASE("testing Scene copy random stream")
+{
+    fge::reg::RegisterNewClass<Creature>();
+
+    fge::Scene scene;
+    scene.setRandomSeed(42);
+
+    auto const getSids = [](fge::Scene& target) {
+        std::vector<fge::ObjectSid> sids;
+        for (int i = 0; i < 8; ++i)
+        {
+            sids.push_back(target.newObject<Creature>()->_myObjectData.lock()->getSid());
+        }
+        return sids;
+    };
+
+    //A copied Scene must not generate the same SID sequence as its source
+    fge::Scene copy(scene);
+    REQUIRE(getSids(scene) != getSids(copy));
+
+    fge::Scene assigned;
+    assigned = scene;
+    REQUIRE(getSids(scene) != getSids(assigned));
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_scene.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+#include <atomic>
+#include <thread>
+
+namespace
+{
+
+class Crate : public fge::Object
+{
+public:
+    Crate() { this->_netSyncMode = fge::Object::NetSyncModes::FULL_SYNC; }
+    Crate(Crate const& r) :
+            Crate()
+    {
+        this->_weight = r._weight;
+    }
+
+    FGE_OBJ_DEFAULT_COPYMETHOD(Crate)
+
+    void pack(fge::net::Packet& pck) override
+    {
+        fge::Object::pack(pck);
+        pck << this->_weight;
+    }
+    void unpack(fge::net::Packet const& pck) override
+    {
+        fge::Object::unpack(pck);
+        pck >> this->_weight;
+        gUnpackThreads.fetch_add(std::this_thread::get_id() != gMainThread ? 1 : 0);
+    }
+
+    char const* getClassName() const override { return "TEST_LOAD_CRATE"; }
+    char const* getReadableClassName() const override { return "crate"; }
+
+    int _weight{0};
+
+    static inline std::thread::id gMainThread;
+    static inline std::atomic_size_t gUnpackThreads{0};
+};
+
+constexpr std::size_t gCrateCount = FGE_SCENE_PARALLEL_LOAD_MIN_OBJECTS * 2;
+
+void FillScene(fge::Scene& scene)
+{
+    for (std::size_t i = 0; i < gCrateCount; ++i)
+    {
+        auto* crate = scene.newObject<Crate>();
+        crate->setPosition({static_cast<float>(i), 0.0f});
+        crate->_weight = static_cast<int>(i) * 3;
+    }
+}
+
+void CheckScene(fge::Scene const& scene)
+{
+    REQUIRE(scene.getObjectSize() == gCrateCount);
+    for (auto const& data: scene)
+    {
+        auto const* crate = data->getObject<Crate>();
+        REQUIRE(crate->_weight == static_cast<int>(crate->getPosition().x) * 3);
+    }
+}
+
+} // namespace
+
+TEST_CASE("testing Scene parallel unpack")
+{
+    fge::reg::RegisterNewClass<Crate>();
+    Crate::gMainThread = std::this_thread::get_id();
+    Crate::gUnpackThreads = 0;
+
+    fge::Scene server;
+    FillScene(server);
+
+    fge::Scene client;
+    client.setLoadThreadCount(4);
+
+    SUBCASE("object sizes are only packed on demand")
+    {
+        fge::net::Packet withoutSizes;
+        server.pack(withoutSizes, {});
+        REQUIRE_FALSE(server.isPackingObjectSizes());
+
+        server.setPackObjectSizes(true);
+        fge::net::Packet withSizes;
+        server.pack(withSizes, {});
+        REQUIRE(withSizes.getDataSize() == withoutSizes.getDataSize() + gCrateCount * sizeof(uint32_t));
+
+        //Without sizes, the Object are unpacked serially
+        REQUIRE_FALSE(client.unpack(withoutSizes).has_value());
+        CheckScene(client);
+        REQUIRE(Crate::gUnpackThreads == 0);
+    }
+
+    SUBCASE("the worker threads are reused between unpacks")
+    {
+        server.setPackObjectSizes(true);
+        for (int i = 0; i < 3; ++i)
+        {
+            fge::net::Packet pck;
+            server.pack(pck, {});
+            REQUIRE_FALSE(client.unpack(pck).has_value());
+            CheckScene(client);
+        }
+        REQUIRE(Crate::gUnpackThreads > 0);
+
+        //A serial Scene still unpack the sizes
+        fge::net::Packet pck;
+        server.pack(pck, {});
+        fge::Scene serialClient;
+        REQUIRE_FALSE(serialClient.unpack(pck).has_value());
+        CheckScene(serialClient);
+    }
+
+    SUBCASE("a truncated packet is refused")
+    {
+        server.setPackObjectSizes(true);
+        fge::net::Packet pck;
+        server.pack(pck, {});
+        pck.shrink(sizeof(int));
+        REQUIRE(client.unpack(pck).has_value());
+    }
+}
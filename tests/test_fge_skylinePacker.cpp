@@ -0,0 +1,185 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/graphic/C_skylinePacker.hpp"
+#include <vector>
+
+namespace
+{
+
+bool Overlap(fge::RectInt const& a, fge::RectInt const& b)
+{
+    return a._x < b._x + b._width && b._x < a._x + a._width && a._y < b._y + b._height && b._y < a._y + a._height;
+}
+
+bool IsInside(fge::RectInt const& rect, fge::Vector2i const& size)
+{
+    return rect._x >= 0 && rect._y >= 0 && rect._x + rect._width <= size.x && rect._y + rect._height <= size.y;
+}
+
+bool IsSkylineValid(fge::SkylinePacker const& packer)
+{
+    int x = 0;
+    for (auto const& node: packer.getNodes())
+    {
+        if (node._x != x || node._width <= 0 || node._y > packer.getSize().y)
+        {
+            return false;
+        }
+        x += node._width;
+    }
+    return x == packer.getSize().x;
+}
+
+} // namespace
+
+TEST_CASE("testing SkylinePacker placement")
+{
+    SUBCASE("bottom-left placement")
+    {
+        fge::SkylinePacker packer({64, 64});
+
+        auto const a = packer.insert(32, 16);
+        REQUIRE(a.has_value());
+        CHECK(a->_x == 0);
+        CHECK(a->_y == 0);
+
+        auto const b = packer.insert(16, 8);
+        REQUIRE(b.has_value());
+        CHECK(b->_x == 32);
+        CHECK(b->_y == 0);
+
+        //The lowest place is now at x=48
+        auto const c = packer.insert(16, 16);
+        REQUIRE(c.has_value());
+        CHECK(c->_x == 48);
+        CHECK(c->_y == 0);
+
+        //Filling the hole between the taller segments
+        auto const d = packer.insert(16, 4);
+        REQUIRE(d.has_value());
+        CHECK(d->_x == 32);
+        CHECK(d->_y == 8);
+
+        //Resting on the highest segment under it
+        auto const e = packer.insert(40, 2);
+        REQUIRE(e.has_value());
+        CHECK(e->_x == 0);
+        CHECK(e->_y == 16);
+
+        CHECK(packer.getUsedArea() == 32 * 16 + 16 * 8 + 16 * 16 + 16 * 4 + 40 * 2);
+        CHECK(IsSkylineValid(packer));
+    }
+
+    SUBCASE("invalid and too large rectangles")
+    {
+        fge::SkylinePacker packer({16, 16});
+        CHECK_FALSE(packer.insert(0, 4).has_value());
+        CHECK_FALSE(packer.insert(4, -1).has_value());
+        CHECK_FALSE(packer.insert(17, 4).has_value());
+        CHECK_FALSE(packer.insert(4, 17).has_value());
+        CHECK(packer.insert(16, 16).has_value());
+        CHECK_FALSE(packer.insert(1, 1).has_value());
+        CHECK(packer.getOccupancy() == doctest::Approx(1.0f));
+    }
+
+    SUBCASE("no overlap with many rectangles")
+    {
+        fge::SkylinePacker packer({256, 256});
+        std::vector<fge::RectInt> rects;
+
+        uint32_t state = 12345;
+        for (int i = 0; i < 400; ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+            auto const width = static_cast<int>(4 + (state >> 8) % 20);
+            auto const height = static_cast<int>(4 + (state >> 16) % 20);
+            if (auto rect = packer.insert(width, height))
+            {
+                rects.push_back(*rect);
+            }
+        }
+
+        REQUIRE(rects.size() > 100);
+        bool valid = IsSkylineValid(packer);
+        for (std::size_t i = 0; i < rects.size() && valid; ++i)
+        {
+            valid = IsInside(rects[i], packer.getSize());
+            for (std::size_t j = i + 1; j < rects.size() && valid; ++j)
+            {
+                valid = !Overlap(rects[i], rects[j]);
+            }
+        }
+        CHECK(valid);
+        CHECK(packer.getOccupancy() > 0.7f);
+    }
+}
+
+TEST_CASE("testing SkylinePacker growth and restore")
+{
+    SUBCASE("growth keeps the placed rectangles")
+    {
+        fge::SkylinePacker packer({16, 16});
+        auto const a = packer.insert(16, 12);
+        REQUIRE(a.has_value());
+        CHECK_FALSE(packer.insert(8, 8).has_value());
+
+        packer.grow({32, 32});
+        CHECK(packer.getSize() == fge::Vector2i{32, 32});
+        CHECK(IsSkylineValid(packer));
+
+        auto const b = packer.insert(8, 8);
+        REQUIRE(b.has_value());
+        CHECK(b->_x == 16);
+        CHECK(b->_y == 0);
+        CHECK_FALSE(Overlap(*a, *b));
+
+        //A smaller size is ignored
+        packer.grow({8, 8});
+        CHECK(packer.getSize() == fge::Vector2i{32, 32});
+    }
+
+    SUBCASE("restore a saved skyline")
+    {
+        fge::SkylinePacker packer({32, 32});
+        REQUIRE(packer.insert(10, 5).has_value());
+        REQUIRE(packer.insert(7, 9).has_value());
+
+        fge::SkylinePacker restored;
+        REQUIRE(restored.restore(packer.getSize(), packer.getNodes(), packer.getUsedArea()));
+        CHECK(restored.getUsedArea() == packer.getUsedArea());
+
+        auto const a = packer.insert(5, 5);
+        auto const b = restored.insert(5, 5);
+        REQUIRE(a.has_value());
+        REQUIRE(b.has_value());
+        CHECK(*a == *b);
+    }
+
+    SUBCASE("invalid skylines are refused")
+    {
+        fge::SkylinePacker packer({16, 16});
+        CHECK_FALSE(packer.restore({16, 16}, {{0, 0, 8}}, 0));
+        CHECK_FALSE(packer.restore({16, 16}, {{0, 0, 8}, {4, 0, 8}}, 0));
+        CHECK_FALSE(packer.restore({16, 16}, {{0, 17, 16}}, 0));
+        CHECK_FALSE(packer.restore({16, 16}, {{0, 0, 16}}, 16 * 16 + 1));
+        CHECK(packer.getSize() == fge::Vector2i{16, 16});
+        CHECK(packer.getNodes().size() == 1);
+    }
+}
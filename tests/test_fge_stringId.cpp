@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_propertyList.hpp"
+#include "FastEngine/C_stringId.hpp"
+#include "FastEngine/C_tagList.hpp"
+
+using namespace fge::literals;
+
+namespace
+{
+
+//Evaluated during the static initialization of this translation unit
+std::string_view const gStaticInitString = ("static init literal"_strid).getString();
+
+} // namespace
+
+TEST_CASE("testing StringId")
+{
+    SUBCASE("hashing")
+    {
+        constexpr auto id = "player"_strid;
+        static_assert(id == fge::StringId{"player"});
+        static_assert(id != fge::StringId{"enemy"});
+        static_assert(id.isValid());
+        static_assert(!fge::StringId{}.isValid());
+
+        REQUIRE(fge::StringId{""}.getValue() == fge::HashFnv1a(""));
+        REQUIRE(fge::StringId::FromValue(id.getValue()) == id);
+    }
+
+    SUBCASE("interning")
+    {
+        REQUIRE(fge::StringId{"never interned string"}.getString().empty());
+
+        auto const id = fge::InternString("interned string");
+        REQUIRE(id == fge::StringId{"interned string"});
+        REQUIRE(id.getString() == "interned string");
+
+        auto const count = fge::GetInternedStringCount();
+        REQUIRE(fge::InternString("interned string") == id);
+        REQUIRE(fge::GetInternedStringCount() == count);
+
+        auto const literal = "interned literal"_strid;
+        REQUIRE(literal.getString() == "interned literal");
+
+        REQUIRE(gStaticInitString == "static init literal");
+    }
+}
+
+TEST_CASE("testing TagList")
+{
+    fge::TagList tags;
+
+    tags.add("red");
+    tags.add("red"_strid);
+    tags.add("blue");
+    REQUIRE(tags.getSize() == 2);
+
+    REQUIRE(tags.check("red"));
+    REQUIRE(tags.check("blue"_strid));
+    REQUIRE_FALSE(tags.check("green"));
+
+    for (auto const& tag: tags)
+    {
+        REQUIRE_FALSE(tag.getString().empty());
+    }
+
+    tags.del("red"_strid);
+    REQUIRE_FALSE(tags.check("red"));
+    tags.del("blue");
+    REQUIRE(tags.getSize() == 0);
+}
+
+TEST_CASE("testing PropertyList")
+{
+    fge::PropertyList properties;
+
+    properties.setProperty("health", 10);
+    REQUIRE(properties.count() == 1);
+    REQUIRE(properties.findProperty<fge::PintType>("health"));
+    REQUIRE(properties.findProperty("health"_strid));
+
+    REQUIRE(properties.getProperty("health"_strid).get<fge::PintType>().value() == 10);
+    properties["health"_strid] = 20;
+    REQUIRE(properties.getProperty("health").get<fge::PintType>().value() == 20);
+
+    auto const& constProperties = properties;
+    REQUIRE(constProperties["health"] != nullptr);
+    REQUIRE(constProperties["mana"] == nullptr);
+    REQUIRE(properties.count() == 1);
+
+    for (auto const& property: properties)
+    {
+        REQUIRE(property.first.getString() == "health");
+    }
+
+    properties.delProperty("health");
+    REQUIRE(properties.count() == 0);
+}
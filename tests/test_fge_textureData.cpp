@@ -0,0 +1,250 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/graphic/C_surface.hpp"
+#include "FastEngine/vulkan/C_textureData.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+void WriteLE(std::vector<uint8_t>& buffer, std::size_t offset, uint64_t value, std::size_t size)
+{
+    if (buffer.size() < offset + size)
+    {
+        buffer.resize(offset + size, 0);
+    }
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        buffer[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+std::vector<uint8_t> MakeKTX2(VkFormat format, uint32_t width, uint32_t height, uint32_t levelCount)
+{
+    uint8_t const identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+    std::vector<uint8_t> file(identifier, identifier + 12);
+    WriteLE(file, 12, static_cast<uint32_t>(format), 4);
+    WriteLE(file, 16, 1, 4);
+    WriteLE(file, 20, width, 4);
+    WriteLE(file, 24, height, 4);
+    WriteLE(file, 36, 1, 4);
+    WriteLE(file, 40, levelCount, 4);
+    //A level count of 0 still have one level
+    auto const storedLevelCount = std::max(levelCount, 1u);
+    WriteLE(file, 80 + storedLevelCount * 24, 0, 0);
+
+    //Levels are stored from the smallest to the largest like most KTX2 writers do
+    for (uint32_t i = storedLevelCount; i-- > 0;)
+    {
+        fge::Vector2i const size{std::max<int>(static_cast<int>(width >> i), 1),
+                                 std::max<int>(static_cast<int>(height >> i), 1)};
+        auto const byteSize = fge::vulkan::TextureData::ComputeLevelByteSize(format, size);
+        auto const offset = file.size();
+        WriteLE(file, 80 + i * 24, offset, 8);
+        WriteLE(file, 80 + i * 24 + 8, byteSize, 8);
+        WriteLE(file, 80 + i * 24 + 16, byteSize, 8);
+        file.resize(offset + byteSize, static_cast<uint8_t>(i + 1));
+    }
+    return file;
+}
+
+std::vector<uint8_t> MakeDDS(uint32_t fourCC, uint32_t width, uint32_t height, uint32_t levelCount, std::size_t dataSize)
+{
+    std::vector<uint8_t> file;
+    WriteLE(file, 0, 0x20534444, 4);
+    WriteLE(file, 4, 124, 4);
+    WriteLE(file, 12, height, 4);
+    WriteLE(file, 16, width, 4);
+    WriteLE(file, 28, levelCount, 4);
+    WriteLE(file, 76, 32, 4);
+    WriteLE(file, 80, 0x4, 4);
+    WriteLE(file, 84, fourCC, 4);
+    file.resize(128, 0);
+    file.resize(128 + dataSize, 0x5A);
+    return file;
+}
+
+constexpr uint32_t FourCC(char const (&code)[5])
+{
+    return static_cast<uint32_t>(code[0]) | (static_cast<uint32_t>(code[1]) << 8) |
+           (static_cast<uint32_t>(code[2]) << 16) | (static_cast<uint32_t>(code[3]) << 24);
+}
+
+} // namespace
+
+TEST_CASE("testing TextureData level sizes")
+{
+    using fge::vulkan::TextureData;
+
+    CHECK(TextureData::ComputeMipLevels({1, 1}) == 1);
+    CHECK(TextureData::ComputeMipLevels({256, 16}) == 9);
+    CHECK(TextureData::ComputeMipLevels({5, 3}) == 3);
+
+    CHECK(TextureData::ComputeLevelByteSize(VK_FORMAT_R8G8B8A8_UNORM, {5, 3}) == 60);
+    CHECK(TextureData::ComputeLevelByteSize(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, {5, 3}) == 16);
+    CHECK(TextureData::ComputeLevelByteSize(VK_FORMAT_BC3_UNORM_BLOCK, {1, 1}) == 16);
+    CHECK(TextureData::ComputeLevelByteSize(VK_FORMAT_BC7_UNORM_BLOCK, {8, 8}) == 64);
+
+    CHECK(TextureData::IsCompressedFormat(VK_FORMAT_BC7_SRGB_BLOCK));
+    CHECK_FALSE(TextureData::IsCompressedFormat(VK_FORMAT_R8G8B8A8_UNORM));
+    CHECK_FALSE(TextureData::IsSupportedFormat(VK_FORMAT_BC7_SRGB_BLOCK));
+}
+
+TEST_CASE("testing TextureData mip chain generation")
+{
+    fge::Surface surface(5, 3, fge::Color{0, 0, 0, 0});
+    for (int y = 0; y < 3; ++y)
+    {
+        for (int x = 0; x < 5; ++x)
+        {
+            surface.setPixel(x, y, fge::Color{static_cast<uint8_t>(x * 40), static_cast<uint8_t>(y * 100), 7, 255});
+        }
+    }
+
+    fge::vulkan::TextureData data;
+    REQUIRE(data.create(surface.get()));
+    REQUIRE(data.getLevelCount() == 3);
+    CHECK(data.getFormat() == VK_FORMAT_R8G8B8A8_UNORM);
+    CHECK_FALSE(data.isCompressed());
+    CHECK(data.getLevel(1)._size == fge::Vector2i{2, 1});
+    CHECK(data.getLevel(2)._size == fge::Vector2i{1, 1});
+    CHECK(data.getData().size() == (15 + 2 + 1) * 4);
+
+    //Level 0 is the surface
+    auto const* level0 = data.getLevelData(0);
+    CHECK(level0[(2 * 5 + 3) * 4] == 120);
+    CHECK(level0[(2 * 5 + 3) * 4 + 1] == 200);
+
+    //Level 1 pixels are the average of 2x2 pixels
+    auto const* level1 = data.getLevelData(1);
+    CHECK(level1[0] == 20);
+    CHECK(level1[1] == 50);
+    CHECK(level1[2] == 7);
+    CHECK(level1[3] == 255);
+    CHECK(level1[4] == 100);
+
+    auto const* level2 = data.getLevelData(2);
+    CHECK(level2[0] == 60);
+    CHECK(level2[1] == 50);
+
+    REQUIRE(data.create(surface.get(), 2));
+    CHECK(data.getLevelCount() == 2);
+    REQUIRE(data.create(surface.get(), 20));
+    CHECK(data.getLevelCount() == 3);
+}
+
+TEST_CASE("testing TextureData KTX2 loading")
+{
+    fge::vulkan::TextureData data;
+
+    SUBCASE("BC7 with a full mip chain")
+    {
+        auto const file = MakeKTX2(VK_FORMAT_BC7_SRGB_BLOCK, 8, 8, 4);
+        REQUIRE(data.loadFromMemory(file.data(), file.size()));
+        CHECK(data.getFormat() == VK_FORMAT_BC7_UNORM_BLOCK);
+        CHECK(data.isCompressed());
+        CHECK(data.getSize() == fge::Vector2i{8, 8});
+        REQUIRE(data.getLevelCount() == 4);
+        CHECK(data.getLevel(0)._byteSize == 64);
+        CHECK(data.getLevel(3)._byteSize == 16);
+        CHECK(data.getLevel(3)._offset == 64 + 16 + 16);
+        CHECK(data.getData().size() == 64 + 16 + 16 + 16);
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            CHECK(data.getLevelData(i)[0] == i + 1);
+        }
+    }
+    SUBCASE("BC1 without mip levels")
+    {
+        auto const file = MakeKTX2(VK_FORMAT_BC1_RGB_UNORM_BLOCK, 10, 6, 0);
+        REQUIRE(data.loadFromMemory(file.data(), file.size()));
+        CHECK(data.getFormat() == VK_FORMAT_BC1_RGB_UNORM_BLOCK);
+        REQUIRE(data.getLevelCount() == 1);
+        CHECK(data.getLevel(0)._byteSize == 3 * 2 * 8);
+    }
+    SUBCASE("invalid files")
+    {
+        auto file = MakeKTX2(VK_FORMAT_BC3_UNORM_BLOCK, 16, 16, 5);
+        CHECK_FALSE(data.loadFromMemory(file.data(), file.size() - 1));
+        CHECK_FALSE(data.isValid());
+
+        auto supercompressed = file;
+        WriteLE(supercompressed, 44, 2, 4);
+        CHECK_FALSE(data.loadFromMemory(supercompressed.data(), supercompressed.size()));
+
+        auto cubeMap = file;
+        WriteLE(cubeMap, 36, 6, 4);
+        CHECK_FALSE(data.loadFromMemory(cubeMap.data(), cubeMap.size()));
+
+        auto tooManyLevels = MakeKTX2(VK_FORMAT_BC3_UNORM_BLOCK, 4, 4, 4);
+        CHECK_FALSE(data.loadFromMemory(tooManyLevels.data(), tooManyLevels.size()));
+
+        CHECK(data.loadFromMemory(file.data(), file.size()));
+    }
+}
+
+TEST_CASE("testing TextureData DDS loading")
+{
+    fge::vulkan::TextureData data;
+
+    SUBCASE("DXT1")
+    {
+        auto const file = MakeDDS(FourCC("DXT1"), 16, 8, 5, 64 + 16 + 8 + 8 + 8);
+        REQUIRE(data.loadFromMemory(file.data(), file.size()));
+        CHECK(data.getFormat() == VK_FORMAT_BC1_RGBA_UNORM_BLOCK);
+        REQUIRE(data.getLevelCount() == 5);
+        CHECK(data.getLevel(4)._size == fge::Vector2i{1, 1});
+        CHECK(data.getLevel(4)._offset == 64 + 16 + 8 + 8);
+
+        CHECK_FALSE(data.loadFromMemory(file.data(), file.size() - 1));
+    }
+    SUBCASE("DX10 BC7")
+    {
+        auto file = MakeDDS(FourCC("DX10"), 4, 4, 1, 20 + 16);
+        WriteLE(file, 128, 99, 4);
+        WriteLE(file, 132, 3, 4);
+        WriteLE(file, 140, 1, 4);
+        REQUIRE(data.loadFromMemory(file.data(), file.size()));
+        CHECK(data.getFormat() == VK_FORMAT_BC7_UNORM_BLOCK);
+        CHECK(data.getLevel(0)._byteSize == 16);
+
+        WriteLE(file, 128, 2, 4); //DXGI_FORMAT_R32G32B32A32_FLOAT
+        CHECK_FALSE(data.loadFromMemory(file.data(), file.size()));
+    }
+    SUBCASE("uncompressed RGBA")
+    {
+        auto file = MakeDDS(0, 2, 2, 0, 16);
+        WriteLE(file, 80, 0x40 | 0x1, 4);
+        WriteLE(file, 88, 32, 4);
+        WriteLE(file, 92, 0x000000FF, 4);
+        WriteLE(file, 96, 0x0000FF00, 4);
+        WriteLE(file, 100, 0x00FF0000, 4);
+        WriteLE(file, 104, 0xFF000000, 4);
+        REQUIRE(data.loadFromMemory(file.data(), file.size()));
+        CHECK(data.getFormat() == VK_FORMAT_R8G8B8A8_UNORM);
+        CHECK(data.getLevelCount() == 1);
+    }
+    SUBCASE("not a texture file")
+    {
+        std::vector<uint8_t> const file(256, 0);
+        CHECK_FALSE(data.loadFromMemory(file.data(), file.size()));
+    }
+}
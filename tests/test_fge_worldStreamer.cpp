@@ -0,0 +1,156 @@
+/*
+ * Copyright 2026 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "FastEngine/C_worldStreamer.hpp"
+#include "FastEngine/manager/reg_manager.hpp"
+#include <chrono>
+#include <thread>
+
+namespace
+{
+
+class Crate : public fge::Object
+{
+public:
+    FGE_OBJ_DEFAULT_COPYMETHOD(Crate)
+
+    char const* getClassName() const override { return "TEST_CRATE"; }
+    char const* getReadableClassName() const override { return "crate"; }
+};
+
+std::size_t SaveCell(fge::WorldStreamer const& streamer, fge::Vector2i const& cell, std::size_t crateCount)
+{
+    fge::Scene scene;
+    auto const bounds = streamer.getCellBounds(cell);
+    for (std::size_t i = 0; i < crateCount; ++i)
+    {
+        scene.newObject<Crate>()->setPosition(bounds.getPosition() + fge::Vector2f{static_cast<float>(i), 0.0f});
+    }
+
+    auto const path = streamer.getCellObjectsPath(cell);
+    REQUIRE(fge::SaveSceneSnapshot(scene, path));
+    return static_cast<std::size_t>(std::filesystem::file_size(path));
+}
+
+void Stream(fge::WorldStreamer& streamer, fge::Vector2f const& point)
+{
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        streamer.update(point);
+        if (streamer.getLoadingCellCount() == 0)
+        {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    FAIL("the cells are never loaded");
+}
+
+} // namespace
+
+TEST_CASE("testing WorldStreamer")
+{
+    fge::reg::RegisterNewClass<Crate>();
+
+    auto const directory = std::filesystem::temp_directory_path() / "fge_test_worldStreamer";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    fge::WorldStreamerConfig config;
+    config._cellSize = {100.0f, 100.0f};
+    config._loadDistance = 50.0f;
+    config._unloadDistance = 150.0f;
+
+    {
+        fge::Scene scene;
+        fge::WorldStreamer streamer(scene, directory, config);
+
+        //The saved SID of both cells are the same
+        auto const cellSizeA = SaveCell(streamer, {0, 0}, 2);
+        auto const cellSizeB = SaveCell(streamer, {1, 0}, 3);
+
+        SUBCASE("cell coordinates")
+        {
+            REQUIRE(streamer.getCellCoord({0.0f, 0.0f}) == fge::Vector2i{0, 0});
+            REQUIRE(streamer.getCellCoord({99.9f, 100.0f}) == fge::Vector2i{0, 1});
+            REQUIRE(streamer.getCellCoord({-0.1f, 250.0f}) == fge::Vector2i{-1, 2});
+            REQUIRE(streamer.getCellBounds({-1, 2}) == fge::RectFloat{{-100.0f, 200.0f}, {100.0f, 100.0f}});
+            REQUIRE(streamer.getCellObjectsPath({-1, 2}).filename() == "cell_-1_2.fges");
+            REQUIRE(streamer.getCellTilesPath({-1, 2}).filename() == "cell_-1_2.json");
+        }
+
+        SUBCASE("load and unload with hysteresis")
+        {
+            std::vector<fge::Vector2i> unloadedCells;
+            streamer._onCellUnloaded.addLambda([&](fge::WorldStreamer&, fge::Vector2i const& cell) {
+                unloadedCells.push_back(cell);
+            });
+
+            //The cell of the point and the 2 nearest neighbour cells are in the load distance
+            Stream(streamer, {60.0f, 55.0f});
+            REQUIRE(streamer.getLoadedCellCount() == 3);
+            REQUIRE(streamer.getCellState({0, 0}) == fge::WorldStreamer::CellStates::LOADED);
+            REQUIRE(streamer.getCellState({1, 0}) == fge::WorldStreamer::CellStates::LOADED);
+            REQUIRE(streamer.getCellState({1, 1}) == fge::WorldStreamer::CellStates::UNLOADED);
+            REQUIRE(scene.getObjectSize() == 5);
+            REQUIRE(streamer.getMemoryUsage() == cellSizeA + cellSizeB);
+
+            //Between the load and the unload distance, the cell stay loaded
+            Stream(streamer, {220.0f, 55.0f});
+            REQUIRE(streamer.getCellState({0, 0}) == fge::WorldStreamer::CellStates::LOADED);
+            REQUIRE(scene.getObjectSize() == 5);
+            REQUIRE(unloadedCells.empty());
+
+            Stream(streamer, {300.0f, 55.0f});
+            REQUIRE(streamer.getCellState({0, 0}) == fge::WorldStreamer::CellStates::UNLOADED);
+            REQUIRE(streamer.getCellState({1, 0}) == fge::WorldStreamer::CellStates::LOADED);
+            REQUIRE(std::find(unloadedCells.begin(), unloadedCells.end(), fge::Vector2i{0, 0}) !=
+                    unloadedCells.end());
+            REQUIRE(scene.getObjectSize() == 3);
+            REQUIRE(streamer.getMemoryUsage() == cellSizeB);
+
+            streamer.unloadAll();
+            REQUIRE(streamer.getLoadedCellCount() == 0);
+            REQUIRE(scene.getObjectSize() == 0);
+            REQUIRE(streamer.getMemoryUsage() == 0);
+        }
+
+        SUBCASE("memory budget")
+        {
+            config._memoryBudget = cellSizeA - 1;
+            config._maxConcurrentLoads = 1;
+            streamer.setConfig(config);
+
+            //The nearest cell exceed the budget, no other cell is loaded
+            Stream(streamer, {60.0f, 55.0f});
+            REQUIRE(streamer.getLoadedCellCount() == 1);
+            REQUIRE(streamer.getCellState({0, 0}) == fge::WorldStreamer::CellStates::LOADED);
+            REQUIRE(scene.getObjectSize() == 2);
+
+            //Cells outside the load distance are unloaded first to respect the budget
+            Stream(streamer, {180.0f, 55.0f});
+            REQUIRE(streamer.getCellState({0, 0}) == fge::WorldStreamer::CellStates::UNLOADED);
+            REQUIRE(streamer.getCellState({1, 0}) == fge::WorldStreamer::CellStates::LOADED);
+            REQUIRE(streamer.getLoadedCellCount() == 1);
+            REQUIRE(scene.getObjectSize() == 3);
+            REQUIRE(streamer.getMemoryUsage() == cellSizeB);
+        }
+    }
+
+    std::filesystem::remove_all(directory);
+}